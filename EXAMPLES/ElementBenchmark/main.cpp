@@ -0,0 +1,483 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// Purpose: this file contains a C++ main procedure to time the element
+// state determination of some of the more expensive elements. For each
+// element type a small model is built (a chain of force-based beams with
+// fiber sections, patches of bricks, MITC4 shells and quads with J2
+// plasticity), a displacement field is imposed on the nodes following a
+// cyclic history of growing amplitude, and update(), getTangentStiff()
+// and getResistingForce() are timed separately over a number of
+// iterations per step, as Newton's method would call them. 
+//
+//   elementBenchmark <-n size?> <-steps numSteps?> <-iters numIters?> 
+//                    <-element forceBeamColumn|brick|shell|quad>
+//
+// One line per element type is printed to stdout:
+//
+//   element numEle numEleIters updateNs tangentNs resistingNs totalNs cacheMisses
+//
+// with the times in ns per element per iteration. cacheMisses is the number
+// of hardware cache misses per element per iteration over the three calls,
+// available on linux when perf events are permitted, -1 otherwise.
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+
+#ifdef _WIN32
+#include <time.h>
+#else
+#include <sys/time.h>
+#endif
+
+#ifdef __linux__
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+
+#include <OPS_Globals.h>
+#include <StandardStream.h>
+
+#include <Vector.h>
+#include <Domain.h>
+#include <Node.h>
+#include <NodeIter.h>
+#include <Element.h>
+#include <ElementIter.h>
+
+#include <Steel02.h>
+#include <Concrete02.h>
+#include <UniaxialFiber2d.h>
+#include <FiberSection2d.h>
+#include <LobattoBeamIntegration.h>
+#include <LinearCrdTransf2d.h>
+#include <ForceBeamColumn2d.h>
+
+#include <J2Plasticity.h>
+#include <Brick.h>
+#include <FourNodeQuad.h>
+
+#include <ElasticMembranePlateSection.h>
+#include <ShellMITC4.h>
+
+// init the global variabled defined in OPS_Globals.h
+StandardStream sserr;
+OPS_Stream *opserrPtr = &sserr;
+
+double        ops_Dt = 0;
+Element      *ops_TheActiveElement = 0;
+bool          ops_InitialStateAnalysis = false;
+
+// use the accelerated local iterations in the force based elements
+static bool accelerateLocal = false;
+
+
+//
+// the models, n is the number of elements along each side
+//
+
+static Domain *
+buildForceBeamColumn(int n)
+{
+  Domain *theDomain = new Domain();
+
+  // 12x20 reinforced concrete section, 10 concrete and 2 steel layers
+  Concrete02 concrete(1, -4.0, -0.002, -0.8, -0.006, 0.1, 0.5, 200.0);
+  Steel02 steel(2, 60.0, 29000.0, 0.01, 18.0, 0.925, 0.15);
+
+  const int numFibers = 12;
+  Fiber *fibers[numFibers];
+  for (int i=0; i<10; i++)
+    fibers[i] = new UniaxialFiber2d(i, concrete, 24.0, -9.0 + 2.0*i);
+  fibers[10] = new UniaxialFiber2d(10, steel, 3.0, -8.0);
+  fibers[11] = new UniaxialFiber2d(11, steel, 3.0, 8.0);
+  FiberSection2d theSection(1, numFibers, fibers);
+  for (int i=0; i<numFibers; i++)
+    delete fibers[i];
+
+  const int numSections = 5;
+  SectionForceDeformation *sections[numSections];
+  for (int i=0; i<numSections; i++)
+    sections[i] = &theSection;
+
+  LobattoBeamIntegration theIntegration;
+  LinearCrdTransf2d theTransf(1);
+
+  for (int i=0; i<=n; i++)
+    theDomain->addNode(new Node(i+1, 3, 120.0*i, 0.0));
+
+  for (int i=0; i<n; i++)
+    theDomain->addElement(new ForceBeamColumn2d(i+1, i+1, i+2, numSections, sections,
+						 theIntegration, theTransf, 0.0, 10, 1.0e-12,
+						 accelerateLocal));
+  return theDomain;
+}
+
+static Domain *
+buildBrick(int n)
+{
+  Domain *theDomain = new Domain();
+  J2Plasticity theMaterial(1, 0, 166667.0, 76923.0, 250.0, 300.0, 10.0, 1000.0);
+
+  int tag = 1;
+  for (int k=0; k<=n; k++)
+    for (int j=0; j<=n; j++)
+      for (int i=0; i<=n; i++)
+	theDomain->addNode(new Node(tag++, 3, 1.0*i, 1.0*j, 1.0*k));
+
+  tag = 1;
+  int nn = n+1;
+  for (int k=0; k<n; k++)
+    for (int j=0; j<n; j++)
+      for (int i=0; i<n; i++) {
+	int n1 = k*nn*nn + j*nn + i + 1;
+	int n5 = n1 + nn*nn;
+	theDomain->addElement(new Brick(tag++, n1, n1+1, n1+nn+1, n1+nn,
+					n5, n5+1, n5+nn+1, n5+nn, theMaterial));
+      }
+  return theDomain;
+}
+
+static Domain *
+buildShell(int n)
+{
+  Domain *theDomain = new Domain();
+  ElasticMembranePlateSection theSection(1, 30000.0, 0.2, 0.1);
+
+  int tag = 1;
+  for (int j=0; j<=n; j++)
+    for (int i=0; i<=n; i++)
+      theDomain->addNode(new Node(tag++, 6, 1.0*i, 1.0*j, 0.0));
+
+  tag = 1;
+  int nn = n+1;
+  for (int j=0; j<n; j++)
+    for (int i=0; i<n; i++) {
+      int n1 = j*nn + i + 1;
+      theDomain->addElement(new ShellMITC4(tag++, n1, n1+1, n1+nn+1, n1+nn, theSection));
+    }
+  return theDomain;
+}
+
+static Domain *
+buildQuad(int n)
+{
+  Domain *theDomain = new Domain();
+  J2Plasticity theMaterial(1, 0, 166667.0, 76923.0, 250.0, 300.0, 10.0, 1000.0);
+
+  int tag = 1;
+  for (int j=0; j<=n; j++)
+    for (int i=0; i<=n; i++)
+      theDomain->addNode(new Node(tag++, 2, 1.0*i, 1.0*j));
+
+  tag = 1;
+  int nn = n+1;
+  for (int j=0; j<n; j++)
+    for (int i=0; i<n; i++) {
+      int n1 = j*nn + i + 1;
+      theDomain->addElement(new FourNodeQuad(tag++, n1, n1+1, n1+nn+1, n1+nn, 
+					     theMaterial, "PlaneStrain", 1.0));
+    }
+  return theDomain;
+}
+
+
+//
+// the imposed displacement fields, scaled by factor
+//
+
+static void
+getForceBeamColumnDisp(const Vector &crd, double length, double factor, Vector &disp)
+{
+  // lateral drift of 2% with a parabolic profile and a small axial shortening
+  double x = crd(0)/length;
+  disp(0) = -0.0005*factor*crd(0);
+  disp(1) = 0.02*factor*length*x*x;
+  disp(2) = 0.04*factor*x;
+}
+
+static void
+getBrickDisp(const Vector &crd, double length, double factor, Vector &disp)
+{
+  // simple shear with some compression
+  disp(0) = 0.01*factor*crd(2);
+  disp(1) = 0.0;
+  disp(2) = -0.001*factor*crd(2);
+}
+
+static void
+getShellDisp(const Vector &crd, double length, double factor, Vector &disp)
+{
+  // bending into a paraboloid with some membrane stretch
+  double x = crd(0);
+  double y = crd(1);
+  double a = 0.01*factor/length;
+  disp(0) = 0.001*factor*x;
+  disp(1) = 0.0;
+  disp(2) = 0.5*a*(x*x + y*y);
+  disp(3) = a*y;
+  disp(4) = -a*x;
+  disp(5) = 0.0;
+}
+
+static void
+getQuadDisp(const Vector &crd, double length, double factor, Vector &disp)
+{
+  // simple shear with some compression
+  disp(0) = 0.01*factor*crd(1);
+  disp(1) = -0.001*factor*crd(1);
+}
+
+
+//
+// timing
+//
+
+static double
+getTime(void)
+{
+#ifdef _WIN32
+  return (double)clock()/CLOCKS_PER_SEC;
+#else
+  struct timeval tp;
+  gettimeofday(&tp, 0);
+  return tp.tv_sec + 1.0e-6*tp.tv_usec;
+#endif
+}
+
+static int
+openCacheMissCounter(void)
+{
+#ifdef __linux__
+  struct perf_event_attr pe;
+  memset(&pe, 0, sizeof(pe));
+  pe.type = PERF_TYPE_HARDWARE;
+  pe.size = sizeof(pe);
+  pe.config = PERF_COUNT_HW_CACHE_MISSES;
+  pe.disabled = 1;
+  pe.exclude_kernel = 1;
+  pe.exclude_hv = 1;
+  return syscall(__NR_perf_event_open, &pe, 0, -1, -1, 0);
+#else
+  return -1;
+#endif
+}
+
+static void
+startCacheMissCounter(int fd)
+{
+#ifdef __linux__
+  if (fd >= 0)
+    ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+#endif
+}
+
+static void
+stopCacheMissCounter(int fd)
+{
+#ifdef __linux__
+  if (fd >= 0)
+    ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+#endif
+}
+
+static double
+readCacheMissCounter(int fd)
+{
+#ifdef __linux__
+  long long count;
+  if (fd >= 0 && read(fd, &count, sizeof(count)) == sizeof(count))
+    return (double)count;
+#endif
+  return -1.0;
+}
+
+typedef Domain *(*BuildFunction)(int n);
+typedef void (*DispFunction)(const Vector &crd, double length, double factor, Vector &disp);
+
+static int
+runBenchmark(const char *name, BuildFunction build, DispFunction getDisp, 
+	     int n, int numSteps, int numIters)
+{
+  Domain *theDomain = (*build)(n);
+
+  int numEle = theDomain->getNumElements();
+  int numNodes = theDomain->getNumNodes();
+  if (numEle == 0) {
+    opserr << "elementBenchmark - failed to build the " << name << " model\n";
+    delete theDomain;
+    return -1;
+  }
+
+  Element **theElements = new Element *[numEle];
+  Node **theNodes = new Node *[numNodes];
+  Element *theEle;
+  Node *theNode;
+  ElementIter &theEles = theDomain->getElements();
+  int numE = 0;
+  while ((theEle = theEles()) != 0)
+    theElements[numE++] = theEle;
+  NodeIter &theNods = theDomain->getNodes();
+  int numN = 0;
+  while ((theNode = theNods()) != 0)
+    theNodes[numN++] = theNode;
+
+  double length = 0.0;
+  for (int i=0; i<numNodes; i++) {
+    double x = theNodes[i]->getCrds()(0);
+    if (x > length) length = x;
+  }
+
+  int fd = openCacheMissCounter();
+#ifdef __linux__
+  if (fd >= 0)
+    ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+#endif
+
+  double timeUpdate = 0.0;
+  double timeTangent = 0.0;
+  double timeResisting = 0.0;
+  double checksum = 0.0;
+  double lastFactor = 0.0;
+  const double pi = 3.14159265358979323846;
+
+  for (int step=0; step<numSteps; step++) {
+
+    // three cycles of growing amplitude over the steps
+    double s = (step+1.0)/numSteps;
+    double factor = s*sin(6.0*pi*s);
+
+    for (int iter=0; iter<numIters; iter++) {
+      double iterFactor = lastFactor + (factor-lastFactor)*(iter+1.0)/numIters;
+      for (int i=0; i<numNodes; i++) {
+	Vector disp(theNodes[i]->getNumberDOF());
+	(*getDisp)(theNodes[i]->getCrds(), length, iterFactor, disp);
+	theNodes[i]->setTrialDisp(disp);
+      }
+
+      startCacheMissCounter(fd);
+
+      double t0 = getTime();
+      for (int i=0; i<numEle; i++)
+	theElements[i]->update();
+
+      double t1 = getTime();
+      for (int i=0; i<numEle; i++)
+	checksum += theElements[i]->getTangentStiff()(0,0);
+
+      double t2 = getTime();
+      for (int i=0; i<numEle; i++)
+	checksum += theElements[i]->getResistingForce()(0);
+
+      double t3 = getTime();
+      stopCacheMissCounter(fd);
+
+      timeUpdate += t1-t0;
+      timeTangent += t2-t1;
+      timeResisting += t3-t2;
+    }
+
+    theDomain->commit();
+    lastFactor = factor;
+  }
+
+  double numEleIters = (double)numEle*numSteps*numIters;
+  double cacheMisses = readCacheMissCounter(fd);
+  if (cacheMisses >= 0.0)
+    cacheMisses /= numEleIters;
+#ifdef __linux__
+  if (fd >= 0)
+    close(fd);
+#endif
+
+  fprintf(stdout, "%s %d %.0f %.1f %.1f %.1f %.1f %.2f\n", name, numEle, numEleIters,
+	  timeUpdate*1.0e9/numEleIters, timeTangent*1.0e9/numEleIters, 
+	  timeResisting*1.0e9/numEleIters,
+	  (timeUpdate+timeTangent+timeResisting)*1.0e9/numEleIters, cacheMisses);
+  fflush(stdout);
+
+  // so the work is not optimised away
+  if (checksum != checksum)
+    opserr << "elementBenchmark - " << name << " response is NaN\n";
+
+  delete [] theElements;
+  delete [] theNodes;
+  delete theDomain;
+
+  return 0;
+}
+
+
+// main routine
+int main(int argc, char **argv)
+{
+  int n = 0;
+  int numSteps = 100;
+  int numIters = 3;
+  const char *only = 0;
+
+  for (int i=1; i<argc; i++) {
+    if (strcmp(argv[i],"-n") == 0 && i+1 < argc)
+      n = atoi(argv[++i]);
+    else if (strcmp(argv[i],"-steps") == 0 && i+1 < argc)
+      numSteps = atoi(argv[++i]);
+    else if (strcmp(argv[i],"-iters") == 0 && i+1 < argc)
+      numIters = atoi(argv[++i]);
+    else if (strcmp(argv[i],"-element") == 0 && i+1 < argc)
+      only = argv[++i];
+    else if (strcmp(argv[i],"-accelerate") == 0)
+      accelerateLocal = true;
+    else {
+      opserr << "usage: elementBenchmark <-n size?> <-steps numSteps?> <-iters numIters?>";
+      opserr << " <-element forceBeamColumn|brick|shell|quad> <-accelerate>\n";
+      exit(-1);
+    }
+  }
+
+  if (numSteps < 1 || numIters < 1 || n < 0) {
+    opserr << "elementBenchmark - invalid arguments\n";
+    exit(-1);
+  }
+
+  // a unit pseudo time step, the rate dependent materials divide by it
+  ops_Dt = 1.0;
+
+  fprintf(stdout, "# element numEle numEleIters updateNs tangentNs resistingNs totalNs cacheMisses\n");
+
+  // the default sizes give a few hundred elements, enough to leave the caches
+  if (only == 0 || strcmp(only,"forceBeamColumn") == 0)
+    runBenchmark("forceBeamColumn", buildForceBeamColumn, getForceBeamColumnDisp,
+		 (n > 0) ? n : 100, numSteps, numIters);
+  if (only == 0 || strcmp(only,"brick") == 0)
+    runBenchmark("brick", buildBrick, getBrickDisp,
+		 (n > 0) ? n : 8, numSteps, numIters);
+  if (only == 0 || strcmp(only,"shell") == 0)
+    runBenchmark("shell", buildShell, getShellDisp,
+		 (n > 0) ? n : 20, numSteps, numIters);
+  if (only == 0 || strcmp(only,"quad") == 0)
+    runBenchmark("quad", buildQuad, getQuadDisp,
+		 (n > 0) ? n : 20, numSteps, numIters);
+
+  exit(0);
+}
@@ -0,0 +1,416 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// Purpose: this file contains a C++ main procedure to time the linear
+// solvers on a frame and on a solid model. The system is one of
+//
+//   SparseGeneral  SparseGenColLinSOE with SuperLU, when built with 
+//                  PROGRAMMING_MODE = THREADS with ThreadedSuperLU 
+//                  (SuperLU_MT); running the program from the two builds
+//                  compares the threaded and serial solvers
+//   SupernodalSPD  SupernodalSPDLinSOE with SupernodalSPDLinSolver
+//   SupernodalSPDMixed  the same with a single precision factor and
+//                  iterative refinement, the refinement of each solve
+//                  printed to stderr
+//   ProfileSPD     ProfileSPDLinSOE with ProfileSPDLinDirectSolver
+//   OutOfCoreProfileSPD  OutOfCoreProfileSPDLinSOE with
+//                  OutOfCoreProfileSPDLinSolver, at most -memory MB of
+//                  the profile mapped at any one time
+//   BandSPD        BandSPDLinSOE with BandSPDLinLapackSolver
+//   BlockSparse    BlockSparseGenLinSOE with BlockSparseGenLinSolver,
+//                  block ILU(0) preconditioned BiCGStab
+//
+//   solverBenchmark <-model frame|solid> <-system type?> <-n size?> 
+//                   <-steps numSteps?> <-threads numThreads?>
+//                   <-memory MB?> <-profile fileName?>
+//
+// The frame is an n x n bay, n story 3d frame of elastic beams, the solid
+// an n x n x n block of elastic bricks. The first analysis step, which 
+// numbers the dofs, orders the columns and does the first factorization,
+// is timed as setup. Then the tangent is formed and the system factored
+// and solved numSteps times, the symbolic work of the first step being 
+// reused. One line per model is printed to stdout:
+//
+//   model system numEqn threads setupSec formSec factorSec solveSec normX
+//
+// with formSec the mean time to assemble the tangent, factorSec and 
+// solveSec the mean time of a factorization (including its substitution)
+// and of a substitution alone, and normX the norm of the solution to check
+// that the systems agree. For BlockSparse the factorization is that of the
+// preconditioner followed by the iterations, the substitution the
+// iterations alone. With -profile the regions of the analysis timed by
+// the Profiler are written to fileName as JSON.
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+#ifdef _WIN32
+#include <time.h>
+#else
+#include <sys/time.h>
+#endif
+
+#include <OPS_Globals.h>
+#include <Profiler.h>
+#include <StandardStream.h>
+
+#include <Vector.h>
+#include <Domain.h>
+#include <Node.h>
+#include <SP_Constraint.h>
+#include <LoadPattern.h>
+#include <LinearSeries.h>
+#include <NodalLoad.h>
+
+#include <LinearCrdTransf3d.h>
+#include <ElasticBeam3d.h>
+#include <ElasticIsotropic3D.h>
+#include <Brick.h>
+
+#include <StaticAnalysis.h>
+#include <AnalysisModel.h>
+#include <Linear.h>
+#include <PlainHandler.h>
+#include <DOF_Numberer.h>
+#include <RCM.h>
+#include <LoadControl.h>
+#include <SparseGenColLinSOE.h>
+#ifdef _THREADS
+#include <ThreadedSuperLU.h>
+#else
+#include <SuperLU.h>
+#endif
+#include <SupernodalSPDLinSOE.h>
+#include <SupernodalSPDLinSolver.h>
+#include <ProfileSPDLinSOE.h>
+#include <ProfileSPDLinDirectSolver.h>
+#ifndef _WIN32
+#include <OutOfCoreProfileSPDLinSOE.h>
+#include <OutOfCoreProfileSPDLinSolver.h>
+#endif
+#include <BandSPDLinSOE.h>
+#include <BandSPDLinLapackSolver.h>
+#include <BlockSparseGenLinSOE.h>
+#include <BlockSparseGenLinSolver.h>
+
+// init the global variabled defined in OPS_Globals.h
+StandardStream sserr;
+OPS_Stream *opserrPtr = &sserr;
+
+double        ops_Dt = 0;
+Element      *ops_TheActiveElement = 0;
+bool          ops_InitialStateAnalysis = false;
+
+
+//
+// the models, n is the number of bays or elements along each side
+//
+
+static Domain *
+buildFrame(int n)
+{
+  Domain *theDomain = new Domain();
+
+  Vector xzColumn(3);
+  xzColumn(0) = 1.0;
+  Vector xzBeam(3);
+  xzBeam(2) = 1.0;
+  LinearCrdTransf3d theColumnTransf(1, xzColumn);
+  LinearCrdTransf3d theBeamTransf(2, xzBeam);
+
+  int nn = n+1;
+  int tag = 1;
+  for (int k=0; k<=n; k++)
+    for (int j=0; j<=n; j++)
+      for (int i=0; i<=n; i++)
+	theDomain->addNode(new Node(tag++, 6, 240.0*i, 240.0*j, 144.0*k));
+
+  // columns, and the beams of each floor in x and y
+  tag = 1;
+  for (int k=0; k<n; k++)
+    for (int j=0; j<=n; j++)
+      for (int i=0; i<=n; i++) {
+	int n1 = k*nn*nn + j*nn + i + 1;
+	int n2 = n1 + nn*nn;
+	theDomain->addElement(new ElasticBeam3d(tag++, 400.0, 29000.0, 11200.0, 5000.0,
+						 20000.0, 20000.0, n1, n2, theColumnTransf));
+	if (i < n)
+	  theDomain->addElement(new ElasticBeam3d(tag++, 200.0, 29000.0, 11200.0, 2000.0,
+						   10000.0, 5000.0, n2, n2+1, theBeamTransf));
+	if (j < n)
+	  theDomain->addElement(new ElasticBeam3d(tag++, 200.0, 29000.0, 11200.0, 2000.0,
+						   10000.0, 5000.0, n2, n2+nn, theBeamTransf));
+      }
+
+  return theDomain;
+}
+
+static Domain *
+buildSolid(int n)
+{
+  Domain *theDomain = new Domain();
+  ElasticIsotropic3D theMaterial(1, 30000.0, 0.2, 0.0);
+
+  int nn = n+1;
+  int tag = 1;
+  for (int k=0; k<=n; k++)
+    for (int j=0; j<=n; j++)
+      for (int i=0; i<=n; i++)
+	theDomain->addNode(new Node(tag++, 3, 1.0*i, 1.0*j, 1.0*k));
+
+  tag = 1;
+  for (int k=0; k<n; k++)
+    for (int j=0; j<n; j++)
+      for (int i=0; i<n; i++) {
+	int n1 = k*nn*nn + j*nn + i + 1;
+	int n5 = n1 + nn*nn;
+	theDomain->addElement(new Brick(tag++, n1, n1+1, n1+nn+1, n1+nn,
+					n5, n5+1, n5+nn+1, n5+nn, theMaterial));
+      }
+
+  return theDomain;
+}
+
+// fixes the nodes at z = 0 and loads the nodes at the top laterally
+static void
+addSupportsAndLoads(Domain *theDomain, int n, int ndf)
+{
+  int nn = n+1;
+  for (int node=1; node<=nn*nn; node++)
+    for (int dof=0; dof<ndf; dof++)
+      theDomain->addSP_Constraint(new SP_Constraint(node, dof, 0.0, true));
+
+  LoadPattern *theLoadPattern = new LoadPattern(1);
+  theLoadPattern->setTimeSeries(new LinearSeries());
+  theDomain->addLoadPattern(theLoadPattern);
+
+  Vector theLoad(ndf);
+  theLoad(0) = 1.0;
+  theLoad(1) = 0.5;
+  int firstTop = n*nn*nn + 1;
+  for (int node=firstTop; node<firstTop+nn*nn; node++)
+    theDomain->addNodalLoad(new NodalLoad(node, node, theLoad), 1);
+}
+
+
+static double
+getTime(void)
+{
+#ifdef _WIN32
+  return (double)clock()/CLOCKS_PER_SEC;
+#else
+  struct timeval tp;
+  gettimeofday(&tp, 0);
+  return tp.tv_sec + 1.0e-6*tp.tv_usec;
+#endif
+}
+
+
+// memory budget of OutOfCoreProfileSPD, in MB
+static double memoryMB = 64.0;
+
+static LinearSOE *
+createSOE(const char *system, int &numThreads)
+{
+  if (strcmp(system,"SparseGeneral") == 0) {
+#ifdef _THREADS
+    SparseGenColLinSolver *theSolver = new ThreadedSuperLU(numThreads);
+#else
+    SparseGenColLinSolver *theSolver = new SuperLU();
+    numThreads = 1;
+#endif
+    return new SparseGenColLinSOE(*theSolver);
+  }
+
+  if (strcmp(system,"SupernodalSPD") == 0) {
+    SupernodalSPDLinSolver *theSolver = new SupernodalSPDLinSolver(numThreads);
+    numThreads = theSolver->getNumThreads();
+    return new SupernodalSPDLinSOE(*theSolver);
+  }
+
+  if (strcmp(system,"SupernodalSPDMixed") == 0) {
+    SupernodalSPDLinSolver *theSolver = 
+      new SupernodalSPDLinSolver(numThreads, 10, 1.0e-12, true);
+    numThreads = theSolver->getNumThreads();
+    return new SupernodalSPDLinSOE(*theSolver, true);
+  }
+
+  numThreads = 1;
+
+  if (strcmp(system,"ProfileSPD") == 0) {
+    ProfileSPDLinSolver *theSolver = new ProfileSPDLinDirectSolver();
+    return new ProfileSPDLinSOE(*theSolver);
+  }
+
+#ifndef _WIN32
+  if (strcmp(system,"OutOfCoreProfileSPD") == 0) {
+    OutOfCoreProfileSPDLinSolver *theSolver = new OutOfCoreProfileSPDLinSolver();
+    return new OutOfCoreProfileSPDLinSOE(*theSolver, memoryMB*1.0e6);
+  }
+#endif
+
+  if (strcmp(system,"BandSPD") == 0) {
+    BandSPDLinSolver *theSolver = new BandSPDLinLapackSolver();
+    return new BandSPDLinSOE(*theSolver);
+  }
+
+  if (strcmp(system,"BlockSparse") == 0) {
+    BlockSparseGenLinSolver *theSolver = new BlockSparseGenLinSolver();
+    return new BlockSparseGenLinSOE(*theSolver);
+  }
+
+  return 0;
+}
+
+
+static int
+runBenchmark(const char *name, Domain *theDomain, const char *system,
+	     int numSteps, int numThreads)
+{
+  LinearSOE *theSOE = createSOE(system, numThreads);
+  if (theSOE == 0) {
+    opserr << "solverBenchmark - unknown system " << system << endln;
+    return -1;
+  }
+
+  AnalysisModel *theModel = new AnalysisModel();
+  EquiSolnAlgo *theSolnAlgo = new Linear();
+  StaticIntegrator *theIntegrator = new LoadControl(1.0, 1, 1.0, 1.0);
+  ConstraintHandler *theHandler = new PlainHandler();
+  RCM *theRCM = new RCM();
+  DOF_Numberer *theNumberer = new DOF_Numberer(*theRCM);
+
+  StaticAnalysis theAnalysis(*theDomain, *theHandler, *theNumberer, *theModel,
+			     *theSolnAlgo, *theSOE, *theIntegrator);
+
+  // first step: numbering, ordering and the first factorization
+  double t0 = getTime();
+  if (theAnalysis.analyze(1) < 0) {
+    opserr << "solverBenchmark - " << name << " first step failed\n";
+    return -1;
+  }
+  double setupTime = getTime() - t0;
+
+  double formTime = 0.0;
+  double factorTime = 0.0;
+  double solveTime = 0.0;
+  for (int step=0; step<numSteps; step++) {
+    // zeroes A so that the next solve factors it again
+    double t1 = getTime();
+    if (theIntegrator->formTangent() < 0) {
+      opserr << "solverBenchmark - " << name << " failed to form tangent\n";
+      return -1;
+    }
+    formTime += getTime() - t1;
+
+    t1 = getTime();
+    if (theSOE->solve() < 0) {
+      opserr << "solverBenchmark - " << name << " failed to factor\n";
+      return -1;
+    }
+    double t2 = getTime();
+    theSOE->solve();
+    double t3 = getTime();
+
+    factorTime += t2-t1;
+    solveTime += t3-t2;
+  }
+
+  fprintf(stdout, "%s %s %d %d %.4f %.4f %.4f %.5f %.10e\n", name, system, 
+	  theSOE->getNumEqn(), numThreads, setupTime, formTime/numSteps,
+	  factorTime/numSteps, solveTime/numSteps, theSOE->getX().Norm());
+  fflush(stdout);
+
+  theAnalysis.clearAll();
+
+  return 0;
+}
+
+
+// main routine
+int main(int argc, char **argv)
+{
+  int n = 0;
+  int numSteps = 10;
+  int numThreads = 1;
+  const char *only = 0;
+  const char *system = "SparseGeneral";
+  const char *profileFile = 0;
+
+  for (int i=1; i<argc; i++) {
+    if (strcmp(argv[i],"-n") == 0 && i+1 < argc)
+      n = atoi(argv[++i]);
+    else if (strcmp(argv[i],"-steps") == 0 && i+1 < argc)
+      numSteps = atoi(argv[++i]);
+    else if (strcmp(argv[i],"-threads") == 0 && i+1 < argc)
+      numThreads = atoi(argv[++i]);
+    else if (strcmp(argv[i],"-model") == 0 && i+1 < argc)
+      only = argv[++i];
+    else if (strcmp(argv[i],"-system") == 0 && i+1 < argc)
+      system = argv[++i];
+    else if (strcmp(argv[i],"-memory") == 0 && i+1 < argc)
+      memoryMB = atof(argv[++i]);
+    else if (strcmp(argv[i],"-profile") == 0 && i+1 < argc)
+      profileFile = argv[++i];
+    else {
+      opserr << "usage: solverBenchmark <-model frame|solid> <-system type?> <-n size?>";
+      opserr << " <-steps numSteps?> <-threads numThreads?> <-memory MB?>";
+      opserr << " <-profile fileName?>\n";
+      exit(-1);
+    }
+  }
+
+  if (numSteps < 1 || numThreads < 1 || n < 0 || memoryMB <= 0.0) {
+    opserr << "solverBenchmark - invalid arguments\n";
+    exit(-1);
+  }
+
+#ifndef _THREADS
+  if (numThreads > 1)
+    opserr << "solverBenchmark - not built with threads, using 1 thread\n";
+#endif
+
+  fprintf(stdout, "# model system numEqn threads setupSec formSec factorSec solveSec normX\n");
+
+  if (profileFile != 0)
+    Profiler::start();
+
+  if (only == 0 || strcmp(only,"frame") == 0) {
+    int size = (n > 0) ? n : 8;
+    Domain *theDomain = buildFrame(size);
+    addSupportsAndLoads(theDomain, size, 6);
+    runBenchmark("frame", theDomain, system, numSteps, numThreads);
+    delete theDomain;
+  }
+
+  if (only == 0 || strcmp(only,"solid") == 0) {
+    int size = (n > 0) ? n : 12;
+    Domain *theDomain = buildSolid(size);
+    addSupportsAndLoads(theDomain, size, 3);
+    runBenchmark("solid", theDomain, system, numSteps, numThreads);
+    delete theDomain;
+  }
+
+  if (profileFile != 0)
+    Profiler::writeJSON(profileFile);
+
+  exit(0);
+}
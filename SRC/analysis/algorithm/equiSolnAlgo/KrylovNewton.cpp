@@ -141,14 +141,13 @@ KrylovNewton::solveCurrentStep(void)
   if (work == 0)
     work = new double [lwork];
 
-  // Evaluate system residual R(y_0)
-  if (theIntegrator->formUnbalance() < 0) {
+  // Evaluate system residual R(y_0) and Jacobian J = R'(y)|y_0
+  if (theIntegrator->formTangentAndUnbalance(tangent) < 0) {
     opserr << "WARNING KrylovNewton::solveCurrentStep() -";
-    opserr << "the Integrator failed in formUnbalance()\n";	
+    opserr << "the Integrator failed in formTangentAndUnbalance()\n";	
     return -2;
   }
 
-
   // set itself as the ConvergenceTest objects EquiSolnAlgo
   theTest->setEquiSolnAlgo(*this);
   if (theTest->start() < 0) {
@@ -156,14 +155,6 @@ KrylovNewton::solveCurrentStep(void)
     opserr << "the ConvergenceTest object failed in start()\n";
     return -3;
   }
-  
-  
-  // Evaluate system Jacobian J = R'(y)|y_0
-  if (theIntegrator->formTangent(tangent) < 0){
-    opserr << "WARNING KrylovNewton::solveCurrentStep() -";
-    opserr << "the Integrator failed in formTangent()\n";
-    return -1;
-  }    
 
   // Loop counter
   int k = 1;
@@ -175,15 +166,10 @@ KrylovNewton::solveCurrentStep(void)
 
   do {
 
-    // Clear the subspace if its dimension has exceeded max
-    if (dim > maxDimension) {
+    // Clear the subspace if its dimension has exceeded max, the new
+    // tangent was formed with the last residual
+    if (dim > maxDimension)
       dim = 0;
-      if (theIntegrator->formTangent(tangent) < 0){
-	opserr << "WARNING KrylovNewton::solveCurrentStep() -";
-	opserr << "the Integrator failed to produce new formTangent()\n";
-	return -1;
-      }
-    }
 
     // Solve for residual f(y_k) = J^{-1} R(y_k)
     if (theSOE->solve() < 0) {
@@ -206,8 +192,15 @@ KrylovNewton::solveCurrentStep(void)
       return -4;
     }	
 
-    // Evaluate system residual R(y_k)
-    if (theIntegrator->formUnbalance() < 0) {
+    // Evaluate system residual R(y_k), and the Jacobian with it if the 
+    // subspace is to be cleared in the next iteration
+    if (dim+1 > maxDimension) {
+      if (theIntegrator->formTangentAndUnbalance(tangent) < 0) {
+	opserr << "WARNING KrylovNewton::solveCurrentStep() -";
+	opserr << "the Integrator failed to produce new formTangentAndUnbalance()\n";
+	return -1;
+      }
+    } else if (theIntegrator->formUnbalance() < 0) {
       opserr << "WARNING KrylovNewton::solveCurrentStep() -";
       opserr << "the Integrator failed in formUnbalance()\n";	
       return -2;
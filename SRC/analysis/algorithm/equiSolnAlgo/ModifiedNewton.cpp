@@ -91,18 +91,12 @@ ModifiedNewton::solveCurrentStep(void)
     //    Timer timer1;
     // timer1.start();
 
-    if (theIncIntegratorr->formUnbalance() < 0) {
+    if (theIncIntegratorr->formTangentAndUnbalance(tangent) < 0) {
 	opserr << "WARNING ModifiedNewton::solveCurrentStep() -";
-	opserr << "the Integrator failed in formUnbalance()\n";	
+	opserr << "the Integrator failed in formTangentAndUnbalance()\n";	
 	return -2;
     }	
 
-    if (theIncIntegratorr->formTangent(tangent) < 0){
-	opserr << "WARNING ModifiedNewton::solveCurrentStep() -";
-	opserr << "the Integrator failed in formTangent()\n";
-	return -1;
-    }		    
-
     // set itself as the ConvergenceTest objects EquiSolnAlgo
     theTest->setEquiSolnAlgo(*this);
     if (theTest->start() < 0) {
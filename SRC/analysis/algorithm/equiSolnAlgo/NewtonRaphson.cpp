@@ -88,9 +88,14 @@ NewtonRaphson::solveCurrentStep(void)
 	return -5;
     }	
 
-    if (theIntegrator->formUnbalance() < 0) {
+    // the unbalance and the first tangent are formed in one pass
+    int statusFlag = tangent;
+    if (tangent == INITIAL_THEN_CURRENT_TANGENT)
+      statusFlag = INITIAL_TANGENT;
+
+    if (theIntegrator->formTangentAndUnbalance(statusFlag) < 0) {
       opserr << "WARNING NewtonRaphson::solveCurrentStep() -";
-      opserr << "the Integrator failed in formUnbalance()\n";	
+      opserr << "the Integrator failed in formTangentAndUnbalance()\n";	
       return -2;
     }	    
 
@@ -102,31 +107,12 @@ NewtonRaphson::solveCurrentStep(void)
       return -3;
     }
 
+    if (tangent == INITIAL_THEN_CURRENT_TANGENT)
+      statusFlag = CURRENT_TANGENT;
+
     int result = -1;
     int count = 0;
     do {
-      if (tangent == INITIAL_THEN_CURRENT_TANGENT) {
-	if (count == 0) {
-	  if (theIntegrator->formTangent(INITIAL_TANGENT) < 0){
-	    opserr << "WARNING NewtonRaphson::solveCurrentStep() -";
-	    opserr << "the Integrator failed in formTangent()\n";
-	    return -1;
-	  } 
-	} else {
-	  if (theIntegrator->formTangent(CURRENT_TANGENT) < 0){
-	    opserr << "WARNING NewtonRaphson::solveCurrentStep() -";
-	    opserr << "the Integrator failed in formTangent()\n";
-	    return -1;
-	  } 
-	}	  
-      } else {
-	if (theIntegrator->formTangent(tangent) < 0){
-	    opserr << "WARNING NewtonRaphson::solveCurrentStep() -";
-	    opserr << "the Integrator failed in formTangent()\n";
-	    return -1;
-	}		    
-      }
-
       if (theSOE->solve() < 0) {
 	opserr << "WARNING NewtonRaphson::solveCurrentStep() -";
 	opserr << "the LinearSysOfEqn failed in solve()\n";	
@@ -139,9 +125,11 @@ NewtonRaphson::solveCurrentStep(void)
 	return -4;
       }	        
 
-      if (theIntegrator->formUnbalance() < 0) {
+      // the tangent for the next iteration is formed along with the
+      // unbalance, it goes unused only on the converged iteration
+      if (theIntegrator->formTangentAndUnbalance(statusFlag) < 0) {
 	opserr << "WARNING NewtonRaphson::solveCurrentStep() -";
-	opserr << "the Integrator failed in formUnbalance()\n";	
+	opserr << "the Integrator failed in formTangentAndUnbalance()\n";	
 	return -2;
       }	
 
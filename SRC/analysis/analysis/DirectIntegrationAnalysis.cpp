@@ -55,6 +55,7 @@
 #include <Matrix.h>
 #include <ID.h>
 #include <Graph.h>
+#include <Profiler.h>
 // AddingSensitivity:BEGIN //////////////////////////////////
 #ifdef _RELIABILITY
 #include <SensitivityAlgorithm.h>
@@ -88,6 +89,7 @@ DirectIntegrationAnalysis::DirectIntegrationAnalysis(Domain &the_Domain,
   theAnalysisModel->setLinks(the_Domain, theHandler);
   theConstraintHandler->setLinks(the_Domain, theModel, theTransientIntegrator);
   theDOF_Numberer->setLinks(theModel);
+  theLinSOE.setLinks(theModel);
   theIntegrator->setLinks(theModel, theLinSOE, theTest);
   theAlgorithm->setLinks(theModel, theTransientIntegrator, theLinSOE, theTest);
 
@@ -176,6 +178,7 @@ DirectIntegrationAnalysis::initialize(void)
 int 
 DirectIntegrationAnalysis::analyze(int numSteps, double dT)
 {
+  ProfileScope scope("DirectIntegrationAnalysis::analyze");
   int result = 0;
   Domain *the_Domain = this->getDomainPtr();
 
@@ -351,6 +354,7 @@ DirectIntegrationAnalysis::eigen(int numMode, bool generalized)
 int
 DirectIntegrationAnalysis::domainChanged(void)
 {
+    ProfileScope scope("DirectIntegrationAnalysis::domainChanged");
     Domain *the_Domain = this->getDomainPtr();
     int stamp = the_Domain->hasDomainChanged();
     domainStamp = stamp;
@@ -361,7 +365,10 @@ DirectIntegrationAnalysis::domainChanged(void)
     // now we invoke handle() on the constraint handler which
     // causes the creation of FE_Element and DOF_Group objects
     // and their addition to the AnalysisModel.
-    theConstraintHandler->handle();
+    {
+      ProfileScope handleScope("ConstraintHandler::handle");
+      theConstraintHandler->handle();
+    }
 
     // we now invoke number() on the numberer which causes
     // equation numbers to be assigned to all the DOFs in the
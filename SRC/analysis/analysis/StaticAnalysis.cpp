@@ -47,6 +47,7 @@
 #include <ID.h>
 #include <Graph.h>
 #include <Timer.h>
+#include <Profiler.h>
 
 // AddingSensitivity:BEGIN //////////////////////////////////
 #ifdef _RELIABILITY
@@ -78,6 +79,7 @@ StaticAnalysis::StaticAnalysis(Domain &the_Domain,
     theConstraintHandler->setLinks(the_Domain, theModel, theStaticIntegrator);
     theDOF_Numberer->setLinks(theModel);
 
+    theLinSOE.setLinks(theModel);
     theIntegrator->setLinks(theModel, theLinSOE, theTest);
     theAlgorithm->setLinks(theModel, theStaticIntegrator, theLinSOE, theTest);
 
@@ -142,6 +144,7 @@ StaticAnalysis::clearAll(void)
 int 
 StaticAnalysis::analyze(int numSteps)
 {
+    ProfileScope scope("StaticAnalysis::analyze");
     int result = 0;
     Domain *the_Domain = this->getDomainPtr();
 
@@ -363,6 +366,7 @@ StaticAnalysis::initialize(void)
 int
 StaticAnalysis::domainChanged(void)
 {
+    ProfileScope scope("StaticAnalysis::domainChanged");
     int result = 0;
 
     Domain *the_Domain = this->getDomainPtr();
@@ -384,7 +388,10 @@ StaticAnalysis::domainChanged(void)
     // causes the creation of FE_Element and DOF_Group objects
     // and their addition to the AnalysisModel.
 
-    result = theConstraintHandler->handle();
+    {
+      ProfileScope handleScope("ConstraintHandler::handle");
+      result = theConstraintHandler->handle();
+    }
     if (result < 0) {
 	opserr << "StaticAnalysis::handle() - ";
 	opserr << "ConstraintHandler::handle() failed";
@@ -40,6 +40,7 @@
 #include <Domain.h>
 #include <ConvergenceTest.h>
 #include <float.h>
+#include <math.h>
 #include <AnalysisModel.h>
 
 // Constructor
@@ -151,7 +152,115 @@ VariableTimeStepDirectIntegrationAnalysis::analyze(int numSteps, double dT, doub
 }
 
 
+int 
+VariableTimeStepDirectIntegrationAnalysis::analyzeAdaptive(int numSteps, double dT, 
+							   double dtMin, double dtMax, 
+							   double relTol, double absTol)
+{
+  // get some pointers
+  Domain *theDom = this->getDomainPtr();
+  EquiSolnAlgo *theAlgo = this->getAlgorithm();
+  TransientIntegrator *theIntegratr = this->getIntegrator();
+  AnalysisModel *theModel = this->getModel();
+
+  if (relTol < 0.0 || absTol < 0.0 || relTol + absTol <= 0.0) {
+    opserr << "VariableTimeStepDirectIntegrationAnalysis::analyzeAdaptive() - tolerances must be >= 0, one > 0\n";
+    return -1;
+  }
+
+  // set some variables
+  int result = 0;  
+  double totalTimeIncr = numSteps * dT;
+  double currentTimeIncr = 0.0;
+  double currentDt = dT;
+  double lastErrorRatio = 1.0;
+
+  // loop until analysis has performed the total time incr requested
+  while (totalTimeIncr - currentTimeIncr > 1.0e-12*totalTimeIncr) {
+
+    // do not step past the end, the last step lands on the requested time
+    if (currentTimeIncr + currentDt > totalTimeIncr)
+      currentDt = totalTimeIncr - currentTimeIncr;
+
+    if (theModel->analysisStep(currentDt) < 0) {
+      opserr << "VariableTimeStepDirectIntegrationAnalysis::analyzeAdaptive() - the AnalysisModel failed in newStepDomain";
+      opserr << " at time " << theDom->getCurrentTime() << endln;
+      theDom->revertToLastCommit();
+      return -2;
+    }
 
+    if (this->checkDomainChange() != 0) {
+      opserr << "VariableTimeStepDirectIntegrationAnalysis::analyzeAdaptive() - failed checkDomainChange\n";
+      return -1;
+    }
+
+    if (theIntegratr->newStep(currentDt) < 0) {
+      result = -2;
+    }
+
+    if (result >= 0) {
+      result = theAlgo->solveCurrentStep();
+      if (result < 0) 
+	result = -3;
+    }    
+
+    //
+    // if converged, check the local error estimate of the integrator before
+    // committing; the step is rejected if error exceeds the tolerance
+    //
+
+    double errorRatio = 0.0;
+    if (result >= 0) {
+      errorRatio = theIntegratr->getLocalErrorEstimate(relTol, absTol);
+      if (errorRatio < 0.0) {
+	opserr << "VariableTimeStepDirectIntegrationAnalysis::analyzeAdaptive() - ";
+	opserr << "integrator does not provide a local error estimate\n";
+	theDom->revertToLastCommit();	    
+	theIntegratr->revertToLastStep();
+	return -5;
+      }
+
+      if (errorRatio > 1.0 && currentDt > dtMin) {
+	theDom->revertToLastCommit();	    
+	theIntegratr->revertToLastStep();
+
+	currentDt = this->determineAdaptiveDt(currentDt, dtMin, dtMax, errorRatio, 0.0);
+	result = 0;
+	continue;
+      }
+
+      result = theIntegratr->commit();
+      if (result < 0) 
+	result = -4;
+    }
+
+    if (result >= 0) {
+      currentTimeIncr += currentDt;
+      currentDt = this->determineAdaptiveDt(currentDt, dtMin, dtMax, errorRatio, lastErrorRatio);
+      lastErrorRatio = errorRatio;
+    } else {
+
+      // failed to converge; revert the Domain to last committed state & cut step
+      theDom->revertToLastCommit();	    
+      theIntegratr->revertToLastStep();
+
+      // if last dT was <= min specified the analysis FAILS - return FAILURE
+      if (currentDt <= dtMin) {
+	opserr << "VariableTimeStepDirectIntegrationAnalysis::analyzeAdaptive() - ";
+	opserr << " failed at time " << theDom->getCurrentTime() << endln;
+	return result;
+      }
+
+      currentDt *= 0.5;
+      if (currentDt < dtMin)
+	currentDt = dtMin;
+
+      result = 0;
+    }
+  }
+
+  return 0;
+}
 
 
 double 
@@ -184,3 +293,39 @@ VariableTimeStepDirectIntegrationAnalysis::determineDt(double dT,
 }
 
 
+double 
+VariableTimeStepDirectIntegrationAnalysis::determineAdaptiveDt(double dT, 
+							       double dtMin, 
+							       double dtMax, 
+							       double errorRatio,
+							       double lastErrorRatio)
+{
+  // PI step size control (Gustafsson) for a local error of O(dT^3):
+  //   dTnew = dT * safety * (1/r)^(0.7/3) * (rLast/r)^(0.4/3)
+  // with r = error/tol; after a rejection (rLast == 0) only an I term is used
+  double safety = 0.9;
+  double factor = 5.0;
+
+  if (errorRatio > 1.0e-10) {
+    if (lastErrorRatio > 1.0e-10) 
+      factor = safety * pow(errorRatio, -0.7/3.0) * pow(lastErrorRatio/errorRatio, 0.4/3.0);
+    else
+      factor = safety * pow(errorRatio, -1.0/3.0);
+  }
+
+  // limit the change in step size
+  if (factor < 0.2)
+    factor = 0.2;
+  else if (factor > 5.0)
+    factor = 5.0;
+
+  double newDt = dT*factor;
+
+  // ensure: dtMin <= dT <= dtMax
+  if (newDt < dtMin)
+    newDt = dtMin;
+  else if (newDt > dtMax)
+    newDt = dtMax;
+    
+  return newDt;
+}
@@ -61,10 +61,14 @@ class VariableTimeStepDirectIntegrationAnalysis: public DirectIntegrationAnalysi
     virtual ~VariableTimeStepDirectIntegrationAnalysis();
 
     int analyze(int numSteps, double dT, double dtMin, double dtMax, int Jd);
+    int analyzeAdaptive(int numSteps, double dT, double dtMin, double dtMax, 
+			double relTol, double absTol);
 
   protected:
     virtual double determineDt(double dT, double dtMin, double dtMax, int Jd,
 			       ConvergenceTest *theTest);
+    virtual double determineAdaptiveDt(double dT, double dtMin, double dtMax, 
+				       double errorRatio, double lastErrorRatio);
 
   private:
 };
@@ -42,6 +42,7 @@
 #include <AnalysisModel.h>
 #include <Matrix.h>
 #include <Vector.h>
+#include <Profiler.h>
 
 #define MAX_NUM_DOF 64
 
@@ -297,6 +298,7 @@ FE_Element::getTangent(Integrator *theNewIntegrator)
     }
 
     if (myEle->isSubdomain() == false) {
+      ProfileScope scope("tangent", myEle->getClassTag());
       if (theNewIntegrator != 0)
 	theNewIntegrator->formEleTangent(this);	    	    
 
@@ -324,6 +326,7 @@ FE_Element::getResidual(Integrator *theNewIntegrator)
     }    
 
     if (myEle->isSubdomain() == false) {
+      ProfileScope scope("residual", myEle->getClassTag());
       theNewIntegrator->formEleResidual(this);
       return *theResidual;
     } else {
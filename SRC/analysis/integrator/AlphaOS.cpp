@@ -512,6 +512,17 @@ void AlphaOS::Print(OPS_Stream &s, int flag)
 }
 
 
+// the residual depends on the tangent used in the previous
+// iteration, so the two cannot be formed in one pass here
+int AlphaOS::formTangentAndUnbalance(int statFlag)
+{
+    if (this->formUnbalance() < 0)
+        return -2;
+    
+    return this->formTangent(statFlag);
+}
+
+
 int AlphaOS::formElementResidual(void)
 {
     // calculate Residual Force     
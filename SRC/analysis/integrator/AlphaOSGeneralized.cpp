@@ -526,6 +526,17 @@ void AlphaOSGeneralized::Print(OPS_Stream &s, int flag)
 }
 
 
+// the residual depends on the tangent used in the previous
+// iteration, so the two cannot be formed in one pass here
+int AlphaOSGeneralized::formTangentAndUnbalance(int statFlag)
+{
+    if (this->formUnbalance() < 0)
+        return -2;
+    
+    return this->formTangent(statFlag);
+}
+
+
 int AlphaOSGeneralized::formElementResidual(void)
 {
     // calculate Residual Force     
@@ -435,6 +435,16 @@ int GeneralizedAlpha::commit(void)
 }
 
 
+double GeneralizedAlpha::getLocalErrorEstimate(double relTol, double absTol)
+{
+    if (U == 0 || Utdotdot == 0)
+        return -1.0;
+
+    return this->getNewmarkErrorEstimate(beta, deltaT, *U, *Udotdot, *Utdotdot, 
+                                         relTol, absTol);
+}
+
+
 int GeneralizedAlpha::sendSelf(int cTag, Channel &theChannel)
 {
     Vector data(4);
@@ -421,6 +421,16 @@ int HHT::commit(void)
 }
 
 
+double HHT::getLocalErrorEstimate(double relTol, double absTol)
+{
+    if (U == 0 || Utdotdot == 0)
+        return -1.0;
+
+    return this->getNewmarkErrorEstimate(beta, deltaT, *U, *Udotdot, *Utdotdot, 
+                                         relTol, absTol);
+}
+
+
 int HHT::sendSelf(int cTag, Channel &theChannel)
 {
     Vector data(3);
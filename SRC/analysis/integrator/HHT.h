@@ -62,6 +62,7 @@ public:
     int newStep(double deltaT);    
     int revertToLastStep(void);        
     int update(const Vector &deltaU);
+    double getLocalErrorEstimate(double relTol, double absTol);
     int commit(void);
     
     virtual int sendSelf(int commitTag, Channel &theChannel);
@@ -38,6 +38,7 @@
 #include <DOF_Group.h>
 #include <FE_EleIter.h>
 #include <DOF_GrpIter.h>
+#include <Profiler.h>
 
 IncrementalIntegrator::IncrementalIntegrator(int clasTag)
 :Integrator(clasTag),
@@ -64,6 +65,7 @@ IncrementalIntegrator::setLinks(AnalysisModel &theModel, LinearSOE &theLinSOE, C
 int 
 IncrementalIntegrator::formTangent(int statFlag)
 {
+    ProfileScope scope("IncrementalIntegrator::formTangent");
     int result = 0;
     statusFlag = statFlag;
 
@@ -96,6 +98,8 @@ IncrementalIntegrator::formTangent(int statFlag)
 int 
 IncrementalIntegrator::formUnbalance(void)
 {
+    ProfileScope scope("IncrementalIntegrator::formUnbalance");
+
     if (theAnalysisModel == 0 || theSOE == 0) {
 	opserr << "WARNING IncrementalIntegrator::formUnbalance -";
 	opserr << " no AnalysisModel or LinearSOE has been set\n";
@@ -119,6 +123,51 @@ IncrementalIntegrator::formUnbalance(void)
     return 0;
 }
     
+
+// forms the tangent and the unbalance in a single pass over the 
+// FE_Elements, each element being asked for its residual and tangent
+// in turn while its data is at hand.
+int 
+IncrementalIntegrator::formTangentAndUnbalance(int statFlag)
+{
+    ProfileScope scope("IncrementalIntegrator::formTangentAndUnbalance");
+    int result = 0;
+    statusFlag = statFlag;
+
+    if (theAnalysisModel == 0 || theSOE == 0) {
+	opserr << "WARNING IncrementalIntegrator::formTangentAndUnbalance() -";
+	opserr << " no AnalysisModel or LinearSOE have been set\n";
+	return -1;
+    }
+
+    theSOE->zeroA();
+    theSOE->zeroB();
+
+    FE_Element *elePtr;
+    FE_EleIter &theEles2 = theAnalysisModel->getFEs();    
+    while((elePtr = theEles2()) != 0) {
+	const ID &id = elePtr->getID();
+	if (theSOE->addB(elePtr->getResidual(this),id) < 0) {
+	    opserr << "WARNING IncrementalIntegrator::formTangentAndUnbalance -";
+	    opserr << " failed in addB for ID " << id;
+	    result = -2;
+	}
+	if (theSOE->addA(elePtr->getTangent(this),id) < 0) {
+	    opserr << "WARNING IncrementalIntegrator::formTangentAndUnbalance -";
+	    opserr << " failed in addA for ID " << id;	    
+	    result = -3;
+	}
+    }
+
+    if (this->formNodalUnbalance() < 0) {
+	opserr << "WARNING IncrementalIntegrator::formTangentAndUnbalance ";
+	opserr << " - this->formNodalUnbalance failed\n";
+	result = -2;
+    }    
+
+    return result;
+}
+
 int
 IncrementalIntegrator::getLastResponse(Vector &result, const ID &id)
 {
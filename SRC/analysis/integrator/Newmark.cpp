@@ -88,7 +88,7 @@ OPS_NewNewmark(void)
 
 Newmark::Newmark()
     : TransientIntegrator(INTEGRATOR_TAGS_Newmark),
-    displ(true), gamma(0), beta(0), 
+    displ(true), gamma(0), beta(0), deltaT(0.0), 
     c1(0.0), c2(0.0), c3(0.0), 
     Ut(0), Utdot(0), Utdotdot(0), U(0), Udot(0), Udotdot(0),
     determiningMass(false)
@@ -99,7 +99,7 @@ Newmark::Newmark()
 
 Newmark::Newmark(double _gamma, double _beta, bool dispFlag)
     : TransientIntegrator(INTEGRATOR_TAGS_Newmark),
-    displ(dispFlag), gamma(_gamma), beta(_beta), 
+    displ(dispFlag), gamma(_gamma), beta(_beta), deltaT(0.0), 
     c1(0.0), c2(0.0), c3(0.0), 
     Ut(0), Utdot(0), Utdotdot(0), U(0), Udot(0), Udotdot(0),
     determiningMass(false)
@@ -125,8 +125,10 @@ Newmark::~Newmark()
 }
 
 
-int Newmark::newStep(double deltaT)
+int Newmark::newStep(double _deltaT)
 {
+    deltaT = _deltaT;
+
     if (beta == 0 || gamma == 0)  {
         opserr << "Newmark::newStep() - error in variable\n";
         opserr << "gamma = " << gamma << " beta = " << beta << endln;
@@ -398,6 +400,16 @@ int Newmark::update(const Vector &deltaU)
 }    
 
 
+double Newmark::getLocalErrorEstimate(double relTol, double absTol)
+{
+    if (U == 0 || Utdotdot == 0)
+        return -1.0;
+
+    return this->getNewmarkErrorEstimate(beta, deltaT, *U, *Udotdot, *Utdotdot, 
+                                         relTol, absTol);
+}
+
+
 int Newmark::sendSelf(int cTag, Channel &theChannel)
 {
     Vector data(3);
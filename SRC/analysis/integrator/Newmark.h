@@ -62,6 +62,7 @@ public:
     int newStep(double deltaT);    
     int revertToLastStep(void);        
     int update(const Vector &deltaU);
+    double getLocalErrorEstimate(double relTol, double absTol);
     
     virtual int sendSelf(int commitTag, Channel &theChannel);
     virtual int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);
@@ -76,6 +77,7 @@ protected:
     bool displ;      // a flag indicating whether displ or accel increments
     double gamma;
     double beta;
+    double deltaT;
     
     double c1, c2, c3;              // some constants we need to keep
     Vector *Ut, *Utdot, *Utdotdot;  // response quantities at time t
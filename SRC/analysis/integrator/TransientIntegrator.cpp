@@ -44,6 +44,9 @@
 #include <DOF_Group.h>
 #include <FE_EleIter.h>
 #include <DOF_GrpIter.h>
+#include <ID.h>
+#include <Profiler.h>
+#include <math.h>
 
 TransientIntegrator::TransientIntegrator(int clasTag)
 :IncrementalIntegrator(clasTag)
@@ -59,6 +62,7 @@ TransientIntegrator::~TransientIntegrator()
 int 
 TransientIntegrator::formTangent(int statFlag)
 {
+    ProfileScope scope("TransientIntegrator::formTangent");
     int result = 0;
     statusFlag = statFlag;
 
@@ -101,6 +105,57 @@ TransientIntegrator::formTangent(int statFlag)
 
 
 
+
+int
+TransientIntegrator::formTangentAndUnbalance(int statFlag)
+{
+    int result = 0;
+    statusFlag = statFlag;
+
+    LinearSOE *theLinSOE = this->getLinearSOE();
+    AnalysisModel *theModel = this->getAnalysisModel();
+    if (theLinSOE == 0 || theModel == 0) {
+	opserr << "WARNING TransientIntegrator::formTangentAndUnbalance() ";
+	opserr << "no LinearSOE or AnalysisModel has been set\n";
+	return -1;
+    }
+
+    theLinSOE->zeroA();
+    theLinSOE->zeroB();
+
+    // one pass over the FE_Elements adding both residual and tangent
+    FE_EleIter &theEles2 = theModel->getFEs();    
+    FE_Element *elePtr;    
+    while((elePtr = theEles2()) != 0)     {
+	const ID &id = elePtr->getID();
+	if (theLinSOE->addB(elePtr->getResidual(this),id) < 0) {
+	    opserr << "TransientIntegrator::formTangentAndUnbalance() - failed to addB:ele\n";
+	    result = -2;
+	}
+	if (theLinSOE->addA(elePtr->getTangent(this),id) < 0) {
+	    opserr << "TransientIntegrator::formTangentAndUnbalance() - failed to addA:ele\n";
+	    result = -2;
+	}
+    }
+
+    // and one over the DOF_Groups
+    DOF_GrpIter &theDOFs = theModel->getDOFs();
+    DOF_Group *dofPtr;
+    while ((dofPtr = theDOFs()) != 0) {
+	const ID &id = dofPtr->getID();
+	if (theLinSOE->addB(dofPtr->getUnbalance(this),id) < 0) {
+	    opserr << "TransientIntegrator::formTangentAndUnbalance() - failed to addB:dof\n";
+	    result = -1;
+	}
+	if (theLinSOE->addA(dofPtr->getTangent(this),id) < 0) {
+	    opserr << "TransientIntegrator::formTangentAndUnbalance() - failed to addA:dof\n";
+	    result = -1;
+	}
+    }    
+
+    return result;
+}
+
     
 int
 TransientIntegrator::formEleResidual(FE_Element *theEle)
@@ -117,3 +172,31 @@ TransientIntegrator::formNodUnbalance(DOF_Group *theDof)
   theDof->addPIncInertiaToUnbalance();
   return 0;
 }    
+
+
+// local truncation error in the displacements of the Newmark family
+// (Zienkiewicz & Xie): e = (beta - 1/6) deltaT^2 (Udotdot - Utdotdot); 
+// the update at t+deltaT of HHT and GeneralizedAlpha follows the same
+// relations. returns ||e|| / (absTol + relTol*||U||)
+double
+TransientIntegrator::getNewmarkErrorEstimate(double beta, double deltaT, 
+					     const Vector &U,
+					     const Vector &Udotdot, 
+					     const Vector &Utdotdot,
+					     double relTol, double absTol)
+{
+  double factor = fabs(beta - 1.0/6.0)*deltaT*deltaT;
+  double errNorm = 0.0;
+  int size = U.Size();
+  for (int i=0; i<size; i++)  {
+    double e = factor*(Udotdot(i) - Utdotdot(i));
+    errNorm += e*e;
+  }
+  errNorm = sqrt(errNorm);
+
+  double tol = absTol + relTol*U.Norm();
+  if (tol > 0.0)
+    return errNorm/tol;
+
+  return errNorm;
+}
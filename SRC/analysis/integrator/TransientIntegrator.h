@@ -54,12 +54,22 @@ class TransientIntegrator : public IncrementalIntegrator
     virtual ~TransientIntegrator();
 
     virtual int formTangent(int statFlag);
+    virtual int formTangentAndUnbalance(int statFlag = CURRENT_TANGENT);
     virtual int formEleResidual(FE_Element *theEle);
     virtual int formNodUnbalance(DOF_Group *theDof);    
 
     virtual int initialize(void) {return 0;};
 
+    // estimate of the local truncation error in the displacements for the 
+    // last step, as a ratio to the tolerance absTol + relTol*||U||; 
+    // < 0 if not provided
+    virtual double getLocalErrorEstimate(double relTol, double absTol) {return -1.0;};
+
   protected:
+    // the local error estimate of the Newmark family of methods
+    double getNewmarkErrorEstimate(double beta, double deltaT, const Vector &U,
+				   const Vector &Udotdot, const Vector &Utdotdot,
+				   double relTol, double absTol);
     
   private:
 };
@@ -49,6 +49,7 @@
 #include <Node.h>
 #include <NodeIter.h>
 #include <ConstraintHandler.h>
+#include <Profiler.h>
 
 
 #include <MapOfTaggedObjects.h>
@@ -545,6 +546,7 @@ AnalysisModel::applyLoadDomain(double pseudoTime)
 
     // invoke the method
     myDomain->applyLoad(pseudoTime);
+    ProfileScope scope("ConstraintHandler::applyLoad");
     myHandler->applyLoad();
 }
 
@@ -561,8 +563,10 @@ AnalysisModel::updateDomain(void)
 
     // invoke the method
     int res = myDomain->update();
-    if (res == 0)
+    if (res == 0) {
+      ProfileScope scope("ConstraintHandler::update");
       return myHandler->update();
+    }
 
     return res;
 }
@@ -582,12 +586,16 @@ AnalysisModel::updateDomain(double newTime, double dT)
 
     int res = 0;
     myDomain->applyLoad(newTime);
-    if (res == 0)
+    if (res == 0) {
+      ProfileScope scope("ConstraintHandler::applyLoad");
       res = myHandler->applyLoad();
+    }
     if (res == 0)
       res = myDomain->update();
-    if (res == 0)
+    if (res == 0) {
+      ProfileScope scope("ConstraintHandler::update");
       res = myHandler->update();
+    }
 
     return res;
 }
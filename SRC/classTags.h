@@ -699,6 +699,9 @@
 #define LinSOE_TAGS_MumpsSOE 23
 #define LinSOE_TAGS_MumpsParallelSOE 24
 #define LinSOE_TAGS_MPIDiagonalSOE 25
+#define LinSOE_TAGS_SupernodalSPDLinSOE 26
+#define LinSOE_TAGS_BlockSparseGenLinSOE 27
+#define LinSOE_TAGS_OutOfCoreProfileSPDLinSOE 28
 
 
 #define SOLVER_TAGS_FullGenLinLapackSolver  	1
@@ -726,6 +729,9 @@
 #define SOLVER_TAGS_MumpsSolver			      	23
 #define SOLVER_TAGS_MumpsParallelSolver			24
 #define SOLVER_TAGS_MPIDiagonalSolver 25
+#define SOLVER_TAGS_SupernodalSPDLinSolver 26
+#define SOLVER_TAGS_BlockSparseGenLinSolver 27
+#define SOLVER_TAGS_OutOfCoreProfileSPDLinSolver 28
 
 #define RECORDER_TAGS_ElementRecorder		1
 #define RECORDER_TAGS_NodeRecorder		2
@@ -742,6 +748,7 @@
 #define RECORDER_TAGS_DamageRecorder		12
 #define RECORDER_TAGS_PatternRecorder		13
 #define RECORDER_TAGS_TclFeViewer		14
+#define RECORDER_TAGS_ClassStatsRecorder	16
 
 
 #define OPS_STREAM_TAGS_FileStream		1
@@ -43,15 +43,7 @@
 #include <CorotCrdTransf3d.h>
 
 // initialize static variables
-Matrix CorotCrdTransf3d::RI(3,3); 
-Matrix CorotCrdTransf3d::RJ(3,3); 
-Matrix CorotCrdTransf3d::Rbar(3,3); 
-Matrix CorotCrdTransf3d::e(3,3); 
 Matrix CorotCrdTransf3d::Tp(6,7); 
-Matrix CorotCrdTransf3d::A(3,3);
-Matrix CorotCrdTransf3d::Lr2(12,3);
-Matrix CorotCrdTransf3d::Lr3(12,3);
-Matrix CorotCrdTransf3d::T(7,12);
 
 
 // constructor:
@@ -64,6 +56,8 @@ nodeIPtr(0), nodeJPtr(0), R0(3,3), L(0), Ln(0),
 alphaIq(4), alphaJq(4), 
 alphaIqcommit(4), alphaJqcommit(4), alphaI(3), alphaJ(3),
 ulcommit(7), ul(7),  ulpr(7),
+RI(3,3), RJ(3,3), Rbar(3,3), e(3,3), T(7,12), Lr2(12,3), Lr3(12,3), A(3,3),
+ub(6), dub(6), Dub(6), pg(12), kg(12,12),
 nodeIInitialDisp(0), nodeJInitialDisp(0), initialDispChecked(false)
 {
     // check vector that defines local xz plane
@@ -146,6 +140,8 @@ nodeIPtr(0), nodeJPtr(0), R0(3,3), L(0), Ln(0),
 alphaIq(4), alphaJq(4), 
 alphaIqcommit(4), alphaJqcommit(4), alphaI(3), alphaJ(3),
 ulcommit(7), ul(7),  ulpr(7),
+RI(3,3), RJ(3,3), Rbar(3,3), e(3,3), T(7,12), Lr2(12,3), Lr3(12,3), A(3,3),
+ub(6), dub(6), Dub(6), pg(12), kg(12,12),
 nodeIInitialDisp(0), nodeJInitialDisp(0), initialDispChecked(false)
 {
     // Permutation matrix (to renumber basic dof's)
@@ -281,9 +277,12 @@ CorotCrdTransf3d::initialize(Node *nodeIPointer, Node *nodeJPointer)
                 initialDispChecked = true;
     }
     
-    static Vector XAxis(3);
-    static Vector YAxis(3);
-    static Vector ZAxis(3);
+    double XAxisData[3] = {0.0};
+    Vector XAxis(XAxisData, 3);
+    double YAxisData[3] = {0.0};
+    Vector YAxis(YAxisData, 3);
+    double ZAxisData[3] = {0.0};
+    Vector ZAxis(ZAxisData, 3);
     
     // get 3by3 rotation matrix
     if ((error = this->getLocalAxes(XAxis, YAxis, ZAxis)))
@@ -321,8 +320,10 @@ CorotCrdTransf3d::update(void)
      // get the iterative spins dAlphaI and dAlphaJ 
      // (rotational displacement increments at both nodes)
      
-      static Vector dAlphaI(3);
-      static Vector dAlphaJ(3);
+      double dAlphaIData[3] = {0.0};
+      Vector dAlphaI(dAlphaIData, 3);
+      double dAlphaJData[3] = {0.0};
+      Vector dAlphaJ(dAlphaJData, 3);
       
        
         for (k = 0; k < 3; k++)
@@ -333,8 +334,10 @@ CorotCrdTransf3d::update(void)
     **************************************************************/
     
     // determine global displacement increments from last iteration
-    static Vector dispI(6);
-    static Vector dispJ(6);
+    double dispIData[6] = {0.0};
+    Vector dispI(dispIData, 6);
+    double dispJData[6] = {0.0};
+    Vector dispJ(dispJData, 6);
     dispI = nodeIPtr->getTrialDisp();
     dispJ = nodeJPtr->getTrialDisp();
     
@@ -351,8 +354,10 @@ CorotCrdTransf3d::update(void)
     // get the iterative spins dAlphaI and dAlphaJ 
     // (rotational displacement increments at both nodes)
     
-    static Vector dAlphaI(3);
-    static Vector dAlphaJ(3);
+    double dAlphaIData[3] = {0.0};
+    Vector dAlphaI(dAlphaIData, 3);
+    double dAlphaJData[3] = {0.0};
+    Vector dAlphaJ(dAlphaJData, 3);
     
     for (k = 0; k < 3; k++) {
         dAlphaI(k) = dispI(k+3) - alphaI(k);
@@ -364,8 +369,10 @@ CorotCrdTransf3d::update(void)
     /************** END OF REPLACEMENT **************************/
     
     // update the nodal triads TI and RJ using quaternions
-    static Vector dAlphaIq(4);
-    static Vector dAlphaJq(4);
+    double dAlphaIqData[4] = {0.0};
+    Vector dAlphaIq(dAlphaIqData, 4);
+    double dAlphaJqData[4] = {0.0};
+    Vector dAlphaJq(dAlphaJqData, 4);
     
     dAlphaIq = this->getQuaternionFromPseudoRotVector (dAlphaI);
     dAlphaJq = this->getQuaternionFromPseudoRotVector (dAlphaJ);
@@ -377,9 +384,12 @@ CorotCrdTransf3d::update(void)
     RJ = this->getRotationMatrixFromQuaternion (alphaJq);
     
     // compute the mean nodal triad
-    static Matrix dRgamma(3,3); 
-    static Vector gammaq(4);
-    static Vector gammaw(3);
+    double dRgammaData[3*3] = {0.0};
+    Matrix dRgamma(dRgammaData, 3,3); 
+    double gammaqData[4] = {0.0};
+    Vector gammaq(gammaqData, 4);
+    double gammawData[3] = {0.0};
+    Vector gammaw(gammawData, 3);
     
     dRgamma.Zero();
     
@@ -401,17 +411,22 @@ CorotCrdTransf3d::update(void)
             Rbar.addMatrixProduct(0.0, dRgamma, RI, 1.0);
             
             // compute the base vectors e1, e2, e3
-            static Vector e1(3);
-            static Vector e2(3);
-            static Vector e3(3);
+            double e1Data[3] = {0.0};
+            Vector e1(e1Data, 3);
+            double e2Data[3] = {0.0};
+            Vector e2(e2Data, 3);
+            double e3Data[3] = {0.0};
+            Vector e3(e3Data, 3);
             
             // relative translation displacements
-            static Vector dJI(3);    
+            double dJIData[3] = {0.0};
+            Vector dJI(dJIData, 3);    
             for (int kk = 0; kk < 3; kk++)
                 dJI(kk) = dispJ(kk) - dispI(kk);
             
             // element projection
-            static Vector xJI(3);
+            double xJIData[3] = {0.0};
+            Vector xJI(xJIData, 3);
             xJI = nodeJPtr->getCrds() - nodeIPtr->getCrds();
             
             if (nodeIInitialDisp != 0) {
@@ -426,7 +441,8 @@ CorotCrdTransf3d::update(void)
                 xJI(2) += nodeJInitialDisp[2];
             }
             
-            static Vector dx(3);
+            double dxData[3] = {0.0};
+            Vector dx(dxData, 3);
             // dx = xJI + dJI;  
             dx = xJI;
             dx.addVector (1.0, dJI, 1.0);
@@ -446,9 +462,12 @@ CorotCrdTransf3d::update(void)
             
             // 'rotate' the mean rotation matrix Rbar on to e1 to 
             // obtain e2 and e3 (using the 'mid-point' procedure)
-            static Vector r1(3);
-            static Vector r2(3);
-            static Vector r3(3);
+            double r1Data[3] = {0.0};
+            Vector r1(r1Data, 3);
+            double r2Data[3] = {0.0};
+            Vector r2(r2Data, 3);
+            double r3Data[3] = {0.0};
+            Vector r3(r3Data, 3);
             
             for (k = 0; k < 3; k ++)
             {
@@ -460,7 +479,8 @@ CorotCrdTransf3d::update(void)
             //    e2 = r2 - (e1 + r1)*((r2^ e1)*0.5);
             // e3 = r3 - (e1 + r1)*((r3^ e1)*0.5);
             
-            static Vector tmp(3);
+            double tmpData[3] = {0.0};
+            Vector tmp(tmpData, 3);
             tmp = e1;
             tmp += r1;
             
@@ -476,8 +496,18 @@ CorotCrdTransf3d::update(void)
             e3.addVector(-1.0,  r3, 1.0);
             
             // compute the basic rotations
-            static Vector rI1(3), rI2(3), rI3(3);
-            static Vector rJ1(3), rJ2(3), rJ3(3);
+            double rI1Data[3] = {0.0};
+            Vector rI1(rI1Data, 3);
+            double rI2Data[3] = {0.0};
+            Vector rI2(rI2Data, 3);
+            double rI3Data[3] = {0.0};
+            Vector rI3(rI3Data, 3);
+            double rJ1Data[3] = {0.0};
+            Vector rJ1(rJ1Data, 3);
+            double rJ2Data[3] = {0.0};
+            Vector rJ2(rJ2Data, 3);
+            double rJ3Data[3] = {0.0};
+            Vector rJ3(rJ3Data, 3);
             
             for (k = 0; k < 3; k ++)
             {
@@ -522,10 +552,30 @@ CorotCrdTransf3d::compTransfMatrixBasicGlobal(void)
     int i, j, k;
     
     //opserr << "comprTransfMatrixBasicGlobal: *****************************\n";
-    static Vector r1(3), r2(3), r3(3);
-    static Vector e1(3), e2(3), e3(3);
-    static Vector rI1(3), rI2(3), rI3(3);
-    static Vector rJ1(3), rJ2(3), rJ3(3);
+    double r1Data[3] = {0.0};
+    Vector r1(r1Data, 3);
+    double r2Data[3] = {0.0};
+    Vector r2(r2Data, 3);
+    double r3Data[3] = {0.0};
+    Vector r3(r3Data, 3);
+    double e1Data[3] = {0.0};
+    Vector e1(e1Data, 3);
+    double e2Data[3] = {0.0};
+    Vector e2(e2Data, 3);
+    double e3Data[3] = {0.0};
+    Vector e3(e3Data, 3);
+    double rI1Data[3] = {0.0};
+    Vector rI1(rI1Data, 3);
+    double rI2Data[3] = {0.0};
+    Vector rI2(rI2Data, 3);
+    double rI3Data[3] = {0.0};
+    Vector rI3(rI3Data, 3);
+    double rJ1Data[3] = {0.0};
+    Vector rJ1(rJ1Data, 3);
+    double rJ2Data[3] = {0.0};
+    Vector rJ2(rJ2Data, 3);
+    double rJ3Data[3] = {0.0};
+    Vector rJ3(rJ3Data, 3);
     
     for (k = 0; k < 3; k ++)
     {
@@ -548,7 +598,8 @@ CorotCrdTransf3d::compTransfMatrixBasicGlobal(void)
     
     // compute the transformation matrix from the basic to the
     // global system
-    static Matrix I(3,3);
+    double IData[3*3] = {0.0};
+    Matrix I(IData, 3,3);
     
     //   A = (1/Ln)*(I - e1*e1');
     for (i = 0; i < 3; i++)
@@ -558,11 +609,19 @@ CorotCrdTransf3d::compTransfMatrixBasicGlobal(void)
         for (j = 0; j < 3; j++)
             A(i,j) = (I(i,j) - e1(i)*e1(j))/Ln;
         
-        Lr2 = this->getLMatrix (r2);
-        Lr3 = this->getLMatrix (r3);
+        this->getLMatrix (r2, Lr2);
+        this->getLMatrix (r3, Lr3);
         
-        static Matrix Sr1(3,3), Sr2(3,3), Sr3(3,3);
-        static Vector Se(3), At(3);
+        double Sr1Data[3*3] = {0.0};
+        Matrix Sr1(Sr1Data, 3,3);
+        double Sr2Data[3*3] = {0.0};
+        Matrix Sr2(Sr2Data, 3,3);
+        double Sr3Data[3*3] = {0.0};
+        Matrix Sr3(Sr3Data, 3,3);
+        double SeData[3] = {0.0};
+        Vector Se(SeData, 3);
+        double AtData[3] = {0.0};
+        Vector At(AtData, 3);
         
         //   T1 = [      O', (-S(rI3)*e2 + S(rI2)*e3)',        O', O']';
         //   T2 = [(A*rI2)', (-S(rI2)*e1 + S(rI1)*e2)', -(A*rI2)', O']';
@@ -574,9 +633,9 @@ CorotCrdTransf3d::compTransfMatrixBasicGlobal(void)
         
         T.Zero();
         
-        Sr1 = this->getSkewSymMatrix(rI1);
-        Sr2 = this->getSkewSymMatrix(rI2);
-        Sr3 = this->getSkewSymMatrix(rI3);
+        this->getSkewSymMatrix(rI1, Sr1);
+        this->getSkewSymMatrix(rI2, Sr2);
+        this->getSkewSymMatrix(rI3, Sr3);
         
         //   T1 = [      O', (-S(rI3)*e2 + S(rI2)*e3)',        O', O']';
         
@@ -614,9 +673,9 @@ CorotCrdTransf3d::compTransfMatrixBasicGlobal(void)
             T(2,i+6) = -At(i);
         }
         
-        Sr1 = this->getSkewSymMatrix(rJ1);
-        Sr2 = this->getSkewSymMatrix(rJ2);
-        Sr3 = this->getSkewSymMatrix(rJ3);
+        this->getSkewSymMatrix(rJ1, Sr1);
+        this->getSkewSymMatrix(rJ2, Sr2);
+        this->getSkewSymMatrix(rJ3, Sr3);
         
         //   T4 = [      O', O',        O', (-S(rJ3)*e2 + S(rJ2)*e3)']';
         
@@ -655,7 +714,8 @@ CorotCrdTransf3d::compTransfMatrixBasicGlobal(void)
         }
         
         // setup tranformation matrix
-        static Vector Lr(12);
+        double LrData[12] = {0.0};
+        Vector Lr(LrData, 12);
         
         // T(:,1) += Lr3*rI2 - Lr2*rI3;
         // T(:,2) +=           Lr2*rI1;
@@ -722,10 +782,30 @@ CorotCrdTransf3d::compTransfMatrixBasicGlobalNew(void)
     int i, j, k;
     
     //opserr << "comprTransfMatrixBasicGlobal: *****************************\n";
-    static Vector r1(3), r2(3), r3(3);
-    static Vector e1(3), e2(3), e3(3);
-    static Vector rI1(3), rI2(3), rI3(3);
-    static Vector rJ1(3), rJ2(3), rJ3(3);
+    double r1Data[3] = {0.0};
+    Vector r1(r1Data, 3);
+    double r2Data[3] = {0.0};
+    Vector r2(r2Data, 3);
+    double r3Data[3] = {0.0};
+    Vector r3(r3Data, 3);
+    double e1Data[3] = {0.0};
+    Vector e1(e1Data, 3);
+    double e2Data[3] = {0.0};
+    Vector e2(e2Data, 3);
+    double e3Data[3] = {0.0};
+    Vector e3(e3Data, 3);
+    double rI1Data[3] = {0.0};
+    Vector rI1(rI1Data, 3);
+    double rI2Data[3] = {0.0};
+    Vector rI2(rI2Data, 3);
+    double rI3Data[3] = {0.0};
+    Vector rI3(rI3Data, 3);
+    double rJ1Data[3] = {0.0};
+    Vector rJ1(rJ1Data, 3);
+    double rJ2Data[3] = {0.0};
+    Vector rJ2(rJ2Data, 3);
+    double rJ3Data[3] = {0.0};
+    Vector rJ3(rJ3Data, 3);
     
     for (k = 0; k < 3; k ++)
     {
@@ -748,7 +828,8 @@ CorotCrdTransf3d::compTransfMatrixBasicGlobalNew(void)
     
     // compute the transformation matrix from the basic to the
     // global system
-    static Matrix I(3,3);
+    double IData[3*3] = {0.0};
+    Matrix I(IData, 3,3);
     
     //   A = (1/Ln)*(I - e1*e1');
     for (i = 0; i < 3; i++)
@@ -775,14 +856,22 @@ CorotCrdTransf3d::compTransfMatrixBasicGlobalNew(void)
             opserr << "A: " << A;
         */
         
-        Lr2 = this->getLMatrix (r2);
-        Lr3 = this->getLMatrix (r3);
+        this->getLMatrix (r2, Lr2);
+        this->getLMatrix (r3, Lr3);
         
         // opserr << "Lr2: " << Lr2;
         // opserr << "Lr3: " << Lr3;
         
-        static Matrix Sr1(3,3), Sr2(3,3), Sr3(3,3);
-        static Vector Se(3), At(3);
+        double Sr1Data[3*3] = {0.0};
+        Matrix Sr1(Sr1Data, 3,3);
+        double Sr2Data[3*3] = {0.0};
+        Matrix Sr2(Sr2Data, 3,3);
+        double Sr3Data[3*3] = {0.0};
+        Matrix Sr3(Sr3Data, 3,3);
+        double SeData[3] = {0.0};
+        Vector Se(SeData, 3);
+        double AtData[3] = {0.0};
+        Vector At(AtData, 3);
         
         
         // O = zeros(3,1);
@@ -793,16 +882,22 @@ CorotCrdTransf3d::compTransfMatrixBasicGlobalNew(void)
         // hJ2 = [(A*rJ3)', O', -(A*rJ3)', (-S(rJ3)*e1 + S(rJ1)*e3)']';
         // hJ3 = [(A*rJ2)', O', -(A*rJ2)', (-S(rJ2)*e1 + S(rJ1)*e2)']';
         
-        static Vector hI1(12);
-        static Vector hI2(12);
-        static Vector hI3(12);
-        static Vector hJ1(12);
-        static Vector hJ2(12);
-        static Vector hJ3(12);
-        
-        Sr1 = this->getSkewSymMatrix(rI1);
-        Sr2 = this->getSkewSymMatrix(rI2);
-        Sr3 = this->getSkewSymMatrix(rI3);
+        double hI1Data[12] = {0.0};
+        Vector hI1(hI1Data, 12);
+        double hI2Data[12] = {0.0};
+        Vector hI2(hI2Data, 12);
+        double hI3Data[12] = {0.0};
+        Vector hI3(hI3Data, 12);
+        double hJ1Data[12] = {0.0};
+        Vector hJ1(hJ1Data, 12);
+        double hJ2Data[12] = {0.0};
+        Vector hJ2(hJ2Data, 12);
+        double hJ3Data[12] = {0.0};
+        Vector hJ3(hJ3Data, 12);
+        
+        this->getSkewSymMatrix(rI1, Sr1);
+        this->getSkewSymMatrix(rI2, Sr2);
+        this->getSkewSymMatrix(rI3, Sr3);
         
         // hI1 = [      O', (-S(rI3)*e2 + S(rI2)*e3)',        O', O']';
         Se.addMatrixVector(0.0, Sr3, e2, -1.0);     // (-S(rI3)*e2 + S(rI2)*e3)
@@ -832,9 +927,9 @@ CorotCrdTransf3d::compTransfMatrixBasicGlobalNew(void)
             hI3(i+6) = -At(i);
         }
         
-        Sr1 = this->getSkewSymMatrix(rJ1);
-        Sr2 = this->getSkewSymMatrix(rJ2);
-        Sr3 = this->getSkewSymMatrix(rJ3);
+        this->getSkewSymMatrix(rJ1, Sr1);
+        this->getSkewSymMatrix(rJ2, Sr2);
+        this->getSkewSymMatrix(rJ3, Sr3);
         
         // hJ1 = [      O', O',        O', (-S(rJ3)*e2 + S(rJ2)*e3)']';  
         Se.addMatrixVector(0.0, Sr3, e2, -1.0);    // -S(rJ3)*e2 + S(rJ2)*e3
@@ -891,7 +986,8 @@ CorotCrdTransf3d::compTransfMatrixBasicGlobalNew(void)
         
         // T = F'
         T.Zero();
-        static Vector Lr(12);
+        double LrData[12] = {0.0};
+        Vector Lr(LrData, 12);
         
         // f1 =  [-e1' O' e1' O'];
         for (i=0; i<3; i++) {
@@ -899,8 +995,10 @@ CorotCrdTransf3d::compTransfMatrixBasicGlobalNew(void)
             T(i+3,0) = e1(i);
         }
         
-        static Vector thetaI(3);
-        static Vector thetaJ(3);
+        double thetaIData[3] = {0.0};
+        Vector thetaI(thetaIData, 3);
+        double thetaJData[3] = {0.0};
+        Vector thetaJ(thetaJData, 3);
         
         
         thetaI(0) = ul(0);
@@ -966,8 +1064,6 @@ CorotCrdTransf3d::compTransfMatrixBasicGlobalNew(void)
 const Vector &
 CorotCrdTransf3d::getBasicTrialDisp (void)
 {
-    static Vector ub(6);
-    
     // use transformation matrix to renumber the degrees of freedom
     ub.addMatrixVector(0.0, Tp, ul, 1.0);
     
@@ -978,8 +1074,8 @@ CorotCrdTransf3d::getBasicTrialDisp (void)
 const Vector &
 CorotCrdTransf3d::getBasicIncrDeltaDisp (void)
 {
-    static Vector dub(6);
-    static Vector dul(7);
+    double dulData[7] = {0.0};
+    Vector dul(dulData, 7);
     
     // dul = ul - ulpr;
     dul = ul;
@@ -995,8 +1091,8 @@ CorotCrdTransf3d::getBasicIncrDeltaDisp (void)
 const Vector &
 CorotCrdTransf3d::getBasicIncrDisp(void)
 {
-    static Vector Dub(6);
-    static Vector Dul(7);
+    double DulData[7] = {0.0};
+    Vector Dul(DulData, 7);
     
     // Dul = ul - ulcommit;
     Dul = ul;
@@ -1038,14 +1134,14 @@ CorotCrdTransf3d::getGlobalResistingForce(const Vector &pb, const Vector &unifLo
     
     //   opserr << "basic forces: " << pb;  
     // transform resisting forces from the basic system to local coordinates
-    static Vector pl(7);
+    double plData[7] = {0.0};
+    Vector pl(plData, 7);
     pl.addMatrixTransposeVector(0.0, Tp, pb, 1.0);    // pl = Tp ^ pb;
     //opserr << "pl: " << pl;
     
     // check distributed load is zero (not implemented yet)
     
     // transform resisting forces  from local to global coordinates
-    static Vector pg(12);
     pg.addMatrixTransposeVector(0.0, T, pl, 1.0);   // pg = T ^ pl; residual
     //opserr << "pg: " << pg;
     
@@ -1068,29 +1164,51 @@ CorotCrdTransf3d::getGlobalStiffMatrix (const Matrix &kb, const Vector &pb)
     
     int i, j, k;   
     // transform tangent stiffness matrix from the basic system to local coordinates
-    static Matrix kl(7,7);
+    double klData[7*7] = {0.0};
+    Matrix kl(klData, 7,7);
     kl.addMatrixTripleProduct(0.0, Tp, kb, 1.0);      // kl = Tp ^ kb * Tp;
     
     // transform resisting forces from the basic system to local coordinates
-    static Vector pl(7);
+    double plData[7] = {0.0};
+    Vector pl(plData, 7);
     pl.addMatrixTransposeVector(0.0, Tp, pb, 1.0);    // pl = Tp ^ pb;
     
     // transform tangent  stiffness matrix from local to global coordinates
-    static Matrix kg(12,12);
     
     // compute the tangent stiffness matrix in global coordinates
     kg.addMatrixTripleProduct(0.0, T, kl, 1.0);
     
-    static Vector m(6);
+    double mData[6] = {0.0};
+    Vector m(mData, 6);
     for (i = 0; i < 6; i++)
         m(i) = pl(i)/(2*cos(ul(i)));
     
     // compute the basic rotations
     
-    static Vector e1(3), e2(3), e3(3);
-    static Vector r1(3), r2(3), r3(3);
-    static Vector rI1(3), rI2(3), rI3(3);
-    static Vector rJ1(3), rJ2(3), rJ3(3);
+    double e1Data[3] = {0.0};
+    Vector e1(e1Data, 3);
+    double e2Data[3] = {0.0};
+    Vector e2(e2Data, 3);
+    double e3Data[3] = {0.0};
+    Vector e3(e3Data, 3);
+    double r1Data[3] = {0.0};
+    Vector r1(r1Data, 3);
+    double r2Data[3] = {0.0};
+    Vector r2(r2Data, 3);
+    double r3Data[3] = {0.0};
+    Vector r3(r3Data, 3);
+    double rI1Data[3] = {0.0};
+    Vector rI1(rI1Data, 3);
+    double rI2Data[3] = {0.0};
+    Vector rI2(rI2Data, 3);
+    double rI3Data[3] = {0.0};
+    Vector rI3(rI3Data, 3);
+    double rJ1Data[3] = {0.0};
+    Vector rJ1(rJ1Data, 3);
+    double rJ2Data[3] = {0.0};
+    Vector rJ2(rJ2Data, 3);
+    double rJ3Data[3] = {0.0};
+    Vector rJ3(rJ3Data, 3);
     
     for (k = 0; k < 3; k ++)
     {
@@ -1117,21 +1235,36 @@ CorotCrdTransf3d::getGlobalStiffMatrix (const Matrix &kb, const Vector &pb)
     //        m(5)*ks2r2u1 + m(6)*ks2r3u1 + ...
     //        ks3 + ks3' + ks4 + ks5;
     
-    static Matrix Se1(3,3), Se2(3,3), Se3(3,3);
-    static Matrix SrI1(3,3), SrI2(3,3), SrI3(3,3);
-    static Matrix SrJ1(3,3), SrJ2(3,3), SrJ3(3,3);
-    
-    Se1 = this->getSkewSymMatrix(e1);
-    Se2 = this->getSkewSymMatrix(e2);
-    Se3 = this->getSkewSymMatrix(e3);
-    
-    SrJ1 = this->getSkewSymMatrix(rJ1);
-    SrJ2 = this->getSkewSymMatrix(rJ2);
-    SrJ3 = this->getSkewSymMatrix(rJ3);
-    
-    SrI1 = this->getSkewSymMatrix(rI1);
-    SrI2 = this->getSkewSymMatrix(rI2);
-    SrI3 = this->getSkewSymMatrix(rI3);
+    double Se1Data[3*3] = {0.0};
+    Matrix Se1(Se1Data, 3,3);
+    double Se2Data[3*3] = {0.0};
+    Matrix Se2(Se2Data, 3,3);
+    double Se3Data[3*3] = {0.0};
+    Matrix Se3(Se3Data, 3,3);
+    double SrI1Data[3*3] = {0.0};
+    Matrix SrI1(SrI1Data, 3,3);
+    double SrI2Data[3*3] = {0.0};
+    Matrix SrI2(SrI2Data, 3,3);
+    double SrI3Data[3*3] = {0.0};
+    Matrix SrI3(SrI3Data, 3,3);
+    double SrJ1Data[3*3] = {0.0};
+    Matrix SrJ1(SrJ1Data, 3,3);
+    double SrJ2Data[3*3] = {0.0};
+    Matrix SrJ2(SrJ2Data, 3,3);
+    double SrJ3Data[3*3] = {0.0};
+    Matrix SrJ3(SrJ3Data, 3,3);
+    
+    this->getSkewSymMatrix(e1, Se1);
+    this->getSkewSymMatrix(e2, Se2);
+    this->getSkewSymMatrix(e3, Se3);
+    
+    this->getSkewSymMatrix(rJ1, SrJ1);
+    this->getSkewSymMatrix(rJ2, SrJ2);
+    this->getSkewSymMatrix(rJ3, SrJ3);
+    
+    this->getSkewSymMatrix(rI1, SrI1);
+    this->getSkewSymMatrix(rI2, SrI2);
+    this->getSkewSymMatrix(rI3, SrI3);
     
     
     // ksigma1 -------------------------------
@@ -1159,8 +1292,10 @@ CorotCrdTransf3d::getGlobalStiffMatrix (const Matrix &kb, const Vector &pb)
     
     //     ks3 = [o kbar2 o kbar4];
     
-    static Matrix Sm(3,3);
-    static Matrix kbar(12,3);
+    double SmData[3*3] = {0.0};
+    Matrix Sm(SmData, 3,3);
+    double kbarData[12*3] = {0.0};
+    Matrix kbar(kbarData, 12,3);
     
     Sm.addMatrix(0.0, SrI3,  m(3));
     Sm.addMatrix(1.0, SrI1,  m(1));
@@ -1204,7 +1339,8 @@ CorotCrdTransf3d::getGlobalStiffMatrix (const Matrix &kb, const Vector &pb)
     //           O    O     O    O;
     //           O    O     O  Ks4_44];
     
-    static Matrix ks33(3,3);
+    double ks33Data[3*3] = {0.0};
+    Matrix ks33(ks33Data, 3,3);
     
     ks33.addMatrixProduct(0.0, Se2, SrI3,  m(3));
     ks33.addMatrixProduct(1.0, Se3, SrI2, -m(3));
@@ -1238,7 +1374,8 @@ CorotCrdTransf3d::getGlobalStiffMatrix (const Matrix &kb, const Vector &pb)
     //          Ks5_14t     O   -Ks5_14t   O];
     
     // v = (1/Ln)*(m(2)*rI2 + m(3)*rI3 + m(5)*rJ2 + m(6)*rJ3);
-    static Vector v(3);
+    double vData[3] = {0.0};
+    Vector v(vData, 3);
     v.addVector (0.0, rI2, m(1));
     v.addVector (1.0, rI3, m(2));
     v.addVector (1.0, rJ2, m(4));
@@ -1247,7 +1384,8 @@ CorotCrdTransf3d::getGlobalStiffMatrix (const Matrix &kb, const Vector &pb)
     v /= Ln;
     
     //Ks5_11 = A*v*e1' + e1*v'*A + (e1'*v)*A;
-    static Matrix m33(3,3);
+    double m33Data[3*3] = {0.0};
+    Matrix m33(m33Data, 3,3);
     double  e1tv = 0;   // dot product e1. v
     
     for (i = 0; i < 3; i++)
@@ -1297,25 +1435,34 @@ CorotCrdTransf3d::getGlobalStiffMatrix (const Matrix &kb, const Vector &pb)
             //opserr << "kg += ksigma5: " << kg;
             
             // Ksigma -------------------------------
-            static Vector rm(3);
+            double rmData[3] = {0.0};
+            Vector rm(rmData, 3);
+            double ks2Data[12*12];
+            Matrix ks2(ks2Data, 12,12);
             
             rm = rI3;
             rm.addVector (1.0, rJ3, -1.0); 
             //opserr << "ks2(r2,rI3-rJ3):\n "; 
-            kg.addMatrix (1.0, this->getKs2Matrix(r2, rm), m(3));
+            this->getKs2Matrix(r2, rm, ks2);
+            kg.addMatrix (1.0, ks2, m(3));
             
             rm = rJ2;
             rm.addVector (1.0, rI2, -1.0); 
             //opserr << "ks2(r3,rJ2-rI2):\n "; 
-            kg.addMatrix (1.0, this->getKs2Matrix(r3, rm), m(3));
+            this->getKs2Matrix(r3, rm, ks2);
+            kg.addMatrix (1.0, ks2, m(3));
             //opserr << "ks2(r2,rI1):\n "; 
-            kg.addMatrix (1.0, this->getKs2Matrix(r2, rI1), m(1));
+            this->getKs2Matrix(r2, rI1, ks2);
+            kg.addMatrix (1.0, ks2, m(1));
             //opserr << "ks2(r3,rI1):\n "; 
-            kg.addMatrix (1.0, this->getKs2Matrix(r3, rI1), m(2));
+            this->getKs2Matrix(r3, rI1, ks2);
+            kg.addMatrix (1.0, ks2, m(2));
             //opserr << "ks2(r2,rJ1):\n "; 
-            kg.addMatrix (1.0, this->getKs2Matrix(r2, rJ1), m(4));
+            this->getKs2Matrix(r2, rJ1, ks2);
+            kg.addMatrix (1.0, ks2, m(4));
             //opserr << "ks2(r3,rJ1):\n "; 
-            kg.addMatrix (1.0, this->getKs2Matrix(r3, rJ1), m(5));
+            this->getKs2Matrix(r3, rJ1, ks2);
+            kg.addMatrix (1.0, ks2, m(5));
             
             //opserr << "kg += ksigma2: " << kg;
             
@@ -1339,11 +1486,11 @@ const Matrix &
 CorotCrdTransf3d::getInitialGlobalStiffMatrix (const Matrix &kb)
 {
     // transform tangent stiffness matrix from the basic system to local coordinates
-    static Matrix kl(7,7);
+    double klData[7*7] = {0.0};
+    Matrix kl(klData, 7,7);
     kl.addMatrixTripleProduct(0.0, Tp, kb, 1.0);      // kl = Tp ^ kb * Tp;
     
     // transform tangent  stiffness matrix from local to global coordinates
-    static Matrix kg(12,12);
     
     // compute the tangent stiffness matrix in global coordinates
     kg.addMatrixTripleProduct(0.0, T, kl, 1.0);
@@ -1357,7 +1504,8 @@ CorotCrdTransf3d::getLocalAxes(Vector &XAxis, Vector &YAxis, Vector &ZAxis)
 {
     // element projection
     
-    static Vector dx(3);
+    double dxData[3] = {0.0};
+    Vector dx(dxData, 3);
     
     dx = (nodeJPtr->getCrds() + nodeJOffset) - (nodeIPtr->getCrds() + nodeIOffset);  
     if (nodeIInitialDisp != 0) {
@@ -1389,7 +1537,10 @@ CorotCrdTransf3d::getLocalAxes(Vector &XAxis, Vector &YAxis, Vector &ZAxis)
     XAxis(0) = xAxis(0);    XAxis(1) = xAxis(1);    XAxis(2) = xAxis(2);
     
     // calculate the cross-product y = v * x   
-    static Vector yAxis(3), zAxis(3);
+    double yAxisData[3] = {0.0};
+    Vector yAxis(yAxisData, 3);
+    double zAxisData[3] = {0.0};
+    Vector zAxis(zAxisData, 3);
     
     yAxis(0) = vAxis(1)*xAxis(2) - vAxis(2)*xAxis(1);
     yAxis(1) = vAxis(2)*xAxis(0) - vAxis(0)*xAxis(2);
@@ -1438,14 +1589,14 @@ CorotCrdTransf3d::getDeformedLength(void)
 }
 
 
-const Vector &
+Vector
 CorotCrdTransf3d::getQuaternionFromRotMatrix(const Matrix &R) const
 {
     // obtains the normalised quaternion from the rotation matrix
     int i, j, k;
     double trR;              // trace of R
     double a    ;
-    static Vector q(4);      // normalized quaternion
+    Vector q(4);             // normalized quaternion
     
     trR = R(0,0) + R(1,1) + R(2,2);    
     
@@ -1485,12 +1636,12 @@ CorotCrdTransf3d::getQuaternionFromRotMatrix(const Matrix &R) const
 }
 
 
-const Vector &
+Vector
 CorotCrdTransf3d::getQuaternionFromPseudoRotVector(const Vector  &theta) const
 {
     double t;                // norm of the pseudo rotation vector
     double factor;
-    static Vector q(4);      // normalized quaternion
+    Vector q(4);             // normalized quaternion
     
     t = theta.Norm();
     
@@ -1509,14 +1660,15 @@ CorotCrdTransf3d::getQuaternionFromPseudoRotVector(const Vector  &theta) const
 }
 
 
-const Vector &
+Vector
 CorotCrdTransf3d::quaternionProduct(const Vector &q1, const Vector &q2) const
 {
     
-    static Vector q12(4);
+    Vector q12(4);
     int i;
     double q1Tq2= 0;  // dot product
-    static Vector q1xq2(3);     // cross product
+    double q1xq2Data[3] = {0.0};
+    Vector q1xq2(q1xq2Data, 3);     // cross product
     
     // calculate the dot product q1.q2
     for (i = 0; i < 3; i++)       // NOTE i <3, not i<4
@@ -1537,15 +1689,18 @@ CorotCrdTransf3d::quaternionProduct(const Vector &q1, const Vector &q2) const
 }
 
 
-const Matrix &
+Matrix
 CorotCrdTransf3d::getRotationMatrixFromQuaternion(const Vector &q) const
 { 
     int i, j;
     double factor;
-    static Matrix I(3,3); // identity matrix
-    static Matrix qqT(3,3); 
-    static Matrix S(3,3);
-    static Matrix R(3,3);
+    double IData[3*3] = {0.0};
+    Matrix I(IData, 3,3); // identity matrix
+    double qqTData[3*3] = {0.0};
+    Matrix qqT(qqTData, 3,3); 
+    double SData[3*3] = {0.0};
+    Matrix S(SData, 3,3);
+    Matrix R(3,3);
     
     // R = (q0^2 - q' * q) * I + 2 * q * q' + 2*q0*S(q);
     
@@ -1557,7 +1712,7 @@ CorotCrdTransf3d::getRotationMatrixFromQuaternion(const Vector &q) const
             qqT(i,j) = q(i) * q(j);
         
         // get skew symmetric matrix	     
-        S = this->getSkewSymMatrix (q);
+        this->getSkewSymMatrix(q, S);
         
         R.Zero();
         
@@ -1571,10 +1726,10 @@ CorotCrdTransf3d::getRotationMatrixFromQuaternion(const Vector &q) const
 }
 
 
-const Vector &
+Vector
 CorotCrdTransf3d::getTangScaledPseudoVectorFromQuaternion(const Vector &q) const
 { 
-    static Vector w(3);
+    Vector w(3);
     
     for (int i = 0; i < 3; i++)
         w(i) = 2.0 * q(i)/q(3);
@@ -1583,16 +1738,18 @@ CorotCrdTransf3d::getTangScaledPseudoVectorFromQuaternion(const Vector &q) const
 }
 
 
-const Matrix &
+Matrix
 CorotCrdTransf3d::getRotMatrixFromTangScaledPseudoVector(const Vector &w) const
 { 
     // Rotation matrix in terms of the tangent-scaled pseudo-vector
-    static Matrix S(3,3);
-    static Matrix S2(3,3);
-    static Matrix R(3,3);
+    double SData[3*3] = {0.0};
+    Matrix S(SData, 3,3);
+    double S2Data[3*3] = {0.0};
+    Matrix S2(S2Data, 3,3);
+    Matrix R(3,3);
     double normw2;
     
-    S = this->getSkewSymMatrix(w);
+    this->getSkewSymMatrix(w, S);
     
     // R = I + (S + S*S/2)/(1 + w' * w / 4);
     
@@ -1612,11 +1769,9 @@ CorotCrdTransf3d::getRotMatrixFromTangScaledPseudoVector(const Vector &w) const
 }
 
 
-const Matrix &
-CorotCrdTransf3d::getSkewSymMatrix (const Vector &theta) const
+void
+CorotCrdTransf3d::getSkewSymMatrix (const Vector &theta, Matrix &S) const
 {
-    static Matrix S(3,3);
-    
     //  St = [   0       -theta(2)  theta(1);
     //         theta(2)     0      -theta(0);
     //        -theta(1)   theta(0)      0   ];
@@ -1636,21 +1791,30 @@ CorotCrdTransf3d::getSkewSymMatrix (const Vector &theta) const
     //opserr << "getSkew  theta: " << theta;
     //opserr << "getSkew  S: " << S;
     
-    return S;
+    return;
 }   
 
 
-const Matrix &
-CorotCrdTransf3d::getLMatrix (const Vector &ri) const
+void
+CorotCrdTransf3d::getLMatrix (const Vector &ri, Matrix &L) const
 {
-    static Matrix L1(3,3), L2(3,3);
-    static Vector r1(3), e1(3);
+    double L1Data[3*3] = {0.0};
+    Matrix L1(L1Data, 3,3);
+    double L2Data[3*3] = {0.0};
+    Matrix L2(L2Data, 3,3);
+    double r1Data[3] = {0.0};
+    Vector r1(r1Data, 3);
+    double e1Data[3] = {0.0};
+    Vector e1(e1Data, 3);
     double rie1, e1r1k;
-    static Matrix rie1r1(3,3);
-    static Matrix e1e1r1(3,3);
-    static Matrix Sri(3,3);
-    static Matrix Sr1(3,3);
-    static Matrix L(12,3);
+    double rie1r1Data[3*3] = {0.0};
+    Matrix rie1r1(rie1r1Data, 3,3);
+    double e1e1r1Data[3*3] = {0.0};
+    Matrix e1e1r1(e1e1r1Data, 3,3);
+    double SriData[3*3] = {0.0};
+    Matrix Sri(SriData, 3,3);
+    double Sr1Data[3*3] = {0.0};
+    Matrix Sr1(Sr1Data, 3,3);
     
     int j, k;
     
@@ -1685,8 +1849,8 @@ CorotCrdTransf3d::getLMatrix (const Vector &ri) const
     
     //opserr << "L1: " << L1;
     
-    Sri = this->getSkewSymMatrix(ri);       // Change ??????????????????????
-    Sr1 = this->getSkewSymMatrix(r1);       // Change ??????????????????????
+    this->getSkewSymMatrix(ri, Sri);       // Change ??????????????????????
+    this->getSkewSymMatrix(r1, Sr1);       // Change ??????????????????????
     
     // L2  = Sri/2 - ri'*e1*S(r1)/4 - Sri*e1*(e1 + r1)'/4;
     L2.addMatrix (0.0, Sri, 0.5);
@@ -1708,15 +1872,17 @@ CorotCrdTransf3d::getLMatrix (const Vector &ri) const
     
     //opserr << "L: " << L;
     
-    return L;
+    return;
 }
 
 
-const Matrix &
-CorotCrdTransf3d::getKs2Matrix (const Vector &ri, const Vector &z) const
+void
+CorotCrdTransf3d::getKs2Matrix (const Vector &ri, const Vector &z, Matrix &ks2) const
 {
-    static Matrix ks2(12,12);
-    static Vector e1(3), r1(3);
+    double e1Data[3] = {0.0};
+    Vector e1(e1Data, 3);
+    double r1Data[3] = {0.0};
+    Vector r1(r1Data, 3);
     
     //opserr << "\ngetKs2Matrix:\n";
     //opserr << "ri: " << ri;
@@ -1745,9 +1911,18 @@ CorotCrdTransf3d::getKs2Matrix (const Vector &ri, const Vector &z) const
         ztr1  += z(i)*r1(i);
     }
     
-    static Matrix zrit(3,3), ze1t(3,3);
-    static Matrix rizt(3,3), r1e1t(3,3), rie1t(3,3);
-    static Matrix e1zt(3,3);
+    double zritData[3*3] = {0.0};
+    Matrix zrit(zritData, 3,3);
+    double ze1tData[3*3] = {0.0};
+    Matrix ze1t(ze1tData, 3,3);
+    double riztData[3*3] = {0.0};
+    Matrix rizt(riztData, 3,3);
+    double r1e1tData[3*3] = {0.0};
+    Matrix r1e1t(r1e1tData, 3,3);
+    double rie1tData[3*3] = {0.0};
+    Matrix rie1t(rie1tData, 3,3);
+    double e1ztData[3*3] = {0.0};
+    Matrix e1zt(e1ztData, 3,3);
     
     for (i = 0; i < 3; i++)
         for (j = 0; j < 3; j++)
@@ -1760,7 +1935,8 @@ CorotCrdTransf3d::getKs2Matrix (const Vector &ri, const Vector &z) const
             rie1t(i,j) = ri(i)*e1(j);
         }
         
-        static Matrix U(3,3);
+        double UData[3*3] = {0.0};
+        Matrix U(UData, 3,3);
         //opserr << " rite1: "<< rite1;
         //opserr << " zte1: "<< zte1;
         //opserr << " ztr1: "<< ztr1;
@@ -1780,7 +1956,8 @@ CorotCrdTransf3d::getKs2Matrix (const Vector &ri, const Vector &z) const
         U.addMatrixProduct (1.0, A, rie1t, (zte1 + ztr1)/(2*Ln));
         
         //opserr << "U: " << U;
-        static Matrix ks(3,3);
+        double ksData[3*3] = {0.0};
+        Matrix ks(ksData, 3,3);
         
         //K11 = U + U' + ri'*e1*(2*(e1'*z)+z'*r1)*A/(2*Ln);
         
@@ -1802,16 +1979,24 @@ CorotCrdTransf3d::getKs2Matrix (const Vector &ri, const Vector &z) const
             ks2.Assemble(ks, 6, 0, -1.0);
             ks2.Assemble(ks, 6, 6,  1.0);
             
-            static Matrix Sri(3,3), Sr1(3,3), Sz(3,3), Se1(3,3);
+            double SriData[3*3] = {0.0};
+            Matrix Sri(SriData, 3,3);
+            double Sr1Data[3*3] = {0.0};
+            Matrix Sr1(Sr1Data, 3,3);
+            double SzData[3*3] = {0.0};
+            Matrix Sz(SzData, 3,3);
+            double Se1Data[3*3] = {0.0};
+            Matrix Se1(Se1Data, 3,3);
             
-            Sri = this->getSkewSymMatrix(ri);  
-            Sr1 = this->getSkewSymMatrix(r1);
-            Sz  = this->getSkewSymMatrix(z); 
-            Se1 = this->getSkewSymMatrix(e1); 
+            this->getSkewSymMatrix(ri, Sri);  
+            this->getSkewSymMatrix(r1, Sr1);
+            this->getSkewSymMatrix(z, Sz); 
+            this->getSkewSymMatrix(e1, Se1); 
             
             //K12 = (1/4)*(-A*z*e1'*Sri - A*ri*z'*Sr1 - z'*(e1+r1)*A*Sri);
             
-            static Matrix m1(3,3);
+            double m1Data[3*3] = {0.0};
+            Matrix m1(m1Data, 3,3);
             
             m1.addMatrixProduct(0.0, A, ze1t, -1.0);
             ks.addMatrixProduct(0.0, m1, Sri, 0.25);
@@ -1859,7 +2044,7 @@ CorotCrdTransf3d::getKs2Matrix (const Vector &ri, const Vector &z) const
             ks2.Assemble(ks, 9, 3, 1.0);
             ks2.Assemble(ks, 9, 9, 1.0);
             
-            return ks2;
+            return;
 }
 
 
@@ -84,15 +84,15 @@ public:
 private:
     void compTransfMatrixBasicGlobal(void);
     void compTransfMatrixBasicGlobalNew(void);
-    const Vector &getQuaternionFromRotMatrix(const Matrix &RotMatrix) const;
-    const Vector &getQuaternionFromPseudoRotVector(const Vector &theta) const;
-    const Vector &getTangScaledPseudoVectorFromQuaternion(const Vector &theta) const;
-    const Vector &quaternionProduct(const Vector &q1, const Vector &q2) const;
-    const Matrix &getRotationMatrixFromQuaternion(const Vector &q) const;
-    const Matrix &getRotMatrixFromTangScaledPseudoVector(const Vector &w) const;
-    const Matrix &getSkewSymMatrix(const Vector &theta) const;
-    const Matrix &getLMatrix(const Vector &ri) const;
-    const Matrix &getKs2Matrix(const Vector &ri, const Vector &z) const;
+    Vector getQuaternionFromRotMatrix(const Matrix &RotMatrix) const;
+    Vector getQuaternionFromPseudoRotVector(const Vector &theta) const;
+    Vector getTangScaledPseudoVectorFromQuaternion(const Vector &theta) const;
+    Vector quaternionProduct(const Vector &q1, const Vector &q2) const;
+    Matrix getRotationMatrixFromQuaternion(const Vector &q) const;
+    Matrix getRotMatrixFromTangScaledPseudoVector(const Vector &w) const;
+    void getSkewSymMatrix(const Vector &theta, Matrix &S) const;
+    void getLMatrix(const Vector &ri, Matrix &L) const;
+    void getKs2Matrix(const Vector &ri, const Vector &z, Matrix &ks2) const;
     
     // internal data
     Node *nodeIPtr, *nodeJPtr;  // pointers to the element two endnodes
@@ -118,13 +118,18 @@ private:
     Vector ulcommit;            // commited local displacements
     Vector ulpr;                // previous local displacements
     
-    static Matrix RI;           // nodal triad for node 1
-    static Matrix RJ;           // nodal triad for node 2
-    static Matrix Rbar;         // mean nodal triad 
-    static Matrix e;            // base vectors
+    Matrix RI;                  // nodal triad for node 1
+    Matrix RJ;                  // nodal triad for node 2
+    Matrix Rbar;                // mean nodal triad 
+    Matrix e;                   // base vectors
+    Matrix T;                   // transformation matrix from basic to global system
+    Matrix Lr2, Lr3, A;         // auxiliary matrices	
+    
+    Vector ub, dub, Dub;        // basic displacements returned to the element
+    Vector pg;                  // global resisting forces returned to the element
+    Matrix kg;                  // global stiffness returned to the element
+    
     static Matrix Tp;           // transformation matrix to renumber dofs
-    static Matrix T;            // transformation matrix from basic to global system
-    static Matrix Lr2, Lr3, A;  // auxiliary matrices	
     
     double *nodeIInitialDisp, *nodeJInitialDisp;
     bool initialDispChecked;
@@ -0,0 +1,476 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// Description: This file contains the class implementation for 
+// MemoryDatastore. A MemoryDatastore object is used in the program to
+// store/restore the state of a domain in memory.
+//
+// What: "@(#) MemoryDatastore.C, revA"
+
+#include "MemoryDatastore.h"
+
+#include <string.h>
+#include <stdlib.h>
+
+#include <FEM_ObjectBroker.h>
+#include <Domain.h>
+#include <Node.h>
+#include <NodeIter.h>
+#include <Element.h>
+#include <ElementIter.h>
+#include <SP_Constraint.h>
+#include <SP_ConstraintIter.h>
+#include <MP_Constraint.h>
+#include <MP_ConstraintIter.h>
+#include <LoadPattern.h>
+#include <LoadPatternIter.h>
+#include <Parameter.h>
+#include <ParameterIter.h>
+#include <ID.h>
+#include <Vector.h>
+#include <Matrix.h>
+
+
+MemoryDatastore::MemoryDatastore(Domain &theDomain, 
+				 FEM_ObjectBroker &theObjBroker) 
+  :FE_Datastore(theDomain, theObjBroker), theDomain(&theDomain), theBroker(&theObjBroker),
+   activeArena(0)
+{
+
+}
+
+MemoryDatastore::~MemoryDatastore() 
+{
+  MAP_ARENAS_ITERATOR arenaIter = theArenas.begin();
+  while (arenaIter != theArenas.end()) {
+    MemoryDatastoreArena *theArena = arenaIter->second;
+    if (theArena->ints != 0)
+      delete [] theArena->ints;
+    if (theArena->doubles != 0)
+      delete [] theArena->doubles;
+    delete theArena;
+    arenaIter++;
+  }
+}
+
+
+int 
+MemoryDatastore::sendMsg(int dataTag, int commitTag, 
+			 const Message &, 
+			 ChannelAddress *theAddress)
+{
+  opserr << "MemoryDatastore::sendMsg() - not yet implemented\n";
+  return -1;
+}		       
+
+int 
+MemoryDatastore::recvMsg(int dataTag, int commitTag, 
+			 Message &, 
+			 ChannelAddress *theAddress)
+{
+  opserr << "MemoryDatastore::recvMsg() - not yet implemented\n";
+  return -1;
+}		       
+
+int 
+MemoryDatastore::recvMsgUnknownSize(int dataTag, int commitTag, 
+				    Message &, 
+				    ChannelAddress *theAddress)
+{
+  opserr << "MemoryDatastore::recvMsgUnknownSize() - not yet implemented\n";
+  return -1;
+}		       
+
+
+int 
+MemoryDatastore::sendMatrix(int dbTag, int commitTag, 
+			    const Matrix &theMatrix, 
+			    ChannelAddress *theAddress)
+{
+  MemoryDatastoreArena *theArena = activeArena;
+  if (theArena == 0) {
+    opserr << "MemoryDatastore::sendMatrix() - no state is being stored\n";
+    return -1;
+  }
+
+  return this->storeDoubles(theArena, theArena->theMatrices, dbTag, 
+			    theMatrix.data, theMatrix.dataSize);
+}		       
+
+int 
+MemoryDatastore::recvMatrix(int dbTag, int commitTag, 
+			    Matrix &theMatrix, 
+			    ChannelAddress *theAddress)
+{
+  MemoryDatastoreArena *theArena = activeArena;
+  if (theArena == 0) {
+    opserr << "MemoryDatastore::recvMatrix() - no state is being restored\n";
+    return -1;
+  }
+
+  MAP_OFFSETS_ITERATOR theEntry = 
+    theArena->theMatrices.find(MEMORY_KEY(dbTag, theMatrix.dataSize));
+  if (theEntry == theArena->theMatrices.end()) {
+    opserr << "MemoryDatastore::recvMatrix() - no matrix with dbTag " << dbTag;
+    opserr << " stored for the state\n";
+    return -2;
+  }
+
+  memcpy(theMatrix.data, &(theArena->doubles[theEntry->second]), 
+	 theMatrix.dataSize*sizeof(double));
+
+  return 0;
+}		       
+
+
+int 
+MemoryDatastore::sendVector(int dbTag, int commitTag, 
+			    const Vector &theVector, 
+			    ChannelAddress *theAddress)
+{
+  MemoryDatastoreArena *theArena = activeArena;
+  if (theArena == 0) {
+    opserr << "MemoryDatastore::sendVector() - no state is being stored\n";
+    return -1;
+  }
+
+  return this->storeDoubles(theArena, theArena->theVectors, dbTag, 
+			    theVector.theData, theVector.sz);
+}		       
+
+int 
+MemoryDatastore::recvVector(int dbTag, int commitTag, 
+			    Vector &theVector, 
+			    ChannelAddress *theAddress)
+{
+  MemoryDatastoreArena *theArena = activeArena;
+  if (theArena == 0) {
+    opserr << "MemoryDatastore::recvVector() - no state is being restored\n";
+    return -1;
+  }
+
+  MAP_OFFSETS_ITERATOR theEntry = 
+    theArena->theVectors.find(MEMORY_KEY(dbTag, theVector.sz));
+  if (theEntry == theArena->theVectors.end()) {
+    opserr << "MemoryDatastore::recvVector() - no vector with dbTag " << dbTag;
+    opserr << " stored for the state\n";
+    return -2;
+  }
+
+  memcpy(theVector.theData, &(theArena->doubles[theEntry->second]), 
+	 theVector.sz*sizeof(double));
+
+  return 0;
+}		       
+
+
+int 
+MemoryDatastore::sendID(int dbTag, int commitTag, 
+			const ID &theID, 
+			ChannelAddress *theAddress)
+{
+  MemoryDatastoreArena *theArena = activeArena;
+  if (theArena == 0) {
+    opserr << "MemoryDatastore::sendID() - no state is being stored\n";
+    return -1;
+  }
+
+  return this->storeInts(theArena, dbTag, theID.data, theID.sz);
+}		       
+
+int 
+MemoryDatastore::recvID(int dbTag, int commitTag, 
+			ID &theID, 
+			ChannelAddress *theAddress)
+{
+  MemoryDatastoreArena *theArena = activeArena;
+  if (theArena == 0) {
+    opserr << "MemoryDatastore::recvID() - no state is being restored\n";
+    return -1;
+  }
+
+  MAP_OFFSETS_ITERATOR theEntry = 
+    theArena->theIDs.find(MEMORY_KEY(dbTag, theID.sz));
+  if (theEntry == theArena->theIDs.end()) {
+    opserr << "MemoryDatastore::recvID() - no ID with dbTag " << dbTag;
+    opserr << " stored for the state\n";
+    return -2;
+  }
+
+  memcpy(theID.data, &(theArena->ints[theEntry->second]), theID.sz*sizeof(int));
+
+  return 0;
+}		       
+
+
+// stores the committed state of the domain in the arena for commitTag;
+// the commitTag of the domain is left as it was
+int
+MemoryDatastore::commitState(int commitTag)
+{
+  MemoryDatastoreArena *theArena = this->getArena(commitTag, true);
+  if (theArena == 0)
+    return -1;
+
+  int domainCommitTag = theDomain->getCommitTag();
+  theArena->geoTag = theDomain->hasDomainChanged();
+  theArena->committedTime = theDomain->getCommittedTime();
+
+  activeArena = theArena;
+  int res = theDomain->sendSelf(commitTag, *this);
+  activeArena = 0;
+
+  theDomain->setCommitTag(domainCommitTag);
+
+  if (res < 0) {
+    opserr << "MemoryDatastore::commitState() - domain failed to sendSelf\n";
+    this->dropState(commitTag);
+    return res;
+  }
+
+  return 0;
+}
+
+
+// restores the committed state of the components of the domain from the
+// arena for commitTag; unlike Domain::recvSelf() the domain is never
+// rebuilt, so the objects the analysis holds stay valid
+int
+MemoryDatastore::restoreState(int commitTag)
+{
+  MemoryDatastoreArena *theArena = this->getArena(commitTag, false);
+  if (theArena == 0) {
+    opserr << "MemoryDatastore::restoreState() - nothing stored for commitTag " << commitTag << endln;
+    return -1;
+  }
+
+  if (theDomain->hasDomainChanged() != theArena->geoTag) {
+    opserr << "MemoryDatastore::restoreState() - the domain has changed since the state ";
+    opserr << commitTag << " was stored\n";
+    return -2;
+  }
+
+  int res = 0;
+  activeArena = theArena;
+
+  Node *theNode;
+  NodeIter &theNodes = theDomain->getNodes();
+  while (res == 0 && (theNode = theNodes()) != 0)
+    if (theNode->recvSelf(commitTag, *this, *theBroker) < 0) {
+      opserr << "MemoryDatastore::restoreState() - node " << theNode->getTag() << " failed in recvSelf\n";
+      res = -3;
+    }
+
+  Element *theEle;
+  ElementIter &theElements = theDomain->getElements();
+  while (res == 0 && (theEle = theElements()) != 0)
+    if (theEle->recvSelf(commitTag, *this, *theBroker) < 0) {
+      opserr << "MemoryDatastore::restoreState() - element " << theEle->getTag() << " failed in recvSelf\n";
+      res = -4;
+    }
+
+  SP_Constraint *theSP;
+  SP_ConstraintIter &theSPs = theDomain->getSPs();
+  while (res == 0 && (theSP = theSPs()) != 0)
+    if (theSP->recvSelf(commitTag, *this, *theBroker) < 0) {
+      opserr << "MemoryDatastore::restoreState() - SP_Constraint " << theSP->getTag() << " failed in recvSelf\n";
+      res = -5;
+    }
+
+  MP_Constraint *theMP;
+  MP_ConstraintIter &theMPs = theDomain->getMPs();
+  while (res == 0 && (theMP = theMPs()) != 0)
+    if (theMP->recvSelf(commitTag, *this, *theBroker) < 0) {
+      opserr << "MemoryDatastore::restoreState() - MP_Constraint " << theMP->getTag() << " failed in recvSelf\n";
+      res = -6;
+    }
+
+  LoadPattern *theLP;
+  LoadPatternIter &theLPs = theDomain->getLoadPatterns();
+  while (res == 0 && (theLP = theLPs()) != 0)
+    if (theLP->recvSelf(commitTag, *this, *theBroker) < 0) {
+      opserr << "MemoryDatastore::restoreState() - LoadPattern " << theLP->getTag() << " failed in recvSelf\n";
+      res = -7;
+    }
+
+  Parameter *theParam;
+  ParameterIter &theParams = theDomain->getParameters();
+  while (res == 0 && (theParam = theParams()) != 0)
+    if (theParam->recvSelf(commitTag, *this, *theBroker) < 0) {
+      opserr << "MemoryDatastore::restoreState() - Parameter " << theParam->getTag() << " failed in recvSelf\n";
+      res = -8;
+    }
+
+  activeArena = 0;
+
+  if (res == 0) {
+    theDomain->setCommittedTime(theArena->committedTime);
+    theDomain->setCurrentTime(theArena->committedTime);
+  }
+
+  return res;
+}
+
+
+bool
+MemoryDatastore::hasState(int commitTag)
+{
+  return (theArenas.find(commitTag) != theArenas.end());
+}
+
+
+int
+MemoryDatastore::dropState(int commitTag)
+{
+  MAP_ARENAS_ITERATOR arenaIter = theArenas.find(commitTag);
+  if (arenaIter == theArenas.end()) {
+    opserr << "MemoryDatastore::dropState() - nothing stored for commitTag " << commitTag << endln;
+    return -1;
+  }
+
+  MemoryDatastoreArena *theArena = arenaIter->second;
+  if (theArena->ints != 0)
+    delete [] theArena->ints;
+  if (theArena->doubles != 0)
+    delete [] theArena->doubles;
+  delete theArena;
+
+  theArenas.erase(arenaIter);
+
+  return 0;
+}
+
+
+int
+MemoryDatastore::getNumBytes(int commitTag)
+{
+  MemoryDatastoreArena *theArena = this->getArena(commitTag, false);
+  if (theArena == 0)
+    return 0;
+
+  return theArena->numInts*sizeof(int) + theArena->numDoubles*sizeof(double);
+}
+
+
+MemoryDatastoreArena *
+MemoryDatastore::getArena(int commitTag, bool create)
+{
+  MAP_ARENAS_ITERATOR arenaIter = theArenas.find(commitTag);
+  if (arenaIter != theArenas.end())
+    return arenaIter->second;
+
+  if (create == false)
+    return 0;
+
+  MemoryDatastoreArena *theArena = new MemoryDatastoreArena;
+  if (theArena == 0) {
+    opserr << "MemoryDatastore::getArena() - out of memory\n";
+    return 0;
+  }
+
+  theArena->geoTag = -1;
+  theArena->committedTime = 0.0;
+  theArena->ints = 0;
+  theArena->numInts = 0;
+  theArena->maxInts = 0;
+  theArena->doubles = 0;
+  theArena->numDoubles = 0;
+  theArena->maxDoubles = 0;
+
+  theArenas.insert(MAP_ARENAS_TYPE(commitTag, theArena));
+
+  return theArena;
+}
+
+
+int
+MemoryDatastore::storeDoubles(MemoryDatastoreArena *theArena, MAP_OFFSETS &theOffsets,
+			      int dbTag, const double *data, int size)
+{
+  // if already stored the data is simply overwritten
+  MAP_OFFSETS_ITERATOR theEntry = theOffsets.find(MEMORY_KEY(dbTag, size));
+  if (theEntry != theOffsets.end()) {
+    memcpy(&(theArena->doubles[theEntry->second]), data, size*sizeof(double));
+    return 0;
+  }
+
+  // otherwise append it to the arena, growing the arena if needed
+  int numDoubles = theArena->numDoubles;
+  if (numDoubles + size > theArena->maxDoubles) {
+    int newMax = 2*theArena->maxDoubles;
+    if (newMax < numDoubles + size)
+      newMax = numDoubles + size + 1024;
+    double *newDoubles = new double[newMax];
+    if (newDoubles == 0) {
+      opserr << "MemoryDatastore::storeDoubles() - out of memory\n";
+      return -2;
+    }
+    if (theArena->doubles != 0) {
+      memcpy(newDoubles, theArena->doubles, numDoubles*sizeof(double));
+      delete [] theArena->doubles;
+    }
+    theArena->doubles = newDoubles;
+    theArena->maxDoubles = newMax;
+  }
+
+  memcpy(&(theArena->doubles[numDoubles]), data, size*sizeof(double));
+  theOffsets.insert(MAP_OFFSETS_TYPE(MEMORY_KEY(dbTag, size), numDoubles));
+  theArena->numDoubles = numDoubles + size;
+
+  return 0;
+}
+
+
+int
+MemoryDatastore::storeInts(MemoryDatastoreArena *theArena, 
+			   int dbTag, const int *data, int size)
+{
+  // if already stored the data is simply overwritten
+  MAP_OFFSETS_ITERATOR theEntry = theArena->theIDs.find(MEMORY_KEY(dbTag, size));
+  if (theEntry != theArena->theIDs.end()) {
+    memcpy(&(theArena->ints[theEntry->second]), data, size*sizeof(int));
+    return 0;
+  }
+
+  // otherwise append it to the arena, growing the arena if needed
+  int numInts = theArena->numInts;
+  if (numInts + size > theArena->maxInts) {
+    int newMax = 2*theArena->maxInts;
+    if (newMax < numInts + size)
+      newMax = numInts + size + 1024;
+    int *newInts = new int[newMax];
+    if (newInts == 0) {
+      opserr << "MemoryDatastore::storeInts() - out of memory\n";
+      return -2;
+    }
+    if (theArena->ints != 0) {
+      memcpy(newInts, theArena->ints, numInts*sizeof(int));
+      delete [] theArena->ints;
+    }
+    theArena->ints = newInts;
+    theArena->maxInts = newMax;
+  }
+
+  memcpy(&(theArena->ints[numInts]), data, size*sizeof(int));
+  theArena->theIDs.insert(MAP_OFFSETS_TYPE(MEMORY_KEY(dbTag, size), numInts));
+  theArena->numInts = numInts + size;
+
+  return 0;
+}
@@ -0,0 +1,134 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+#ifndef MemoryDatastore_h
+#define MemoryDatastore_h
+
+// Description: This file contains the class definition for MemoryDatastore.
+// MemoryDatastore is a concrete subclass of FE_Datastore. A MemoryDatastore 
+// object is used in the program to store/restore the state of a domain
+// in memory, i.e. to take snapshots of the committed state that can later
+// be restored. The data for each snapshot is held in its own arena, keyed
+// by the tag given to commitState(), so that any number of snapshots can
+// coexist and each can be dropped. Everything the domain sends during a
+// commitState(), including the geometry it sends under its own stamp, goes
+// into the arena of that snapshot. Storing a snapshot again under the same
+// tag overwrites its data in place. restoreState() only restores the
+// committed state of the components in the domain; it fails if the domain
+// has changed since the snapshot was taken, it never rebuilds the domain.
+//
+// What: "@(#) MemoryDatastore.h, revA"
+
+#include <FE_Datastore.h>
+
+#include <map>
+#include <utility>
+using std::map;
+using std::pair;
+
+class FEM_ObjectBroker;
+
+// objects are located in an arena by their dbTag and size
+typedef pair<int, int>                           MEMORY_KEY;
+typedef map<MEMORY_KEY, int>                     MAP_OFFSETS;
+typedef MAP_OFFSETS::value_type                  MAP_OFFSETS_TYPE;
+typedef MAP_OFFSETS::iterator                    MAP_OFFSETS_ITERATOR;
+
+typedef struct memoryDatastoreArena {
+  int geoTag;               // domain change stamp when the state was stored
+  double committedTime;
+  MAP_OFFSETS theIDs;       // offsets into ints
+  MAP_OFFSETS theVectors;   // offsets into doubles
+  MAP_OFFSETS theMatrices;  // offsets into doubles
+  int *ints;
+  int numInts;
+  int maxInts;
+  double *doubles;
+  int numDoubles;
+  int maxDoubles;
+} MemoryDatastoreArena;
+
+typedef map<int, MemoryDatastoreArena *>         MAP_ARENAS;
+typedef MAP_ARENAS::value_type                   MAP_ARENAS_TYPE;
+typedef MAP_ARENAS::iterator                     MAP_ARENAS_ITERATOR;
+
+class MemoryDatastore: public FE_Datastore
+{
+  public:
+    MemoryDatastore(Domain &theDomain, 
+		    FEM_ObjectBroker &theBroker);    
+    
+    ~MemoryDatastore();
+
+    // methods for sending and receiving the data
+    int sendMsg(int dbTag, int commitTag, 
+		const Message &, 
+		ChannelAddress *theAddress =0);    
+    int recvMsg(int dbTag, int commitTag, 
+		Message &, 
+		ChannelAddress *theAddress =0);        
+    int recvMsgUnknownSize(int dbTag, int commitTag, 
+		Message &, 
+		ChannelAddress *theAddress =0);        
+
+    int sendMatrix(int dbTag, int commitTag, 
+		   const Matrix &theMatrix, 
+		   ChannelAddress *theAddress =0);
+    int recvMatrix(int dbTag, int commitTag, 
+		   Matrix &theMatrix, 
+		   ChannelAddress *theAddress =0);
+    
+    int sendVector(int dbTag, int commitTag, 
+		   const Vector &theVector, 
+		   ChannelAddress *theAddress =0);
+    int recvVector(int dbTag, int commitTag, 
+		   Vector &theVector, 
+		   ChannelAddress *theAddress =0);
+    
+    int sendID(int dbTag, int commitTag,
+	       const ID &theID,
+	       ChannelAddress *theAddress =0);
+    int recvID(int dbTag, int commitTag,
+	       ID &theID,
+	       ChannelAddress *theAddress =0);
+
+    int commitState(int commitTag);
+    int restoreState(int commitTag);
+
+    // methods to query and release the data stored for a commitTag
+    bool hasState(int commitTag);
+    int dropState(int commitTag);
+    int getNumBytes(int commitTag);
+    
+  protected:
+
+  private:
+    MemoryDatastoreArena *getArena(int commitTag, bool create);
+    int storeDoubles(MemoryDatastoreArena *, MAP_OFFSETS &, int dbTag,
+		     const double *data, int size);
+    int storeInts(MemoryDatastoreArena *, int dbTag, const int *data, int size);
+
+    Domain *theDomain;
+    FEM_ObjectBroker *theBroker;
+    MAP_ARENAS theArenas;
+    MemoryDatastoreArena *activeArena;  // arena of the state being stored or restored
+};
+
+#endif
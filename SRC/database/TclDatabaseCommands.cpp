@@ -77,6 +77,7 @@ int
 restore(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 
 extern FE_Datastore *theDatabase;
+extern void clearResponseHandles(int eleTag);
 
 int
 TclAddDatabase(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv, 
@@ -231,6 +232,9 @@ restore(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
       return TCL_OK;	
     }	
 
+    // the elements may be replaced, the response handles are no longer valid
+    clearResponseHandles(-1);
+
     if (theDatabase->restoreState(commitTag) < 0) {
       opserr << "WARNING - database failed to restoreState \n";
       return TCL_ERROR;
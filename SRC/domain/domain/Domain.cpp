@@ -68,6 +68,7 @@
 #include <Analysis.h>
 #include <FE_Datastore.h>
 #include <FEM_ObjectBroker.h>
+#include <Profiler.h>
 
 Domain       *ops_TheActiveDomain = 0;
 
@@ -79,7 +80,13 @@ Domain::Domain()
  eleGraphBuiltFlag(false),  nodeGraphBuiltFlag(false), theNodeGraph(0), 
  theElementGraph(0), 
  theRegions(0), numRegions(0), commitTag(0),
- theBounds(6), theEigenvalues(0), theEigenvalueSetTime(0), lastChannel(0)
+ theBounds(6), theEigenvalues(0), theEigenvalueSetTime(0), lastChannel(0),
+ reactionIndexBuiltFlag(false), numReactionNodes(0), numReactionEles(0),
+ reactionNodes(0), reactionEles(0), reactionNodeTags(0), 
+ reactionNodeEleStart(0), reactionNodeEles(0), 
+ reactionEleNodeStart(0), reactionEleNodes(0), reactionEleNodeOffsets(0),
+ reactionNodeStamp(0), reactionNodeFlag(0), reactionNodeMark(0), 
+ reactionEleMark(0), reactionEleList(0), reactionStamp(0), reactionPass(0)
 {
   
     // init the arrays for storing the domain components
@@ -129,7 +136,13 @@ Domain::Domain(int numNodes, int numElements, int numSPs, int numMPs,
  eleGraphBuiltFlag(false), nodeGraphBuiltFlag(false), theNodeGraph(0), 
  theElementGraph(0),
  theRegions(0), numRegions(0), commitTag(0),
- theBounds(6), theEigenvalues(0), theEigenvalueSetTime(0), lastChannel(0)
+ theBounds(6), theEigenvalues(0), theEigenvalueSetTime(0), lastChannel(0),
+ reactionIndexBuiltFlag(false), numReactionNodes(0), numReactionEles(0),
+ reactionNodes(0), reactionEles(0), reactionNodeTags(0), 
+ reactionNodeEleStart(0), reactionNodeEles(0), 
+ reactionEleNodeStart(0), reactionEleNodes(0), reactionEleNodeOffsets(0),
+ reactionNodeStamp(0), reactionNodeFlag(0), reactionNodeMark(0), 
+ reactionEleMark(0), reactionEleList(0), reactionStamp(0), reactionPass(0)
 {
     // init the arrays for storing the domain components
     theElements = new MapOfTaggedObjects();
@@ -185,7 +198,13 @@ Domain::Domain(TaggedObjectStorage &theNodesStorage,
  theMPs(&theMPsStorage), 
  theLoadPatterns(&theLoadPatternsStorage),
  theRegions(0), numRegions(0), commitTag(0),
- theBounds(6), theEigenvalues(0), theEigenvalueSetTime(0), lastChannel(0)
+ theBounds(6), theEigenvalues(0), theEigenvalueSetTime(0), lastChannel(0),
+ reactionIndexBuiltFlag(false), numReactionNodes(0), numReactionEles(0),
+ reactionNodes(0), reactionEles(0), reactionNodeTags(0), 
+ reactionNodeEleStart(0), reactionNodeEles(0), 
+ reactionEleNodeStart(0), reactionEleNodes(0), reactionEleNodeOffsets(0),
+ reactionNodeStamp(0), reactionNodeFlag(0), reactionNodeMark(0), 
+ reactionEleMark(0), reactionEleList(0), reactionStamp(0), reactionPass(0)
 {
     // init the iters    
     theEleIter = new SingleDomEleIter(theElements);    
@@ -237,7 +256,13 @@ Domain::Domain(TaggedObjectStorage &theStorage)
  eleGraphBuiltFlag(false), nodeGraphBuiltFlag(false), theNodeGraph(0), 
  theElementGraph(0), 
  theRegions(0), numRegions(0), commitTag(0),
- theBounds(6), theEigenvalues(0), theEigenvalueSetTime(0), lastChannel(0)
+ theBounds(6), theEigenvalues(0), theEigenvalueSetTime(0), lastChannel(0),
+ reactionIndexBuiltFlag(false), numReactionNodes(0), numReactionEles(0),
+ reactionNodes(0), reactionEles(0), reactionNodeTags(0), 
+ reactionNodeEleStart(0), reactionNodeEles(0), 
+ reactionEleNodeStart(0), reactionEleNodes(0), reactionEleNodeOffsets(0),
+ reactionNodeStamp(0), reactionNodeFlag(0), reactionNodeMark(0), 
+ reactionEleMark(0), reactionEleList(0), reactionStamp(0), reactionPass(0)
 {
     // init the arrays for storing the domain components
     theStorage.clearAll(); // clear the storage just in case populated
@@ -333,6 +358,8 @@ Domain::~Domain()
 
   if (theEigenvalues != 0)
     delete theEigenvalues;
+
+  this->clearReactionIndex();
   
   int i;
   for (i=0; i<numRecorders; i++) 
@@ -858,6 +885,8 @@ Domain::clearAll(void) {
   nodeGraphBuiltFlag = false;
   eleGraphBuiltFlag = false;
 
+  this->clearReactionIndex();
+
   if (theNodeGraph != 0)
     delete theNodeGraph;
   theNodeGraph = 0;
@@ -1345,6 +1374,12 @@ Domain::getCurrentTime(void) const
     return currentTime;
 }
 
+double
+Domain::getCommittedTime(void) const
+{
+    return committedTime;
+}
+
 int
 Domain::getCommitTag(void) const
 {
@@ -1502,6 +1537,9 @@ Domain::setCurrentTime(double newTime)
 {
     currentTime = newTime;
     dT = currentTime - committedTime;
+
+    // the state may be restored with the time, reactions are no longer valid
+    reactionStamp++;
 }
 
 void
@@ -1509,6 +1547,7 @@ Domain::setCommittedTime(double newTime)
 {
     committedTime = newTime;
     dT = currentTime - committedTime;
+    reactionStamp++;
 }
 
 
@@ -1519,6 +1558,9 @@ Domain::applyLoad(double timeStep)
     currentTime = timeStep;
     dT = currentTime - committedTime;
 
+    // any reactions formed are no longer valid
+    reactionStamp++;
+
     //
     // first loop over nodes and elements getting them to first zero their loads
     //
@@ -1622,8 +1664,10 @@ Domain::record(void)
 
   // invoke record on all recorders
   for (int i=0; i<numRecorders; i++)
-    if (theRecorders[i] != 0)
+    if (theRecorders[i] != 0) {
+      ProfileScope scope("Recorder::record");
       res += theRecorders[i]->record(commitTag, currentTime);
+    }
   
   // update the commitTag
   commitTag++;
@@ -1634,6 +1678,8 @@ Domain::record(void)
 int
 Domain::commit(void)
 {
+    ProfileScope scope("Domain::commit");
+
     // 
     // first invoke commit on all nodes and elements in the domain
     //
@@ -1655,8 +1701,10 @@ Domain::commit(void)
 
     // invoke record on all recorders
     for (int i=0; i<numRecorders; i++)
-      if (theRecorders[i] != 0)
+      if (theRecorders[i] != 0) {
+	ProfileScope scope("Recorder::record");
 	theRecorders[i]->record(commitTag, currentTime);
+      }
 
     // update the commitTag
     commitTag++;
@@ -1685,6 +1733,9 @@ Domain::revertToLastCommit(void)
     currentTime = committedTime;
     dT = 0.0;
 
+    // any reactions formed are for the reverted trial state
+    reactionStamp++;
+
     // apply load for the last committed time
     this->applyLoad(currentTime);
 
@@ -1722,6 +1773,9 @@ Domain::revertToStart(void)
     currentTime = 0;
     dT = 0.0;
 
+    // any reactions formed are for the state before the revert
+    reactionStamp++;
+
     // apply load for the last committed time
     this->applyLoad(currentTime);
 
@@ -1731,10 +1785,15 @@ Domain::revertToStart(void)
 int
 Domain::update(void)
 {
+  ProfileScope scope("Domain::update");
+
   // set the global constants
   ops_Dt = dT;
   ops_TheActiveDomain = this;
 
+  // any reactions formed are no longer valid
+  reactionStamp++;
+
   int ok = 0;
 
   // invoke update on all the ele's
@@ -1742,6 +1801,7 @@ Domain::update(void)
   Element *theEle;
 
   while ((theEle = theEles()) != 0) {
+    ProfileScope eleScope("update", theEle->getClassTag());
     ok += theEle->update();
   }
 
@@ -1859,6 +1919,7 @@ void
 Domain::domainChange(void)
 {
     hasDomainChangedFlag = true;
+    reactionIndexBuiltFlag = false;
 }
 
 
@@ -2998,6 +3059,9 @@ Domain::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
   // now set the domains lastGeoSendTag and currentDomainChangedFlag
   lastGeoSendTag = currentGeoTag;  
 
+  // the state of the nodes and elements is restored, reactions are not valid
+  reactionStamp++;
+
   // if get here we were successfull
   return 0;
 }
@@ -3046,5 +3110,287 @@ Domain::calculateNodalReactions(int flag)
   ElementIter &theElements = this->getElements();
   while ((theElement = theElements()) != 0)
     theElement->addResistingForceToNodalReaction(flag);
+
+  // reactions at all nodes now formed for current state
+  if (reactionIndexBuiltFlag == true)
+    for (int i=0; i<numReactionNodes; i++) {
+      (*reactionNodeStamp)(i) = reactionStamp;
+      (*reactionNodeFlag)(i) = flag;
+    }
+
   return 0;
 }
+
+
+int
+Domain::calculateNodalReactions(int flag, const ID &nodeTags)
+{
+  // build the node-element adjacency if not already done
+  if (reactionIndexBuiltFlag == false) 
+    if (this->buildReactionIndex() != 0) {
+      opserr << "Domain::calculateNodalReactions() - failed to build index, forming all reactions\n";
+      return this->calculateNodalReactions(flag);
+    }
+
+  static Vector theVector(6);
+
+  reactionPass++;
+
+  //
+  // reset the reactions at those nodes not already formed for current state 
+  // & determine the elements attached to them
+  //
+
+  int numEleToDo = 0;
+  int numTags = nodeTags.Size();
+  for (int i=0; i<numTags; i++) {
+    int loc = reactionNodeTags->getLocationOrdered(nodeTags(i));
+    if (loc < 0)
+      continue;
+
+    if ((*reactionNodeStamp)(loc) == reactionStamp && (*reactionNodeFlag)(loc) == flag)
+      continue;
+    if ((*reactionNodeMark)(loc) == reactionPass)
+      continue;
+
+    (*reactionNodeMark)(loc) = reactionPass;
+    (*reactionNodeStamp)(loc) = reactionStamp;
+    (*reactionNodeFlag)(loc) = flag;
+
+    reactionNodes[loc]->resetReactionForce(flag);
+
+    int end = (*reactionNodeEleStart)(loc+1);
+    for (int j=(*reactionNodeEleStart)(loc); j<end; j++) {
+      int eleLoc = (*reactionNodeEles)(j);
+      if ((*reactionEleMark)(eleLoc) != reactionPass) {
+	(*reactionEleMark)(eleLoc) = reactionPass;
+	(*reactionEleList)(numEleToDo++) = eleLoc;
+      }
+    }
+  }
+
+  //
+  // form the resisting force of each of these elements once & add it 
+  // to the reactions of the marked nodes
+  //
+
+  int result = 0;
+  for (int k=0; k<numEleToDo; k++) {
+    int eleLoc = (*reactionEleList)(k);
+    Element *theElement = reactionEles[eleLoc];
+
+    const Vector *theResistingForce;
+    if (flag == 0)
+      theResistingForce = &(theElement->getResistingForce());
+    else if (flag == 1)
+      theResistingForce = &(theElement->getResistingForceIncInertia());
+    else 
+      theResistingForce = &(theElement->getRayleighDampingForces());
+
+    int end = (*reactionEleNodeStart)(eleLoc+1);
+    for (int j=(*reactionEleNodeStart)(eleLoc); j<end; j++) {
+      int loc = (*reactionEleNodes)(j);
+      if ((*reactionNodeMark)(loc) != reactionPass)
+	continue;
+
+      Node *theNode = reactionNodes[loc];
+      int numNodalDOF = theNode->getNumberDOF();
+      int offset = (*reactionEleNodeOffsets)(j);
+      theVector.resize(numNodalDOF);
+      for (int l=0; l<numNodalDOF; l++)
+	theVector(l) = (*theResistingForce)(offset+l);
+      
+      result += theNode->addReactionForce(theVector, 1.0);
+    }
+  }
+
+  return result;
+}
+
+
+int
+Domain::buildReactionIndex(void)
+{
+  this->clearReactionIndex();
+
+  numReactionNodes = this->getNumNodes();
+  numReactionEles = this->getNumElements();
+
+  //
+  // order the nodes by tag
+  //
+
+  int *nodeTags = new int[numReactionNodes+1];
+  reactionNodes = new Node *[numReactionNodes+1];
+  reactionEles = new Element *[numReactionEles+1];
+
+  bool ordered = true;
+  int count = 0;
+  Node *theNode;
+  NodeIter &theNodes = this->getNodes();
+  while ((theNode = theNodes()) != 0 && count < numReactionNodes) {
+    nodeTags[count] = theNode->getTag();
+    if (count != 0 && nodeTags[count] <= nodeTags[count-1])
+      ordered = false;
+    count++;
+  }
+  numReactionNodes = count;
+
+  if (ordered == false) {
+    // sort tags (insertion sort on the nearly sorted tags) & lookup nodes
+    for (int i=1; i<numReactionNodes; i++) {
+      int tag = nodeTags[i];
+      int j = i-1;
+      while (j >= 0 && nodeTags[j] > tag) {
+	nodeTags[j+1] = nodeTags[j];
+	j--;
+      }
+      nodeTags[j+1] = tag;
+    }
+  }
+  reactionNodeTags = new ID(nodeTags, numReactionNodes, true);
+
+  NodeIter &theOrderedNodes = this->getNodes();
+  if (ordered == true) {
+    count = 0;
+    while ((theNode = theOrderedNodes()) != 0 && count < numReactionNodes)
+      reactionNodes[count++] = theNode;
+  } else {
+    for (int i=0; i<numReactionNodes; i++)
+      reactionNodes[i] = this->getNode(nodeTags[i]);
+  }
+
+  //
+  // element -> node locations & offsets of the nodal dof in the element vectors
+  //
+
+  int numEleNodes = 0;
+  count = 0;
+  Element *theElement;
+  ElementIter &theElements = this->getElements();
+  while ((theElement = theElements()) != 0 && count < numReactionEles) {
+    reactionEles[count++] = theElement;
+    numEleNodes += theElement->getNumExternalNodes();
+  }
+  numReactionEles = count;
+
+  reactionEleNodeStart = new ID(numReactionEles+1);
+  reactionEleNodes = new ID(numEleNodes+1);
+  reactionEleNodeOffsets = new ID(numEleNodes+1);
+  ID numNodeEles(numReactionNodes+1);
+  numNodeEles.Zero();
+
+  count = 0;
+  for (int i=0; i<numReactionEles; i++) {
+    theElement = reactionEles[i];
+    (*reactionEleNodeStart)(i) = count;
+    int numNodes = theElement->getNumExternalNodes();
+    const ID &eleNodes = theElement->getExternalNodes();
+    Node **eleNodePtrs = theElement->getNodePtrs();
+    int offset = 0;
+    for (int j=0; j<numNodes; j++) {
+      int loc = reactionNodeTags->getLocationOrdered(eleNodes(j));
+      (*reactionEleNodes)(count) = loc;
+      (*reactionEleNodeOffsets)(count) = offset;
+      count++;
+      if (loc >= 0)
+	numNodeEles(loc)++;
+      if (eleNodePtrs != 0 && eleNodePtrs[j] != 0)
+	offset += eleNodePtrs[j]->getNumberDOF();
+      else if (loc >= 0)
+	offset += reactionNodes[loc]->getNumberDOF();
+    }
+  }
+  (*reactionEleNodeStart)(numReactionEles) = count;
+
+  //
+  // node -> adjacent element locations
+  //
+
+  reactionNodeEleStart = new ID(numReactionNodes+1);
+  count = 0;
+  for (int i=0; i<numReactionNodes; i++) {
+    (*reactionNodeEleStart)(i) = count;
+    count += numNodeEles(i);
+    numNodeEles(i) = (*reactionNodeEleStart)(i);
+  }
+  (*reactionNodeEleStart)(numReactionNodes) = count;
+
+  reactionNodeEles = new ID(count+1);
+  for (int i=0; i<numReactionEles; i++) {
+    int end = (*reactionEleNodeStart)(i+1);
+    for (int j=(*reactionEleNodeStart)(i); j<end; j++) {
+      int loc = (*reactionEleNodes)(j);
+      if (loc >= 0) 
+	(*reactionNodeEles)(numNodeEles(loc)++) = i;
+    }
+  }
+
+  //
+  // the cache & scratch arrays
+  //
+
+  reactionNodeStamp = new ID(numReactionNodes+1);
+  reactionNodeFlag = new ID(numReactionNodes+1);
+  reactionNodeMark = new ID(numReactionNodes+1);
+  reactionEleMark = new ID(numReactionEles+1);
+  reactionEleList = new ID(numReactionEles+1);
+  reactionNodeStamp->Zero();
+  for (int i=0; i<numReactionNodes; i++) 
+    (*reactionNodeFlag)(i) = -1;
+  reactionNodeMark->Zero();
+  reactionEleMark->Zero();
+  reactionPass = 0;
+
+  reactionIndexBuiltFlag = true;
+  return 0;
+}
+
+
+void
+Domain::clearReactionIndex(void)
+{
+  if (reactionNodes != 0)
+    delete [] reactionNodes;
+  if (reactionEles != 0)
+    delete [] reactionEles;
+  if (reactionNodeTags != 0)
+    delete reactionNodeTags;
+  if (reactionNodeEleStart != 0)
+    delete reactionNodeEleStart;
+  if (reactionNodeEles != 0)
+    delete reactionNodeEles;
+  if (reactionEleNodeStart != 0)
+    delete reactionEleNodeStart;
+  if (reactionEleNodes != 0)
+    delete reactionEleNodes;
+  if (reactionEleNodeOffsets != 0)
+    delete reactionEleNodeOffsets;
+  if (reactionNodeStamp != 0)
+    delete reactionNodeStamp;
+  if (reactionNodeFlag != 0)
+    delete reactionNodeFlag;
+  if (reactionNodeMark != 0)
+    delete reactionNodeMark;
+  if (reactionEleMark != 0)
+    delete reactionEleMark;
+  if (reactionEleList != 0)
+    delete reactionEleList;
+
+  reactionNodes = 0;
+  reactionEles = 0;
+  reactionNodeTags = 0;
+  reactionNodeEleStart = 0;
+  reactionNodeEles = 0;
+  reactionEleNodeStart = 0;
+  reactionEleNodes = 0;
+  reactionEleNodeOffsets = 0;
+  reactionNodeStamp = 0;
+  reactionNodeFlag = 0;
+  reactionNodeMark = 0;
+  reactionEleMark = 0;
+  reactionEleList = 0;
+  numReactionNodes = 0;
+  numReactionEles = 0;
+  reactionIndexBuiltFlag = false;
+}
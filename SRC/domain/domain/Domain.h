@@ -145,6 +145,7 @@ class Domain
 
     // methods to query the state of the domain
     virtual double  getCurrentTime(void) const;
+    virtual double  getCommittedTime(void) const;
     virtual int     getCommitTag(void) const;    	
     virtual int getNumElements(void) const;
     virtual int getNumNodes(void) const;
@@ -218,11 +219,13 @@ class Domain
     virtual int setMass(const Matrix &mass, int nodeTag);
 
     virtual int calculateNodalReactions(int flag);
+    virtual int calculateNodalReactions(int flag, const ID &nodeTags);
 
   protected:    
 
     virtual int buildEleGraph(Graph *theEleGraph);
     virtual int buildNodeGraph(Graph *theNodeGraph);
+    virtual int buildReactionIndex(void);
 
     Recorder **theRecorders;
     int numRecorders;    
@@ -277,6 +280,30 @@ class Domain
     enum {paramSize_grow = 20};
     int paramSize;
     int numParameters;
+
+    // node-element adjacency used to form the reactions at a subset of 
+    // the nodes, built once & rebuilt only if the domain changes. the
+    // stamp is bumped whenever the state changes so that the reactions
+    // at a node are formed only once per commitTag
+    bool reactionIndexBuiltFlag;
+    int numReactionNodes;
+    int numReactionEles;
+    Node **reactionNodes;         // nodes, in order of increasing tag
+    Element **reactionEles;       
+    ID *reactionNodeTags;         // ordered node tags
+    ID *reactionNodeEleStart;     // node -> adjacent element locations
+    ID *reactionNodeEles;
+    ID *reactionEleNodeStart;     // element -> node locations & dof offsets
+    ID *reactionEleNodes;
+    ID *reactionEleNodeOffsets;
+    ID *reactionNodeStamp;        // stamp & flag when node reaction last formed
+    ID *reactionNodeFlag;
+    ID *reactionNodeMark;         // scratch used in a pass
+    ID *reactionEleMark;
+    ID *reactionEleList;
+    int reactionStamp;
+    int reactionPass;
+    void clearReactionIndex(void);
 };
 
 #endif
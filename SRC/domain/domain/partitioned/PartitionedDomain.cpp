@@ -1885,6 +1885,23 @@ PartitionedDomain::calculateNodalReactions(bool inclInertia)
   return res;
 }
 
+int 
+PartitionedDomain::calculateNodalReactions(int flag, const ID &nodeTags)
+{
+  int res = this->Domain::calculateNodalReactions(flag, nodeTags); 
+
+  // do the same for all the subdomains
+  if (theSubdomains != 0) {
+    ArrayOfTaggedObjectsIter theSubsIter(*theSubdomains);	
+    TaggedObject *theObject;
+    while ((theObject = theSubsIter()) != 0) {
+      Subdomain *theSub = (Subdomain *)theObject;	    
+      res += theSub->calculateNodalReactions(flag, nodeTags); 
+    }
+  }
+  return res;
+}
+
 bool 
 PartitionedDomain::addParameter(Parameter *param)
 {
@@ -142,6 +142,7 @@ class PartitionedDomain: public Domain
     virtual int setMass(const Matrix &mass, int nodeTag);
 
     virtual int calculateNodalReactions(bool inclInertia);
+    virtual int calculateNodalReactions(int flag, const ID &nodeTags);
     
     // friend classes
     friend class PartitionedDomainEleIter;
@@ -40,7 +40,7 @@ GroundMotion::GroundMotion(TimeSeries *dispSeries,
 			   TimeSeries *accelSeries,
 			   TimeSeriesIntegrator *theIntegratr,
 			   double dTintegration)
-:MovableObject(GROUND_MOTION_TAG_GroundMotion), 
+:MovableObject(GROUND_MOTION_TAG_GroundMotion), fact(1.0),
  theAccelSeries(accelSeries), theVelSeries(velSeries), 
  theDispSeries(dispSeries), theIntegrator(theIntegratr),
  data(3), delta(dTintegration)
@@ -51,7 +51,7 @@ GroundMotion::GroundMotion(TimeSeries *dispSeries,
 
 
 GroundMotion::GroundMotion(int theClassTag)
-:MovableObject(theClassTag), 
+:MovableObject(theClassTag), fact(1.0),
  theAccelSeries(0), theVelSeries(0), theDispSeries(0), theIntegrator(0),
  data(3), delta(0.0)
 {
@@ -71,6 +71,18 @@ GroundMotion::~GroundMotion()
 }
 
 
+void
+GroundMotion::setFactor(double newFactor)
+{
+  fact = newFactor;
+}
+
+double
+GroundMotion::getFactor(void) const
+{
+  return fact;
+}
+
 void
 GroundMotion::setIntegrator(TimeSeriesIntegrator *integrator)
 {
@@ -122,7 +134,7 @@ double
 GroundMotion::getPeakAccel(void)
 {
   if (theAccelSeries != 0)
-    return theAccelSeries->getPeakFactor();
+    return fact*theAccelSeries->getPeakFactor();
   else
     return 0.0;
 
@@ -132,13 +144,13 @@ double
 GroundMotion::getPeakVel(void)
 {
   if (theVelSeries != 0)
-    return theVelSeries->getPeakFactor();
+    return fact*theVelSeries->getPeakFactor();
 
   // if theAccel is not 0, integrate accel series to get a vel series
   else if (theAccelSeries != 0) {
     theVelSeries = this->integrate(theAccelSeries, delta);
     if (theVelSeries != 0)
-      return theVelSeries->getPeakFactor();      
+      return fact*theVelSeries->getPeakFactor();      
     else
       return 0.0;
   }
@@ -149,13 +161,13 @@ double
 GroundMotion::getPeakDisp(void)
 {
   if (theDispSeries != 0)
-    return theDispSeries->getPeakFactor();
+    return fact*theDispSeries->getPeakFactor();
 
   // if theVel is not 0, integrate vel series to get disp series
   else if (theVelSeries != 0) {
     theDispSeries = this->integrate(theVelSeries, delta);
     if (theDispSeries != 0)
-      return theDispSeries->getPeakFactor();      
+      return fact*theDispSeries->getPeakFactor();      
     else
       return 0.0;
   }
@@ -166,7 +178,7 @@ GroundMotion::getPeakDisp(void)
     if (theVelSeries != 0) {
       theDispSeries = this->integrate(theVelSeries, delta);
       if (theDispSeries != 0)
-	return theDispSeries->getPeakFactor();      
+	return fact*theDispSeries->getPeakFactor();      
       else
 	return 0.0;
     } else
@@ -183,7 +195,7 @@ GroundMotion::getAccel(double time)
     return 0.0;
   
   if (theAccelSeries != 0)
-    return theAccelSeries->getFactor(time);
+    return fact*theAccelSeries->getFactor(time);
   else
     return 0.0;
 }     
@@ -195,7 +207,7 @@ GroundMotion::getAccelSensitivity(double time)
     return 0.0;
   
   if (theAccelSeries != 0)
-    return theAccelSeries->getFactorSensitivity(time);
+    return fact*theAccelSeries->getFactorSensitivity(time);
   else
     return 0.0;
 }     
@@ -207,7 +219,7 @@ GroundMotion::getVel(double time)
     return 0.0;
 
   if (theVelSeries != 0)
-    return theVelSeries->getFactor(time);      
+    return fact*theVelSeries->getFactor(time);      
 
   // if theAccel is not 0, integrate accel series to get a vel series
   else if (theAccelSeries != 0) {
@@ -215,7 +227,7 @@ GroundMotion::getVel(double time)
     theVelSeries = this->integrate(theAccelSeries, delta);
 
     if (theVelSeries != 0) {
-      return theVelSeries->getFactor(time);      
+      return fact*theVelSeries->getFactor(time);      
 
     } else {
       opserr << " WARNING: GroundMotion::getVel(double time) - failed to integrate\n";
@@ -233,14 +245,14 @@ GroundMotion::getDisp(double time)
     return 0.0;
 
   if (theDispSeries != 0)
-    return theDispSeries->getFactor(time);
+    return fact*theDispSeries->getFactor(time);
 
   // if theVel is not 0, integrate vel series to get disp series
   else if (theVelSeries != 0) {
     opserr << " WARNING: GroundMotion::getDisp(double time) - integration is required to get the ground displacements from the ground velocities\n";
     theDispSeries = this->integrate(theVelSeries, delta);
     if (theDispSeries != 0)
-      return theDispSeries->getFactor(time);      
+      return fact*theDispSeries->getFactor(time);      
     else
       return 0.0;
   }
@@ -252,7 +264,7 @@ GroundMotion::getDisp(double time)
     if (theVelSeries != 0) {
       theDispSeries = this->integrate(theVelSeries, delta);
       if (theDispSeries != 0)
-	return theDispSeries->getFactor(time);      
+	return fact*theDispSeries->getFactor(time);      
       else
 	return 0.0;
     } else
@@ -273,9 +285,9 @@ GroundMotion::getDispVelAccel(double time)
   }
 
   if (theAccelSeries != 0 && theVelSeries != 0 && theDispSeries != 0) {
-    data(0) = theDispSeries->getFactor(time);
-    data(1) = theVelSeries->getFactor(time);
-    data(2) = theAccelSeries->getFactor(time);
+    data(0) = fact*theDispSeries->getFactor(time);
+    data(1) = fact*theVelSeries->getFactor(time);
+    data(2) = fact*theAccelSeries->getFactor(time);
   } else {
     data(2) = this->getAccel(time);
     data(1) = this->getVel(time);
@@ -291,6 +303,9 @@ GroundMotion::sendSelf(int commitTag, Channel &theChannel)
 {
   int dbTag = this->getDbTag();
 
+  if (fact != 1.0)
+    opserr << "WARNING GroundMotion::sendSelf() - factor " << fact << " is not sent with the motion\n";
+
   static ID idData(8);
   
   if (theAccelSeries != 0) {
@@ -67,6 +67,11 @@ class GroundMotion : public MovableObject
     virtual double getDisp(double time);
     virtual const  Vector &getDispVelAccel(double time);
     
+    // the factor scales the disp, vel and accel returned by the motion;
+    // it is a local setting of the analysis and is not sent with the motion
+    void setFactor(double newFactor);
+    double getFactor(void) const;
+
     void setIntegrator(TimeSeriesIntegrator *integrator);
     TimeSeries *integrate(TimeSeries *theSeries, double delta = 0.01); 
 
@@ -84,6 +89,7 @@ class GroundMotion : public MovableObject
     // AddingSensitivity:END ///////////////////////////////////////////
 
   protected:
+    double fact;                 // scale factor applied to the motion
 
   private:
     TimeSeries *theAccelSeries;  // Ground acceleration
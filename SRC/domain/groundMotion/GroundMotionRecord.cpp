@@ -109,7 +109,7 @@ double
 GroundMotionRecord::getPeakAccel(void)
 {
   if (theAccelTimeSeries != 0)
-    return theAccelTimeSeries->getPeakFactor();
+    return fact*theAccelTimeSeries->getPeakFactor();
   else
     return 0.0;
 
@@ -119,13 +119,13 @@ double
 GroundMotionRecord::getPeakVel(void)
 {
   if (theVelTimeSeries != 0)
-    return theVelTimeSeries->getPeakFactor();
+    return fact*theVelTimeSeries->getPeakFactor();
 
   // if theAccel is not 0, integrate accel series to get a vel series
   else if (theAccelTimeSeries != 0) {
     theVelTimeSeries = this->integrate(theAccelTimeSeries, delta);
     if (theVelTimeSeries != 0)
-      return theVelTimeSeries->getPeakFactor();      
+      return fact*theVelTimeSeries->getPeakFactor();      
     else
       return 0.0;
   }
@@ -136,13 +136,13 @@ double
 GroundMotionRecord::getPeakDisp(void)
 {
   if (theDispTimeSeries != 0)
-    return theDispTimeSeries->getPeakFactor();
+    return fact*theDispTimeSeries->getPeakFactor();
 
   // if theVel is not 0, integrate vel series to get disp series
   else if (theVelTimeSeries != 0) {
     theDispTimeSeries = this->integrate(theVelTimeSeries, delta);
     if (theDispTimeSeries != 0)
-      return theDispTimeSeries->getPeakFactor();      
+      return fact*theDispTimeSeries->getPeakFactor();      
     else
       return 0.0;
   }
@@ -153,7 +153,7 @@ GroundMotionRecord::getPeakDisp(void)
     if (theVelTimeSeries != 0) {
       theDispTimeSeries = this->integrate(theVelTimeSeries, delta);
       if (theDispTimeSeries != 0)
-	return theDispTimeSeries->getPeakFactor();      
+	return fact*theDispTimeSeries->getPeakFactor();      
       else
 	return 0.0;
     } else
@@ -170,7 +170,7 @@ GroundMotionRecord::getAccel(double time)
     return 0.0;
   
   if (theAccelTimeSeries != 0)
-    return theAccelTimeSeries->getFactor(time);
+    return fact*theAccelTimeSeries->getFactor(time);
   else
     return 0.0;
 }     
@@ -182,13 +182,13 @@ GroundMotionRecord::getVel(double time)
     return 0.0;
 
   if (theVelTimeSeries != 0) 
-    return theVelTimeSeries->getFactor(time);      
+    return fact*theVelTimeSeries->getFactor(time);      
   
   // if theAccel is not 0, integrate accel series to get a vel series
   else if (theAccelTimeSeries != 0) {
     theVelTimeSeries = this->integrate(theAccelTimeSeries, delta);
     if (theVelTimeSeries != 0)
-      return theVelTimeSeries->getFactor(time);      
+      return fact*theVelTimeSeries->getFactor(time);      
     else
       return 0.0;
   }
@@ -203,13 +203,13 @@ GroundMotionRecord::getDisp(double time)
     return 0.0;
 
   if (theDispTimeSeries != 0)
-    return theDispTimeSeries->getFactor(time);
+    return fact*theDispTimeSeries->getFactor(time);
 
   // if theVel is not 0, integrate vel series to get disp series
   else if (theVelTimeSeries != 0) {
     theDispTimeSeries = this->integrate(theVelTimeSeries, delta);
     if (theDispTimeSeries != 0)
-      return theDispTimeSeries->getFactor(time);      
+      return fact*theDispTimeSeries->getFactor(time);      
     else
       return 0.0;
   }
@@ -220,7 +220,7 @@ GroundMotionRecord::getDisp(double time)
     if (theVelTimeSeries != 0) {
       theDispTimeSeries = this->integrate(theVelTimeSeries, delta);
       if (theDispTimeSeries != 0)
-	return theDispTimeSeries->getFactor(time);      
+	return fact*theDispTimeSeries->getFactor(time);      
       else
 	return 0.0;
     } else
@@ -241,9 +241,9 @@ GroundMotionRecord::getDispVelAccel(double time)
   }
 
   if (theAccelTimeSeries != 0 && theVelTimeSeries != 0 && theDispTimeSeries != 0) {
-    data(0) = theDispTimeSeries->getFactor(time);
-    data(1) = theVelTimeSeries->getFactor(time);
-    data(2) = theAccelTimeSeries->getFactor(time);
+    data(0) = fact*theDispTimeSeries->getFactor(time);
+    data(1) = fact*theVelTimeSeries->getFactor(time);
+    data(2) = fact*theAccelTimeSeries->getFactor(time);
   } else {
     data(2) = this->getAccel(time);
     data(1) = this->getVel(time);
@@ -259,6 +259,9 @@ GroundMotionRecord::sendSelf(int commitTag, Channel &theChannel)
 {
   int dbTag = this->getDbTag();
 
+  if (fact != 1.0)
+    opserr << "WARNING GroundMotionRecord::sendSelf() - factor " << fact << " is not sent with the motion\n";
+
   static ID idData(6);
   
   if (theAccelTimeSeries != 0) {
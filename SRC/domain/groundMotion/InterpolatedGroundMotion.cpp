@@ -151,7 +151,7 @@ InterpolatedGroundMotion::getAccel(double time)
       value += (*factors)(i) * theMotions[i]->getAccel(time);
   }
 
-  return value;
+  return fact*value;
 
 }     
 
@@ -168,7 +168,7 @@ InterpolatedGroundMotion::getVel(double time)
   }
 
 
-  return value;
+  return fact*value;
 }
 
 double 
@@ -183,7 +183,7 @@ InterpolatedGroundMotion::getDisp(double time)
       value += (*factors)(i) * theMotions[i]->getDisp(time);
   }
 
-  return value;
+  return fact*value;
 }
 
 const Vector &
@@ -205,7 +205,8 @@ InterpolatedGroundMotion::getDispVelAccel(double time)
       motionData *= (*factors)(i);
       data += motionData;
   }
-  
+  data *= fact;
+
   return data;
 }
 
@@ -1472,6 +1472,11 @@ Node::recvSelf(int cTag, Channel &theChannel,
       // set the trial quantity
       for (int i=0; i<numberDOF; i++)
 	vel[i] = vel[i+numberDOF];  // set trial equal commited
+
+    } else if (commitVel != 0) {
+      // as for the disp, zero the vectors the sender did not have
+      commitVel->Zero();
+      trialVel->Zero();
     }
 
     if (data(4) == 0) {
@@ -1488,6 +1493,10 @@ Node::recvSelf(int cTag, Channel &theChannel,
       // set the trial values
       for (int i=0; i<numberDOF; i++)
 	accel[i] = accel[i+numberDOF];  // set trial equal commited
+
+    } else if (commitAccel != 0) {
+      commitAccel->Zero();
+      trialAccel->Zero();
     }
 
     if (data(5) == 0) {
@@ -59,17 +59,27 @@
 #include <LoadPattern.h>
  
 #include <Timer.h>
+#include <classTags.h>
 
 #include <MapOfTaggedObjects.h>
 
+#include <time.h>
+#ifndef _WIN32
+#include <sys/time.h>
+#endif
+
 class NodeLocations: public TaggedObject
 {
 public:
   NodeLocations(int tag);
   void Print(OPS_Stream &s, int flag =0);  
   int addPartition(int partition);
+  int removeElement(int partition);
+  bool hasPartition(int partition) const;
   ID nodePartitions;
   int numPartitions;
+  ID numElements;   // number of elements using the node in each partition
+  bool external;    // node is an external node of its subdomains
 };
 
 
@@ -77,11 +87,27 @@ public:
 NodeLocations::NodeLocations(int tag)
 :TaggedObject(tag), 
  nodePartitions(0,1), 
- numPartitions(0)
+ numPartitions(0),
+ numElements(0,2),
+ external(false)
 {
 
 }
 
+// wall clock time in seconds, Timer only resolves clock ticks which is
+// far too coarse to time a single element
+static double
+getWeightTime(void)
+{
+#ifdef _WIN32
+  return (double)clock()/CLOCKS_PER_SEC;
+#else
+  struct timeval tp;
+  gettimeofday(&tp, 0);
+  return tp.tv_sec + 1.0e-6*tp.tv_usec;
+#endif
+}
+
 void 
 NodeLocations::Print(OPS_Stream &s, int flag)
 {
@@ -93,13 +119,38 @@ NodeLocations::addPartition(int partition)
 {
   if (nodePartitions.insert(partition) != 1)
     numPartitions++;
+  numElements[partition] += 1;
   return 0;
 }
 
+// removes an element of partition from the node, returning the number
+// of elements of the partition still using the node
+int
+NodeLocations::removeElement(int partition)
+{
+  int numLeft = numElements[partition] - 1;
+  numElements[partition] = numLeft;
+  if (numLeft <= 0) {
+    numElements[partition] = 0;
+    if (nodePartitions.removeValue(partition) >= 0)
+      numPartitions--;
+    return 0;
+  }
+  return numLeft;
+}
+
+bool
+NodeLocations::hasPartition(int partition) const
+{
+  return (nodePartitions.getLocationOrdered(partition) >= 0);
+}
+
 DomainPartitioner::DomainPartitioner(GraphPartitioner &theGraphPartitioner)
 :myDomain(0),thePartitioner(theGraphPartitioner),theBalancer(0),
- theElementGraph(0), theBoundaryElements(0), 
- theNodeLocations(0),elementPlace(0), numPartitions(0), partitionFlag(false), usingMainDomain(false)
+ theElementGraph(0), pinnedVertices(0,16), partitionWeights(),
+ theNodeLocations(0),elementPlace(0), numPartitions(0), partitionFlag(false), usingMainDomain(false),
+ weightClassTags(0,8), weightClassValues(), numWeightSamples(0), imbalance(1.0),
+ subdomainCosts(), balanceInterval(1), numBalanceSteps(0), balanceThreshold(1.0)
 {
 
 }    
@@ -107,8 +158,10 @@ DomainPartitioner::DomainPartitioner(GraphPartitioner &theGraphPartitioner)
 DomainPartitioner::DomainPartitioner(GraphPartitioner &theGraphPartitioner,
 				     LoadBalancer &theLoadBalancer)
 :myDomain(0),thePartitioner(theGraphPartitioner),theBalancer(&theLoadBalancer),
- theElementGraph(0), theBoundaryElements(0),
- theNodeLocations(0),elementPlace(0), numPartitions(0), partitionFlag(false), usingMainDomain(false)
+ theElementGraph(0), pinnedVertices(0,16), partitionWeights(),
+ theNodeLocations(0),elementPlace(0), numPartitions(0), partitionFlag(false), usingMainDomain(false),
+ weightClassTags(0,8), weightClassValues(), numWeightSamples(0), imbalance(1.0),
+ subdomainCosts(), balanceInterval(1), numBalanceSteps(0), balanceThreshold(1.0)
 {
     // set the links the loadBalancer needs
     theLoadBalancer.setLinks(*this);
@@ -117,11 +170,13 @@ DomainPartitioner::DomainPartitioner(GraphPartitioner &theGraphPartitioner,
 
 DomainPartitioner::~DomainPartitioner()
 {
-  if (theBoundaryElements != 0) {
-    for (int i=0; i<numPartitions; i++)
-      if (theBoundaryElements[i] != 0)
-	delete theBoundaryElements[i];
-    delete []theBoundaryElements;
+  // once partitioned the element graph is our own copy
+  if (partitionFlag == true && theElementGraph != 0)
+    delete theElementGraph;
+
+  if (theNodeLocations != 0) {
+    theNodeLocations->clearAll();
+    delete theNodeLocations;
   }
 }
 
@@ -154,7 +209,18 @@ DomainPartitioner::partition(int numParts, bool usingMain, int mainPartitionTag)
   //    Graph &theEleGraph = myDomain->getElementGraph();
   //    theElementGraph = new Graph(myDomain->getElementGraph());
 
+  if (partitionFlag == true && theElementGraph != 0)
+    delete theElementGraph;
+  partitionFlag = false;
+
   theElementGraph = &(myDomain->getElementGraph());
+
+  // weight the vertices by the cost of the elements
+  if (this->weighElementGraph() < 0) {
+    opserr << "DomainPartitioner::partition";
+    opserr << " - failed to weight the element graph\n";
+    return -1;
+  }
   
   int theError = thePartitioner.partition(*theElementGraph, numParts);
 
@@ -188,40 +254,79 @@ DomainPartitioner::partition(int numParts, bool usingMain, int mainPartitionTag)
     opserr <<"DomainPartitioner::partition - too few elements for model to be partitioned\n";
     return -1;
   }
-      
-  // we create empty graphs for the numParts subdomains,
-  // in the graphs we place the vertices for the elements on the boundaries
-  
-  // we do not invoke the destructor on the individual graphs as 
-  // this would invoke the destructor on the individual vertices
 
-  if (theBoundaryElements != 0)
-    delete [] theBoundaryElements;
-  
-  theBoundaryElements = new Graph * [numParts];
-  if (theBoundaryElements == 0) {
-    opserr << "DomainPartitioner::partition(int numParts)";
-    opserr << " - ran out of memory\n";
-    numPartitions = 0;  
-    return -1;
+  // determine the load imbalance, the weight of the heaviest partition
+  // over the mean partition weight
+  partitionWeights.resize(numParts+1);
+  partitionWeights.Zero();
+  double totalWeight = 0.0;
+  VertexIter &theVertices2 = theElementGraph->getVertices();
+  while ((vertexPtr = theVertices2()) != 0) {
+    double weight = vertexPtr->getWeight();
+    partitionWeights(vertexPtr->getColor()) += weight;
+    totalWeight += weight;
   }
 
-  for (int l=0; l<numParts; l++) {
-    theBoundaryElements[l] = new Graph(2048); // graphs can grow larger; just an estimate
-    
-    if (theBoundaryElements[l] == 0) {
-      opserr << "DomainPartitioner::partition(int numParts)";
-      opserr << " - ran out of memory\n";
-      numPartitions = 0;
-      return -1;
-    }
+  imbalance = 1.0;
+  if (totalWeight > 0.0) {
+    double maxWeight = 0.0;
+    for (int k=1; k<=numParts; k++)
+      if (partitionWeights(k) > maxWeight)
+	maxWeight = partitionWeights(k);
+    imbalance = maxWeight*numParts/totalWeight;
   }
+
+  opserr << "DomainPartitioner::partition - " << numParts;
+  opserr << " partitions, load imbalance factor: " << imbalance << endln;
   
   numPartitions = numParts;
+
+  // the elements connected to nodes with constraints or loads, and elements 
+  // with elemental loads, are pinned to their partition when load balancing
+  
+  ID fixedNodes(0, 64);
+  ID loadedElements(0, 16);
+
+  SP_ConstraintIter &theFixedSPs = myDomain->getSPs();
+  SP_Constraint *theFixedSP;
+  while ((theFixedSP = theFixedSPs()) != 0)
+    fixedNodes.insert(theFixedSP->getNodeTag());
+
+  MP_ConstraintIter &theFixedMPs = myDomain->getMPs();
+  MP_Constraint *theFixedMP;
+  while ((theFixedMP = theFixedMPs()) != 0) {
+    fixedNodes.insert(theFixedMP->getNodeRetained());
+    fixedNodes.insert(theFixedMP->getNodeConstrained());
+  }
+
+  LoadPatternIter &theFixedPatterns = myDomain->getLoadPatterns();
+  LoadPattern *theFixedPattern;
+  while ((theFixedPattern = theFixedPatterns()) != 0) {
+    NodalLoadIter &theFixedLoads = theFixedPattern->getNodalLoads();
+    NodalLoad *theFixedLoad;
+    while ((theFixedLoad = theFixedLoads()) != 0)
+      fixedNodes.insert(theFixedLoad->getNodeTag());
+
+    SP_ConstraintIter &thePatternSPs = theFixedPattern->getSPs();
+    while ((theFixedSP = thePatternSPs()) != 0)
+      fixedNodes.insert(theFixedSP->getNodeTag());
+
+    ElementalLoadIter &theEleLoads = theFixedPattern->getElementalLoads();
+    ElementalLoad *theEleLoad;
+    while ((theEleLoad = theEleLoads()) != 0)
+      loadedElements.insert(theEleLoad->getElementTag());
+  }
+
+  pinnedVertices = ID(0, 64);
   
   // we now create a MapOfTaggedObjectStorage to store the NodeLocations
   // and create a new NodeLocation for each node; adding it to the map object
 
+  if (theNodeLocations != 0) {
+    theNodeLocations->clearAll();
+    delete theNodeLocations;
+  }
+
   theNodeLocations = new MapOfTaggedObjects();
   if (theNodeLocations == 0) {
     opserr << "DomainPartitioner::partition(int numParts)";
@@ -249,12 +354,10 @@ DomainPartitioner::partition(int numParts, bool usingMain, int mainPartitionTag)
   }
 
   //
-  // we now iterate through the vertices of the element graph
-  // to see if the vertex is a boundary vertex or not - if it is
-  // we add to the appropriate graph created above. We also set the
-  // value the color variable of each of the external nodes connected 
-  // to the element to a value which will indicate that that node will
-  // have to be added to the subdomain.
+  // we now iterate through the vertices of the element graph, adding
+  // the partition of the element to the NodeLocations of each of its 
+  // nodes. This will indicate which subdomains the node will have to 
+  // be added to.
   //
   
   VertexIter &theVertexIter = theElementGraph->getVertices();
@@ -262,21 +365,17 @@ DomainPartitioner::partition(int numParts, bool usingMain, int mainPartitionTag)
     int eleTag = vertexPtr->getRef();
     int vertexColor = vertexPtr->getColor();
     
-    const ID &adjacency = vertexPtr->getAdjacency();
-    int size = adjacency.Size();
-    for (int i=0; i<size; i++) {
-      Vertex *otherVertex = theElementGraph->getVertexPtr(adjacency(i));
-      if (otherVertex->getColor() != vertexColor) {
-	theBoundaryElements[vertexColor-1]->addVertex(vertexPtr,false);
-	i = size;
-      }
-    }
-    
     Element *elePtr = myDomain->getElement(eleTag);
     const ID &nodes = elePtr->getExternalNodes();
-    size = nodes.Size();
+    int size = nodes.Size();
+
+    if (loadedElements.getLocationOrdered(eleTag) >= 0)
+      pinnedVertices.insert(vertexPtr->getTag());
+
     for (int j=0; j<size; j++) {
       int nodeTag = nodes(j);
+      if (fixedNodes.getLocationOrdered(nodeTag) >= 0)
+	pinnedVertices.insert(vertexPtr->getTag());
       TaggedObject *theTaggedObject = theNodeLocations->getComponentPtr(nodeTag);
       if (theTaggedObject == 0) {
 	opserr << "DomainPartitioner::partition(int numParts)";
@@ -329,6 +428,7 @@ DomainPartitioner::partition(int numParts, bool usingMain, int mainPartitionTag)
     int nodeTag = theNodeLocation->getTag();
     ID &nodePartitions = theNodeLocation->nodePartitions;
     int numPartitions = theNodeLocation->numPartitions;
+    theNodeLocation->external = (numPartitions > 1);
 
     for (int i=0; i<numPartitions; i++) {
       int partition = nodePartitions(i);	  
@@ -562,7 +662,18 @@ DomainPartitioner::partition(int numParts, bool usingMain, int mainPartitionTag)
   // we invoke change on the PartitionedDomain
   myDomain->domainChange();
 
+  // keep a colored copy of the element graph for load balancing, the 
+  // domain graph is deleted and would not be valid after migrations
+  Graph *theGraphCopy = new Graph(*theElementGraph);
+  VertexIter &theVertices3 = theElementGraph->getVertices();
+  while ((vertexPtr = theVertices3()) != 0) {
+    Vertex *theCopy = theGraphCopy->getVertexPtr(vertexPtr->getTag());
+    theCopy->setColor(vertexPtr->getColor());
+    theCopy->setWeight(vertexPtr->getWeight());
+  }
+
   myDomain->clearElementGraph();
+  theElementGraph = theGraphCopy;
     
   // we are done
   partitionFlag = true;
@@ -571,6 +682,45 @@ DomainPartitioner::partition(int numParts, bool usingMain, int mainPartitionTag)
 }
 
 
+int
+DomainPartitioner::setLoadBalancer(LoadBalancer &theLoadBalancer)
+{
+  theBalancer = &theLoadBalancer;
+  theBalancer->setLinks(*this);
+  return 0;
+}
+
+
+int
+DomainPartitioner::setBalanceInterval(int numSteps, double imbalanceThreshold)
+{
+  if (numSteps < 1) {
+    opserr << "DomainPartitioner::setBalanceInterval - number of steps ";
+    opserr << numSteps << " must be at least 1\n";
+    return -1;
+  }
+
+  if (imbalanceThreshold < 1.0) {
+    opserr << "DomainPartitioner::setBalanceInterval - imbalance threshold ";
+    opserr << imbalanceThreshold << " must not be less than 1.0\n";
+    return -1;
+  }
+
+  balanceInterval = numSteps;
+  balanceThreshold = imbalanceThreshold;
+  numBalanceSteps = 0;
+  return 0;
+}
+
+
+// int balance(Graph &theWeightedPGraph)
+//	Invoked by the PartitionedDomain on each commit with the subdomain 
+//	graph weighted by the time each subdomain spent in state 
+//	determination since the last commit. The times are accumulated and
+//	every balanceInterval commits, if the imbalance of the accumulated
+//	times, max*n/sum, exceeds balanceThreshold, the LoadBalancer is 
+//	invoked to migrate elements from the slower subdomains.
+
 int
 DomainPartitioner::balance(Graph &theWeightedPGraph)
 {
@@ -583,27 +733,266 @@ DomainPartitioner::balance(Graph &theWeightedPGraph)
   return -1;
     }
 
-    if (theBalancer != 0) {
+    if (theBalancer == 0)
+      return 0;
+
+    // accumulate the cost of each subdomain
+    VertexIter &theVertices = theWeightedPGraph.getVertices();
+    Vertex *vertexPtr;
+    while ((vertexPtr = theVertices()) != 0)
+      subdomainCosts[vertexPtr->getTag()] += vertexPtr->getWeight();
+
+    numBalanceSteps++;
+    if (numBalanceSteps < balanceInterval)
+      return 0;
+
+    numBalanceSteps = 0;
+
+    // weight the graph with the accumulated costs & determine the imbalance
+    double maxCost = 0.0;
+    double totalCost = 0.0;
+    int numVertex = 0;
+    VertexIter &theVertices2 = theWeightedPGraph.getVertices();
+    while ((vertexPtr = theVertices2()) != 0) {
+      double cost = subdomainCosts[vertexPtr->getTag()];
+      vertexPtr->setWeight(cost);
+      if (cost > maxCost)
+	maxCost = cost;
+      totalCost += cost;
+      numVertex++;
+    }
+    subdomainCosts.Zero();
+
+    if (totalCost <= 0.0)
+      return 0;
+
+    double costImbalance = maxCost*numVertex/totalCost;
+    if (costImbalance <= balanceThreshold)
+      return 0;
+
+    opserr << "DomainPartitioner::balance - subdomain cost imbalance ";
+    opserr << costImbalance << ", rebalancing\n";
 
-	// call on the LoadBalancer to partition		
-	res = theBalancer->balance(theWeightedPGraph);
+    // call on the LoadBalancer to partition		
+    res = theBalancer->balance(theWeightedPGraph);
 	    
-	// now invoke domainChanged on Subdomains and PartitionedDomain
-	SubdomainIter &theSubDomains = myDomain->getSubdomains();
-	Subdomain *theSubDomain;
+    // now invoke domainChanged on Subdomains and PartitionedDomain
+    SubdomainIter &theSubDomains = myDomain->getSubdomains();
+    Subdomain *theSubDomain;
 
-	while ((theSubDomain = theSubDomains()) != 0) 
-	  theSubDomain->domainChange();
+    while ((theSubDomain = theSubDomains()) != 0) 
+      theSubDomain->domainChange();
 	
-	// we invoke change on the PartitionedDomain
-	myDomain->domainChange();
+    // we invoke change on the PartitionedDomain
+    myDomain->domainChange();
+
+    // update the imbalance of the element weights
+    double maxWeight = 0.0;
+    double totalWeight = 0.0;
+    for (int k=1; k<=numPartitions; k++) {
+      if (partitionWeights(k) > maxWeight)
+	maxWeight = partitionWeights(k);
+      totalWeight += partitionWeights(k);
     }
+    if (totalWeight > 0.0)
+      imbalance = maxWeight*numPartitions/totalWeight;
 
     return res;
 }
 
 
 
+int
+DomainPartitioner::setElementWeight(int eleClassTag, double weight)
+{
+  if (weight <= 0.0) {
+    opserr << "DomainPartitioner::setElementWeight - weight " << weight;
+    opserr << " for element class " << eleClassTag << " must be positive\n";
+    return -1;
+  }
+
+  int loc = weightClassTags.getLocation(eleClassTag);
+  if (loc < 0) {
+    loc = weightClassTags.Size();
+    weightClassTags[loc] = eleClassTag;
+  }
+  weightClassValues[loc] = weight;
+
+  return 0;
+}
+
+
+int
+DomainPartitioner::setNumWeightSamples(int numSamples)
+{
+  if (numSamples < 0) {
+    opserr << "DomainPartitioner::setNumWeightSamples - number of samples ";
+    opserr << numSamples << " must not be negative\n";
+    return -1;
+  }
+
+  numWeightSamples = numSamples;
+  return 0;
+}
+
+
+// double getElementWeight(Element &theEle)
+//	Returns the weight of an element in the element graph, the weight
+//	set for the element class if there is one, otherwise an estimate of
+//	the cost of a state determination relative to that of a truss. The
+//	estimates for the common elements come from timings with nonlinear
+//	materials; other elements are assumed to cost (numDOF/4)^3.
+
+double
+DomainPartitioner::getElementWeight(Element &theEle)
+{
+  int classTag = theEle.getClassTag();
+
+  int loc = weightClassTags.getLocation(classTag);
+  if (loc >= 0)
+    return weightClassValues(loc);
+
+  switch (classTag) {
+  case ELE_TAG_Truss:
+  case ELE_TAG_CorotTruss:
+  case ELE_TAG_ZeroLength:
+    return 1.0;
+
+  case ELE_TAG_ElasticBeam2d:
+  case ELE_TAG_ElasticBeam3d:
+    return 2.0;
+
+  case ELE_TAG_TrussSection:
+  case ELE_TAG_CorotTrussSection:
+  case ELE_TAG_ZeroLengthSection:
+    return 5.0;
+
+  case ELE_TAG_SSPquad:
+    return 10.0;
+
+  case ELE_TAG_DispBeamColumn2d:
+  case ELE_TAG_DispBeamColumn3d:
+  case ELE_TAG_ElasticForceBeamColumn2d:
+  case ELE_TAG_ElasticForceBeamColumn3d:
+    return 15.0;
+
+  case ELE_TAG_FourNodeQuad:
+  case ELE_TAG_EnhancedQuad:
+  case ELE_TAG_ConstantPressureVolumeQuad:
+    return 20.0;
+
+  case ELE_TAG_BeamWithHinges2d:
+  case ELE_TAG_BeamWithHinges3d:
+  case ELE_TAG_FourNodeQuadUP:
+  case ELE_TAG_BBarFourNodeQuadUP:
+    return 30.0;
+
+  case ELE_TAG_ForceBeamColumn2d:
+  case ELE_TAG_ForceBeamColumn3d:
+  case ELE_TAG_NLBeamColumn2d:
+  case ELE_TAG_NLBeamColumn3d:
+    return 60.0;
+
+  case ELE_TAG_ShellMITC4:
+    return 300.0;
+
+  case ELE_TAG_Brick:
+  case ELE_TAG_BbarBrick:
+  case ELE_TAG_BrickUP:
+  case ELE_TAG_BBarBrickUP:
+    return 500.0;
+
+  default:
+    double numDOF = theEle.getNumDOF();
+    double weight = numDOF*numDOF*numDOF/64.0;
+    if (weight < 1.0)
+      weight = 1.0;
+    return weight;
+  }
+}
+
+
+double
+DomainPartitioner::getImbalance(void) const
+{
+  return imbalance;
+}
+
+
+// int weighElementGraph(void)
+//	Sets the weight of each vertex in the element graph to the weight 
+//	of the element it represents.
+
+int
+DomainPartitioner::weighElementGraph(void)
+{
+  if (numWeightSamples > 0)
+    return this->measureElementWeights();
+
+  VertexIter &theVertices = theElementGraph->getVertices();
+  Vertex *vertexPtr;
+  while ((vertexPtr = theVertices()) != 0) {
+    Element *elePtr = myDomain->getElement(vertexPtr->getRef());
+    if (elePtr == 0) {
+      opserr << "DomainPartitioner::weighElementGraph - no element ";
+      opserr << vertexPtr->getRef() << " in the domain\n";
+      return -1;
+    }
+    vertexPtr->setWeight(this->getElementWeight(*elePtr));
+  }
+
+  return 0;
+}
+
+
+// int measureElementWeights(void)
+//	Sets the weight of each vertex in the element graph to the time 
+//	numWeightSamples state determinations of the element take. The 
+//	elements are reverted to their last committed state afterwards.
+//	As the model has not yet been analyzed the timings are for the 
+//	current committed state. Elements whose class has a weight set 
+//	are not timed, that weight is taken to be in microseconds.
+
+int
+DomainPartitioner::measureElementWeights(void)
+{
+  VertexIter &theVertices = theElementGraph->getVertices();
+  Vertex *vertexPtr;
+  while ((vertexPtr = theVertices()) != 0) {
+    Element *elePtr = myDomain->getElement(vertexPtr->getRef());
+    if (elePtr == 0) {
+      opserr << "DomainPartitioner::measureElementWeights - no element ";
+      opserr << vertexPtr->getRef() << " in the domain\n";
+      return -1;
+    }
+
+    if (weightClassTags.getLocation(elePtr->getClassTag()) >= 0) {
+      vertexPtr->setWeight(this->getElementWeight(*elePtr));
+      continue;
+    }
+
+    double startTime = getWeightTime();
+    for (int i=0; i<numWeightSamples; i++) {
+      elePtr->update();
+      elePtr->getTangentStiff();
+      elePtr->getResistingForce();
+    }
+    double time = getWeightTime() - startTime;
+
+    if (elePtr->revertToLastCommit() < 0) {
+      opserr << "DomainPartitioner::measureElementWeights - element ";
+      opserr << elePtr->getTag() << " failed to revert to last commit\n";
+      return -1;
+    }
+
+    // weight in microseconds per state determination
+    vertexPtr->setWeight(1.0e6*time/numWeightSamples);
+  }
+
+  return 0;
+}
+
+
 int 
 DomainPartitioner::getNumPartitions(void) const
 {
@@ -631,25 +1020,42 @@ DomainPartitioner::getColoredGraph(void)
       opserr << " - No domain has been set";
       exit(0);
     }
+
+    // once partitioned the colored graph is our copy of the element graph
+    if (partitionFlag == true && theElementGraph != 0)
+      return *theElementGraph;
     
     return myDomain->getElementGraph();
 }
 
 
+// int swapVertex(int from, int to, int vertexTag, bool adjacentVertexNotInOther)
+//	Migrates the element of the vertex from subdomain from to subdomain to.
+//	The element is only moved if it is adjacent to an element of to and, 
+//	if adjacentVertexNotInOther is true, to no element of another 
+//	partition. Elements pinned at partitioning, those connected to nodes 
+//	with constraints or loads and those with elemental loads, are not 
+//	moved. A node left shared by both subdomains is made external and is
+//	added to the PartitionedDomain. Returns 0 if the element was moved, 
+//	1 if it could not be moved and a negative number on an error.
+
 int 
 DomainPartitioner::swapVertex(int from, int to, int vertexTag,
 			      bool adjacentVertexNotInOther)
 {
-  opserr << "DomainPartitioner::swapVertex() " << from << " " << to << " " << vertexTag << endln;
-
-  /*
   // check that the object did the partitioning
   if (partitionFlag == false) {
-    opserr << "DomainPartitioner::balance(const Vector &load)";
+    opserr << "DomainPartitioner::swapVertex";
     opserr << " - not partitioned or DomainPartitioner did not partition\n";
     return -1;
   }
-  
+
+  if (from == to)
+    return 1;
+
+  if (usingMainDomain == true && (from == mainPartition || to == mainPartition))
+    return 1;
+
   // check that the subdomain exist in partitioned domain
   Subdomain *fromSubdomain = myDomain->getSubdomainPtr(from);
   if (fromSubdomain == 0) {
@@ -663,694 +1069,143 @@ DomainPartitioner::swapVertex(int from, int to, int vertexTag,
     opserr << to << " exists\n";
     return -3;
   }    
-  
-  // remove the vertex from the boundary if there
-  // if not there we have to get a pointer to it from the ele graph.
-  
-  //    Graph &theEleGraph = myDomain->getElementGraph();    
-  Graph *fromBoundary = theBoundaryElements[from-1];
-  Graph *toBoundary = theBoundaryElements[to-1];    
-  Vertex *vertexPtr;
-  
-  // get a pointer to the vertex in the element graph
-  if (adjacentVertexNotInOther  == false) {
-    vertexPtr = fromBoundary->removeVertex(vertexTag,false);    
-    if (vertexPtr == 0) 
-      vertexPtr = theElementGraph->getVertexPtr(vertexTag);
-
-    if (vertexPtr == 0)  // if still 0 no vertex given by tag exists
-      return -4;
-  } else { // get a pointer and check vertex not adjacent to another partition
-    vertexPtr = fromBoundary->getVertexPtr(vertexTag);    
-    if (vertexPtr == 0) 
-      vertexPtr = theElementGraph->getVertexPtr(vertexTag);
-    if (vertexPtr == 0)  // if still 0 no vertex given by tag exists
-      return -4;	
-    const ID &adjacent = vertexPtr->getAdjacency();
-    bool inTo = false;
-    bool inOther = false;
-    int adjacentSize = adjacent.Size();
-    for (int i=0; i<adjacentSize; i++) {
-      Vertex *other = theElementGraph->getVertexPtr(adjacent(i));
-      if (other->getColor() == to) 
-	inTo = true;
-      else if (other->getColor() != from) {
-	inOther = true;
-	i = adjacentSize;
-      }
-    }
-    if (inTo != true || inOther == true) // we cannot remove the vertex
-      return -5;
-    // if can remove the vertex from the fromBoundary
-    Vertex *theVertex = fromBoundary->removeVertex(vertexTag,false);
-  }
-  
-  int eleTag = vertexPtr->getRef();
-  
-  //
-  // in the FROM subdomain we:
-  //  1. remove the element
-  //  2. remove all nodes connected to the element divide color by prime
-  //  3. see if have to add nodes back as external
-  //  4. remove from the PartitionedDomain if node was external
-  //  5. add new elements to the boundary vertices for from
-  
-  //  1. remove the element from the fromSubdomain
-    //          this gives us a pointer to the element as well.
-
-    Element *elePtr = fromSubdomain->removeElement(eleTag);
-    if (elePtr == 0) // if ele not there we can just return but ERROR it should be
-  return -6;
-
-    //  2. remove all nodes connected to the element divide color by prime    
-    //  3. add back if still in subdomain
-    //  4. if node external remove from PartitionedDomains external nodes
-    int primeFrom = primes(from);
-    const ID  &nodes1 = elePtr->getExternalNodes(); // create a copy, need after send ele
-    ID  nodes(nodes1);
-
-    int nodesSize = nodes.Size();
-    Node **nodesArray = new Node *[nodesSize];
-    for (int i=0; i<nodesSize; i++) {
-  int nodeTag = nodes(i);
-
-  // remove the node
-  Node *nodePtr = fromSubdomain->removeNode(nodeTag);
-
-  (*nodePlace)(nodeTag) /= primeFrom;
-  nodesArray[i] = nodePtr;
-        // opserr << "DomainPartitioner::swapVertex -NODE " << *nodePtr;
-  // add back as external if still needed
-  if ((*nodePlace)(nodeTag)%primeFrom == 0)
-      fromSubdomain->addExternalNode(nodePtr);
-
-  // if it was external remove from PartitionedDomains external nodes
-  int partition = (*nodePlace)(nodeTag);
-  for (int j=1; j<=numPartitions; j++) 
-      if (j != from) {
-    int prime = primes(j);
-    if (partition%prime == 0) {
-        myDomain->removeExternalNode(nodeTag);
-        j = numPartitions+1;
-    }
-      }
-    }
-
-    // 5. add new elements to boundary vertices of from if connected to
-    //    vertex we just removed and of color of from and not already in boundary
 
-    const ID &eleAdjacent = vertexPtr->getAdjacency();
-    int eleAdjacentSize = eleAdjacent.Size();
-
-    for (int a=0; a<eleAdjacentSize; a++) {
-	int otherEleVertexTag = eleAdjacent(a);
-	Vertex *other = fromBoundary->getVertexPtr(otherEleVertexTag);
-	if (other == 0) {
-	    other = theElementGraph->getVertexPtr(otherEleVertexTag);
-	    if (other->getColor() == from)
-		fromBoundary->addVertex(other,false);
-	}
-    }
+  Vertex *vertexPtr = theElementGraph->getVertexPtr(vertexTag);
+  if (vertexPtr == 0)
+    return -4;
 
+  if (vertexPtr->getColor() != from || 
+      pinnedVertices.getLocationOrdered(vertexTag) >= 0)
+    return 1;
 
-    
-    // in the TO subdomain we:
-    //  1. remove all nodes connected to the element, may or may not be there
-    //     if there don't divide by primeTo. 
-    //  2. mark all connecting nodes of elements as belonging to To
-    //  3. add the nodes, checking if external or internal
-    //  3. add the element
-    //  4. change the vertex color to be to and add vertex to boundary
-    //     also see if we can reduce the size of boundary
-    //     of boundary of to vertices
-
-    //  1. remove all nodes connected to the element, may or may not be there
-    //      if there divide by primeTo, do this as may have been added as extnl
-    int primeTo = primes(to);
-    for (int l=0; l<nodesSize; l++) {    
-  int nodeTag = nodesArray[l]->getTag();
-  int nodeColor = (*nodePlace)(nodeTag);
-  if (nodeColor % primeTo == 0) {
-      Node *nodePtr;
-      nodePtr = toSubdomain->removeNode(nodes(l));
+  // check the vertex is adjacent to to, and to no other if required
+  const ID &adjacent = vertexPtr->getAdjacency();
+  bool inTo = false;
+  bool inOther = false;
+  int adjacentSize = adjacent.Size();
+  for (int i=0; i<adjacentSize; i++) {
+    Vertex *other = theElementGraph->getVertexPtr(adjacent(i));
+    if (other == 0)
+      continue;
+    int otherColor = other->getColor();
+    if (otherColor == to) 
+      inTo = true;
+    else if (otherColor != from)
+      inOther = true;
   }
-    }
 
+  if (inTo == false || (adjacentVertexNotInOther == true && inOther == true))
+    return 1;
 
-    for (int m=0; m<nodesSize; m++) {
-  Node *nodePtr = nodesArray[m];
-  int nodeTag = nodePtr->getTag();
-  
-  //  2. mark all connecting nodes of elements as belonging to To      
-  (*nodePlace)(nodeTag) *= primeTo;
-
-  //  3. add the nodes, checking if external or internal  
-  int internal = 0;
-  for (int n=1; n<=numPartitions; n++) 
-      if (n != to) {
-    int prime = primes(n);
-    if ((*nodePlace)(nodeTag)%prime == 0) { // its external
-        internal = 1;
-        n = numPartitions+1;
-    }
-      }
-  
-  if (internal == 0)
-      toSubdomain->addNode(nodePtr);
-  else {
-      toSubdomain->addExternalNode(nodePtr);
-      myDomain->addNode(nodePtr);
+  // remove the element from the from subdomain
+  int eleTag = vertexPtr->getRef();
+  Element *elePtr = fromSubdomain->removeElement(eleTag);
+  if (elePtr == 0) {
+    opserr << "DomainPartitioner::swapVertex - element " << eleTag;
+    opserr << " not in Subdomain " << from << endln;
+    return -5;
   }
-    }
 
-    delete [] nodesArray; // DELETE nodesArray here should not use nodePtrs
-                          // after here as node objects deleted if parallel    
-    
-    //  3. add the element
-    
-    toSubdomain->addElement(elePtr);
-    
-    //  4. change the vertex color to be to and add vertex to boundary
-    //     also see if we can reduce the size of to's boundary vertices
-
-
-    vertexPtr->setColor(to);
-    toBoundary->addVertex(vertexPtr,false);
-
-    for (int n=0; n<eleAdjacentSize; n++) {
-	int otherEleVertexTag = eleAdjacent(n);
-	Vertex *other = toBoundary->removeVertex(otherEleVertexTag,false);
-	if (other != 0) {
-	    const ID &othersAdjacency = other->getAdjacency();
-	    int otherSize = othersAdjacency.Size();
-	    for (int b=0; b<otherSize; b++) {
-		int anotherEleVertexTag = othersAdjacency(b);
-		Vertex *otherOther = theElementGraph->getVertexPtr(anotherEleVertexTag);
-		if (otherOther->getColor() != to) {
-		    toBoundary->addVertex(other,false);
-		    b=otherSize;
-		}
-	    }
-	}
-    }
-
-
-    // now remove any SP_Constraints that may have been external to 
-    // PartitionedDomain and are now internal to toSubdomain
-    SP_ConstraintIter &theSPs = myDomain->getSPs();
-    SP_Constraint *spPtr;
-    while ((spPtr = theSPs()) != 0) {
-  int nodeTag = spPtr->getNodeTag();
-  for (int i=0; i<nodesSize; i++) {
-      if (nodeTag == nodes(i)) {
-    int internal = 0;
-    for (int j=1; j<=numPartitions; j++) 
-        if (j != to) {
-      int prime = primes(j);
-      if ((*nodePlace)(nodeTag)%prime == 0) {
-          internal = 1;
-          j = numPartitions+1;
-      }
-        }
-    if (internal == 0) { // add to toSubdomain if inteernal
-        myDomain->removeSP_Constraint(spPtr->getTag());
-        toSubdomain->addSP_Constraint(spPtr);
+  // move or share the nodes of the element
+  const ID &nodes = elePtr->getExternalNodes();
+  int numNodes = nodes.Size();
+  for (int j=0; j<numNodes; j++) {
+    int nodeTag = nodes(j);
+    TaggedObject *theObject = theNodeLocations->getComponentPtr(nodeTag);
+    if (theObject == 0) {
+      opserr << "DomainPartitioner::swapVertex - no location for node ";
+      opserr << nodeTag << endln;
+      return -6;
     }
+    NodeLocations *theLocation = (NodeLocations *)theObject;
+
+    bool toHasNode = theLocation->hasPartition(to);
+    int numLeft = theLocation->removeElement(from);
+    theLocation->addPartition(to);
+
+    if (theLocation->external == false) {
+      if (numLeft != 0) {
+	// node now shared: keep it in from as an external node and
+	// add it to the PartitionedDomain and to
+	Node *theCopy = fromSubdomain->makeNodeExternal(nodeTag);
+	if (theCopy == 0) {
+	  opserr << "DomainPartitioner::swapVertex - failed to make node ";
+	  opserr << nodeTag << " external in Subdomain " << from << endln;
+	  return -7;
+	}
+	myDomain->addNode(theCopy);
+	toSubdomain->addExternalNode(theCopy);
+	theLocation->external = true;
+      } else {
+	// node only used by the element: it moves with it
+	Node *nodePtr = fromSubdomain->removeNode(nodeTag);
+	if (nodePtr == 0) {
+	  opserr << "DomainPartitioner::swapVertex - node " << nodeTag;
+	  opserr << " not in Subdomain " << from << endln;
+	  return -7;
+	}
+	toSubdomain->addNode(nodePtr);
       }
-  }
-    }
-
-    
-    
-    // now remove any SP_Constraints that may have been internal to fromSubdomain
-    // and are now external to PartitionedDomain or internal to toSubdomain 
-    SP_ConstraintIter &theSPs2 = fromSubdomain->getSPs();
-    while ((spPtr = theSPs2()) != 0) {
-  int nodeTag = spPtr->getNodeTag();
-  for (int i=0; i<nodesSize; i++) {
-      if (nodeTag == nodes(i)) {
-    fromSubdomain->removeSP_Constraint(spPtr->getTag());
-    int internal = 0;
-    for (int j=1; j<=numPartitions; j++) 
-        if (j != to) {
-      int prime = primes(j);
-      if ((*nodePlace)(nodeTag)%prime == 0) {
-          internal = 1;
-          j = numPartitions+1;
-      }
-        }
-    if (internal == 0) 
-        toSubdomain->addSP_Constraint(spPtr);
-    else
-        myDomain->addSP_Constraint(spPtr);
-      }
-  }
-    }
-
-
-
-  */
-    /*
-    // now remove any NodalLoads that may have been external to 
-    // PartitionedDomain and are now internal to toSubdomain
-    NodalLoadIter &theNodalLoads = myDomain->getNodalLoads();
-    NodalLoad *loadPtr;
-    while ((loadPtr = theNodalLoads()) != 0) {
-  int nodeTag = loadPtr->getNodeTag();
-  for (int i=0; i<nodesSize; i++) {
-      if (nodeTag == nodes(i)) {
-    int internal = 0;
-    for (int j=1; j<=numPartitions; j++) 
-        if (j != to) {
-      int prime = primes(j);
-      if ((*nodePlace)(nodeTag)%prime == 0) {
-          internal = 1;
-          j = numPartitions+1;
+    } else {
+      if (toHasNode == false)
+	toSubdomain->addExternalNode(myDomain->getNode(nodeTag));
+      if (numLeft == 0) {
+	Node *nodePtr = fromSubdomain->removeNode(nodeTag);
+	if (nodePtr != 0)
+	  delete nodePtr;
       }
-        }
-    if (internal == 0) { // add to toSubdomain if inteernal
-        myDomain->removeNodalLoad(loadPtr->getTag());
-        toSubdomain->addNodalLoad(loadPtr);
     }
-      }
   }
-    }
-
 
-    // now remove any NodalLoads that may have been internal to fromSubdomain
-    // and are now external to PartitionedDomain or internal to toSubdomain 
-
-    NodalLoadIter &theNodalLoads2 = myDomain->getNodalLoads();
-    while ((loadPtr = theNodalLoads2()) != 0) {
-  int nodeTag = loadPtr->getNodeTag();
-  for (int i=0; i<nodesSize; i++) {
-      if (nodeTag == nodes(i)) {
-    fromSubdomain->removeNodalLoad(loadPtr->getTag());
-    int internal = 0;
-    for (int j=1; j<=numPartitions; j++) 
-        if (j != to) {
-      int prime = primes(j);
-      if ((*nodePlace)(nodeTag)%prime == 0) {
-          internal = 1;
-          j = numPartitions+1;
-      }
-        }
-    if (internal == 0) 
-        toSubdomain->addNodalLoad(loadPtr);
-    else
-        myDomain->addNodalLoad(loadPtr);
-      }  
+  // add the element to to
+  if (toSubdomain->addElement(elePtr) == false) {
+    opserr << "DomainPartitioner::swapVertex - failed to add element ";
+    opserr << eleTag << " to Subdomain " << to << endln;
+    return -8;
   }
-    }
-    */
 
-    return 0;
+  vertexPtr->setColor(to);
+  double weight = vertexPtr->getWeight();
+  partitionWeights(from) -= weight;
+  partitionWeights(to) += weight;
 
+  return 0;
 }
 
 
-
 // method to move from from to to, all elements on the interface of 
 // from that are adjacent with to.
 
 int 
 DomainPartitioner::swapBoundary(int from, int to, bool adjacentVertexNotInOther)
-          
 {
-  opserr << "DomainPartitioner::swapBoundary: from "  << from << " to " << to << endln;
-  /***********************************************************************************
-    opserr << "DomainPartitioner::swapBoundary from " << from << "  to " << to << endln;
-    Timer timer;
-    timer.start();
-
-    // check that the object did the partitioning
-    if (partitionFlag == false) {
-  opserr << "DomainPartitioner::balance(const Vector &load)";
-  opserr << " - not partitioned or DomainPartitioner did not partition\n";
-  return -1;
-    }
-
-    // check that the subdomains exist in partitioned domain
-    Subdomain *fromSubdomain = myDomain->getSubdomainPtr(from);
-    if (fromSubdomain == 0) {
-  opserr << "DomainPartitioner::swapBoundary - No from Subdomain: ";
-  opserr << from << " exists\n";
-  return -2;
-    }
-
-    Subdomain *toSubdomain = myDomain->getSubdomainPtr(to);
-    if (toSubdomain == 0) {
-  opserr << "DomainPartitioner::swapBoundary - No to Subdomain: ";
-  opserr << to << " exists\n";
-  return -3;
-    }    
-
-    // get the element graph
-    //    Graph &theEleGraph = myDomain->getElementGraph();    
-    Graph *fromBoundary = theBoundaryElements[from-1];
-    Graph *toBoundary = theBoundaryElements[to-1];
-
-    // into a new graph place the vertices that are to be swapped
-    Graph *swapVertices = new Graph(fromBoundary->getNumVertex());
-
-    VertexIter &swappableVertices = fromBoundary->getVertices();
-    Vertex *vertexPtr;
-
-    while ((vertexPtr = swappableVertices()) != 0) {
-	if (adjacentVertexNotInOther == false) {   
-	    const ID &adjacency=vertexPtr->getAdjacency();
-	    int size = adjacency.Size();
-	    for (int i=0; i<size; i++) {
-		int otherTag = adjacency(i);
-		Vertex *otherVertex = toBoundary->getVertexPtr(otherTag);
-		if (otherVertex != 0) {
-		    swapVertices->addVertex(vertexPtr,false);
-		    i = size;
-		}
-	    }
-	}
-	else {
-	    const ID &adjacent = vertexPtr->getAdjacency();
-	    bool inTo = false;
-	    bool inOther = false;
-	    int adjacentSize = adjacent.Size();
-	    for (int i=0; i<adjacentSize; i++) {
-		Vertex *other = theElementGraph->getVertexPtr(adjacent(i));
-		if (other->getColor() == to) 
-		    inTo = true;
-		else if (other->getColor() != from) {
-		    inOther = true;
-		    i = adjacentSize;
-		}
-	    }
-	    if (inTo == true && inOther == false) { // we remove the vertex
-		swapVertices->addVertex(vertexPtr,false);
-		vertexPtr->setColor(to);
-	    }
-	}
-    }
-
-    //
-    // in the FROM subdomain we:
-    //  1. remove the elements corresponding to the vertices
-    //  2. remove all nodes connected to the elements divide color by prime
-    //  3. see if have to add nodes back as external
-    //  4. remove from the PartitionedDomain if node was external
-    //  5. add new elements to the boundary vertices for from
-
-    // 1. first remove all the elements from from subdomain
-    VertexIter &verticesToSwap = swapVertices->getVertices();
-
-    int numEleToSwap = swapVertices->getNumVertex();
-    Element **elementsArray = new Element *[numEleToSwap];
-
-    int count =0; 
-    int numCannotRemove =0;
-    for (int i=0; i<numEleToSwap; i++) {
-      vertexPtr = verticesToSwap();
-  if (vertexPtr == 0) 
-      return -1;
-
-  int vertexTag = vertexPtr->getTag();
-  int eleTag = vertexPtr->getRef();
-
-  // remove the vertex from fromBoundary, set color to to
-  // and add to toBoundary
-  bool inFrom = true;
-  vertexPtr = fromBoundary->removeVertex(vertexTag,false);
-
-
-  if (inFrom == true) {
-      vertexPtr->setColor(to);
-      toBoundary->addVertex(vertexPtr,false);
-      Element *elePtr = fromSubdomain->removeElement(eleTag);
-      if (elePtr == 0) // if ele not there we can just return IT SHOULD BE
-    return -4;
-      elementsArray[count] = elePtr;
-      count++;
-  }
-  else  // we cannot remove the element
-      numCannotRemove++;
-    }
-    numEleToSwap -= numCannotRemove;
-
-    //  2. remove all nodes connected to the elements divide color by prime    
-    //     for each element and add back if still in subdomain
-    //  3. add back if still in subdomain
-    //  4. if node external remove from PartitionedDomains external nodes
-
-    // first determine which nodes to remove
-    int primeFrom = primes(from);
-    int primeTo = primes(to);
-    int numNodToSwap = 0;
-    ID nodesToRemove(0,128);
-    for (int j=0; j<numEleToSwap; j++) {
-  Element *elePtr = elementsArray[j];
-  const ID  &nodes = elePtr->getExternalNodes(); 
-  
-  int nodesSize = nodes.Size();
-
-  for (int k=0; k<nodesSize; k++) {
-      int nodeTag = nodes(k);
-      int loc = nodesToRemove.getLocation(nodeTag);
-      if (loc < 0) {
-    nodesToRemove[numNodToSwap] = nodeTag;
-    numNodToSwap++;
-      }
-      (*nodePlace)(nodeTag) /= primeFrom;    
-      (*nodePlace)(nodeTag) *= primeTo;        
-  }
-    }
-
-    // remove the nodes
-    Node **nodesArray = new Node *[numNodToSwap];  
-    for (int k=0; k<numNodToSwap; k++) {
-  int nodeTag = nodesToRemove(k); 
-  Node *nodePtr = fromSubdomain->removeNode(nodeTag);
-  nodesArray[k] = nodePtr;
-
-  // add the node back to from if still external
-  if ((*nodePlace)(nodeTag)%primeFrom == 0)
-      fromSubdomain->addExternalNode(nodePtr);
-
-  // if it was external remove from PartitionedDomains external nodes
-  int partition = (*nodePlace)(nodeTag);
-  for (int j=1; j<=numPartitions; j++) 
-      if (j != from) {
-    int prime = primes(j);
-    if (partition%prime == 0) {
-        myDomain->removeExternalNode(nodeTag);
-        j = numPartitions+1;
-    }
-      }
-    }
-
-    // 5. add new vertices to boundary vertices of from if connected to
-    //    vertex we just removed and of color of from and not already in boundary
-
-    VertexIter &verticesToSwap2 = swapVertices->getVertices();
-    while ((vertexPtr = verticesToSwap2()) != 0) {
-  const ID &vertexAdjacent = vertexPtr->getAdjacency();
-  int vertexAdjacentSize = vertexAdjacent.Size();
-
-	for (int a=0; a<vertexAdjacentSize; a++) {
-	    int otherEleVertexTag = vertexAdjacent(a);
-	    Vertex *other = fromBoundary->getVertexPtr(otherEleVertexTag);
-	    if (other == 0) {
-		other = theElementGraph->getVertexPtr(otherEleVertexTag);
-		if (other->getColor() == from)
-		    fromBoundary->addVertex(other,false);
-	    }
-	}	
-    }
-
-
-    // in the TO subdomain we:
-    //  1. remove all nodes connected to the element, may or may not be there
-    //     if there don't divide by primeTo. 
-    //  2. mark all connecting nodes of elements as belonging to To
-    //  3. add the nodes, checking if external or internal
-    //  3. add the element
-    //  4. change the vertex color to be to and add vertex to boundary
-    //     also see if we can reduce the size of boundary
-    //     of boundary of to vertices
-
-    //  1. remove all nodes connected to the element, may or may not be there
-    //      if there divide by primeTo, do this as may have been added as extnl
-
-    for (int l=0; l<numNodToSwap; l++) {    
-  int nodeTag = nodesArray[l]->getTag();
-  Node *nodePtr;
-  nodePtr = toSubdomain->removeNode(nodesToRemove(l));
-    }
-
-
-    for (int m=0; m<numNodToSwap; m++) {
-  Node *nodePtr = nodesArray[m];
-  int nodeTag = nodePtr->getTag();
-  
-  //  3. add the nodes, checking if external or internal  
-  int internal = 0;
-  for (int n=1; n<=numPartitions; n++) 
-      if (n != to) {
-    int prime = primes(n);
-    if ((*nodePlace)(nodeTag)%prime == 0) { // its external
-        internal = 1;
-        n = numPartitions+1;
-    }
-      }
-  
-  if (internal == 0)
-      toSubdomain->addNode(nodePtr);
-  else {
-      toSubdomain->addExternalNode(nodePtr);
-      myDomain->addNode(nodePtr);
+  // check that the object did the partitioning
+  if (partitionFlag == false) {
+    opserr << "DomainPartitioner::swapBoundary";
+    opserr << " - not partitioned or DomainPartitioner did not partition\n";
+    return -1;
   }
-    }
-
 
-    delete [] nodesArray; // DELETE nodesArray here should not use nodePtrs
-                          // after here as node objects deleted if parallel    
-    
-    //  3. add the elements
-    for (int a=0; a<numEleToSwap; a++)
-  toSubdomain->addElement(elementsArray[a]);
-
-
-    //  4. change the vertex color to be to and add vertex to boundary
-    //     also see if we can reduce the size of to's boundary vertices
-
-    VertexIter &verticesToSwap3 = swapVertices->getVertices();
-    while ((vertexPtr = verticesToSwap3()) != 0) {
-	const ID &vertexAdjacent = vertexPtr->getAdjacency();
-	int vertexAdjacentSize = vertexAdjacent.Size();
-	for (int n=0; n<vertexAdjacentSize; n++) {
-	    int otherEleVertexTag = vertexAdjacent(n);
-	    Vertex *other = toBoundary->removeVertex(otherEleVertexTag,false);
-	    if (other != 0) {
-		const ID &othersAdjacency = other->getAdjacency();
-		int otherSize = othersAdjacency.Size();
-		for (int b=0; b<otherSize; b++) {
-		    int anotherEleVertexTag = othersAdjacency(b);
-		    Vertex *otherOther 
-			= theElementGraph->getVertexPtr(anotherEleVertexTag);
-		    if (otherOther->getColor() != to) {
-			toBoundary->addVertex(other,false);
-			b=otherSize;
-		    }
-		}
-	    }
-	}
-    }
-
-    // now remove any SP_Constraints that may have been external to 
-    // PartitionedDomain and are now internal to toSubdomain
-    SP_ConstraintIter &theSPs = myDomain->getSPs();
-    SP_Constraint *spPtr;
-    while ((spPtr = theSPs()) != 0) {
-  int nodeTag = spPtr->getNodeTag();
-  int loc = nodesToRemove.getLocation(nodeTag);
-  if (loc >= 0) {
-      int internal = 0;
-      for (int j=1; j<=numPartitions; j++) 
-    if (j != to) {
-        int prime = primes(j);
-        if ((*nodePlace)(nodeTag)%prime == 0) {
-      internal = 1;
-      j = numPartitions+1;
-        }
-    }
-      if (internal == 0) { // add to toSubdomain if inteernal
-    myDomain->removeSP_Constraint(spPtr->getTag());
-    toSubdomain->addSP_Constraint(spPtr);
-      }
+  // collect the vertices first, the colors change as they are moved
+  ID boundary(0, 64);
+  this->getBoundaryVertices(from, to, boundary);
+
+  int numSwapped = 0;
+  int numBoundary = boundary.Size();
+  for (int i=0; i<numBoundary; i++) {
+    int res = this->swapVertex(from, to, boundary(i), adjacentVertexNotInOther);
+    if (res < 0) 
+      return res;
+    if (res == 0)
+      numSwapped++;
   }
-    }
-
-    
-    // now remove any SP_Constraints that may have been internal to fromSubdomain
-    // and are now external to PartitionedDomain or internal to toSubdomain 
-    SP_ConstraintIter &theSPs2 = fromSubdomain->getSPs();
-    while ((spPtr = theSPs2()) != 0) {
-  int nodeTag = spPtr->getNodeTag();
-  int loc = nodesToRemove.getLocation(nodeTag);
-  if (loc >= 0) {
-      fromSubdomain->removeSP_Constraint(spPtr->getTag());
-      int internal = 0;
-      for (int j=1; j<=numPartitions; j++) 
-    if (j != to) {
-        int prime = primes(j);
-        if ((*nodePlace)(nodeTag)%prime == 0) {
-      internal = 1;
-      j = numPartitions+1;
-        }
-    }
-      if (internal == 0) 
-    toSubdomain->addSP_Constraint(spPtr);
-      else
-    myDomain->addSP_Constraint(spPtr);
-  }  
-    }
 
-    // now remove any NodalLoads that may have been external to 
-    // PartitionedDomain and are now internal to toSubdomain
-    NodalLoadIter &theNodalLoads = myDomain->getNodalLoads();
-    NodalLoad *loadPtr;
-    while ((loadPtr = theNodalLoads()) != 0) {
-  int nodeTag = loadPtr->getNodeTag();
-  int loc = nodesToRemove.getLocation(nodeTag);
-  if (loc >= 0) {
-
-      int internal = 0;
-      for (int j=1; j<=numPartitions; j++) 
-    if (j != to) {
-        int prime = primes(j);
-        if ((*nodePlace)(nodeTag)%prime == 0) {
-      internal = 1;
-      j = numPartitions+1;
-        }
-    }
-      if (internal == 0) { // add to toSubdomain if inteernal
-    myDomain->removeNodalLoad(loadPtr->getTag());
-    toSubdomain->addNodalLoad(loadPtr);
-      }
+  if (numSwapped != 0) {
+    opserr << "DomainPartitioner::swapBoundary - moved " << numSwapped;
+    opserr << " elements from " << from << " to " << to << endln;
   }
-    }
-
 
-    // now remove any NodalLoads that may have been internal to fromSubdomain
-    // and are now external to PartitionedDomain or internal to toSubdomain 
-
-    NodalLoadIter &theNodalLoads2 = myDomain->getNodalLoads();
-    while ((loadPtr = theNodalLoads2()) != 0) {
-  int nodeTag = loadPtr->getNodeTag();
-  int loc = nodesToRemove.getLocation(nodeTag);
-  if (loc >= 0) {
-      fromSubdomain->removeNodalLoad(loadPtr->getTag());
-      int internal = 0;
-      for (int j=1; j<=numPartitions; j++) 
-    if (j != to) {
-        int prime = primes(j);
-        if ((*nodePlace)(nodeTag)%prime == 0) {
-      internal = 1;
-      j = numPartitions+1;
-        }
-    }
-      if (internal == 0) 
-    toSubdomain->addNodalLoad(loadPtr);
-      else
-    myDomain->addNodalLoad(loadPtr);
-  }  
-    }
-
-
-    delete swapVertices;
-
-    timer.pause();
-    opserr << "DomainPartitioner::swapBoundary DONE" << timer.getReal() << endln;
-
-  ***************************************************************************/
-    return 0;
+  return 0;
 }
 
 
@@ -1364,28 +1219,20 @@ DomainPartitioner::releaseVertex(int from,
 {
   // check that the object did the partitioning
   if (partitionFlag == false) {
-    opserr << "DomainPartitioner::balance(const Vector &load)";
+    opserr << "DomainPartitioner::releaseVertex";
     opserr << " - not partitioned or DomainPartitioner did not partition\n";
     return -1;
   }
   
-  // we first check the vertex is on the fromBoundary
   Subdomain *fromSubdomain = myDomain->getSubdomainPtr(from);
   if (fromSubdomain == 0) {
-    opserr << "DomainPartitioner::swapVertex - No from Subdomain: ";
+    opserr << "DomainPartitioner::releaseVertex - No from Subdomain: ";
     opserr << from << " exists\n";
     return -1;
   }
 
-  // get the vertex from the boundary vertices of from
-  // Graph &theEleGraph = myDomain->getElementGraph();    
-  Graph *fromBoundary = theBoundaryElements[from-1];
-    
-  Vertex *vertexPtr = fromBoundary->getVertexPtr(vertexTag);
-  if (vertexPtr == 0) 
-    vertexPtr = theElementGraph->getVertexPtr(vertexTag);
-  
-  if (vertexPtr == 0)  // if still 0 no vertex given by tag exists
+  Vertex *vertexPtr = theElementGraph->getVertexPtr(vertexTag);
+  if (vertexPtr == 0)  // no vertex given by tag exists
     return -3;
 
   ID attraction(numPartitions+1);
@@ -1397,43 +1244,55 @@ DomainPartitioner::releaseVertex(int from,
   for (int i=0; i<numAdjacent; i++) {
     int otherTag = adjacent(i);
     Vertex *otherVertex = theElementGraph->getVertexPtr(otherTag);
+    if (otherVertex == 0)
+      continue;
     int otherPartition = otherVertex->getColor();
     if (otherPartition != from)
       attraction(otherPartition) += 1;
   }
   
   // determine the other partition the vertex is most attracted to
-  int partition = 1;
-  int maxAttraction = attraction(1);
-  for (int j=2; j<=numPartitions; j++)
+  int partition = 0;
+  int maxAttraction = 0;
+  for (int j=1; j<=numPartitions; j++)
     if (attraction(j) > maxAttraction) {
       partition = j;
       maxAttraction = attraction(j);
     }
 
-  // swap the vertex
-  if (mustReleaseToLighter == false)
-    return swapVertex(from, partition, vertexTag, adjacentVertexNotInOther);
-  
-  else { // check the other partition has a lighter load
-    Vertex *fromVertex = theWeightedPartitionGraph.getVertexPtr(from);
-    Vertex *toVertex = theWeightedPartitionGraph.getVertexPtr(partition);	    
-    
-    double fromWeight = fromVertex->getWeight();
-    double toWeight  = toVertex->getWeight();
-    
-    if (fromWeight == toWeight)
-      opserr << "DomainPartitioner::releaseVertex - TO CHANGE >= to >\n";
-
-    if (fromWeight >= toWeight) {
-      if (toWeight == 0.0) 
-	return swapVertex(from,partition,vertexTag,adjacentVertexNotInOther);	    
-      if (fromWeight/toWeight > factorGreater)        
-	return swapVertex(from,partition,vertexTag,adjacentVertexNotInOther);	    
-    }
+  if (partition == 0)
+    return 1;
+
+  Vertex *fromVertex = theWeightedPartitionGraph.getVertexPtr(from);
+  Vertex *toVertex = theWeightedPartitionGraph.getVertexPtr(partition);	    
+  if (fromVertex == 0 || toVertex == 0) 
+    return 1;
+
+  double fromWeight = fromVertex->getWeight();
+  double toWeight  = toVertex->getWeight();
+
+  // check the other partition has a lighter load
+  if (mustReleaseToLighter == true) {
+    if (fromWeight <= toWeight)
+      return 1;
+    if (toWeight != 0.0 && fromWeight/toWeight <= factorGreater)
+      return 1;
+  }
+
+  double vertexWeight = vertexPtr->getWeight();
+  double fromElementWeight = partitionWeights(from);
+
+  int res = this->swapVertex(from, partition, vertexTag, adjacentVertexNotInOther);
+
+  // move the element's share of the measured cost to the other partition
+  // so that subsequent releases see the shifted load
+  if (res == 0 && fromElementWeight > 0.0) {
+    double share = fromWeight*vertexWeight/fromElementWeight;
+    fromVertex->setWeight(fromWeight - share);
+    toVertex->setWeight(toWeight + share);
   }
   
-  return 0;
+  return res;
 }
 
 
@@ -1447,46 +1306,74 @@ DomainPartitioner::releaseBoundary(int from,
 {
     // check that the object did the partitioning
     if (partitionFlag == false) {
-      opserr << "DomainPartitioner::balance(const Vector &load)";
+      opserr << "DomainPartitioner::releaseBoundary";
       opserr << " - not partitioned or DomainPartitioner did not partition\n";
       return -1;
     }
 
-    // we first get a pointer to fromSubdomain & the fromBoundary
     Subdomain *fromSubdomain = myDomain->getSubdomainPtr(from);
     if (fromSubdomain == 0) {
-      opserr << "DomainPartitioner::swapVertex - No from Subdomain: ";
+      opserr << "DomainPartitioner::releaseBoundary - No from Subdomain: ";
       opserr << from << " exists\n";
       return -1;
     }
 
-    //    Graph &theEleGraph = myDomain->getElementGraph();    
-    Graph *fromBoundary = theBoundaryElements[from-1];
+    // collect the vertices on the boundary of from first, we cannot 
+    // iterate over the graph as the colors change in called methods
+    ID boundary(0, 64);
+    this->getBoundaryVertices(from, 0, boundary);
+
+    // release all the vertices on the boundary
+    int numReleased = 0;
+    int numBoundary = boundary.Size();
+    for (int i=0; i<numBoundary; i++) {
+      int res = this->releaseVertex(from,
+				    boundary(i),
+				    theWeightedPartitionGraph,
+				    mustReleaseToLighter,
+				    factorGreater,
+				    adjacentVertexNotInOther);
+      if (res < 0)
+	return res;
+      if (res == 0)
+	numReleased++;
+    }
 
-    // into a new graph place the vertices on the fromBoundary
-    // we cannot use fromBoundary as this would empty all the nodes
-    // as fromBoundary changes in called methods
+    if (numReleased != 0) {
+      opserr << "DomainPartitioner::releaseBoundary - released " << numReleased;
+      opserr << " elements from " << from << endln;
+    }
 
-    Graph *swapVertices = new Graph(fromBoundary->getNumVertex());
+    return 0;
+}
 
-    VertexIter &swappableVertices = fromBoundary->getVertices();
-    Vertex *vertexPtr;
 
-    while ((vertexPtr = swappableVertices()) != 0) 
-      swapVertices->addVertex(vertexPtr,false);
-
-    // release all the vertices in the swapVertices
-    VertexIter &verticesToSwap = swapVertices->getVertices();
-    while ((vertexPtr = verticesToSwap()) != 0)
-      releaseVertex(from,
-		    vertexPtr->getTag(),
-		    theWeightedPartitionGraph,
-		    mustReleaseToLighter,
-		    factorGreater,
-		    adjacentVertexNotInOther);
-    
-    delete swapVertices;    
+// void getBoundaryVertices(int from, int to, ID &boundary)
+//	Places in boundary the tags of the vertices of partition from that
+//	are adjacent to a vertex of partition to, or to a vertex of any other
+//	partition if to is 0.
 
-    return 0;
-}
+void
+DomainPartitioner::getBoundaryVertices(int from, int to, ID &boundary)
+{
+  int numBoundary = 0;
+  VertexIter &theVertices = theElementGraph->getVertices();
+  Vertex *vertexPtr;
+  while ((vertexPtr = theVertices()) != 0) {
+    if (vertexPtr->getColor() != from)
+      continue;
 
+    const ID &adjacent = vertexPtr->getAdjacency();
+    int numAdjacent = adjacent.Size();
+    for (int i=0; i<numAdjacent; i++) {
+      Vertex *other = theElementGraph->getVertexPtr(adjacent(i));
+      if (other == 0)
+	continue;
+      int otherColor = other->getColor();
+      if (otherColor != from && (to == 0 || otherColor == to)) {
+	boundary[numBoundary++] = vertexPtr->getTag();
+	break;
+      }
+    }
+  }
+}
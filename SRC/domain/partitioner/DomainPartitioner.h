@@ -39,13 +39,14 @@
 #endif
 
 #include <ID.h>
+#include <Vector.h>
 
 class GraphPartitioner;
 class LoadBalancer;
 class PartitionedDomain;
-class Vector;
 class Graph;
 class TaggedObjectStorage;
+class Element;
 
 class DomainPartitioner
 {
@@ -60,8 +61,16 @@ class DomainPartitioner
     virtual void setPartitionedDomain(PartitionedDomain &theDomain);
     virtual int partition(int numParts, bool useMainDomain = false, int mainPartition = 0);
 
+    virtual int setLoadBalancer(LoadBalancer &theLoadBalancer);
+    virtual int setBalanceInterval(int numSteps, double imbalanceThreshold);
     virtual int balance(Graph &theWeightedSubdomainGraph);
 
+    // public member functions to weight the elements by their cost
+    virtual int setElementWeight(int eleClassTag, double weight);
+    virtual int setNumWeightSamples(int numSamples);
+    virtual double getElementWeight(Element &theEle);
+    virtual double getImbalance(void) const;
+
     // public member functions needed by the load balancer
     virtual int getNumPartitions(void) const;
     virtual Graph &getPartitionGraph(void);
@@ -92,12 +101,17 @@ class DomainPartitioner
   protected:    
     
   private:
+    int weighElementGraph(void);
+    int measureElementWeights(void);
+    void getBoundaryVertices(int from, int to, ID &boundary);
+    
     PartitionedDomain *myDomain; 
     GraphPartitioner  &thePartitioner;
     LoadBalancer      *theBalancer;    
 
-    Graph *theElementGraph;
-    Graph **theBoundaryElements; 
+    Graph *theElementGraph;    // colored copy of the element graph
+    ID pinnedVertices;         // vertices whose elements are never migrated
+    Vector partitionWeights;   // sum of the vertex weights in each partition
     
     TaggedObjectStorage *theNodeLocations;
     ID *elementPlace;
@@ -107,6 +121,16 @@ class DomainPartitioner
     
     bool usingMainDomain;
     int mainPartition;
+
+    ID weightClassTags;        // element classes with user specified weights
+    Vector weightClassValues;  // .. and the weights
+    int numWeightSamples;      // if > 0 weights are measured element timings
+    double imbalance;          // max/mean partition weight of last partition
+
+    Vector subdomainCosts;     // subdomain costs summed since last balance step
+    int balanceInterval;       // number of commits between balance steps
+    int numBalanceSteps;       // commits since last balance step
+    double balanceThreshold;   // cost imbalance above which elements migrate
 };
 
 #endif
@@ -37,7 +37,9 @@
 #include <PathSeries.h>
 #include <Vector.h>
 #include <Channel.h>
+#include <TimeSeriesFile.h>
 #include <math.h>
+#include <string.h>
 
 #include <fstream>
 using std::ifstream;
@@ -47,7 +49,8 @@ using std::ios;
 
 PathSeries::PathSeries()	
   :TimeSeries(TSERIES_TAG_PathSeries),
-   thePath(0), pathTimeIncr(0.0), cFactor(0.0), otherDbTag(0), lastSendCommitTag(-1)
+   thePath(0), pathTimeIncr(0.0), cFactor(0.0), otherDbTag(0), lastSendCommitTag(-1),
+   theFileName(0), theFileData(0)
 {
   // does nothing
 }
@@ -57,7 +60,8 @@ PathSeries::PathSeries(int tag,
 		       double theTimeIncr, 
 		       double theFactor)
   :TimeSeries(tag, TSERIES_TAG_PathSeries),
-   thePath(0), pathTimeIncr(theTimeIncr), cFactor(theFactor), otherDbTag(0), lastSendCommitTag(-1)
+   thePath(0), pathTimeIncr(theTimeIncr), cFactor(theFactor), otherDbTag(0), lastSendCommitTag(-1),
+   theFileName(0), theFileData(0)
 {
   // create a copy of the vector containg path points
   thePath = new Vector(theLoadPath);
@@ -78,8 +82,46 @@ PathSeries::PathSeries(int tag,
 		       double theTimeIncr, 
 		       double theFactor)
   :TimeSeries(tag, TSERIES_TAG_PathSeries),
-   thePath(0), pathTimeIncr(theTimeIncr), cFactor(theFactor), otherDbTag(0), lastSendCommitTag(-1)
+   thePath(0), pathTimeIncr(theTimeIncr), cFactor(theFactor), otherDbTag(0), lastSendCommitTag(-1),
+   theFileName(0), theFileData(0)
 {
+  // binary time series files are mapped, the data shared with any other 
+  // series using the same file
+  if (isTimeSeriesFile(fileName) == true) {
+    int numDataPoints = 0;
+    double startTime, fileTimeIncr;
+    double *times;
+    theFileData = openTimeSeriesFile(fileName, numDataPoints, startTime, fileTimeIncr, times);
+    if (theFileData == 0)
+      return;
+
+    // the points of a PathSeries are at 0, dt, 2dt, .. so the times in
+    // the file must be of that form
+    if (times != 0 || startTime != 0.0) {
+      opserr << "WARNING - PathSeries::PathSeries() - file " << fileName;
+      opserr << " holds times not starting at 0.0 with a constant dt, use a Path -file series\n";
+      numDataPoints = 0;
+    } 
+
+    // a time increment stored in the file is the one the data is for
+    else if (fileTimeIncr > 0.0) {
+      if (fabs(fileTimeIncr - pathTimeIncr) > 1.0e-8*fileTimeIncr)
+	opserr << "WARNING - PathSeries::PathSeries() - using dt " << fileTimeIncr 
+	       << " of file " << fileName << " not " << pathTimeIncr << endln;
+      pathTimeIncr = fileTimeIncr;
+    }
+
+    if (numDataPoints > 0) {
+      thePath = new Vector(theFileData, numDataPoints);
+      theFileName = new char[strlen(fileName)+1];
+      strcpy(theFileName, fileName);
+    } else {
+      closeTimeSeriesFile(theFileData);
+      theFileData = 0;
+    }
+    return;
+  }
+
   // determine the number of data points .. open file and count num entries
   int numDataPoints =0;
   double dataPoint;
@@ -140,10 +182,18 @@ PathSeries::~PathSeries()
 {
   if (thePath != 0)
     delete thePath;
+  if (theFileData != 0)
+    closeTimeSeriesFile(theFileData);
+  if (theFileName != 0)
+    delete [] theFileName;
 }
 
 TimeSeries *
 PathSeries::getCopy(void) {
+  // copy of a series from a binary file shares the file data
+  if (theFileData != 0)
+    return new PathSeries(this->getTag(), theFileName, pathTimeIncr, cFactor);
+
   return new PathSeries(this->getTag(), *thePath, pathTimeIncr, cFactor);
 }
 
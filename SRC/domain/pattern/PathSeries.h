@@ -82,6 +82,8 @@ class PathSeries : public TimeSeries
     double cFactor;       // additional factor on the returned load factor
     int otherDbTag;       // a database tag needed for the vector object
     int lastSendCommitTag;
+    char *theFileName;    // name of binary file if data is from a mapped file
+    double *theFileData;  // the shared data in that file
 };
 
 #endif
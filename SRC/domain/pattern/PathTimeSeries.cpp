@@ -38,7 +38,9 @@
 #include <PathTimeSeries.h>
 #include <Vector.h>
 #include <Channel.h>
+#include <TimeSeriesFile.h>
 #include <math.h>
+#include <string.h>
 
 #include <fstream>
 using std::ifstream;
@@ -49,7 +51,8 @@ using std::ios;
 PathTimeSeries::PathTimeSeries()	
   :TimeSeries(TSERIES_TAG_PathTimeSeries),
    thePath(0), time(0), currentTimeLoc(0), 
-   cFactor(0.0), dbTag1(0), dbTag2(0), lastSendCommitTag(-1)
+   cFactor(0.0), dbTag1(0), dbTag2(0), lastSendCommitTag(-1), lastChannel(0),
+   startTime(0.0), timeIncr(0.0), theFileName(0), theFileData(0)
 {
   // does nothing
 }
@@ -61,7 +64,8 @@ PathTimeSeries::PathTimeSeries(int tag,
 			       double theFactor)
   :TimeSeries(tag, TSERIES_TAG_PathTimeSeries),
    thePath(0), time(0), currentTimeLoc(0), 
-   cFactor(theFactor), dbTag1(0), dbTag2(0), lastSendCommitTag(-1), lastChannel(0)
+   cFactor(theFactor), dbTag1(0), dbTag2(0), lastSendCommitTag(-1), lastChannel(0),
+   startTime(0.0), timeIncr(0.0), theFileName(0), theFileData(0)
 {
   // check vectors are of same size
   if (theLoadPath.Size() != theTimePath.Size()) {
@@ -86,6 +90,8 @@ PathTimeSeries::PathTimeSeries(int tag,
       time = 0;
     }
   }
+
+  this->setTimeIncr();
 }
 
 
@@ -96,8 +102,14 @@ PathTimeSeries::PathTimeSeries(int tag,
 			       
   :TimeSeries(tag, TSERIES_TAG_PathTimeSeries),
    thePath(0), time(0), currentTimeLoc(0), 
-   cFactor(theFactor), dbTag1(0), dbTag2(0), lastSendCommitTag(-1), lastChannel(0)
+   cFactor(theFactor), dbTag1(0), dbTag2(0), lastSendCommitTag(-1), lastChannel(0),
+   startTime(0.0), timeIncr(0.0), theFileName(0), theFileData(0)
 {
+  // a binary time series file holds both path & time
+  if (isTimeSeriesFile(filePathName) == true) {
+    this->openBinaryFile(filePathName);
+    return;
+  }
 
   // determine the number of data points
   int numDataPoints1 =0;
@@ -196,6 +208,8 @@ PathTimeSeries::PathTimeSeries(int tag,
       }   // read in the path data and then do the time
     }
   }
+
+  this->setTimeIncr();
 }
 
 
@@ -204,9 +218,15 @@ PathTimeSeries::PathTimeSeries(int tag,
 			       double theFactor)
   :TimeSeries(tag, TSERIES_TAG_PathTimeSeries),
    thePath(0), time(0), currentTimeLoc(0), 
-   cFactor(theFactor), dbTag1(0), dbTag2(0), lastChannel(0)
+   cFactor(theFactor), dbTag1(0), dbTag2(0), lastSendCommitTag(-1), lastChannel(0),
+   startTime(0.0), timeIncr(0.0), theFileName(0), theFileData(0)
 {
-
+  // binary time series files are mapped, the data shared with any other 
+  // series using the same file
+  if (isTimeSeriesFile(fileName) == true) {
+    this->openBinaryFile(fileName);
+    return;
+  }
 
   // determine the number of data points
   int numDataPoints = 0;
@@ -280,6 +300,8 @@ PathTimeSeries::PathTimeSeries(int tag,
       theFile1.close();
     } 
   }
+
+  this->setTimeIncr();
 }
 
 PathTimeSeries::~PathTimeSeries()
@@ -288,15 +310,91 @@ PathTimeSeries::~PathTimeSeries()
     delete thePath;
   if (time != 0)
     delete time;
+  if (theFileData != 0)
+    closeTimeSeriesFile(theFileData);
+  if (theFileName != 0)
+    delete [] theFileName;
 }
 
 TimeSeries *
 PathTimeSeries::getCopy(void) 
 {
+  // copy of a series from a binary file shares the file data
+  if (theFileData != 0)
+    return new PathTimeSeries(this->getTag(), theFileName, cFactor);
+
   return new PathTimeSeries(this->getTag(), *thePath, *time, cFactor);
 }
 
 
+int
+PathTimeSeries::openBinaryFile(const char *fileName)
+{
+  int numDataPoints = 0;
+  double *times = 0;
+  theFileData = openTimeSeriesFile(fileName, numDataPoints, startTime, timeIncr, times);
+  if (theFileData == 0 || numDataPoints == 0) {
+    if (theFileData != 0)
+      closeTimeSeriesFile(theFileData);
+    theFileData = 0;
+    timeIncr = 0.0;
+    return -1;
+  }
+
+  // the file must give the times, either stored or by the increment
+  if (times == 0 && timeIncr <= 0.0) {
+    opserr << "WARNING - PathTimeSeries::PathTimeSeries() - file " << fileName;
+    opserr << " holds no times, use a Path -dt dt -filePath series\n";
+    closeTimeSeriesFile(theFileData);
+    theFileData = 0;
+    timeIncr = 0.0;
+    return -1;
+  }
+
+  thePath = new Vector(theFileData, numDataPoints);
+
+  // times are either in the file or need to be generated from the increment
+  if (times != 0)
+    time = new Vector(times, numDataPoints);
+  else {
+    time = new Vector(numDataPoints);
+    for (int i=0; i<numDataPoints; i++)
+      (*time)(i) = startTime + i*timeIncr;
+  }
+
+  theFileName = new char[strlen(fileName)+1];
+  strcpy(theFileName, fileName);
+
+  this->setTimeIncr();
+
+  return 0;
+}
+
+
+void
+PathTimeSeries::setTimeIncr(void)
+{
+  // if time points are uniformly spaced getFactor() can find the
+  // interval directly without searching
+  timeIncr = 0.0;
+  if (time == 0 || time->Size() < 2)
+    return;
+
+  int size = time->Size();
+  startTime = (*time)(0);
+  double incr = ((*time)(size-1) - startTime)/(size-1);
+  if (incr <= 0.0)
+    return;
+
+  double tol = 1.0e-8*incr;
+  for (int i=1; i<size; i++) 
+    if (fabs((*time)(i) - (startTime + i*incr)) > tol)
+      return;
+
+  timeIncr = incr;
+}
+
+
 double
 PathTimeSeries::getTimeIncr (double pseudoTime)
 {
@@ -311,6 +409,26 @@ PathTimeSeries::getFactor(double pseudoTime)
   if (thePath == 0)
     return 0.0;
 
+  // if uniformly spaced, the interval holding time found directly
+  if (timeIncr != 0.0) {
+    double incr = (pseudoTime - startTime)/timeIncr;
+    if (incr < 0.0)
+      return 0.0;
+
+    int loc = (int)floor(incr);
+    int sizem1 = time->Size() - 1;
+    if (loc >= sizem1) {
+      if (loc == sizem1 && incr == loc)
+	return cFactor * (*thePath)[sizem1];
+      return 0.0;
+    }
+
+    currentTimeLoc = loc;
+    double value1 = (*thePath)[loc];
+    double value2 = (*thePath)[loc+1];
+    return cFactor*(value1 + (value2-value1)*(incr - loc));
+  }
+
   // determine indexes into the data array whose boundary holds the time
   double time1 = (*time)(currentTimeLoc);
 
@@ -500,6 +618,8 @@ PathTimeSeries::recvSelf(int commitTag, Channel &theChannel,
       opserr << "channel failed to receive tha time Vector\n";
       return result;  
     }
+
+    this->setTimeIncr();
   }
   return 0;    
 }
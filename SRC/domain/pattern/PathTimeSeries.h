@@ -83,6 +83,9 @@ class PathTimeSeries : public TimeSeries
   protected:
     
   private:
+    int openBinaryFile(const char *fileName);
+    void setTimeIncr(void);
+
     Vector *thePath;      // vector containg the data points
     Vector *time;		  // vector containg the time values of data points
     int currentTimeLoc;   // current location in time
@@ -91,6 +94,11 @@ class PathTimeSeries : public TimeSeries
     int lastSendCommitTag;
 
     Channel *lastChannel;
+
+    double startTime;     // time of first point & time increment if the 
+    double timeIncr;      // times uniformly spaced (timeIncr = 0 if not)
+    char *theFileName;    // name of binary file if data is from a mapped file
+    double *theFileData;  // the shared data in that file
 };
 
 #endif
@@ -0,0 +1,468 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// Description: This file contains the functions used to read & write
+// the binary time series files, see TimeSeriesFile.h for the format.
+
+#include <TimeSeriesFile.h>
+#include <OPS_Globals.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#ifdef _WIN32
+#else
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#ifdef _THREADS
+#include <pthread.h>
+#endif
+
+#include <fstream>
+using std::ifstream;
+
+#include <iomanip>
+using std::ios;
+
+static const char *timeSeriesFileMagic = "OSTSBIN1";
+
+#define TIMESERIESFILE_HEADER_SIZE 32
+
+// list of the opened files, so series referencing same file share the data;
+// a file is identified by its device, inode, modification time and size, so
+// that different paths to one file share it and a rewritten file is reread
+struct TimeSeriesFileEntry {
+  char *fileName;
+  dev_t device;
+  ino_t inode;
+  time_t modTime;
+  size_t length;
+  char *base;           // start of mapping (or malloc'ed copy)
+  int refCount;
+  int numPoints;
+  double startTime;
+  double timeIncr;
+  double *values;
+  double *times;
+  TimeSeriesFileEntry *next;
+};
+
+static TimeSeriesFileEntry *theTimeSeriesFiles = 0;
+
+#ifdef _THREADS
+// guards the list, series may be created by a number of threads
+static pthread_mutex_t timeSeriesFilesMutex = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+
+static int
+readTimeSeriesFileHeader(const char *header, int &numPoints, int &flags,
+			 double &startTime, double &timeIncr)
+{
+  if (strncmp(header, timeSeriesFileMagic, 8) != 0)
+    return -1;
+
+  memcpy(&numPoints, &header[8], sizeof(int));
+  memcpy(&flags, &header[12], sizeof(int));
+  memcpy(&startTime, &header[16], sizeof(double));
+  memcpy(&timeIncr, &header[24], sizeof(double));
+
+  if (numPoints < 0)
+    return -2;
+
+  return 0;
+}
+
+
+// returns the opened file with the same identity, 0 if none; the caller
+// holds the lock
+static TimeSeriesFileEntry *
+findTimeSeriesFile(const char *fileName, const struct stat &fileStat)
+{
+  TimeSeriesFileEntry *theEntry = theTimeSeriesFiles;
+  while (theEntry != 0) {
+    if (theEntry->device == fileStat.st_dev && 
+	theEntry->inode == fileStat.st_ino &&
+	theEntry->modTime == fileStat.st_mtime && 
+	theEntry->length == (size_t)fileStat.st_size) {
+#ifdef _WIN32
+      // no inode numbers, the name must match as well
+      if (strcmp(theEntry->fileName, fileName) == 0)
+	return theEntry;
+#else
+      return theEntry;
+#endif
+    }
+    theEntry = theEntry->next;
+  }
+
+  return 0;
+}
+
+
+bool
+isTimeSeriesFile(const char *fileName)
+{
+  char header[TIMESERIESFILE_HEADER_SIZE];
+
+  FILE *fp = fopen(fileName, "rb");
+  if (fp == 0)
+    return false;
+
+  size_t numRead = fread(header, 1, TIMESERIESFILE_HEADER_SIZE, fp);
+  fclose(fp);
+
+  if (numRead != TIMESERIESFILE_HEADER_SIZE)
+    return false;
+
+  return (strncmp(header, timeSeriesFileMagic, 8) == 0);
+}
+
+
+double *
+openTimeSeriesFile(const char *fileName, int &numPoints, 
+		   double &startTime, double &timeIncr, double *&times)
+{
+  char *base = 0;
+  size_t length = 0;
+  struct stat fileStat;
+
+#ifdef _WIN32
+  FILE *fp = fopen(fileName, "rb");
+  if (fp == 0 || stat(fileName, &fileStat) != 0) {
+    opserr << "WARNING - openTimeSeriesFile() - could not open file " << fileName << endln;
+    if (fp != 0)
+      fclose(fp);
+    return 0;
+  }
+#else
+  int fd = open(fileName, O_RDONLY);
+  if (fd < 0 || fstat(fd, &fileStat) != 0) {
+    opserr << "WARNING - openTimeSeriesFile() - could not open file " << fileName << endln;
+    if (fd >= 0)
+      close(fd);
+    return 0;
+  }
+#endif
+
+#ifdef _THREADS
+  pthread_mutex_lock(&timeSeriesFilesMutex);
+#endif
+
+  //
+  // check if file already opened; if so share it
+  //
+
+  TimeSeriesFileEntry *theEntry = findTimeSeriesFile(fileName, fileStat);
+  if (theEntry != 0) {
+    theEntry->refCount++;
+    numPoints = theEntry->numPoints;
+    startTime = theEntry->startTime;
+    timeIncr = theEntry->timeIncr;
+    times = theEntry->times;
+    double *values = theEntry->values;
+#ifdef _THREADS
+    pthread_mutex_unlock(&timeSeriesFilesMutex);
+#endif
+#ifdef _WIN32
+    fclose(fp);
+#else
+    close(fd);
+#endif
+    return values;
+  }
+
+  //
+  // read or map the file
+  //
+
+  length = fileStat.st_size;
+
+#ifdef _WIN32
+  if (length >= TIMESERIESFILE_HEADER_SIZE) {
+    base = (char *)malloc(length);
+    if (base != 0 && fread(base, 1, length, fp) != length) {
+      free(base);
+      base = 0;
+    }
+  }
+  fclose(fp);
+#else
+  if (length >= TIMESERIESFILE_HEADER_SIZE) {
+    void *theMap = mmap(0, length, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (theMap != MAP_FAILED)
+      base = (char *)theMap;
+  }
+  close(fd);
+#endif
+
+  if (base == 0) {
+#ifdef _THREADS
+    pthread_mutex_unlock(&timeSeriesFilesMutex);
+#endif
+    opserr << "WARNING - openTimeSeriesFile() - could not read file " << fileName << endln;
+    return 0;
+  }
+
+  //
+  // check the header & that file holds all the data
+  //
+
+  int flags = 0;
+  const char *errMsg = 0;
+  if (readTimeSeriesFileHeader(base, numPoints, flags, startTime, timeIncr) != 0)
+    errMsg = " is not a binary time series file\n";
+  else {
+    size_t numArrays = ((flags & TIMESERIESFILE_HAS_TIMES) != 0) ? 2 : 1;
+    if (length < TIMESERIESFILE_HEADER_SIZE + numArrays*numPoints*sizeof(double))
+      errMsg = " is truncated\n";
+  }
+
+  if (errMsg != 0) {
+#ifdef _THREADS
+    pthread_mutex_unlock(&timeSeriesFilesMutex);
+#endif
+    opserr << "WARNING - openTimeSeriesFile() - file " << fileName << errMsg;
+#ifdef _WIN32
+    free(base);
+#else
+    munmap(base, length);
+#endif
+    return 0;
+  }
+
+  theEntry = new TimeSeriesFileEntry;
+  theEntry->fileName = new char[strlen(fileName)+1];
+  strcpy(theEntry->fileName, fileName);
+  theEntry->device = fileStat.st_dev;
+  theEntry->inode = fileStat.st_ino;
+  theEntry->modTime = fileStat.st_mtime;
+  theEntry->length = length;
+  theEntry->base = base;
+  theEntry->refCount = 1;
+  theEntry->numPoints = numPoints;
+  theEntry->startTime = startTime;
+  theEntry->timeIncr = timeIncr;
+  theEntry->values = (double *)(base + TIMESERIESFILE_HEADER_SIZE);
+  if ((flags & TIMESERIESFILE_HAS_TIMES) != 0) {
+    theEntry->times = theEntry->values + numPoints;
+    timeIncr = 0.0;
+    theEntry->timeIncr = 0.0;
+  } else
+    theEntry->times = 0;
+
+  theEntry->next = theTimeSeriesFiles;
+  theTimeSeriesFiles = theEntry;
+
+  times = theEntry->times;
+  double *values = theEntry->values;
+
+#ifdef _THREADS
+  pthread_mutex_unlock(&timeSeriesFilesMutex);
+#endif
+
+  return values;
+}
+
+
+int
+closeTimeSeriesFile(double *values)
+{
+#ifdef _THREADS
+  pthread_mutex_lock(&timeSeriesFilesMutex);
+#endif
+
+  TimeSeriesFileEntry *theEntry = theTimeSeriesFiles;
+  TimeSeriesFileEntry *lastEntry = 0;
+
+  while (theEntry != 0 && theEntry->values != values) {
+    lastEntry = theEntry;
+    theEntry = theEntry->next;
+  }
+
+  // remove from list when no longer used
+  bool found = (theEntry != 0);
+  TimeSeriesFileEntry *theReleased = 0;
+  if (found == true) {
+    theEntry->refCount--;
+    if (theEntry->refCount == 0) {
+      if (lastEntry == 0)
+	theTimeSeriesFiles = theEntry->next;
+      else
+	lastEntry->next = theEntry->next;
+      theReleased = theEntry;
+    }
+  }
+
+#ifdef _THREADS
+  pthread_mutex_unlock(&timeSeriesFilesMutex);
+#endif
+
+  if (found == false) {
+    opserr << "WARNING - closeTimeSeriesFile() - data not from an opened file\n";
+    return -1;
+  }
+
+  // release the data
+  if (theReleased != 0) {
+#ifdef _WIN32
+    free(theReleased->base);
+#else
+    munmap(theReleased->base, theReleased->length);
+#endif
+    delete [] theReleased->fileName;
+    delete theReleased;
+  }
+
+  return 0;
+}
+
+
+// reads all the doubles in a text file in one pass
+static double *
+readTextData(const char *fileName, int &numPoints)
+{
+  numPoints = 0;
+
+  ifstream theFile;
+  theFile.open(fileName, ios::in);
+  if (theFile.bad() || !theFile.is_open()) {
+    opserr << "WARNING - textToBinaryTimeSeries() - could not open file " << fileName << endln;
+    return 0;
+  }
+
+  int size = 1024;
+  double *data = new double[size];
+  double dataPoint;
+  while (theFile >> dataPoint) {
+    if (numPoints == size) {
+      double *newData = new double[2*size];
+      for (int i=0; i<size; i++)
+	newData[i] = data[i];
+      delete [] data;
+      data = newData;
+      size *= 2;
+    }
+    data[numPoints++] = dataPoint;
+  }
+  theFile.close();
+
+  return data;
+}
+
+
+int
+textToBinaryTimeSeries(const char *valuesFileName, 
+		       const char *outputFileName,
+		       double timeIncr, 
+		       const char *timesFileName)
+{
+  int numPoints = 0;
+  double *values = readTextData(valuesFileName, numPoints);
+  if (values == 0)
+    return -1;
+
+  double *times = 0;
+  double startTime = 0.0;
+  int flags = 0;
+
+  if (timesFileName != 0) {
+    int numTimes = 0;
+    times = readTextData(timesFileName, numTimes);
+    if (times == 0) {
+      delete [] values;
+      return -1;
+    }
+    if (numTimes != numPoints) {
+      opserr << "WARNING - textToBinaryTimeSeries() - files containing data ";
+      opserr << "points for path and time do not contain same number of points\n";
+      delete [] values;
+      delete [] times;
+      return -2;
+    }
+
+  }
+
+  // if the times are uniformly spaced only store the increment
+  if (times != 0 && numPoints > 0) {
+    startTime = times[0];
+    timeIncr = 0.0;
+    bool uniform = (numPoints > 1);
+    if (uniform == true) {
+      timeIncr = (times[numPoints-1] - times[0])/(numPoints-1);
+      double tol = 1.0e-8*fabs(timeIncr);
+      for (int i=0; i<numPoints && uniform == true; i++) 
+	if (fabs(times[i] - (startTime + i*timeIncr)) > tol)
+	  uniform = false;
+    }
+    if (uniform == true) {
+      delete [] times;
+      times = 0;
+      flags = 0;
+    } else {
+      timeIncr = 0.0;
+      flags = TIMESERIESFILE_HAS_TIMES;
+    }
+  }
+
+  //
+  // write header & data
+  //
+
+  FILE *fp = fopen(outputFileName, "wb");
+  if (fp == 0) {
+    opserr << "WARNING - textToBinaryTimeSeries() - could not open file " << outputFileName << endln;
+    delete [] values;
+    if (times != 0)
+      delete [] times;
+    return -1;
+  }
+
+  char header[TIMESERIESFILE_HEADER_SIZE];
+  memcpy(&header[0], timeSeriesFileMagic, 8);
+  memcpy(&header[8], &numPoints, sizeof(int));
+  memcpy(&header[12], &flags, sizeof(int));
+  memcpy(&header[16], &startTime, sizeof(double));
+  memcpy(&header[24], &timeIncr, sizeof(double));
+
+  int result = 0;
+  if (fwrite(header, 1, TIMESERIESFILE_HEADER_SIZE, fp) != TIMESERIESFILE_HEADER_SIZE ||
+      fwrite(values, sizeof(double), numPoints, fp) != (size_t)numPoints)
+    result = -3;
+  if (times != 0 && result == 0)
+    if (fwrite(times, sizeof(double), numPoints, fp) != (size_t)numPoints)
+      result = -3;
+  fclose(fp);
+
+  if (result != 0)
+    opserr << "WARNING - textToBinaryTimeSeries() - failed writing file " << outputFileName << endln;
+
+  delete [] values;
+  if (times != 0)
+    delete [] times;
+
+  return result;
+}
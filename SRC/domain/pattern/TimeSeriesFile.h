@@ -0,0 +1,58 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+#ifndef TimeSeriesFile_h
+#define TimeSeriesFile_h
+
+// Description: This file contains the functions used to read & write
+// the binary time series files used by PathSeries and PathTimeSeries.
+// A binary file consists of a 32 byte header:
+//    char   magic[8]   "OSTSBIN1"
+//    int    numPoints
+//    int    flags      (1 if the times of the points are stored)
+//    double startTime
+//    double timeIncr   (0 if the times of the points are stored)
+// followed by numPoints doubles for the values and, if flag set, numPoints
+// doubles for the times. The files are memory mapped & the mapping shared
+// by all series that open the same file, i.e. same device, inode,
+// modification time and size; the data must not be modified.
+
+#define TIMESERIESFILE_HAS_TIMES 1
+
+// returns true if fileName is a binary time series file
+bool isTimeSeriesFile(const char *fileName);
+
+// opens (or shares an already opened) binary time series file; returns a
+// pointer to the values, 0 if the file could not be opened. times is set
+// to 0 if the file stores a uniform timeIncr.
+double *openTimeSeriesFile(const char *fileName, int &numPoints, 
+			   double &startTime, double &timeIncr, double *&times);
+
+// releases the file opened with openTimeSeriesFile
+int closeTimeSeriesFile(double *values);
+
+// converts a text file of values (& optional text file of times) to a binary
+// time series file; if the times are uniformly spaced only timeIncr is stored
+int textToBinaryTimeSeries(const char *valuesFileName, 
+			   const char *outputFileName,
+			   double timeIncr, 
+			   const char *timesFileName = 0);
+
+#endif
@@ -71,6 +71,25 @@ UniformExcitation::getGroundMotion(void)
   return theMotion;
 }
 
+// replaces the motion without touching the domain, so that a model can
+// be run for a number of records without the analysis being rebuilt. the
+// pattern takes the new motion; the old one is returned to the caller,
+// who is then responsible for it. returns 0 if the motion can't be replaced.
+GroundMotion *
+UniformExcitation::setGroundMotion(GroundMotion &newMotion)
+{
+  if (numMotions != 1 || theMotions[0] != theMotion) {
+    opserr << "UniformExcitation::setGroundMotion() - pattern has no motion to replace\n";
+    return 0;
+  }
+
+  GroundMotion *oldMotion = theMotion;
+  theMotion = &newMotion;
+  theMotions[0] = theMotion;
+
+  return oldMotion;
+}
+
 int
 UniformExcitation::setParameter(const char **argv, int argc, Parameter &param)
 {
@@ -62,6 +62,7 @@ class UniformExcitation : public EarthquakePattern
     // AddingSensitivity:END ///////////////////////////////////
     
     const GroundMotion *getGroundMotion(void);
+    GroundMotion *setGroundMotion(GroundMotion &newMotion);
     
  protected:
     
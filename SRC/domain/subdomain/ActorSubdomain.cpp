@@ -457,6 +457,26 @@ ActorSubdomain::run(void)
 
 	    break;
 
+	  case ShadowActorSubdomain_makeNodeExternal:
+	    tag = msgData(1);
+
+	    theNod = this->makeNodeExternal(tag);
+
+	    if (theNod != 0) 
+		msgData(0) = theNod->getClassTag();
+	    else
+		msgData(0) = -1;
+
+	    this->sendID(msgData);
+	    if (theNod != 0) {
+		this->sendObject(*theNod);
+		delete theNod;
+	    }
+
+	    msgData(0) = 0;
+
+	    break;
+
 	  case ShadowActorSubdomain_removeSP_Constraint:
 	    tag = msgData(1);
 
@@ -856,6 +876,16 @@ ActorSubdomain::run(void)
 	      this->calculateNodalReactions(false);
 	    break;
 
+	  case ShadowActorSubdomain_calculateNodalReactionsAtNodes:
+	    if (msgData(2) != 0) {
+	      theID = new ID(msgData(2));
+	      this->recvID(*((ID *)theID));
+	      this->calculateNodalReactions(msgData(1), *theID);
+	      delete theID;
+	    } else
+	      this->calculateNodalReactions(msgData(1), ID(0));
+	    break;
+
          case ShadowActorSubdomain_setRayleighDampingFactors:
 	   theV = new Vector(4);
 	   this->recvVector(*theV);
@@ -85,6 +85,7 @@ static const int ShadowActorSubdomain_Print = 150;
 static const int ShadowActorSubdomain_addRecorder = 151;
 static const int ShadowActorSubdomain_removeRecorders = 152;
 static const int ShadowActorSubdomain_removeRecorder = 154;
+static const int ShadowActorSubdomain_makeNodeExternal = 155;
 static const int ShadowActorSubdomain_PrintNodeAndEle = 153;
 static const int ShadowActorSubdomain_getNodeDisp = 92;
 static const int ShadowActorSubdomain_setMass = 93;
@@ -100,3 +101,4 @@ static const int ShadowActorSubdomain_updateParameterDOUBLE = 102;
 static const int ShadowActorSubdomain_addSP_ConstraintAXIS = 103;
 static const int ShadowActorSubdomain_getDomainChangeFlag = 104;
 static const int ShadowActorSubdomain_record = 105;
+static const int ShadowActorSubdomain_calculateNodalReactionsAtNodes = 106;
@@ -297,6 +297,31 @@ ShadowSubdomain::addExternalNode(Node *theNode)
     return true;    
 }
 
+Node *
+ShadowSubdomain::makeNodeExternal(int tag)
+{
+    msgData(0) = ShadowActorSubdomain_makeNodeExternal;
+    msgData(1) = tag;
+    this->sendID(msgData);
+
+    // receive a copy of the node from the actor
+    this->recvID(msgData);
+    int theType = msgData(0);
+
+    if (theType == -1) // the node was not an internal node
+	return 0;
+
+    Node *theNode = theObjectBroker->getNewNode(theType);
+    if (theNode != 0) {
+	this->recvObject(*theNode);
+	theExternalNodes[numExternalNodes] = tag;
+	numExternalNodes++;
+	numDOF += theNode->getNumberDOF();
+    }
+
+    return theNode;
+}
+
 bool 
 ShadowSubdomain::addSP_Constraint(SP_Constraint *theSP)
 {
@@ -1409,15 +1434,12 @@ ShadowSubdomain::eigenAnalysis(int numMode, bool generalized)
 double
 ShadowSubdomain::getCost(void)    
 {
-  /*
-    msgData(0) = ShadowActorSubdomain_getCost;
+  msgData(0) = ShadowActorSubdomain_getCost;
     
-    this->sendID(msgData);
-    Vector cost(2);
-    this->recvVector(cost);
-    return cost(0);
-  */
-  return 0.0;
+  this->sendID(msgData);
+  Vector cost(4);
+  this->recvVector(cost);
+  return cost(0);
 }
 
 
@@ -1577,6 +1599,18 @@ ShadowSubdomain::calculateNodalReactions(bool incInertia)
   this->sendID(msgData);
   return 0;
 }
+
+int
+ShadowSubdomain::calculateNodalReactions(int flag, const ID &nodeTags)
+{
+  msgData(0) = ShadowActorSubdomain_calculateNodalReactionsAtNodes;
+  msgData(1) = flag;
+  msgData(2) = nodeTags.Size();
+  this->sendID(msgData);
+  if (nodeTags.Size() != 0)
+    this->sendID(nodeTags);
+  return 0;
+}
   
 
 bool
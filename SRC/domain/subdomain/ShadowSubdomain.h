@@ -64,6 +64,7 @@ class ShadowSubdomain: public Shadow, public Subdomain
     virtual  bool addElement(Element *);
     virtual  bool addNode(Node *);
     virtual  bool addExternalNode(Node *);
+    virtual  Node *makeNodeExternal(int tag);
     virtual  bool addSP_Constraint(SP_Constraint *);
     virtual  int  addSP_Constraint(int axisDirn, double axisValue, 
 				   const ID &fixityCodes, double tol=1e-10);
@@ -175,6 +176,7 @@ class ShadowSubdomain: public Shadow, public Subdomain
 
     virtual const Vector *getNodeResponse(int tag, NodeResponseType responseType);
     virtual int calculateNodalReactions(bool inclInertia);
+    virtual int calculateNodalReactions(int flag, const ID &nodeTags);
     
   protected:    
 
@@ -59,6 +59,24 @@
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 
+#include <time.h>
+#ifndef _WIN32
+#include <sys/time.h>
+#endif
+
+// wall clock time in seconds used to accumulate the cost of the subdomain
+static double
+getCostTime(void)
+{
+#ifdef _WIN32
+  return (double)clock()/CLOCKS_PER_SEC;
+#else
+  struct timeval tp;
+  gettimeofday(&tp, 0);
+  return tp.tv_sec + 1.0e-6*tp.tv_usec;
+#endif
+}
+
 
 Matrix Subdomain::badResult(1,1); // for returns from getStiff, getMass and getDamp
 
@@ -232,6 +250,38 @@ Subdomain::addExternalNode(Node *thePtr)
 }
 
 
+// Node *makeNodeExternal(int tag)
+//	Moves an internal node to the external nodes, without replacing the
+//	node object the elements of the subdomain point to. The mass of the 
+//	node is now assembled by the PartitionedDomain, so it is zeroed 
+//	here. Returns a copy of the node, mass included, for the caller to 
+//	add to the PartitionedDomain, 0 if no internal node with the tag.
+
+Node *
+Subdomain::makeNodeExternal(int tag)
+{
+  TaggedObject *object = internalNodes->removeComponent(tag);
+  if (object == 0)
+    return 0;
+
+  Node *theNode = (Node *)object;
+  Node *theCopy = new Node(*theNode, true);
+
+  if (externalNodes->addComponent(theNode) == false) {
+    internalNodes->addComponent(theNode);
+    delete theCopy;
+    return 0;
+  }
+
+  int numDOF = theNode->getNumberDOF();
+  Matrix zeroMass(numDOF, numDOF);
+  theNode->setMass(zeroMass);
+
+  this->domainChange();
+
+  return theCopy;
+}
+
 
 Node *
 Subdomain::removeNode(int tag)
@@ -360,13 +410,21 @@ Subdomain::revertToStart(void)
 int
 Subdomain::update(void)
 {
-  return this->Domain::update();
+  double startTime = getCostTime();
+  int res = this->Domain::update();
+  realCost += getCostTime() - startTime;
+
+  return res;
 }
 
 int
 Subdomain::update(double newTime, double dT)
 {
-    return this->Domain::update(newTime, dT);
+  double startTime = getCostTime();
+  int res = this->Domain::update(newTime, dT);
+  realCost += getCostTime() - startTime;
+
+  return res;
 }
 
 void
@@ -670,11 +728,13 @@ int
 Subdomain::computeTang(void)
 {   
   if (theAnalysis != 0) {
-    //    theTimer.start();
+    double startTime = getCostTime();
     
     int res =0;
     res = theAnalysis->formTangent();
     
+    realCost += getCostTime() - startTime;
+
     return res;
     
   } else {
@@ -690,15 +750,12 @@ int
 Subdomain::computeResidual(void)
 {
   if (theAnalysis != 0) {
-    //    theTimer.start();
+    double startTime = getCostTime();
     
     int res =0;
     res = theAnalysis->formResidual();
     
-    //theTimer.pause();
-    //    realCost += theTimer.getReal();
-    //    cpuCost += theTimer.getCPU();
-    //    pageCost += theTimer.getNumPageFaults();
+    realCost += getCostTime() - startTime;
     
     return res;
     
@@ -854,6 +911,10 @@ Subdomain::recvSelf(int cTag, Channel &theChannel,
     return -1;
 }
 
+// double getCost(void)
+//	Returns the wall clock time spent in update(), computeTang() and 
+//	computeResidual() since the last call, and resets it.
+
 double    
 Subdomain::getCost(void) 
 {
@@ -104,6 +104,7 @@ class Subdomain: public Element, public Domain
     virtual NodeIter &getInternalNodeIter(void);
     virtual NodeIter &getExternalNodeIter(void);
     virtual bool addExternalNode(Node *);
+    virtual Node *makeNodeExternal(int tag);
 
     virtual void wipeAnalysis(void);
     virtual void setDomainDecompAnalysis(DomainDecompositionAnalysis &theAnalysis);
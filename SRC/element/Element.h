@@ -85,6 +85,7 @@ class Element : public DomainComponent
     // methods for obtaining resisting force (force includes elemental loads)
     virtual const Vector &getResistingForce(void) =0;
     virtual const Vector &getResistingForceIncInertia(void);        
+    const Vector &getRayleighDampingForces(void);
 
     // method for obtaining information specific to an element
     virtual Response *setResponse(const char **argv, int argc, 
@@ -105,8 +106,6 @@ class Element : public DomainComponent
     virtual int addResistingForceToNodalReaction(int flag);
 
   protected:
-    const Vector &getRayleighDampingForces(void);
-
     double alphaM, betaK, betaK0, betaKc;
     Matrix *Kc; // pointer to hold last committed matrix if needed for rayleigh damping
 
@@ -48,14 +48,6 @@
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 
-//static data
-double  Brick::xl[3][8] ;
-
-Matrix  Brick::stiff(24,24) ;
-Vector  Brick::resid(24) ;
-Matrix  Brick::mass(24,24) ;
-
-    
 //quadrature data
 const double  Brick::root3 = sqrt(3.0) ;
 const double  Brick::one_over_root3 = 1.0 / root3 ;
@@ -66,16 +58,13 @@ const double  Brick::sg[] = { -one_over_root3,
 const double  Brick::wg[] = { 1.0, 1.0, 1.0, 1.0, 
                               1.0, 1.0, 1.0, 1.0  } ;
 
-  
-static Matrix B(6,3) ;
 
 //null constructor
 Brick::Brick( ) 
 :Element( 0, ELE_TAG_Brick ),
- connectedExternalNodes(8), applyLoad(0), load(0), Ki(0)
+ connectedExternalNodes(8), applyLoad(0), load(0), Ki(0),
+ stiff(24,24), resid(24), mass(0)
 {
-  B.Zero();
-
   for (int i=0; i<8; i++ ) {
     materialPointers[i] = 0;
     nodePointers[i] = 0;
@@ -101,10 +90,9 @@ Brick::Brick(int tag,
 	     NDMaterial &theMaterial,
 	     double b1, double b2, double b3)
   :Element(tag, ELE_TAG_Brick),
-   connectedExternalNodes(8), applyLoad(0), load(0), Ki(0)
+   connectedExternalNodes(8), applyLoad(0), load(0), Ki(0),
+   stiff(24,24), resid(24), mass(0)
 {
-  B.Zero();
-
   connectedExternalNodes(0) = node1 ;
   connectedExternalNodes(1) = node2 ;
   connectedExternalNodes(2) = node3 ;
@@ -145,6 +133,9 @@ Brick::~Brick( )
 
   if (Ki != 0)
     delete Ki;
+
+  if (mass != 0)
+    delete mass;
   
 }
 
@@ -343,26 +334,33 @@ const Matrix&  Brick::getInitialStiff( )
   int jj, kk ;
 
   
-  static double volume ;
-  static double xsj ;  // determinant jacaobian matrix 
-  static double dvol[numberGauss] ; //volume element
-  static double gaussPoint[ndm] ;
-  static Vector strain(nstress) ;  //strain
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
-  static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
-  static Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness 
-  static Matrix dd(nstress,nstress) ;  //material tangent
+  double volume ;
+  double xsj ;  // determinant jacaobian matrix 
+  double dvol[numberGauss] ; //volume element
+  double gaussPoint[ndm] ;
+  double strainData[nstress] ;
+  Vector strain(strainData,nstress) ;  //strain
+  double shp[nShape][numberNodes] ;  //shape functions at a gauss point
+  double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
+  double stiffJKData[ndf*ndf] ;
+  Matrix stiffJK(stiffJKData,ndf,ndf) ; //nodeJK stiffness 
+  double ddData[nstress*nstress] ;
+  Matrix dd(ddData,nstress,nstress) ;  //material tangent
 
 
   //---------B-matrices------------------------------------
 
-    static Matrix BJ(nstress,ndf) ;      // B matrix node J
+    double BJData[nstress*ndf] ;
+    Matrix BJ(BJData,nstress,ndf) ;      // B matrix node J
 
-    static Matrix BJtran(ndf,nstress) ;
+    double BJtranData[ndf*nstress] ;
+    Matrix BJtran(BJtranData,ndf,nstress) ;
 
-    static Matrix BK(nstress,ndf) ;      // B matrix node k
+    double BKData[nstress*ndf] ;
+    Matrix BK(BKData,nstress,ndf) ;      // B matrix node k
 
-    static Matrix BJtranD(ndf,nstress) ;
+    double BJtranDData[ndf*nstress] ;
+    Matrix BJtranD(BJtranDData,ndf,nstress) ;
 
   //-------------------------------------------------------
 
@@ -424,7 +422,7 @@ const Matrix&  Brick::getInitialStiff( )
     jj = 0;
     for ( j = 0; j < numberNodes; j++ ) {
 
-      BJ = computeB( j, shp ) ;
+      computeB( j, shp, BJ ) ;
    
       //transpose 
       //BJtran = transpose( nstress, ndf, BJ ) ;
@@ -439,7 +437,7 @@ const Matrix&  Brick::getInitialStiff( )
       kk = 0 ;
       for ( k = 0; k < numberNodes; k++ ) {
 	
-	BK = computeB( k, shp ) ;
+	computeB( k, shp, BK ) ;
 	
 	
 	//stiffJK =  BJtranD * BK  ;
@@ -472,7 +470,7 @@ const Matrix&  Brick::getMass( )
 
   formInertiaTerms( tangFlag ) ;
 
-  return mass ;
+  return *mass ;
 } 
 
 
@@ -550,7 +548,7 @@ Brick::addInertiaLoadToUnbalance(const Vector &accel)
     load = new Vector(numberNodes*ndf);
 
   // add -M * RV(accel) to the load vector
-  load->addMatrixVector(1.0, mass, resid, -1.0);
+  load->addMatrixVector(1.0, *mass, resid, -1.0);
   
   return 0;
 }
@@ -573,25 +571,27 @@ const Vector&  Brick::getResistingForce( )
 //get residual with inertia terms
 const Vector&  Brick::getResistingForceIncInertia( )
 {
-  static Vector res(24);
-
   int tang_flag = 0 ; //don't get the tangent
 
+  // the rayleigh damping forces are obtained first, forming them
+  // reforms the tangent and mass and so overwrites the residual
+  const Vector *dampingForces = 0;
+  if (alphaM != 0.0 || betaK != 0.0 || betaK0 != 0.0 || betaKc != 0.0)
+    dampingForces = &(this->getRayleighDampingForces());
+
   //do tangent and residual here 
   formResidAndTangent( tang_flag ) ;
 
   formInertiaTerms( tang_flag ) ;
 
-  res = resid;
-
   // add the damping forces if rayleigh damping
-  if (alphaM != 0.0 || betaK != 0.0 || betaK0 != 0.0 || betaKc != 0.0)
-      res += this->getRayleighDampingForces();
+  if (dampingForces != 0)
+    resid += *dampingForces;
 
   if (load != 0)
-    res -= *load;
+    resid -= *load;
 
-  return res;
+  return resid;
 }
 
 
@@ -617,13 +617,14 @@ void   Brick::formInertiaTerms( int tangFlag )
 
   double dvol[numberGauss] ; //volume element
 
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
+  double shp[nShape][numberNodes] ;  //shape functions at a gauss point
 
-  static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
+  double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
 
-  static double gaussPoint[ndm] ;
+  double gaussPoint[ndm] ;
 
-  static Vector momentum(ndf) ;
+  double momentumData[ndf] ;
+  Vector momentum(momentumData,ndf) ;
 
   int i, j, k, p, q ;
   int jj, kk ;
@@ -632,7 +633,11 @@ void   Brick::formInertiaTerms( int tangFlag )
 
 
   //zero mass 
-  mass.Zero( ) ;
+  if ( tangFlag == 1 ) {
+    if (mass == 0)
+      mass = new Matrix(24,24) ;
+    mass->Zero( ) ;
+  }
 
   //compute basis vectors and local nodal coordinates
   computeBasis( ) ;
@@ -719,7 +724,7 @@ void   Brick::formInertiaTerms( int tangFlag )
 	    massJK = temp * shp[massIndex][k] ;
 
             for ( p = 0; p < ndf; p++ )  
-	      mass( jj+p, kk+p ) += massJK ;
+	      (*mass)( jj+p, kk+p ) += massJK ;
             
             kk += ndf ;
           } // end for k loop
@@ -757,29 +762,34 @@ Brick::update(void)
   int i, j, k, p, q ;
   int success ;
   
-  static double volume ;
+  double volume ;
 
-  static double xsj ;  // determinant jacaobian matrix 
+  double xsj ;  // determinant jacaobian matrix 
 
-  static double dvol[numberGauss] ; //volume element
+  double dvol[numberGauss] ; //volume element
 
-  static double gaussPoint[ndm] ;
+  double gaussPoint[ndm] ;
 
-  static Vector strain(nstress) ;  //strain
+  double strainData[nstress] ;
+  Vector strain(strainData,nstress) ;  //strain
 
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
+  double shp[nShape][numberNodes] ;  //shape functions at a gauss point
 
-  static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
+  double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
 
   //---------B-matrices------------------------------------
 
-    static Matrix BJ(nstress,ndf) ;      // B matrix node J
+    double BJData[nstress*ndf] ;
+    Matrix BJ(BJData,nstress,ndf) ;      // B matrix node J
 
-    static Matrix BJtran(ndf,nstress) ;
+    double BJtranData[ndf*nstress] ;
+    Matrix BJtran(BJtranData,ndf,nstress) ;
 
-    static Matrix BK(nstress,ndf) ;      // B matrix node k
+    double BKData[nstress*ndf] ;
+    Matrix BK(BKData,nstress,ndf) ;      // B matrix node k
 
-    static Matrix BJtranD(ndf,nstress) ;
+    double BJtranDData[ndf*nstress] ;
+    Matrix BJtranD(BJtranDData,ndf,nstress) ;
 
   //-------------------------------------------------------
 
@@ -840,7 +850,7 @@ Brick::update(void)
 
       /**************** fmk - unwinding for performance
       //compute B matrix 
-      BJ = computeB( j, shp ) ;
+      computeB( j, shp, BJ ) ;
 
       //nodal displacements 
       const Vector &ul = nodePointers[j]->getTrialDisp( ) ;
@@ -923,38 +933,44 @@ void  Brick::formResidAndTangent( int tang_flag )
 
   int i, j, k, p, q ;
 
-  int success ;
-  
-  static double volume ;
+  double volume ;
 
-  static double xsj ;  // determinant jacaobian matrix 
+  double xsj ;  // determinant jacaobian matrix 
 
-  static double dvol[numberGauss] ; //volume element
+  double dvol[numberGauss] ; //volume element
 
-  static double gaussPoint[ndm] ;
+  double gaussPoint[ndm] ;
 
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
+  double shp[nShape][numberNodes] ;  //shape functions at a gauss point
 
-  static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
+  double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
 
-  static Vector residJ(ndf) ; //nodeJ residual 
+  double residJData[ndf] ;
+  Vector residJ(residJData,ndf) ; //nodeJ residual 
 
-  static Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness 
+  double stiffJKData[ndf*ndf] ;
+  Matrix stiffJK(stiffJKData,ndf,ndf) ; //nodeJK stiffness 
 
-  static Vector stress(nstress) ;  //stress
+  double stressData[nstress] ;
+  Vector stress(stressData,nstress) ;  //stress
 
-  static Matrix dd(nstress,nstress) ;  //material tangent
+  double ddData[nstress*nstress] ;
+  Matrix dd(ddData,nstress,nstress) ;  //material tangent
 
 
   //---------B-matrices------------------------------------
 
-    static Matrix BJ(nstress,ndf) ;      // B matrix node J
+    double BJData[nstress*ndf] ;
+    Matrix BJ(BJData,nstress,ndf) ;      // B matrix node J
 
-    static Matrix BJtran(ndf,nstress) ;
+    double BJtranData[ndf*nstress] ;
+    Matrix BJtran(BJtranData,ndf,nstress) ;
 
-    static Matrix BK(nstress,ndf) ;      // B matrix node k
+    double BKData[nstress*ndf] ;
+    Matrix BK(BKData,nstress,ndf) ;      // B matrix node k
 
-    static Matrix BJtranD(ndf,nstress) ;
+    double BJtranDData[ndf*nstress] ;
+    Matrix BJtranD(BJtranDData,ndf,nstress) ;
 
   //-------------------------------------------------------
 
@@ -1070,7 +1086,7 @@ void  Brick::formResidAndTangent( int tang_flag )
       residJ(1) = b11 * stress1 + b31 * stress3 + b41 * stress4;
       residJ(2) = b22 * stress2 + b42 * stress4 + b52 * stress5;
       
-      BJ = computeB( j, shp ) ;
+      computeB( j, shp, BJ ) ;
    
       //transpose 
       //BJtran = transpose( nstress, ndf, BJ ) ;
@@ -1097,7 +1113,7 @@ void  Brick::formResidAndTangent( int tang_flag )
 	int kk = 0 ;
          for ( k = 0; k < numberNodes; k++ ) {
 
-            BK = computeB( k, shp ) ;
+            computeB( k, shp, BK ) ;
   
  
             //stiffJK =  BJtranD * BK  ;
@@ -1148,8 +1164,8 @@ void   Brick::computeBasis( )
 //*************************************************************************
 //compute B
 
-const Matrix&   
-Brick::computeB( int node, const double shp[4][8] )
+void
+Brick::computeB( int node, const double shp[4][8], Matrix &B )
 {
 
 //---B Matrix in standard {1,2,3} mechanics notation---------
@@ -1165,6 +1181,8 @@ Brick::computeB( int node, const double shp[4][8] )
 //
 //-------------------------------------------------------------------
 
+  B.Zero( ) ;
+
   B(0,0) = shp[0][node] ;
   B(1,1) = shp[1][node] ;
   B(2,2) = shp[2][node] ;
@@ -1178,8 +1196,6 @@ Brick::computeB( int node, const double shp[4][8] )
   B(5,0) = shp[2][node] ;
   B(5,2) = shp[0][node] ;
 
-  return B ;
-
 }
 
 //***********************************************************************
@@ -142,23 +142,24 @@ class Brick : public Element {
     Vector *load;
     Matrix *Ki;
 
+    //element tangent, residual and mass (allocated when first needed),
+    //held by each element so that elements can be formed concurrently
+    Matrix stiff ;
+    Vector resid ;
+    Matrix *mass ;
+
+    //local nodal coordinates, three coordinates for each of eight nodes
+    double xl[3][8] ; 
+
     //
     // static attributes
     //
 
-    static Matrix stiff ;
-    static Vector resid ;
-    static Matrix mass ;
-    static Matrix damping ;
-
     //quadrature data
     static const double root3 ;
     static const double one_over_root3 ;    
     static const double sg[2] ;
     static const double wg[8] ;
-  
-    //local nodal coordinates, three coordinates for each of four nodes
-    static double xl[3][8] ; 
 
     //
     // private methods
@@ -174,7 +175,7 @@ class Brick : public Element {
     void computeBasis( ) ;
 
     //compute B matrix
-    const Matrix& computeB( int node, const double shp[4][8] ) ;
+    void computeB( int node, const double shp[4][8], Matrix &B ) ;
   
     //Matrix transpose
     Matrix transpose( int dim1, int dim2, const Matrix &M ) ;
@@ -76,6 +76,8 @@ Journal of Structural Engineering, Approved for publication, February 2007.
 #include <ElementResponse.h>
 #include <CompositeResponse.h>
 #include <ElementalLoad.h>
+#include <Profiler.h>
+#include <ClassTagNames.h>
 
 Matrix ForceBeamColumn2d::theMatrix(6,6);
 Vector ForceBeamColumn2d::theVector(6);
@@ -90,7 +92,10 @@ Vector *ForceBeamColumn2d::SsrSubdivide = 0;
 ForceBeamColumn2d::ForceBeamColumn2d(): 
   Element(0,ELE_TAG_ForceBeamColumn2d), connectedExternalNodes(2), 
   beamIntegr(0), numSections(0), sections(0), crdTransf(0),
-  rho(0.0), maxIters(0), tol(0.0),
+  rho(0.0), maxIters(0), tol(0.0), accelerate(false),
+  lastStrategy(0), numUpdates(0), numLocalIters(0), lastLocalIters(0),
+  maxLocalIters(0), numSubdivisions(0), numFallbacks(0), numFailures(0),
+  numSectionReuse(0),
   initialFlag(0),
   kv(NEBD,NEBD), Se(NEBD),
   kvcommit(NEBD,NEBD), Secommit(NEBD),
@@ -120,10 +125,15 @@ ForceBeamColumn2d::ForceBeamColumn2d (int tag, int nodeI, int nodeJ,
 				      int numSec, SectionForceDeformation **sec,
 				      BeamIntegration &bi,
 				      CrdTransf &coordTransf, double massDensPerUnitLength,
-				      int maxNumIters, double tolerance):
+				      int maxNumIters, double tolerance,
+				      bool accelerateLocal):
   Element(tag,ELE_TAG_ForceBeamColumn2d), connectedExternalNodes(2),
   beamIntegr(0), numSections(0), sections(0), crdTransf(0),
   rho(massDensPerUnitLength),maxIters(maxNumIters), tol(tolerance), 
+  accelerate(accelerateLocal),
+  lastStrategy(0), numUpdates(0), numLocalIters(0), lastLocalIters(0),
+  maxLocalIters(0), numSubdivisions(0), numFallbacks(0), numFailures(0),
+  numSectionReuse(0),
   initialFlag(0),
   kv(NEBD,NEBD), Se(NEBD), 
   kvcommit(NEBD,NEBD), Secommit(NEBD),
@@ -318,6 +328,9 @@ ForceBeamColumn2d::commitState()
   // commit the element variables state
   kvcommit = kv;
   Secommit = Se;
+
+  // start the local iterations of the next step with newton
+  lastStrategy = 0;
   
   //   initialFlag = 0;  fmk - commented out, see what happens to Example3.1.tcl if uncommented
   //                         - i have not a clue why, ask remo if he ever gets in contact with us again!
@@ -352,6 +365,7 @@ int ForceBeamColumn2d::revertToLastCommit()
   // revert the element state to last commit
   Se   = Secommit;
   kv   = kvcommit;
+  lastStrategy = 0;
   
   initialFlag = 0;
   // this->update();
@@ -386,6 +400,17 @@ int ForceBeamColumn2d::revertToStart()
   
   Se.Zero();
   kv.Zero();
+
+  // reset the local iteration statistics
+  lastStrategy = 0;
+  numUpdates = 0;
+  numLocalIters = 0;
+  lastLocalIters = 0;
+  maxLocalIters = 0;
+  numSubdivisions = 0;
+  numFallbacks = 0;
+  numFailures = 0;
+  numSectionReuse = 0;
   
   initialFlag = 0;
   // this->update();
@@ -622,6 +647,18 @@ ForceBeamColumn2d::update()
   dvToDo = dv;
   dvTrial = dvToDo;
 
+  // accelerated local iterations: correction from the previous iteration,
+  // energy norm of the last accepted iteration and relaxation factor
+  static Vector dSeLast(NEBD);
+  static Vector dSeDiff(NEBD);
+  double dWLast = 0.0;
+  double omega = 1.0;
+  int numBacktrack = 0;
+  const int maxBacktrack = 4;
+
+  int numIterUpdate = 0;
+  numUpdates++;
+
   static double factor = 10;
 
   maxSubdivisions = 4;
@@ -642,7 +679,10 @@ ForceBeamColumn2d::update()
     // initial tangent on first iteration then regular newton (if l==1), or 
     // initial tangent iterations (if l==2)
 
-    for (int l=0; l<3; l++) {
+    // when accelerating, start with the strategy that last converged
+    int lStart = (accelerate == true) ? lastStrategy : 0;
+
+    for (int l=lStart; l<3; l++) {
 
       //      if (l == 1) l = 2;
       SeTrial = Se;
@@ -658,6 +698,11 @@ ForceBeamColumn2d::update()
       dSe.addMatrixVector(0.0, kvTrial, dvTrial, 1.0);
       SeTrial += dSe;
 
+      dSeLast = dSe;
+      dWLast = 0.0;
+      omega = 1.0;
+      numBacktrack = 0;
+
       if (initialFlag != 2) {
 
 	int numIters = maxIters;
@@ -765,20 +810,36 @@ ForceBeamColumn2d::update()
 	      dvs.addMatrixVector(0.0, fs0, dSs, 1.0);
 	    }
 	    
-	    // set section deformations
-	    if (initialFlag != 0)
+	    // set section deformations - when accelerating, a section whose
+	    // deformations do not change keeps its resultant and flexibility
+	    bool reuseSection = false;
+	    if (initialFlag != 0) {
+	      if (accelerate == true && j > 0) {
+		reuseSection = true;
+		for (ii = 0; ii < order; ii++)
+		  if (vsSubdivide[i](ii) + dvs(ii) != vsSubdivide[i](ii)) {
+		    reuseSection = false;
+		    break;
+		  }
+	      }
 	      vsSubdivide[i] += dvs;
-	    
-	    if (sections[i]->setTrialSectionDeformation(vsSubdivide[i]) < 0) {
-	      opserr << "ForceBeamColumn2d::update() - section failed in setTrial\n";
-	      return -1;
 	    }
-	    
-	    // get section resisting forces
-	    SsrSubdivide[i] = sections[i]->getStressResultant();
 
-	    // get section flexibility matrix
-	    fsSubdivide[i] = sections[i]->getSectionFlexibility();
+	    if (reuseSection == true)
+	      numSectionReuse++;
+
+	    else {
+	      if (sections[i]->setTrialSectionDeformation(vsSubdivide[i]) < 0) {
+		opserr << "ForceBeamColumn2d::update() - section failed in setTrial\n";
+		return -1;
+	      }
+
+	      // get section resisting forces
+	      SsrSubdivide[i] = sections[i]->getStressResultant();
+
+	      // get section flexibility matrix
+	      fsSubdivide[i] = sections[i]->getSectionFlexibility();
+	    }
 
 	    // calculate section residual deformations
 	    // dvs = fs * (Ss - Ssr);
@@ -883,10 +944,50 @@ ForceBeamColumn2d::update()
 	  // dSe = kv * dv;
 	  dSe.addMatrixVector(0.0, kvTrial, dv, 1.0);
 
-	  dW = dv ^ dSe; 
-	  
-	  SeTrial += dSe;
-	  
+	  dW = dv ^ dSe;
+
+	  numIterUpdate++;
+
+	  if (accelerate == true && j > 0 && fabs(dW) >= tol) {
+
+	    if (l == 1) {
+
+	      // secant (Aitken) relaxation of the initial flexibility iterations
+	      //   omega = -omega * dSeLast^(dSe-dSeLast) / |dSe-dSeLast|^2
+	      dSeDiff = dSe;
+	      dSeDiff -= dSeLast;
+	      double den = dSeDiff ^ dSeDiff;
+	      if (den > 0.0)
+		omega = -omega*(dSeLast ^ dSeDiff)/den;
+	      if (omega < 0.1)
+		omega = 0.1;
+	      else if (omega > 4.0)
+		omega = 4.0;
+
+	      dSeLast = dSe;
+	      SeTrial.addVector(1.0, dSe, omega);
+
+	    } else if (fabs(dW) > fabs(dWLast) && numBacktrack < maxBacktrack) {
+
+	      // line search - the energy norm grew, so step back half of
+	      // the last correction instead of applying this one
+	      dSeLast *= 0.5;
+	      SeTrial.addVector(1.0, dSeLast, -1.0);
+	      numBacktrack++;
+
+	    } else {
+	      dSeLast = dSe;
+	      dWLast = dW;
+	      numBacktrack = 0;
+	      SeTrial += dSe;
+	    }
+
+	  } else {
+	    dSeLast = dSe;
+	    dWLast = dW;
+	    SeTrial += dSe;
+	  }
+
 	  // check for convergence of this interval
 	  if (fabs(dW) < tol) { 
 	    
@@ -915,6 +1016,11 @@ ForceBeamColumn2d::update()
 	      Ssr[k] = SsrSubdivide[k];
 	    }
 
+	    // remember the strategy for the next update
+	    lastStrategy = l;
+	    if (l > 0)
+	      numFallbacks++;
+
 	    // break out of j & l loops
 	    j = numIters+1;
 	    l = 4;
@@ -927,6 +1033,7 @@ ForceBeamColumn2d::update()
 	    if (j == (numIters-1) && (l == 2)) {
 	      dvTrial /= factor;
 	      numSubdivide++;
+	      numSubdivisions++;
 	    }
 	  }
 	} // for (j=0; j<numIters; j++)
@@ -935,9 +1042,22 @@ ForceBeamColumn2d::update()
   } // while (converged == false)
 
 
+  // update the local iteration statistics
+  lastLocalIters = numIterUpdate;
+  numLocalIters += numIterUpdate;
+  if (numIterUpdate > maxLocalIters)
+    maxLocalIters = numIterUpdate;
+  if (Profiler::on)
+    Profiler::count("localIterations", this->getClassTag(),
+                    getElementClassName(this->getClassTag()), numIterUpdate);
+
   // if fail to converge we return an error flag & print an error message
 
   if (converged == false) {
+    numFailures++;
+    if (Profiler::on)
+      Profiler::count("localFailures", this->getClassTag(),
+                      getElementClassName(this->getClassTag()));
     opserr << "WARNING - ForceBeamColumn2d::update - failed to get compatible ";
     opserr << "element forces & deformations for element: ";
     opserr << this->getTag() << "(dW: << " << dW << ")\n";
@@ -1348,6 +1468,8 @@ ForceBeamColumn2d::sendSelf(int commitTag, Channel &theChannel)
   }
   idData(9) = beamIntegrDbTag;
 
+  idData(10) = (accelerate == true) ? 1 : 0;
+
   if (theChannel.sendID(dbTag, commitTag, idData) < 0) {
     opserr << "ForceBeamColumn2d::sendSelf() - failed to send ID data\n";
     return -1;
@@ -1469,6 +1591,7 @@ ForceBeamColumn2d::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker
   connectedExternalNodes(1) = idData(2);
   maxIters = idData(4);
   initialFlag = idData(5);
+  accelerate = (idData(10) == 1) ? true : false;
   
   int crdTransfClassTag = idData(6);
   int crdTransfDbTag = idData(7);
@@ -2155,6 +2278,27 @@ ForceBeamColumn2d::displaySelf(Renderer &theViewer, int displayMode, float fact)
   return theViewer.drawLine (v1, v2, 1.0, 1.0);
 }
 
+// returns the element-local iteration statistics: iterations in the
+// last update, number of updates, total and largest number of
+// iterations, subdivisions, initial flexibility fallbacks, failures
+// and skipped section state determinations
+const Vector &
+ForceBeamColumn2d::getIterationStats(void)
+{
+  static Vector stats(8);
+
+  stats(0) = lastLocalIters;
+  stats(1) = numUpdates;
+  stats(2) = numLocalIters;
+  stats(3) = maxLocalIters;
+  stats(4) = numSubdivisions;
+  stats(5) = numFallbacks;
+  stats(6) = numFailures;
+  stats(7) = numSectionReuse;
+
+  return stats;
+}
+
 Response*
 ForceBeamColumn2d::setResponse(const char **argv, int argc, OPS_Stream &output)
 {
@@ -2254,6 +2398,20 @@ ForceBeamColumn2d::setResponse(const char **argv, int argc, OPS_Stream &output)
   else if (strcmp(argv[0],"dqdh") == 0)
     return new ElementResponse(this, 12, Vector(3));
 
+  // local iteration statistics
+  else if (strcmp(argv[0],"localIterations") == 0 || strcmp(argv[0],"iterationStats") == 0) {
+    output.tag("ResponseType","lastIters");
+    output.tag("ResponseType","numUpdates");
+    output.tag("ResponseType","numIters");
+    output.tag("ResponseType","maxIters");
+    output.tag("ResponseType","numSubdivisions");
+    output.tag("ResponseType","numFallbacks");
+    output.tag("ResponseType","numFailures");
+    output.tag("ResponseType","numSectionReuse");
+
+    theResponse = new ElementResponse(this, 13, Vector(8));
+  }
+
   else if (strcmp(argv[0],"integrationPoints") == 0)
     theResponse = new ElementResponse(this, 10, Vector(numSections));
 
@@ -2497,6 +2655,9 @@ ForceBeamColumn2d::getResponse(int responseID, Information &eleInfo)
   }
   */
 
+  else if (responseID == 13)
+    return eleInfo.setVector(this->getIterationStats());
+
   else if (responseID == 10) {
     double L = crdTransf->getInitialLength();
     double pts[maxNumSections];
@@ -81,7 +81,8 @@ class ForceBeamColumn2d: public Element
 		    int numSections, SectionForceDeformation **sec,
 		    BeamIntegration &beamIntegr,
 		    CrdTransf &coordTransf, double rho = 0.0, 
-		    int maxNumIters = 10, double tolerance = 1.0e-12);
+		    int maxNumIters = 10, double tolerance = 1.0e-12,
+		    bool accelerateLocal = false);
   
   ~ForceBeamColumn2d();
   
@@ -119,6 +120,7 @@ class ForceBeamColumn2d: public Element
   
   Response *setResponse(const char **argv, int argc, OPS_Stream &s);
   int getResponse(int responseID, Information &eleInformation);
+  const Vector &getIterationStats(void);
   int getResponseSensitivity(int responseID, int gradNumber,
 			     Information &eleInformation);
   
@@ -160,6 +162,18 @@ class ForceBeamColumn2d: public Element
   double rho;                    // mass density per unit length
   int    maxIters;               // maximum number of local iterations
   double tol;	                   // tolerance for relative energy norm for local iterations
+
+  // element-local iteration acceleration and statistics
+  bool   accelerate;             // use accelerated local iterations
+  int    lastStrategy;           // local strategy that converged in last update
+  int    numUpdates;             // number of updates requiring local iterations
+  int    numLocalIters;          // total number of local iterations
+  int    lastLocalIters;         // number of local iterations in last update
+  int    maxLocalIters;          // largest number of local iterations in one update
+  int    numSubdivisions;        // number of subdivisions of the deformation increment
+  int    numFallbacks;           // number of updates converged with initial flexibility
+  int    numFailures;            // number of updates that failed to converge
+  int    numSectionReuse;        // number of section state determinations skipped
   
   int    initialFlag;            // indicates if the element has been initialized
   
@@ -81,6 +81,8 @@ using std::ifstream;
 #include <CompositeResponse.h>
 
 #include <ElementalLoad.h>
+#include <Profiler.h>
+#include <ClassTagNames.h>
 
 #define  NDM   3         // dimension of the problem (3d)
 #define  NND   6         // number of nodal dof's
@@ -102,7 +104,10 @@ Vector *ForceBeamColumn3d::SsrSubdivide = 0;
 ForceBeamColumn3d::ForceBeamColumn3d(): 
   Element(0,ELE_TAG_ForceBeamColumn3d), connectedExternalNodes(2), 
   beamIntegr(0), numSections(0), sections(0), crdTransf(0),
-  rho(0.0), maxIters(0), tol(0.0),
+  rho(0.0), maxIters(0), tol(0.0), accelerate(false),
+  lastStrategy(0), numUpdates(0), numLocalIters(0), lastLocalIters(0),
+  maxLocalIters(0), numSubdivisions(0), numFallbacks(0), numFailures(0),
+  numSectionReuse(0),
   initialFlag(0),
   kv(NEBD,NEBD), Se(NEBD),
   kvcommit(NEBD,NEBD), Secommit(NEBD),
@@ -142,10 +147,15 @@ ForceBeamColumn3d::ForceBeamColumn3d (int tag, int nodeI, int nodeJ,
 				      int numSec, SectionForceDeformation **sec,
 				      BeamIntegration &bi,
 				      CrdTransf &coordTransf, double massDensPerUnitLength,
-				      int maxNumIters, double tolerance):
+				      int maxNumIters, double tolerance,
+				      bool accelerateLocal):
   Element(tag,ELE_TAG_ForceBeamColumn3d), connectedExternalNodes(2),
   beamIntegr(0), numSections(0), sections(0), crdTransf(0),
   rho(massDensPerUnitLength),maxIters(maxNumIters), tol(tolerance), 
+  accelerate(accelerateLocal),
+  lastStrategy(0), numUpdates(0), numLocalIters(0), lastLocalIters(0),
+  maxLocalIters(0), numSubdivisions(0), numFallbacks(0), numFailures(0),
+  numSectionReuse(0),
   initialFlag(0),
   kv(NEBD,NEBD), Se(NEBD), 
   kvcommit(NEBD,NEBD), Secommit(NEBD),
@@ -346,6 +356,9 @@ ForceBeamColumn3d::commitState()
   // commit the element variables state
   kvcommit = kv;
   Secommit = Se;
+
+  // start the local iterations of the next step with newton
+  lastStrategy = 0;
   
   //   initialFlag = 0;  fmk - commented out, see what happens to Example3.1.tcl if uncommented
   //                         - i have not a clue why, ask remo if he ever gets in contact with us again!
@@ -380,6 +393,7 @@ int ForceBeamColumn3d::revertToLastCommit()
   // revert the element state to last commit
   Se   = Secommit;
   kv   = kvcommit;
+  lastStrategy = 0;
   
   initialFlag = 0;
   // this->update();
@@ -414,6 +428,17 @@ int ForceBeamColumn3d::revertToStart()
   
   Se.Zero();
   kv.Zero();
+
+  // reset the local iteration statistics
+  lastStrategy = 0;
+  numUpdates = 0;
+  numLocalIters = 0;
+  lastLocalIters = 0;
+  maxLocalIters = 0;
+  numSubdivisions = 0;
+  numFallbacks = 0;
+  numFailures = 0;
+  numSectionReuse = 0;
   
   initialFlag = 0;
   // this->update();
@@ -535,6 +560,18 @@ ForceBeamColumn3d::getInitialStiff(void)
     dvToDo = dv;
     dvTrial = dvToDo;
 
+    // accelerated local iterations: correction from the previous iteration,
+    // energy norm of the last accepted iteration and relaxation factor
+    static Vector dSeLast(NEBD);
+    static Vector dSeDiff(NEBD);
+    double dWLast = 0.0;
+    double omega = 1.0;
+    int numBacktrack = 0;
+    const int maxBacktrack = 4;
+
+    int numIterUpdate = 0;
+    numUpdates++;
+
     static double factor = 10;
     double dW0 = 0.0;
 
@@ -556,7 +593,10 @@ ForceBeamColumn3d::getInitialStiff(void)
       // initial tangent iterations (if l==1), or
       // initial tangent on first iteration then regular newton (if l==2)
 
-      for (int l=0; l<3; l++) {
+      // when accelerating, start with the strategy that last converged
+      int lStart = (accelerate == true) ? lastStrategy : 0;
+
+      for (int l=lStart; l<3; l++) {
 
 	//      if (l == 1) l = 2;
 	SeTrial = Se;
@@ -572,6 +612,11 @@ ForceBeamColumn3d::getInitialStiff(void)
 	dSe.addMatrixVector(0.0, kvTrial, dvTrial, 1.0);
 	SeTrial += dSe;
 
+	dSeLast = dSe;
+	dWLast = 0.0;
+	omega = 1.0;
+	numBacktrack = 0;
+
 	if (initialFlag != 2) {
 
 	  int numIters = maxIters;
@@ -710,21 +755,37 @@ ForceBeamColumn3d::getInitialStiff(void)
 		dvs.addMatrixVector(0.0, fs0, dSs, 1.0);
 	      }
 
-	      // set section deformations
-	      if (initialFlag != 0)
+	      // set section deformations - when accelerating, a section whose
+	      // deformations do not change keeps its resultant and flexibility
+	      bool reuseSection = false;
+	      if (initialFlag != 0) {
+		if (accelerate == true && j > 0) {
+		  reuseSection = true;
+		  for (ii = 0; ii < order; ii++)
+		    if (vsSubdivide[i](ii) + dvs(ii) != vsSubdivide[i](ii)) {
+		      reuseSection = false;
+		      break;
+		    }
+		}
 		vsSubdivide[i] += dvs;
-
-	      if ( sections[i]->setTrialSectionDeformation(vsSubdivide[i]) < 0) {
-		opserr << "ForceBeamColumn3d::update() - section failed in setTrial\n";
-		return -1;
 	      }
 
-	      // get section resisting forces
-	      SsrSubdivide[i] = sections[i]->getStressResultant();
+	      if (reuseSection == true)
+		numSectionReuse++;
 
-	      // get section flexibility matrix
-	      // FRANK 
-	      fsSubdivide[i] = sections[i]->getSectionFlexibility();
+	      else {
+		if (sections[i]->setTrialSectionDeformation(vsSubdivide[i]) < 0) {
+		  opserr << "ForceBeamColumn3d::update() - section failed in setTrial\n";
+		  return -1;
+		}
+
+		// get section resisting forces
+		SsrSubdivide[i] = sections[i]->getStressResultant();
+
+		// get section flexibility matrix
+		// FRANK 
+		fsSubdivide[i] = sections[i]->getSectionFlexibility();
+	      }
 
 	      /*
 	      const Matrix &sectionStiff = sections[i]->getSectionTangent();
@@ -896,7 +957,47 @@ ForceBeamColumn3d::getInitialStiff(void)
 	    if (dW0 == 0.0) 
 	      dW0 = dW;
 
-	    SeTrial += dSe;
+	    numIterUpdate++;
+
+	    if (accelerate == true && j > 0 && fabs(dW) >= tol) {
+
+	      if (l == 1) {
+
+		// secant (Aitken) relaxation of the initial flexibility iterations
+		//   omega = -omega * dSeLast^(dSe-dSeLast) / |dSe-dSeLast|^2
+		dSeDiff = dSe;
+		dSeDiff -= dSeLast;
+		double den = dSeDiff ^ dSeDiff;
+		if (den > 0.0)
+		  omega = -omega*(dSeLast ^ dSeDiff)/den;
+		if (omega < 0.1)
+		  omega = 0.1;
+		else if (omega > 4.0)
+		  omega = 4.0;
+
+		dSeLast = dSe;
+		SeTrial.addVector(1.0, dSe, omega);
+
+	      } else if (fabs(dW) > fabs(dWLast) && numBacktrack < maxBacktrack) {
+
+		// line search - the energy norm grew, so step back half of
+		// the last correction instead of applying this one
+		dSeLast *= 0.5;
+		SeTrial.addVector(1.0, dSeLast, -1.0);
+		numBacktrack++;
+
+	      } else {
+		dSeLast = dSe;
+		dWLast = dW;
+		numBacktrack = 0;
+		SeTrial += dSe;
+	      }
+
+	    } else {
+	      dSeLast = dSe;
+	      dWLast = dW;
+	      SeTrial += dSe;
+	    }
 
 	    // check for convergence of this interval
 	    if (fabs(dW) < tol) { 
@@ -926,6 +1027,11 @@ ForceBeamColumn3d::getInitialStiff(void)
 		Ssr[k] = SsrSubdivide[k];
 	      }
 
+	      // remember the strategy for the next update
+	      lastStrategy = l;
+	      if (l > 0)
+		numFallbacks++;
+
 	      // break out of j & l loops
 	      j = numIters+1;
 	      l = 4;
@@ -937,6 +1043,7 @@ ForceBeamColumn3d::getInitialStiff(void)
 	      if (j == (numIters-1) && (l == 2)) {
 		dvTrial /= factor;
 		numSubdivide++;
+		numSubdivisions++;
 	      }
 	    }
 
@@ -945,9 +1052,22 @@ ForceBeamColumn3d::getInitialStiff(void)
       } // for (int l=0; l<2; l++)
     } // while (converged == false)
 
+    // update the local iteration statistics
+    lastLocalIters = numIterUpdate;
+    numLocalIters += numIterUpdate;
+    if (numIterUpdate > maxLocalIters)
+      maxLocalIters = numIterUpdate;
+    if (Profiler::on)
+      Profiler::count("localIterations", this->getClassTag(),
+                      getElementClassName(this->getClassTag()), numIterUpdate);
+
     // if fail to converge we return an error flag & print an error message
 
     if (converged == false) {
+      numFailures++;
+      if (Profiler::on)
+        Profiler::count("localFailures", this->getClassTag(),
+                        getElementClassName(this->getClassTag()));
       opserr << "WARNING - ForceBeamColumn3d::update - failed to get compatible ";
       opserr << "element forces & deformations for element: ";
       opserr << this->getTag() << "(dW: << " << dW << ", dW0: " << dW0 << ")\n";
@@ -1243,7 +1363,7 @@ ForceBeamColumn3d::getInitialStiff(void)
     int i, j , k;
     int loc = 0;
 
-    static ID idData(11);  
+    static ID idData(12);  
     idData(0) = this->getTag();
     idData(1) = connectedExternalNodes(0);
     idData(2) = connectedExternalNodes(1);
@@ -1271,6 +1391,8 @@ ForceBeamColumn3d::getInitialStiff(void)
     }
     idData(10) = beamIntegrDbTag;
 
+    idData(11) = (accelerate == true) ? 1 : 0;
+
     if (theChannel.sendID(dbTag, commitTag, idData) < 0) {
       opserr << "ForceBeamColumn3d::sendSelf() - failed to send ID data\n";
       return -1;
@@ -1381,7 +1503,7 @@ ForceBeamColumn3d::getInitialStiff(void)
     int dbTag = this->getDbTag();
     int i,j,k;
 
-    static ID idData(11); // one bigger than needed 
+    static ID idData(12); // one bigger than needed 
 
     if (theChannel.recvID(dbTag, commitTag, idData) < 0)  {
       opserr << "ForceBeamColumn3d::recvSelf() - failed to recv ID data\n";
@@ -1395,6 +1517,7 @@ ForceBeamColumn3d::getInitialStiff(void)
     maxIters = idData(4);
     initialFlag = idData(5);
     isTorsion = (idData(6) == 1) ? true : false;
+    accelerate = (idData(11) == 1) ? true : false;
 
     int crdTransfClassTag = idData(7);
     int crdTransfDbTag = idData(8);
@@ -2081,6 +2204,27 @@ ForceBeamColumn3d::getInitialDeformations(Vector &v0)
     return theViewer.drawLine (v1, v2, 1.0, 1.0);
   }
 
+  // returns the element-local iteration statistics: iterations in the
+  // last update, number of updates, total and largest number of
+  // iterations, subdivisions, initial flexibility fallbacks, failures
+  // and skipped section state determinations
+  const Vector &
+  ForceBeamColumn3d::getIterationStats(void)
+  {
+    static Vector stats(8);
+
+    stats(0) = lastLocalIters;
+    stats(1) = numUpdates;
+    stats(2) = numLocalIters;
+    stats(3) = maxLocalIters;
+    stats(4) = numSubdivisions;
+    stats(5) = numFallbacks;
+    stats(6) = numFailures;
+    stats(7) = numSectionReuse;
+
+    return stats;
+  }
+
   Response*
   ForceBeamColumn3d::setResponse(const char **argv, int argc, OPS_Stream &output)
   {
@@ -2172,6 +2316,19 @@ ForceBeamColumn3d::getInitialDeformations(Vector &v0)
 
     } else if (strcmp(argv[0],"getRemCriteria2") == 0) {
       theResponse = new ElementResponse(this, 8, Vector(2), ID(6));
+      // local iteration statistics
+    } else if (strcmp(argv[0],"localIterations") == 0 || strcmp(argv[0],"iterationStats") == 0) {
+
+      output.tag("ResponseType","lastIters");
+      output.tag("ResponseType","numUpdates");
+      output.tag("ResponseType","numIters");
+      output.tag("ResponseType","maxIters");
+      output.tag("ResponseType","numSubdivisions");
+      output.tag("ResponseType","numFallbacks");
+      output.tag("ResponseType","numFailures");
+      output.tag("ResponseType","numSectionReuse");
+
+      theResponse = new ElementResponse(this, 13, Vector(8));
 
       // section response -
     } else if (strcmp(argv[0],"section") ==0) { 
@@ -2386,6 +2543,9 @@ ForceBeamColumn3d::getResponse(int responseID, Information &eleInfo)
 
     return eleInfo.setVector(d);
 
+  } else if (responseID == 13) {
+    return eleInfo.setVector(this->getIterationStats());
+
   } else if (responseID == 7) {
     return -1;
   } else if (responseID == 8) {
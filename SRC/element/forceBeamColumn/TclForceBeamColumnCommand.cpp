@@ -256,6 +256,7 @@ TclModelBuilder_addForceBeamColumn(ClientData clientData, Tcl_Interp *interp,
     int numIter = 10;
     double tol = 1.0e-12;
     double mass = 0.0;
+    bool accelerate = false;
     BeamIntegration *beamIntegr = 0;
 
     while (argi < argc) {
@@ -276,6 +277,9 @@ TclModelBuilder_addForceBeamColumn(ClientData clientData, Tcl_Interp *interp,
 	  return TCL_ERROR;
 	}
 	argi += 3;
+      } else if (strcmp(argv[argi],"-accelerate") == 0) {
+	accelerate = true;
+	argi++;
       } else if (strcmp(argv[argi],"-mass") == 0) {
 	if (argc < argi+2) {
 	  opserr << "WARNING not enough -iter args need -mass mass??\n";
@@ -347,7 +351,8 @@ TclModelBuilder_addForceBeamColumn(ClientData clientData, Tcl_Interp *interp,
 	theElement = new DispBeamColumn2dWithSensitivity(eleTag, iNode, jNode, nIP, sections, *beamIntegr, *theTransf2d, mass);
       else								            //tag     ndI    ndJ   nPts  secID    transf
 	theElement = new ForceBeamColumn2d(eleTag, iNode, jNode, nIP, sections,
-					   *beamIntegr, *theTransf2d, mass, numIter, tol);
+					   *beamIntegr, *theTransf2d, mass, numIter, tol,
+					   accelerate);
     }
     else {
       if (strcmp(argv[1],"elasticForceBeamColumn") == 0)
@@ -359,7 +364,8 @@ TclModelBuilder_addForceBeamColumn(ClientData clientData, Tcl_Interp *interp,
 	                                               
       else
 	theElement = new ForceBeamColumn3d(eleTag, iNode, jNode, nIP, sections,
-					   *beamIntegr, *theTransf3d, mass, numIter, tol);
+					   *beamIntegr, *theTransf3d, mass, numIter, tol,
+					   accelerate);
     }
 
     delete [] sections;    
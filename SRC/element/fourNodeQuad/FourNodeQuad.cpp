@@ -45,34 +45,20 @@
 #include <ElementalLoad.h>
 
 
-double FourNodeQuad::matrixData[64];
-Matrix FourNodeQuad::K(matrixData, 8, 8);
-Vector FourNodeQuad::P(8);
-double FourNodeQuad::shp[3][4];
-double FourNodeQuad::pts[4][2];
-double FourNodeQuad::wts[4];
+// the 2x2 Gauss points and weights, shared by all the elements
+const double FourNodeQuad::pts[4][2] = {{-0.5773502691896258, -0.5773502691896258},
+					{ 0.5773502691896258, -0.5773502691896258},
+					{ 0.5773502691896258,  0.5773502691896258},
+					{-0.5773502691896258,  0.5773502691896258}};
+const double FourNodeQuad::wts[4] = {1.0, 1.0, 1.0, 1.0};
 
 FourNodeQuad::FourNodeQuad(int tag, int nd1, int nd2, int nd3, int nd4,
 			   NDMaterial &m, const char *type, double t,
 			   double p, double r, double b1, double b2)
 :Element (tag, ELE_TAG_FourNodeQuad), 
   theMaterial(0), connectedExternalNodes(4), 
- Q(8), pressureLoad(8), thickness(t), applyLoad(0), pressure(p), rho(r), Ki(0)
+ K(matrixData, 8, 8), P(8), Q(8), pressureLoad(8), thickness(t), applyLoad(0), pressure(p), rho(r), Ki(0)
 {
-	pts[0][0] = -0.5773502691896258;
-	pts[0][1] = -0.5773502691896258;
-	pts[1][0] =  0.5773502691896258;
-	pts[1][1] = -0.5773502691896258;
-	pts[2][0] =  0.5773502691896258;
-	pts[2][1] =  0.5773502691896258;
-	pts[3][0] = -0.5773502691896258;
-	pts[3][1] =  0.5773502691896258;
-
-	wts[0] = 1.0;
-	wts[1] = 1.0;
-	wts[2] = 1.0;
-	wts[3] = 1.0;
-
 	if (strcmp(type,"PlaneStrain") != 0 && strcmp(type,"PlaneStress") != 0
 	    && strcmp(type,"PlaneStrain2D") != 0 && strcmp(type,"PlaneStress2D") != 0) {
 	  opserr << "FourNodeQuad::FourNodeQuad -- improper material type: " << type << "for FourNodeQuad\n";
@@ -117,22 +103,8 @@ FourNodeQuad::FourNodeQuad(int tag, int nd1, int nd2, int nd3, int nd4,
 FourNodeQuad::FourNodeQuad()
 :Element (0,ELE_TAG_FourNodeQuad),
   theMaterial(0), connectedExternalNodes(4), 
- Q(8), pressureLoad(8), thickness(0.0), applyLoad(0), pressure(0.0), Ki(0)
+ K(matrixData, 8, 8), P(8), Q(8), pressureLoad(8), thickness(0.0), applyLoad(0), pressure(0.0), Ki(0)
 {
-  pts[0][0] = -0.577350269189626;
-  pts[0][1] = -0.577350269189626;
-  pts[1][0] =  0.577350269189626;
-  pts[1][1] = -0.577350269189626;
-  pts[2][0] =  0.577350269189626;
-  pts[2][1] =  0.577350269189626;
-  pts[3][0] = -0.577350269189626;
-  pts[3][1] =  0.577350269189626;
-  
-  wts[0] = 1.0;
-  wts[1] = 1.0;
-  wts[2] = 1.0;
-  wts[3] = 1.0;
-
     for (int i=0; i<4; i++)
       theNodes[i] = 0;
 }
@@ -273,7 +245,7 @@ FourNodeQuad::update()
 	const Vector &disp3 = theNodes[2]->getTrialDisp();
 	const Vector &disp4 = theNodes[3]->getTrialDisp();
 	
-	static double u[2][4];
+	double u[2][4];
 
 	u[0][0] = disp1(0);
 	u[1][0] = disp1(1);
@@ -284,7 +256,8 @@ FourNodeQuad::update()
 	u[0][3] = disp4(0);
 	u[1][3] = disp4(1);
 
-	static Vector eps(3);
+	double epsData[3];
+	Vector eps(epsData, 3);
 
 	int ret = 0;
 
@@ -430,7 +403,7 @@ FourNodeQuad::getMass()
 	K.Zero();
 
 	int i;
-	static double rhoi[4];
+	double rhoi[4];
 	double sum = 0.0;
 	for (i = 0; i < 4; i++) {
 	  if (rho == 0)
@@ -502,7 +475,7 @@ int
 FourNodeQuad::addInertiaLoadToUnbalance(const Vector &accel)
 {
   int i;
-  static double rhoi[4];
+  double rhoi[4];
   double sum = 0.0;
   for (i = 0; i < 4; i++) {
     rhoi[i] = theMaterial[i]->getRho();
@@ -524,7 +497,7 @@ FourNodeQuad::addInertiaLoadToUnbalance(const Vector &accel)
     return -1;
   }
   
-  static double ra[8];
+  double ra[8];
   
   ra[0] = Raccel1(0);
   ra[1] = Raccel1(1);
@@ -602,7 +575,7 @@ const Vector&
 FourNodeQuad::getResistingForceIncInertia()
 {
 	int i;
-	static double rhoi[4];
+	double rhoi[4];
 	double sum = 0.0;
 	for (i = 0; i < 4; i++) {
 	  rhoi[i] = theMaterial[i]->getRho();
@@ -625,7 +598,7 @@ FourNodeQuad::getResistingForceIncInertia()
 	const Vector &accel3 = theNodes[2]->getTrialAccel();
 	const Vector &accel4 = theNodes[3]->getTrialAccel();
 	
-	static double a[8];
+	double a[8];
 
 	a[0] = accel1(0);
 	a[1] = accel1(1);
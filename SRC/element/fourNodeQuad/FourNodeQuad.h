@@ -112,9 +112,9 @@ class FourNodeQuad : public Element
 
     Node *theNodes[4];
 
-    static double matrixData[64];  // array data for matrix
-    static Matrix K;		// Element stiffness, damping, and mass Matrix
-    static Vector P;		// Element resisting force vector
+    double matrixData[64];  // array data for matrix
+    Matrix K;		// Element stiffness, damping, and mass Matrix
+    Vector P;		// Element resisting force vector
     Vector Q;		        // Applied nodal loads
     double b[2];		// Body forces
 
@@ -127,9 +127,9 @@ class FourNodeQuad : public Element
     double pressure;	        // Normal surface traction (pressure) over entire element
 					 // Note: positive for outward normal
     double rho;
-    static double shp[3][4];	// Stores shape functions and derivatives (overwritten)
-    static double pts[4][2];	// Stores quadrature points
-    static double wts[4];		// Stores quadrature weights
+    double shp[3][4];	// Stores shape functions and derivatives (overwritten)
+    static const double pts[4][2];	// Stores quadrature points
+    static const double wts[4];		// Stores quadrature weights
 
     // private member functions - only objects of this class can call these
     double shapeFunction(double xi, double eta);
@@ -92,43 +92,26 @@ OPS_NewShellMITC4(void)
 }
 
 
-//static data
-Matrix  ShellMITC4::stiff(24,24) ;
-Vector  ShellMITC4::resid(24) ;
-Matrix  ShellMITC4::mass(24,24) ;
-
 //quadrature data
 const double  ShellMITC4::root3 = sqrt(3.0) ;
 const double  ShellMITC4::one_over_root3 = 1.0 / root3 ;
 
-double ShellMITC4::sg[4] ;
-double ShellMITC4::tg[4] ;
-double ShellMITC4::wg[4] ;
+const double ShellMITC4::sg[] = { -one_over_root3, one_over_root3, 
+				  one_over_root3, -one_over_root3 } ;
+const double ShellMITC4::tg[] = { -one_over_root3, -one_over_root3, 
+				  one_over_root3, one_over_root3 } ;
+const double ShellMITC4::wg[] = { 1.0, 1.0, 1.0, 1.0 } ;
 
  
 
 //null constructor
 ShellMITC4::ShellMITC4( ) :
 Element( 0, ELE_TAG_ShellMITC4 ),
-connectedExternalNodes(4), load(0), Ki(0)
+stiff(24,24), resid(24), mass(0), connectedExternalNodes(4),
+load(0), Ki(0)
 { 
   for (int i = 0 ;  i < 4; i++ ) 
     materialPointers[i] = 0;
-
-  sg[0] = -one_over_root3;
-  sg[1] = one_over_root3;
-  sg[2] = one_over_root3;
-  sg[3] = -one_over_root3;  
-
-  tg[0] = -one_over_root3;
-  tg[1] = -one_over_root3;
-  tg[2] = one_over_root3;
-  tg[3] = one_over_root3;  
-
-  wg[0] = 1.0;
-  wg[1] = 1.0;
-  wg[2] = 1.0;
-  wg[3] = 1.0;
 }
 
 
@@ -141,7 +124,8 @@ ShellMITC4::ShellMITC4(  int tag,
                          int node4,
 	                     SectionForceDeformation &theMaterial ) :
 Element( tag, ELE_TAG_ShellMITC4 ),
-connectedExternalNodes(4), load(0), Ki(0)
+stiff(24,24), resid(24), mass(0), connectedExternalNodes(4),
+load(0), Ki(0)
 {
   int i;
 
@@ -160,21 +144,6 @@ connectedExternalNodes(4), load(0), Ki(0)
       
   } //end for i 
 
-  sg[0] = -one_over_root3;
-  sg[1] = one_over_root3;
-  sg[2] = one_over_root3;
-  sg[3] = -one_over_root3;  
-
-  tg[0] = -one_over_root3;
-  tg[1] = -one_over_root3;
-  tg[2] = one_over_root3;
-  tg[3] = one_over_root3;  
-
-  wg[0] = 1.0;
-  wg[1] = 1.0;
-  wg[2] = 1.0;
-  wg[3] = 1.0;
-
  }
 //******************************************************************
 
@@ -196,6 +165,9 @@ ShellMITC4::~ShellMITC4( )
 
   if (Ki != 0)
     delete Ki;
+
+  if (mass != 0)
+    delete mass;
 }
 //**************************************************************************
 
@@ -204,8 +176,8 @@ ShellMITC4::~ShellMITC4( )
 void  ShellMITC4::setDomain( Domain *theDomain ) 
 {  
   int i, j ;
-  static Vector eig(3) ;
-  static Matrix ddMembrane(3,3) ;
+  Vector eig(3) ;
+  Matrix ddMembrane(3,3) ;
 
   //node pointers
   for ( i = 0; i < 4; i++ ) {
@@ -544,47 +516,56 @@ const Matrix&  ShellMITC4::getInitialStiff( )
 
   double volume = 0.0 ;
 
-  static double xsj ;  // determinant jacaobian matrix 
+  double xsj ;  // determinant jacaobian matrix 
 
-  static double dvol[ngauss] ; //volume element
+  double dvol[ngauss] ; //volume element
 
-  static double shp[3][numnodes] ;  //shape functions at a gauss point
+  double shp[3][numnodes] ;  //shape functions at a gauss point
 
   //  static double Shape[3][numnodes][ngauss] ; //all the shape functions
 
-  static Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness 
+  double stiffJKData[ndf*ndf] ;
+  Matrix stiffJK(stiffJKData,ndf,ndf) ; //nodeJK stiffness 
 
-  static Matrix dd(nstress,nstress) ;  //material tangent
+  double ddData[nstress*nstress] ;
+  Matrix dd(ddData,nstress,nstress) ;  //material tangent
 
-  static Matrix J0(2,2) ;  //Jacobian at center
+  double J0Data[2*2] ;
+  Matrix J0(J0Data,2,2) ;  //Jacobian at center
  
-  static Matrix J0inv(2,2) ; //inverse of Jacobian at center
+  double J0invData[2*2] ;
+  Matrix J0inv(J0invData,2,2) ; //inverse of Jacobian at center
 
   //---------B-matrices------------------------------------
 
-    static Matrix BJ(nstress,ndf) ;      // B matrix node J
-
-    static Matrix BJtran(ndf,nstress) ;
+    double BJData[nstress*ndf] ;
+    Matrix BJ(BJData,nstress,ndf) ;      // B matrix node J
 
-    static Matrix BK(nstress,ndf) ;      // B matrix node k
+    double BJtranData[ndf*nstress] ;
+    Matrix BJtran(BJtranData,ndf,nstress) ;
 
-    static Matrix BJtranD(ndf,nstress) ;
+    double BKData[nstress*ndf] ;
+    Matrix BK(BKData,nstress,ndf) ;      // B matrix node k
 
+    double BJtranDData[ndf*nstress] ;
+    Matrix BJtranD(BJtranDData,ndf,nstress) ;
 
-    static Matrix Bbend(3,3) ;  // bending B matrix
 
-    static Matrix Bshear(2,3) ; // shear B matrix
+    double BbendData[3*2] ;
+    Matrix Bbend(BbendData,3,2) ;  // bending B matrix
 
-    static Matrix Bmembrane(3,2) ; // membrane B matrix
+    double BshearData[2*3] ;
+    Matrix Bshear(BshearData,2,3) ; // shear B matrix
 
+    double BmembraneData[3*2] ;
+    Matrix Bmembrane(BmembraneData,3,2) ; // membrane B matrix
 
-    static double BdrillJ[ndf] ; //drill B matrix
 
-    static double BdrillK[ndf] ;  
+    double BdrillJ[ndf] ; //drill B matrix
 
-    double *drillPointer ;
+    double BdrillK[ndf] ;  
 
-    static double saveB[nstress][ndf][numnodes] ;
+    double saveB[nstress][ndf][numnodes] ;
 
   //-------------------------------------------------------
 
@@ -693,16 +674,16 @@ const Matrix&  ShellMITC4::getInitialStiff( )
 
       //compute B matrix 
 
-      Bmembrane = computeBmembrane( j, shp ) ;
+      computeBmembrane( j, shp, Bmembrane ) ;
 
-      Bbend = computeBbend( j, shp ) ;
+      computeBbend( j, shp, Bbend ) ;
 
       for ( p = 0; p < 3; p++) {
 		  Bshear(0,p) = Bs(0,j*3+p);
 		  Bshear(1,p) = Bs(1,j*3+p);
       }//end for p
 
-      BJ = assembleB( Bmembrane, Bbend, Bshear ) ;
+      assembleB( Bmembrane, Bbend, Bshear, BJ ) ;
 
       //save the B-matrix
       for (p=0; p<nstress; p++) {
@@ -711,12 +692,7 @@ const Matrix&  ShellMITC4::getInitialStiff( )
       }//end for p
 
       //drilling B matrix
-      drillPointer = computeBdrill( j, shp ) ;
-      for (p=0; p<ndf; p++ ) {
-	    //BdrillJ[p] = *drillPointer++ ;
-	    BdrillJ[p] = *drillPointer ; //set p-th component
-	    drillPointer++ ;             //pointer arithmetic
-      }//end for p
+      computeBdrill( j, shp, BdrillJ ) ;
     } // end for j
   
 
@@ -750,11 +726,7 @@ const Matrix&  ShellMITC4::getInitialStiff( )
       }//end for p
 
       //drilling B matrix
-      drillPointer = computeBdrill( j, shp ) ;
-      for (p=0; p<ndf; p++ ) {
-	BdrillJ[p] = *drillPointer ;
-	drillPointer++ ;
-      }//end for p
+      computeBdrill( j, shp, BdrillJ ) ;
 
       //BJtranD = BJtran * dd ;
       BJtranD.addMatrixProduct(0.0, BJtran,dd,1.0 ) ;
@@ -773,11 +745,7 @@ const Matrix&  ShellMITC4::getInitialStiff( )
 	
 	
 	//drilling B matrix
-	drillPointer = computeBdrill( k, shp ) ;
-	for (p=0; p<ndf; p++ ) {
-	  BdrillK[p] = *drillPointer ;
-	  drillPointer++ ;
-	}//end for p
+	computeBdrill( k, shp, BdrillK ) ;
 	
 	//stiffJK = BJtranD * BK  ;
 	// +  transpose( 1,ndf,BdrillJ ) * BdrillK ; 
@@ -811,7 +779,7 @@ const Matrix&  ShellMITC4::getMass( )
 
   formInertiaTerms( tangFlag ) ;
 
-  return mass ;
+  return *mass ;
 } 
 
 
@@ -859,7 +827,7 @@ ShellMITC4::addInertiaLoadToUnbalance(const Vector &accel)
   formInertiaTerms( tangFlag ) ;
   if (load == 0) 
     load = new Vector(24);
-  load->addMatrixVector(1.0, mass, resid, -1.0);
+  load->addMatrixVector(1.0, *mass, resid, -1.0);
 
   return 0;
 }
@@ -884,24 +852,28 @@ const Vector&  ShellMITC4::getResistingForce( )
 //get residual with inertia terms
 const Vector&  ShellMITC4::getResistingForceIncInertia( )
 {
-  static Vector res(24);
   int tang_flag = 0 ; //don't get the tangent
 
+  // the rayleigh damping forces are obtained first, forming them
+  // reforms the tangent and mass and so overwrites the residual
+  const Vector *dampingForces = 0;
+  if (alphaM != 0.0 || betaK != 0.0 || betaK0 != 0.0 || betaKc != 0.0)
+    dampingForces = &(this->getRayleighDampingForces());
+
   //do tangent and residual here 
   formResidAndTangent( tang_flag ) ;
 
   formInertiaTerms( tang_flag ) ;
 
-  res = resid;
   // add the damping forces if rayleigh damping
-  if (alphaM != 0.0 || betaK != 0.0 || betaK0 != 0.0 || betaKc != 0.0)
-    res += this->getRayleighDampingForces();
+  if (dampingForces != 0)
+    resid += *dampingForces;
 
   // subtract external loads 
   if (load != 0)
-    res -= *load;
+    resid -= *load;
 
-  return res;
+  return resid;
 }
 
 //*********************************************************************
@@ -929,9 +901,10 @@ ShellMITC4::formInertiaTerms( int tangFlag )
 
   double dvol ; //volume element
 
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
+  double shp[nShape][numberNodes] ;  //shape functions at a gauss point
 
-  static Vector momentum(ndf) ;
+  double momentumData[ndf] ;
+  Vector momentum(momentumData, ndf) ;
 
 
   int i, j, k, p;
@@ -941,7 +914,11 @@ ShellMITC4::formInertiaTerms( int tangFlag )
 
 
   //zero mass 
-  mass.Zero( ) ;
+  if ( tangFlag == 1 ) {
+    if (mass == 0)
+      mass = new Matrix(24,24) ;
+    mass->Zero( ) ;
+  }
 
   //gauss loop 
   for ( i = 0; i < numberGauss; i++ ) {
@@ -989,7 +966,7 @@ ShellMITC4::formInertiaTerms( int tangFlag )
 	   massJK = temp * shp[massIndex][k] ;
 
 	   for ( p = 0; p < 3; p++ ) 
-	      mass( jj+p, kk+p ) +=  massJK ;
+	      (*mass)( jj+p, kk+p ) +=  massJK ;
             
           } // end for k loop
 
@@ -1061,27 +1038,34 @@ ShellMITC4::formResidAndTangent( int tang_flag )
   
   double volume = 0.0 ;
 
-  static double xsj ;  // determinant jacaobian matrix 
+  double xsj ;  // determinant jacaobian matrix 
 
-  static double dvol[ngauss] ; //volume element
+  double dvol[ngauss] ; //volume element
 
-  static Vector strain(nstress) ;  //strain
+  double strainData[nstress] ;
+  Vector strain(strainData,nstress) ;  //strain
 
-  static double shp[3][numnodes] ;  //shape functions at a gauss point
+  double shp[3][numnodes] ;  //shape functions at a gauss point
 
   //  static double Shape[3][numnodes][ngauss] ; //all the shape functions
 
-  static Vector residJ(ndf) ; //nodeJ residual 
+  double residJData[ndf] ;
+  Vector residJ(residJData,ndf) ; //nodeJ residual 
 
-  static Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness 
+  double stiffJKData[ndf*ndf] ;
+  Matrix stiffJK(stiffJKData,ndf,ndf) ; //nodeJK stiffness 
 
-  static Vector stress(nstress) ;  //stress resultants
+  double stressData[nstress] ;
+  Vector stress(stressData,nstress) ;  //stress resultants
 
-  static Matrix dd(nstress,nstress) ;  //material tangent
+  double ddData[nstress*nstress] ;
+  Matrix dd(ddData,nstress,nstress) ;  //material tangent
 
-  static Matrix J0(2,2) ;  //Jacobian at center
+  double J0Data[2*2] ;
+  Matrix J0(J0Data,2,2) ;  //Jacobian at center
  
-  static Matrix J0inv(2,2) ; //inverse of Jacobian at center
+  double J0invData[2*2] ;
+  Matrix J0inv(J0invData,2,2) ; //inverse of Jacobian at center
 
   double epsDrill = 0.0 ;  //drilling "strain"
 
@@ -1089,29 +1073,34 @@ ShellMITC4::formResidAndTangent( int tang_flag )
 
   //---------B-matrices------------------------------------
 
-    static Matrix BJ(nstress,ndf) ;      // B matrix node J
-
-    static Matrix BJtran(ndf,nstress) ;
+    double BJData[nstress*ndf] ;
+    Matrix BJ(BJData,nstress,ndf) ;      // B matrix node J
 
-    static Matrix BK(nstress,ndf) ;      // B matrix node k
+    double BJtranData[ndf*nstress] ;
+    Matrix BJtran(BJtranData,ndf,nstress) ;
 
-    static Matrix BJtranD(ndf,nstress) ;
+    double BKData[nstress*ndf] ;
+    Matrix BK(BKData,nstress,ndf) ;      // B matrix node k
 
+    double BJtranDData[ndf*nstress] ;
+    Matrix BJtranD(BJtranDData,ndf,nstress) ;
 
-    static Matrix Bbend(3,3) ;  // bending B matrix
 
-    static Matrix Bshear(2,3) ; // shear B matrix
+    double BbendData[3*2] ;
+    Matrix Bbend(BbendData,3,2) ;  // bending B matrix
 
-    static Matrix Bmembrane(3,2) ; // membrane B matrix
+    double BshearData[2*3] ;
+    Matrix Bshear(BshearData,2,3) ; // shear B matrix
 
+    double BmembraneData[3*2] ;
+    Matrix Bmembrane(BmembraneData,3,2) ; // membrane B matrix
 
-    static double BdrillJ[ndf] ; //drill B matrix
 
-    static double BdrillK[ndf] ;  
+    double BdrillJ[ndf] ; //drill B matrix
 
-    double *drillPointer ;
+    double BdrillK[ndf] ;  
 
-    static double saveB[nstress][ndf][numnodes] ;
+    double saveB[nstress][ndf][numnodes] ;
 
   //------------------------------------------------------- 
 
@@ -1226,16 +1215,16 @@ ShellMITC4::formResidAndTangent( int tang_flag )
 
       //compute B matrix 
 
-      Bmembrane = computeBmembrane( j, shp ) ;
+      computeBmembrane( j, shp, Bmembrane ) ;
 
-      Bbend = computeBbend( j, shp ) ;
+      computeBbend( j, shp, Bbend ) ;
 
       for ( p = 0; p < 3; p++) {
 		  Bshear(0,p) = Bs(0,j*3+p);
 		  Bshear(1,p) = Bs(1,j*3+p);
       }//end for p
 
-      BJ = assembleB( Bmembrane, Bbend, Bshear ) ;
+      assembleB( Bmembrane, Bbend, Bshear, BJ ) ;
 
       //save the B-matrix
       for (p=0; p<nstress; p++) {
@@ -1252,11 +1241,7 @@ ShellMITC4::formResidAndTangent( int tang_flag )
       strain.addMatrixVector(1.0, BJ,ul,1.0 ) ;
 
       //drilling B matrix
-      drillPointer = computeBdrill( j, shp ) ;
-      for (p=0; p<ndf; p++ ) {
-	      BdrillJ[p] = *drillPointer ; //set p-th component
-	      drillPointer++ ;             //pointer arithmetic
-      }//end for p
+      computeBdrill( j, shp, BdrillJ ) ;
 
       //drilling "strain" 
       for ( p = 0; p < ndf; p++ )
@@ -1310,11 +1295,7 @@ ShellMITC4::formResidAndTangent( int tang_flag )
       residJ.addMatrixVector(0.0, BJtran,stress,1.0 ) ;
 
       //drilling B matrix
-      drillPointer = computeBdrill( j, shp ) ;
-      for (p=0; p<ndf; p++ ) {
-	    BdrillJ[p] = *drillPointer ;
-	    drillPointer++ ;
-      }//end for p
+      computeBdrill( j, shp, BdrillJ ) ;
 
       //residual including drill
       for ( p = 0; p < ndf; p++ )
@@ -1337,11 +1318,7 @@ ShellMITC4::formResidAndTangent( int tang_flag )
 	      }//end for p
 	  
 	      //drilling B matrix
-	      drillPointer = computeBdrill( k, shp ) ;
-	      for (p=0; p<ndf; p++ ) {
-	        BdrillK[p] = *drillPointer ;
-	        drillPointer++ ;
-	      }//end for p
+	      computeBdrill( k, shp, BdrillK ) ;
  
           //stiffJK = BJtranD * BK  ;
 	      // +  transpose( 1,ndf,BdrillJ ) * BdrillK ; 
@@ -1379,11 +1356,11 @@ ShellMITC4::computeBasis( )
   //and use those as basis vectors but this is easier 
   //and the shell is flat anyway.
 
-  static Vector temp(3) ;
+  Vector temp(3) ;
 
-  static Vector v1(3) ;
-  static Vector v2(3) ;
-  static Vector v3(3) ;
+  Vector v1(3) ;
+  Vector v2(3) ;
+  Vector v3(3) ;
 
   //get two vectors (v1, v2) in plane of shell by 
   // nodal coordinate differences
@@ -1458,15 +1435,13 @@ ShellMITC4::computeBasis( )
 //*************************************************************************
 //compute Bdrill
 
-double*
-ShellMITC4::computeBdrill( int node, const double shp[3][4] )
+void
+ShellMITC4::computeBdrill( int node, const double shp[3][4], double Bdrill[6] )
 {
 
-  //static Matrix Bdrill(1,6) ;
-  static double Bdrill[6] ;
-  static double B1 ;
-  static double B2 ;
-  static double B6 ;
+  double B1 ;
+  double B2 ;
+  double B6 ;
 
 
 //---Bdrill Matrix in standard {1,2,3} mechanics notation---------
@@ -1500,7 +1475,7 @@ ShellMITC4::computeBdrill( int node, const double shp[3][4] )
   Bdrill[4] = B6*g3[1] ; 
   Bdrill[5] = B6*g3[2] ;
  
-  return Bdrill ;
+  return ;
 
 }
 
@@ -1508,10 +1483,11 @@ ShellMITC4::computeBdrill( int node, const double shp[3][4] )
 //********************************************************************
 //assemble a B matrix
 
-const Matrix&  
+void
 ShellMITC4::assembleB( const Matrix &Bmembrane,
                                const Matrix &Bbend, 
-                               const Matrix &Bshear ) 
+                               const Matrix &Bshear,
+                               Matrix &B ) 
 {
 
   //Matrix Bbend(3,3) ;  // plate bending B matrix
@@ -1521,17 +1497,20 @@ ShellMITC4::assembleB( const Matrix &Bmembrane,
   //Matrix Bmembrane(3,2) ; // plate membrane B matrix
 
 
-    static Matrix B(8,6) ;
-
-    static Matrix BmembraneShell(3,3) ; 
+    double BmembraneShellData[3*3] ;
+    Matrix BmembraneShell(BmembraneShellData,3,3) ; 
     
-    static Matrix BbendShell(3,3) ; 
+    double BbendShellData[3*3] ;
+    Matrix BbendShell(BbendShellData,3,3) ; 
 
-    static Matrix BshearShell(2,6) ;
+    double BshearShellData[2*6] ;
+    Matrix BshearShell(BshearShellData,2,6) ;
  
-    static Matrix Gmem(2,3) ;
+    double GmemData[2*3] ;
+    Matrix Gmem(GmemData,2,3) ;
 
-    static Matrix Gshear(3,6) ;
+    double GshearData[3*6] ;
+    Matrix Gshear(GshearData,3,6) ;
 
     int p, q ;
     int pp ;
@@ -1627,19 +1606,18 @@ ShellMITC4::assembleB( const Matrix &Bmembrane,
  
   } //end for p
   
-  return B ;
+  return ;
 
 }
 
 //***********************************************************************
 //compute Bmembrane matrix
 
-const Matrix&   
-ShellMITC4::computeBmembrane( int node, const double shp[3][4] ) 
+void
+ShellMITC4::computeBmembrane( int node, const double shp[3][4], 
+			      Matrix &Bmembrane ) 
 {
 
-  static Matrix Bmembrane(3,2) ;
-
 //---Bmembrane Matrix in standard {1,2,3} mechanics notation---------
 //
 //                -             -
@@ -1658,19 +1636,17 @@ ShellMITC4::computeBmembrane( int node, const double shp[3][4] )
   Bmembrane(2,0) = shp[1][node] ;
   Bmembrane(2,1) = shp[0][node] ;
 
-  return Bmembrane ;
+  return ;
 
 }
 
 //***********************************************************************
 //compute Bbend matrix
 
-const Matrix&   
-ShellMITC4::computeBbend( int node, const double shp[3][4] )
+void
+ShellMITC4::computeBbend( int node, const double shp[3][4], Matrix &Bbend )
 {
 
-    static Matrix Bbend(3,2) ;
-
 //---Bbend Matrix in standard {1,2,3} mechanics notation---------
 //
 //            -             -
@@ -1689,7 +1665,7 @@ ShellMITC4::computeBbend( int node, const double shp[3][4] )
     Bbend(2,0) =  shp[0][node] ;
     Bbend(2,1) = -shp[1][node] ; 
 
-    return Bbend ;
+    return ;
 }
 
 
@@ -1712,8 +1688,8 @@ ShellMITC4::shape2d( double ss, double tt,
   static const double s[] = { -0.5,  0.5, 0.5, -0.5 } ;
   static const double t[] = { -0.5, -0.5, 0.5,  0.5 } ;
 
-  static double xs[2][2] ;
-  static double sx[2][2] ;
+  double xs[2][2] ;
+  double sx[2][2] ;
 
   for ( i = 0; i < 4; i++ ) {
       shp[2][i] = ( 0.5 + s[i]*ss )*( 0.5 + t[i]*tt ) ;
@@ -114,18 +114,18 @@ class ShellMITC4 : public Element {
 
   private : 
 
-    //static data
-    static Matrix stiff ;
-    static Vector resid ;
-    static Matrix mass ;
-    static Matrix damping ;
-
     //quadrature data
     static const double root3 ;
     static const double one_over_root3 ;    
-    static double sg[4] ;
-    static double tg[4] ;
-    static double wg[4] ;
+    static const double sg[4] ;
+    static const double tg[4] ;
+    static const double wg[4] ;
+
+    //element tangent, residual and mass (allocated when first needed),
+    //held by each element so that elements can be formed concurrently
+    Matrix stiff ;
+    Vector resid ;
+    Matrix *mass ;
 
     //node information
     ID connectedExternalNodes ;  //four node numbers
@@ -156,18 +156,19 @@ class ShellMITC4 : public Element {
     void formResidAndTangent( int tang_flag ) ;
 
     //compute Bdrill matrix
-    double* computeBdrill( int node, const double shp[3][4] ) ;
+    void computeBdrill( int node, const double shp[3][4], double Bdrill[6] ) ;
 
     //assemble a B matrix 
-    const Matrix& assembleB( const Matrix &Bmembrane,
-			                 const Matrix &Bbend, 
-			                 const Matrix &Bshear ) ;
+    void assembleB( const Matrix &Bmembrane,
+		    const Matrix &Bbend, 
+		    const Matrix &Bshear,
+		    Matrix &B ) ;
   
     //compute Bmembrane matrix
-    const Matrix& computeBmembrane( int node, const double shp[3][4] ) ;
+    void computeBmembrane( int node, const double shp[3][4], Matrix &Bmembrane ) ;
   
     //compute Bbend matrix
-    const Matrix& computeBbend( int node, const double shp[3][4] ) ;
+    void computeBbend( int node, const double shp[3][4], Matrix &Bbend ) ;
   
     //Matrix transpose
     Matrix transpose( int dim1, int dim2, const Matrix &M ) ;
@@ -52,6 +52,12 @@ int METIS_PartGraphRecursive(int *, int *, int *, int *, int *, int *, int *, in
 extern "C" 
 int METIS_PartGraphKway(int *, int *, int *, int *, int *, int *, int *, int *, int *, int *, int *);
 
+extern "C" 
+void METIS_mCPartGraphRecursive(int *, int *, int *, int *, int *, int *, int *, int *, int *, int *, int *, int *);
+
+extern "C" 
+void METIS_mCPartGraphKway(int *, int *, int *, int *, int *, int *, int *, int *, int *, float *, int *, int *, int *);
+
 extern "C"
 int METIS_PartMeshDual(int *, int *, int *, int *, int *, int *, int *, int *, int *);
 //int METIS_PartMeshDual(&ne, &nn, elmnts, &etype, &numflag, &nparts, &edgecut, epart, npart);
@@ -63,7 +69,7 @@ int METIS_PartMeshNodal(int *, int *, int *, int *, int *, int *, int *, int *,
 Metis::Metis(int numParts) 
 :GraphNumberer(GraphNUMBERER_TAG_Metis),
  myPtype(0), myMtype(0), myCoarsenTo(0), myRtype(0), myIPtype(0),
- defaultOptions(true), numPartitions(numParts), theRefResult(0)
+ defaultOptions(true), myNumConstraints(2), numPartitions(numParts), theRefResult(0)
 {
     
 }
@@ -76,7 +82,8 @@ Metis::Metis(int Ptype,
 	  int numParts)
 :GraphNumberer(GraphNUMBERER_TAG_Metis),
  myPtype(Ptype), myMtype(Mtype), myCoarsenTo(coarsenTo), myRtype(Rtype), 
- myIPtype(IPtype), defaultOptions(false), numPartitions(numParts), theRefResult(0)
+ myIPtype(IPtype), defaultOptions(false), myNumConstraints(2), 
+ numPartitions(numParts), theRefResult(0)
 {
     // check the options are valid
     checkOptions();
@@ -185,12 +192,34 @@ Metis::setDefaultOptions(void)
 }
 
 
+// int setNumConstraints(int numConstraints)
+//	Sets the number of balance constraints used when the graph has
+//	weighted vertices: 1 balances the vertex weights only, 2 also
+//	balances the number of vertices in each partition.
+
+int
+Metis::setNumConstraints(int numConstraints)
+{
+    if (numConstraints != 1 && numConstraints != 2) {
+	opserr << "WARNING: Metis::setNumConstraints ";
+	opserr << " - Illegal number of constraints " << numConstraints << endln;
+	return -1;
+    }
+
+    myNumConstraints = numConstraints;
+    return 0;
+}
+
+
 // int partition(Graph &theGraph, int numPart)
 //	Method to partition the graph. It first creates the arrays needed
 //	by the metis lib and then invokes a function from the metis lib to
 //	partition the graph. The solors of the vertices of the graph are
 //	set to colors 0 through numPart-1 to indicate which partition the
-//	vrtices are in. Returns -1 if options are not set, -2 if metis failed.
+//	vrtices are in. If any vertex has a non-zero weight the weights are
+//	scaled to integers and passed to metis, with the vertex count as a
+//	second balance constraint if myNumConstraints is 2. Returns -1 if 
+//	options are not set, -2 if metis failed.
 
 int
 Metis::partition(Graph &theGraph, int numPart)
@@ -211,7 +240,8 @@ Metis::partition(Graph &theGraph, int numPart)
     int *vwgts = 0;
     int *ewgts = 0;
     int numbering = 0;
-    int weightflag = 0; // no weights on our graphs yet
+    int weightflag = 0; // no edge weights on our graphs
+    int numCon = 1;
 
     if (START_VERTEX_NUM == 0)
 	numbering = 0;	
@@ -265,6 +295,46 @@ Metis::partition(Graph &theGraph, int numPart)
     }
     
     
+    // if the vertices are weighted we pass the weights to metis as
+    // integers, the heaviest vertex having weight maxVertexWeight
+    
+    double maxWeight = 0.0;
+    for (int j=0; j<numVertex; j++) {
+	double weight = theGraph.getVertexPtr(j+START_VERTEX_NUM)->getWeight();
+	if (weight > maxWeight)
+	    maxWeight = weight;
+    }
+
+    if (maxWeight > 0.0) {
+	numCon = myNumConstraints;
+	vwgts = new int [numCon*numVertex];
+	if (vwgts == 0) {
+	    opserr << "WARNING Metis::partition - No partitioning done";
+	    opserr << " as ran out of memory\n";
+	    delete [] options;
+	    delete [] partition;
+	    delete [] xadj;
+	    delete [] adjncy;
+	    return -2;
+	}
+
+	// keep the total weight well within int range
+	double maxVertexWeight = 1000.0;
+	if (maxVertexWeight*numVertex > 1.0e9)
+	    maxVertexWeight = 1.0e9/numVertex;
+	double scale = maxVertexWeight/maxWeight;
+
+	for (int k=0; k<numVertex; k++) {
+	    double weight = theGraph.getVertexPtr(k+START_VERTEX_NUM)->getWeight();
+	    int iWeight = (int)(weight*scale + 0.5);
+	    if (iWeight < 1)
+		iWeight = 1;
+	    vwgts[k*numCon] = iWeight;
+	    if (numCon == 2)
+		vwgts[k*numCon+1] = 1;
+	}
+    }
+    
     if (defaultOptions == true) 
 	options[0] = 0;
     else {
@@ -279,8 +349,21 @@ Metis::partition(Graph &theGraph, int numPart)
     // we now the metis routines
     //
 
-    
-    if (myPtype == 1) {
+    if (numCon == 2) {
+      if (myPtype == 1) 
+	METIS_mCPartGraphRecursive(&numVertex, &numCon, xadj, adjncy, vwgts, ewgts, &weightflag, &numbering, &numPart, options, &edgecut, partition);
+      else {
+	// tight tolerance on the work, looser on the vertex count
+	float ubvec[2];
+	ubvec[0] = 1.05;
+	ubvec[1] = 1.5;
+	METIS_mCPartGraphKway(&numVertex, &numCon, xadj, adjncy, vwgts, ewgts, &weightflag, &numbering, &numPart, ubvec, options, &edgecut, partition);
+      }
+    }
+
+    else if (myPtype == 1) {
+      if (vwgts != 0)
+	weightflag = 2; // weights on the vertices only
       //opserr << " Metis::partition PartGraphRecursive \n";
       METIS_PartGraphRecursive(&numVertex, xadj, adjncy, vwgts, ewgts, &weightflag,&numbering, &numPart,options, &edgecut, partition);
     }
@@ -298,6 +381,8 @@ Metis::partition(Graph &theGraph, int numPart)
       opserr << " numpart " << numPart;
       opserr << " numbering " << numbering << "\n";
       */
+      if (vwgts != 0)
+	weightflag = 2;
       METIS_PartGraphKway(&numVertex, xadj, adjncy, vwgts, ewgts, &weightflag, &numbering, &numPart,options, &edgecut, partition);
     }
     //
@@ -315,6 +400,8 @@ Metis::partition(Graph &theGraph, int numPart)
     delete [] partition;
     delete [] xadj;
     delete [] adjncy;
+    if (vwgts != 0)
+	delete [] vwgts;
     
     return 0;
 }
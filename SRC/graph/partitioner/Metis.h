@@ -66,6 +66,7 @@ class Metis : public GraphPartitioner, public GraphNumberer
 		    int IPtype);
 
     bool setDefaultOptions(void);
+    int setNumConstraints(int numConstraints);
     int partitionHexMesh(int* elmnts, int* epart, int* npart, int ne, int nn, int nparts, bool whichToUse);
 
     int partition(Graph &theGraph, int numPart);
@@ -122,6 +123,10 @@ class Metis : public GraphPartitioner, public GraphNumberer
 			//    	graph growing followed by K-L = 4
 	
     bool defaultOptions;			    
+
+    int myNumConstraints; // balance constraints used when the vertices are weighted:
+                        //	1 = vertex weight only
+                        //	2 = vertex weight and vertex count
     
     int   numPartitions; // needed if to be used as a numberer
     ID    *theRefResult;
@@ -0,0 +1,65 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+#ifndef MaterialParameterBlock_h
+#define MaterialParameterBlock_h
+
+// Description: This file contains the class definition for 
+// MaterialParameterBlock. A MaterialParameterBlock holds the fixed
+// (input) parameters of a material model so that they can be shared by
+// all the copies of the material obtained through getCopy(), e.g. the
+// fibers of a section, while each copy keeps only its own history 
+// variables. The block is reference counted: attach() is called by each
+// new sharer and detach() when a sharer is done with the block, the last
+// detach() deleting it. A material that needs to change its parameters
+// (recvSelf(), updateParameter()) first takes a private copy of a shared 
+// block, so that the other copies are unaffected.
+//
+// What: "@(#) MaterialParameterBlock.h, revA"
+
+class MaterialParameterBlock
+{
+  public:
+    MaterialParameterBlock() :refCount(1) {};
+    MaterialParameterBlock(const MaterialParameterBlock &) :refCount(1) {};
+    virtual ~MaterialParameterBlock() {};
+
+    void attach(void) {refCount++;};
+    void detach(void) {if (--refCount == 0) delete this;};
+    bool isShared(void) const {return refCount > 1;};
+
+  private:
+    MaterialParameterBlock &operator=(const MaterialParameterBlock &);
+    int refCount;
+};
+
+// sets thePtr to a private copy of the block it points to if that block
+// is shared with other materials; Block is the derived parameter class
+template <class Block>
+void unshareParameterBlock(Block *&thePtr)
+{
+  if (thePtr->isShared()) {
+    Block *theCopy = new Block(*thePtr);
+    thePtr->detach();
+    thePtr = theCopy;
+  }
+}
+
+#endif
@@ -52,6 +52,8 @@
 #include <J2PlaneStress.h>
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
+#include <Profiler.h>
+#include <ClassTagNames.h>
 
 Vector J2PlaneStress :: strain_vec(3) ;
 Vector J2PlaneStress :: stress_vec(3) ;
@@ -154,6 +156,9 @@ int J2PlaneStress :: setTrialStrain( const Vector &strain_from_element )
      if ( iteration_counter > max_iterations ) {
        opserr << "More than " << max_iterations ;
        opserr << " iterations in setTrialStrain of J2PlaneStress \n" ;
+       if (Profiler::on)
+         Profiler::count("planeStressFailures", this->getClassTag(),
+                         getNDMaterialClassName(this->getClassTag()));
        break ;
      }// end if 
 
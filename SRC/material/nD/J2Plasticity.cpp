@@ -52,6 +52,8 @@
 
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
+#include <Profiler.h>
+#include <ClassTagNames.h>
 
 //this is mike's problem
 Tensor J2Plasticity :: rank2(2, def_dim_2, 0.0 ) ;
@@ -501,6 +503,9 @@ void J2Plasticity :: plastic_integrator( )
 	if ( iteration_counter > max_iterations ) {
 	    opserr << "More than " << max_iterations ;
 	    opserr << " iterations in constituive subroutine J2-plasticity \n" ;
+	    if (Profiler::on)
+	      Profiler::count("returnMappingFailures", this->getClassTag(),
+			      getNDMaterialClassName(this->getClassTag()));
 	    break ;
 	} //end if 
 	
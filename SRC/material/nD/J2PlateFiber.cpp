@@ -52,6 +52,8 @@
 #include <J2PlateFiber.h>
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
+#include <Profiler.h>
+#include <ClassTagNames.h>
 
 Vector J2PlateFiber :: strain_vec(5) ;
 Vector J2PlateFiber :: stress_vec(5) ;
@@ -167,6 +169,9 @@ int J2PlateFiber :: setTrialStrain( const Vector &strain_from_element )
      if ( iteration_counter > max_iterations ) {
        opserr << "More than " << max_iterations ;
        opserr << " iterations in setTrialStrain of J2PlateFiber \n" ;
+       if (Profiler::on)
+         Profiler::count("planeStressFailures", this->getClassTag(),
+                         getNDMaterialClassName(this->getClassTag()));
        break ;
      }// end if 
 
@@ -44,26 +44,31 @@
 
 Concrete01::Concrete01
 (int tag, double FPC, double EPSC0, double FPCU, double EPSCU)
-  :UniaxialMaterial(tag, MAT_TAG_Concrete01),
-   fpc(FPC), epsc0(EPSC0), fpcu(FPCU), epscu(EPSCU), 
+  :UniaxialMaterial(tag, MAT_TAG_Concrete01), params(0),
    CminStrain(0.0), CendStrain(0.0),
    Cstrain(0.0), Cstress(0.0) 
 {
+  params = new Concrete01Parameters;
+  params->fpc = FPC;
+  params->epsc0 = EPSC0;
+  params->fpcu = FPCU;
+  params->epscu = EPSCU;
+
   // Make all concrete parameters negative
-  if (fpc > 0.0)
-    fpc = -fpc;
+  if (params->fpc > 0.0)
+    params->fpc = -params->fpc;
   
-  if (epsc0 > 0.0)
-    epsc0 = -epsc0;
+  if (params->epsc0 > 0.0)
+    params->epsc0 = -params->epsc0;
   
-  if (fpcu > 0.0)
-    fpcu = -fpcu;
+  if (params->fpcu > 0.0)
+    params->fpcu = -params->fpcu;
   
-  if (epscu > 0.0)
-    epscu = -epscu;
+  if (params->epscu > 0.0)
+    params->epscu = -params->epscu;
   
   // Initial tangent
-  double Ec0 = 2*fpc/epsc0;
+  double Ec0 = 2*params->fpc/params->epsc0;
   Ctangent = Ec0;
   CunloadSlope = Ec0;
   Ttangent = Ec0;
@@ -77,11 +82,39 @@ Concrete01::Concrete01
   // AddingSensitivity:END //////////////////////////////////////
 }
 
-Concrete01::Concrete01():UniaxialMaterial(0, MAT_TAG_Concrete01),
- fpc(0.0), epsc0(0.0), fpcu(0.0), epscu(0.0),
+Concrete01::Concrete01():UniaxialMaterial(0, MAT_TAG_Concrete01), params(0),
  CminStrain(0.0), CunloadSlope(0.0), CendStrain(0.0),
  Cstrain(0.0), Cstress(0.0)
 {
+  params = new Concrete01Parameters;
+  params->fpc = 0.0;
+  params->epsc0 = 0.0;
+  params->fpcu = 0.0;
+  params->epscu = 0.0;
+
+  // Set trial values
+  this->revertToLastCommit();
+  
+  // AddingSensitivity:BEGIN /////////////////////////////////////
+  parameterID = 0;
+  SHVs = 0;
+  // AddingSensitivity:END //////////////////////////////////////
+}
+
+// constructor used by getCopy(), the copy shares the material properties
+Concrete01::Concrete01(int tag, Concrete01Parameters &theParams)
+  :UniaxialMaterial(tag, MAT_TAG_Concrete01), params(&theParams),
+   CminStrain(0.0), CendStrain(0.0),
+   Cstrain(0.0), Cstress(0.0) 
+{
+  params->attach();
+
+  // Initial tangent
+  double Ec0 = 2*params->fpc/params->epsc0;
+  Ctangent = Ec0;
+  CunloadSlope = Ec0;
+  Ttangent = Ec0;
+  
   // Set trial values
   this->revertToLastCommit();
   
@@ -93,7 +126,7 @@ Concrete01::Concrete01():UniaxialMaterial(0, MAT_TAG_Concrete01),
 
 Concrete01::~Concrete01 ()
 {
-  // Does nothing
+  params->detach();
 }
 
 
@@ -287,18 +320,18 @@ void Concrete01::reload ()
 
 void Concrete01::envelope ()
 {
-  if (Tstrain > epsc0) {
-    double eta = Tstrain/epsc0;
-    Tstress = fpc*(2*eta-eta*eta);
-    double Ec0 = 2.0*fpc/epsc0;
+  if (Tstrain > params->epsc0) {
+    double eta = Tstrain/params->epsc0;
+    Tstress = params->fpc*(2*eta-eta*eta);
+    double Ec0 = 2.0*params->fpc/params->epsc0;
     Ttangent = Ec0*(1.0-eta);
   }
-  else if (Tstrain > epscu) {
-    Ttangent = (fpc-fpcu)/(epsc0-epscu);
-    Tstress = fpc + Ttangent*(Tstrain-epsc0);
+  else if (Tstrain > params->epscu) {
+    Ttangent = (params->fpc-params->fpcu)/(params->epsc0-params->epscu);
+    Tstress = params->fpc + Ttangent*(Tstrain-params->epsc0);
   }
   else {
-    Tstress = fpcu;
+    Tstress = params->fpcu;
     Ttangent = 0.0;
   }
 }
@@ -307,21 +340,21 @@ void Concrete01::unload ()
 {
   double tempStrain = TminStrain;
   
-  if (tempStrain < epscu)
-    tempStrain = epscu;
+  if (tempStrain < params->epscu)
+    tempStrain = params->epscu;
   
-  double eta = tempStrain/epsc0;
+  double eta = tempStrain/params->epsc0;
   
   double ratio = 0.707*(eta-2.0) + 0.834;
   
   if (eta < 2.0)
     ratio = 0.145*eta*eta + 0.13*eta;
   
-  TendStrain = ratio*epsc0;
+  TendStrain = ratio*params->epsc0;
   
   double temp1 = TminStrain - TendStrain;
   
-  double Ec0 = 2.0*fpc/epsc0;
+  double Ec0 = 2.0*params->fpc/params->epsc0;
   
   double temp2 = Tstress/Ec0;
   
@@ -385,7 +418,7 @@ int Concrete01::revertToLastCommit ()
 
 int Concrete01::revertToStart ()
 {
-	double Ec0 = 2.0*fpc/epsc0;
+	double Ec0 = 2.0*params->fpc/params->epsc0;
 
    // History variables
    CminStrain = 0.0;
@@ -409,8 +442,7 @@ int Concrete01::revertToStart ()
 
 UniaxialMaterial* Concrete01::getCopy ()
 {
-   Concrete01* theCopy = new Concrete01(this->getTag(),
-                                    fpc, epsc0, fpcu, epscu);
+   Concrete01* theCopy = new Concrete01(this->getTag(), *params);
 
    // Converged history variables
    theCopy->CminStrain = CminStrain;
@@ -432,10 +464,10 @@ int Concrete01::sendSelf (int commitTag, Channel& theChannel)
    data(0) = this->getTag();
 
    // Material properties
-   data(1) = fpc;
-   data(2) = epsc0;
-   data(3) = fpcu;
-   data(4) = epscu;
+   data(1) = params->fpc;
+   data(2) = params->epsc0;
+   data(3) = params->fpcu;
+   data(4) = params->epscu;
 
    // History variables from last converged state
    data(5) = CminStrain;
@@ -472,10 +504,11 @@ int Concrete01::recvSelf (int commitTag, Channel& theChannel,
       this->setTag(int(data(0)));
 
       // Material properties 
-      fpc = data(1);
-      epsc0 = data(2);
-      fpcu = data(3);
-      epscu = data(4);
+      unshareParameterBlock(params);
+      params->fpc = data(1);
+      params->epsc0 = data(2);
+      params->fpcu = data(3);
+      params->epscu = data(4);
 
       // History variables from last converged state
       CminStrain = data(5);
@@ -499,10 +532,10 @@ int Concrete01::recvSelf (int commitTag, Channel& theChannel,
 void Concrete01::Print (OPS_Stream& s, int flag)
 {
    s << "Concrete01, tag: " << this->getTag() << endln;
-   s << "  fpc: " << fpc << endln;
-   s << "  epsc0: " << epsc0 << endln;
-   s << "  fpcu: " << fpcu << endln;
-   s << "  epscu: " << epscu << endln;
+   s << "  fpc: " << params->fpc << endln;
+   s << "  epsc0: " << params->epsc0 << endln;
+   s << "  fpcu: " << params->fpcu << endln;
+   s << "  epscu: " << params->epscu << endln;
 }
 
 
@@ -534,38 +567,41 @@ Concrete01::setParameter(const char **argv, int argc, Parameter &param)
 int
 Concrete01::updateParameter(int parameterID, Information &info)
 {
+	if (parameterID >= 1 && parameterID <= 4)
+		unshareParameterBlock(params);
+
 	switch (parameterID) {
 	case 1:
-		this->fpc = info.theDouble;
+		params->fpc = info.theDouble;
 		break;
 	case 2:
-		this->epsc0 = info.theDouble;
+		params->epsc0 = info.theDouble;
 		break;
 	case 3:
-		this->fpcu = info.theDouble;
+		params->fpcu = info.theDouble;
 		break;
 	case 4:
-		this->epscu = info.theDouble;
+		params->epscu = info.theDouble;
 		break;
 	default:
 		break;
 	}
         
 	// Make all concrete parameters negative
-	if (fpc > 0.0)
-		fpc = -fpc;
+	if (params->fpc > 0.0)
+		params->fpc = -params->fpc;
 
-	if (epsc0 > 0.0)
-		epsc0 = -epsc0;
+	if (params->epsc0 > 0.0)
+		params->epsc0 = -params->epsc0;
 
-	if (fpcu > 0.0)
-		fpcu = -fpcu;
+	if (params->fpcu > 0.0)
+		params->fpcu = -params->fpcu;
 
-	if (epscu > 0.0)
-		epscu = -epscu;
+	if (params->epscu > 0.0)
+		params->epscu = -params->epscu;
 
 	// Initial tangent
-	double Ec0 = 2*fpc/epsc0;
+	double Ec0 = 2*params->fpc/params->epsc0;
 	Ctangent = Ec0;
 	CunloadSlope = Ec0;
 	Ttangent = Ec0;
@@ -637,30 +673,30 @@ Concrete01::getStressSensitivity(int gradIndex, bool conditional)
 
 		if (Tstrain < CminStrain) {			// loading along the backbone curve
 
-			if (Tstrain > epsc0) {			//on the parabola
+			if (Tstrain > params->epsc0) {			//on the parabola
 				
-				TstressSensitivity = fpcSensitivity*(2.0*Tstrain/epsc0-(Tstrain/epsc0)*(Tstrain/epsc0))
-					      + fpc*( (2.0*TstrainSensitivity*epsc0-2.0*Tstrain*epsc0Sensitivity)/(epsc0*epsc0) 
-						  - 2.0*(Tstrain/epsc0)*(TstrainSensitivity*epsc0-Tstrain*epsc0Sensitivity)/(epsc0*epsc0));
+				TstressSensitivity = fpcSensitivity*(2.0*Tstrain/params->epsc0-(Tstrain/params->epsc0)*(Tstrain/params->epsc0))
+					      + params->fpc*( (2.0*TstrainSensitivity*params->epsc0-2.0*Tstrain*epsc0Sensitivity)/(params->epsc0*params->epsc0) 
+						  - 2.0*(Tstrain/params->epsc0)*(TstrainSensitivity*params->epsc0-Tstrain*epsc0Sensitivity)/(params->epsc0*params->epsc0));
 				
-				dktdh = 2.0*((fpcSensitivity*epsc0-fpc*epsc0Sensitivity)/(epsc0*epsc0))
-					  * (1.0-Tstrain/epsc0)
-					  - 2.0*(fpc/epsc0)*(TstrainSensitivity*epsc0-Tstrain*epsc0Sensitivity)
-					  / (epsc0*epsc0);
+				dktdh = 2.0*((fpcSensitivity*params->epsc0-params->fpc*epsc0Sensitivity)/(params->epsc0*params->epsc0))
+					  * (1.0-Tstrain/params->epsc0)
+					  - 2.0*(params->fpc/params->epsc0)*(TstrainSensitivity*params->epsc0-Tstrain*epsc0Sensitivity)
+					  / (params->epsc0*params->epsc0);
 			}
-			else if (Tstrain > epscu) {		// on the straight inclined line
+			else if (Tstrain > params->epscu) {		// on the straight inclined line
 //cerr << "ON THE STRAIGHT INCLINED LINE" << endl;
 
 				dktdh = ( (fpcSensitivity-fpcuSensitivity)
-					  * (epsc0-epscu) 
-					  - (fpc-fpcu)
+					  * (params->epsc0-params->epscu) 
+					  - (params->fpc-params->fpcu)
 					  * (epsc0Sensitivity-epscuSensitivity) )
-					  / ((epsc0-epscu)*(epsc0-epscu));
+					  / ((params->epsc0-params->epscu)*(params->epsc0-params->epscu));
 
-				double kt = (fpc-fpcu)/(epsc0-epscu);
+				double kt = (params->fpc-params->fpcu)/(params->epsc0-params->epscu);
 
 				TstressSensitivity = fpcSensitivity 
-					      + dktdh*(Tstrain-epsc0)
+					      + dktdh*(Tstrain-params->epsc0)
 						  + kt*(TstrainSensitivity-epsc0Sensitivity);
 			}
 			else {							// on the horizontal line
@@ -743,7 +779,7 @@ Concrete01::commitSensitivity(double TstrainSensitivity, int gradIndex, int numG
 	
 	if (SHVs == 0) {
 		SHVs = new Matrix(5,numGrads);
-		CunloadSlopeSensitivity = (2.0*fpcSensitivity*epsc0-2.0*fpc*epsc0Sensitivity) / (epsc0*epsc0);
+		CunloadSlopeSensitivity = (2.0*fpcSensitivity*params->epsc0-2.0*params->fpc*epsc0Sensitivity) / (params->epsc0*params->epsc0);
 	}
 	else {
 		CminStrainSensitivity   = (*SHVs)(0,gradIndex);
@@ -762,29 +798,29 @@ Concrete01::commitSensitivity(double TstrainSensitivity, int gradIndex, int numG
 
 		if (Tstrain < CminStrain) {			// loading along the backbone curve
 
-			if (Tstrain > epsc0) {			//on the parabola
+			if (Tstrain > params->epsc0) {			//on the parabola
 				
-				TstressSensitivity = fpcSensitivity*(2.0*Tstrain/epsc0-(Tstrain/epsc0)*(Tstrain/epsc0))
-					      + fpc*( (2.0*TstrainSensitivity*epsc0-2.0*Tstrain*epsc0Sensitivity)/(epsc0*epsc0) 
-						  - 2.0*(Tstrain/epsc0)*(TstrainSensitivity*epsc0-Tstrain*epsc0Sensitivity)/(epsc0*epsc0));
+				TstressSensitivity = fpcSensitivity*(2.0*Tstrain/params->epsc0-(Tstrain/params->epsc0)*(Tstrain/params->epsc0))
+					      + params->fpc*( (2.0*TstrainSensitivity*params->epsc0-2.0*Tstrain*epsc0Sensitivity)/(params->epsc0*params->epsc0) 
+						  - 2.0*(Tstrain/params->epsc0)*(TstrainSensitivity*params->epsc0-Tstrain*epsc0Sensitivity)/(params->epsc0*params->epsc0));
 				
-				dktdh = 2.0*((fpcSensitivity*epsc0-fpc*epsc0Sensitivity)/(epsc0*epsc0))
-					  * (1.0-Tstrain/epsc0)
-					  - 2.0*(fpc/epsc0)*(TstrainSensitivity*epsc0-Tstrain*epsc0Sensitivity)
-					  / (epsc0*epsc0);
+				dktdh = 2.0*((fpcSensitivity*params->epsc0-params->fpc*epsc0Sensitivity)/(params->epsc0*params->epsc0))
+					  * (1.0-Tstrain/params->epsc0)
+					  - 2.0*(params->fpc/params->epsc0)*(TstrainSensitivity*params->epsc0-Tstrain*epsc0Sensitivity)
+					  / (params->epsc0*params->epsc0);
 			}
-			else if (Tstrain > epscu) {		// on the straight inclined line
+			else if (Tstrain > params->epscu) {		// on the straight inclined line
 
 				dktdh = ( (fpcSensitivity-fpcuSensitivity)
-					  * (epsc0-epscu) 
-					  - (fpc-fpcu)
+					  * (params->epsc0-params->epscu) 
+					  - (params->fpc-params->fpcu)
 					  * (epsc0Sensitivity-epscuSensitivity) )
-					  / ((epsc0-epscu)*(epsc0-epscu));
+					  / ((params->epsc0-params->epscu)*(params->epsc0-params->epscu));
 
-				double kt = (fpc-fpcu)/(epsc0-epscu);
+				double kt = (params->fpc-params->fpcu)/(params->epsc0-params->epscu);
 
 				TstressSensitivity = fpcSensitivity 
-					      + dktdh*(Tstrain-epsc0)
+					      + dktdh*(Tstrain-params->epsc0)
 						  + kt*(TstrainSensitivity-epsc0Sensitivity);
 			}
 			else {							// on the horizontal line
@@ -845,9 +881,9 @@ Concrete01::commitSensitivity(double TstrainSensitivity, int gradIndex, int numG
 
 		TminStrainSensitivity = TstrainSensitivity;
 
-		if (Tstrain < epscu) {
+		if (Tstrain < params->epscu) {
 
-			epsTemp = epscu; 
+			epsTemp = params->epscu; 
 
 			epsTempSensitivity = epscuSensitivity;
 
@@ -859,9 +895,9 @@ Concrete01::commitSensitivity(double TstrainSensitivity, int gradIndex, int numG
 			epsTempSensitivity = TstrainSensitivity;
 		}
 
-		eta = epsTemp/epsc0;
+		eta = epsTemp/params->epsc0;
 
-		etaSensitivity = (epsTempSensitivity*epsc0-epsTemp*epsc0Sensitivity) / (epsc0*epsc0);
+		etaSensitivity = (epsTempSensitivity*params->epsc0-epsTemp*epsc0Sensitivity) / (params->epsc0*params->epsc0);
 
 		if (eta < 2.0) {
 
@@ -877,19 +913,19 @@ Concrete01::commitSensitivity(double TstrainSensitivity, int gradIndex, int numG
 			ratioSensitivity = 0.707 * etaSensitivity;
 		}
 
-		temp1 = Tstrain - ratio * epsc0;
+		temp1 = Tstrain - ratio * params->epsc0;
 
-		temp1Sensitivity = TstrainSensitivity - ratioSensitivity * epsc0
+		temp1Sensitivity = TstrainSensitivity - ratioSensitivity * params->epsc0
 			                                  - ratio * epsc0Sensitivity;
 
-		temp2 = Tstress * epsc0 / (2.0*fpc); 
+		temp2 = Tstress * params->epsc0 / (2.0*params->fpc); 
 		
-		temp2Sensitivity = (2.0*fpc*(TstressSensitivity*epsc0+Tstress*epsc0Sensitivity)
-			-2.0*Tstress*epsc0*fpcSensitivity) / (4.0*fpc*fpc);
+		temp2Sensitivity = (2.0*params->fpc*(TstressSensitivity*params->epsc0+Tstress*epsc0Sensitivity)
+			-2.0*Tstress*params->epsc0*fpcSensitivity) / (4.0*params->fpc*params->fpc);
 
 		if (temp1 == 0.0) {
 
-			TunloadSlopeSensitivity = (2.0*fpcSensitivity*epsc0-2.0*fpc*epsc0Sensitivity) / (epsc0*epsc0);
+			TunloadSlopeSensitivity = (2.0*fpcSensitivity*params->epsc0-2.0*params->fpc*epsc0Sensitivity) / (params->epsc0*params->epsc0);
 		}
 		else if (temp1 < temp2) {
 
@@ -902,7 +938,7 @@ Concrete01::commitSensitivity(double TstrainSensitivity, int gradIndex, int numG
 
 			TendStrainSensitivity = TstrainSensitivity - temp2Sensitivity;
 
-			TunloadSlopeSensitivity = (2.0*fpcSensitivity*epsc0-2.0*fpc*epsc0Sensitivity) / (epsc0*epsc0);
+			TunloadSlopeSensitivity = (2.0*fpcSensitivity*params->epsc0-2.0*params->fpc*epsc0Sensitivity) / (params->epsc0*params->epsc0);
 		}
 	}
 	else {
@@ -1032,7 +1068,7 @@ int
 Concrete01::getVariable(const char *varName, Information &theInfo)
 {
   if (strcmp(varName,"ec") == 0) {
-    theInfo.theDouble = epsc0;
+    theInfo.theDouble = params->epsc0;
     return 0;
   } else
     return -1;
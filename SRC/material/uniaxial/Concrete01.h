@@ -40,6 +40,17 @@
 
 
 #include <UniaxialMaterial.h>
+#include <MaterialParameterBlock.h>
+
+// fixed material properties, shared by the copies of a Concrete01 object
+class Concrete01Parameters : public MaterialParameterBlock
+{
+ public:
+  double fpc;    // Compressive strength
+  double epsc0;  // Strain at compressive strength
+  double fpcu;   // Crushing strength
+  double epscu;  // Strain at crushing strength
+};
 
 class Concrete01 : public UniaxialMaterial
 {
@@ -55,7 +66,7 @@ class Concrete01 : public UniaxialMaterial
   double getStrain(void);      
   double getStress(void);
   double getTangent(void);
-  double getInitialTangent(void) {return 2.0*fpc/epsc0;}
+  double getInitialTangent(void) {return 2.0*params->fpc/params->epsc0;}
 
   int commitState(void);
   int revertToLastCommit(void);    
@@ -82,11 +93,8 @@ class Concrete01 : public UniaxialMaterial
  protected:
 
  private:
-  /*** Material Properties ***/
-  double fpc;    // Compressive strength
-  double epsc0;  // Strain at compressive strength
-  double fpcu;   // Crushing strength
-  double epscu;  // Strain at crushing strength
+  /*** Material Properties, shared with copies ***/
+  Concrete01Parameters *params;
   
   /*** CONVERGED History Variables ***/
   double CminStrain;   // Smallest previous concrete strain (compression)
@@ -115,6 +123,8 @@ class Concrete01 : public UniaxialMaterial
   void reload();
   void unload();
   void envelope();
+
+  Concrete01(int tag, Concrete01Parameters &theParams);
   
   // AddingSensitivity:BEGIN //////////////////////////////////////////
   int parameterID;
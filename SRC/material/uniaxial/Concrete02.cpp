@@ -45,35 +45,59 @@
 
 Concrete02::Concrete02(int tag, double _fc, double _epsc0, double _fcu,
 		       double _epscu, double _rat, double _ft, double _Ets):
-  UniaxialMaterial(tag, MAT_TAG_Concrete02),
-  fc(_fc), epsc0(_epsc0), fcu(_fcu), epscu(_epscu), rat(_rat), ft(_ft), Ets(_Ets)
+  UniaxialMaterial(tag, MAT_TAG_Concrete02), params(0)
 {
+  params = new Concrete02Parameters;
+  params->fc = _fc;
+  params->epsc0 = _epsc0;
+  params->fcu = _fcu;
+  params->epscu = _epscu;
+  params->rat = _rat;
+  params->ft = _ft;
+  params->Ets = _Ets;
+
   ecminP = 0.0;
   deptP = 0.0;
 
-  eP = 2.0*fc/epsc0;
+  eP = 2.0*params->fc/params->epsc0;
   epsP = 0.0;
   sigP = 0.0;
   eps = 0.0;
   sig = 0.0;
-  e = 2.0*fc/epsc0;
+  e = 2.0*params->fc/params->epsc0;
 }
 
 Concrete02::Concrete02(void):
-  UniaxialMaterial(0, MAT_TAG_Concrete02)
+  UniaxialMaterial(0, MAT_TAG_Concrete02), params(0)
 {
- 
+  params = new Concrete02Parameters;
+  params->fc = 0.0;
+  params->epsc0 = 0.0;
+  params->fcu = 0.0;
+  params->epscu = 0.0;
+  params->rat = 0.0;
+  params->ft = 0.0;
+  params->Ets = 0.0;
+}
+
+// constructor used by getCopy(), the copy shares the material properties
+Concrete02::Concrete02(int tag, Concrete02Parameters &theParams):
+  UniaxialMaterial(tag, MAT_TAG_Concrete02), params(&theParams)
+{
+  params->attach();
+
+  this->revertToStart();
 }
 
 Concrete02::~Concrete02(void)
 {
-  // Does nothing
+  params->detach();
 }
 
 UniaxialMaterial*
 Concrete02::getCopy(void)
 {
-  Concrete02 *theCopy = new Concrete02(this->getTag(), fc, epsc0, fcu, epscu, rat, ft, Ets);
+  Concrete02 *theCopy = new Concrete02(this->getTag(), *params);
   
   return theCopy;
 }
@@ -81,13 +105,13 @@ Concrete02::getCopy(void)
 double
 Concrete02::getInitialTangent(void)
 {
-  return 2.0*fc/epsc0;
+  return 2.0*params->fc/params->epsc0;
 }
 
 int
 Concrete02::setTrialStrain(double trialStrain, double strainRate)
 {
-  double  ec0 = fc * 2. / epsc0;
+  double  ec0 = params->fc * 2. / params->epsc0;
 
   // retrieve concrete hitory variables
 
@@ -119,7 +143,7 @@ Concrete02::setTrialStrain(double trialStrain, double strainRate)
     // (corresponding equations are 2.31 and 2.32 
     // the strain of point R is epsR and the stress is sigmR 
     
-    double epsr = (fcu - rat * ec0 * epscu) / (ec0 * (1.0 - rat));
+    double epsr = (params->fcu - params->rat * ec0 * params->epscu) / (ec0 * (1.0 - params->rat));
     double sigmr = ec0 * epsr;
     
     // calculate the previous minimum stress sigmm from the minimum 
@@ -235,12 +259,12 @@ Concrete02::revertToStart(void)
   ecminP = 0.0;
   deptP = 0.0;
 
-  eP = 2.0*fc/epsc0;
+  eP = 2.0*params->fc/params->epsc0;
   epsP = 0.0;
   sigP = 0.0;
   eps = 0.0;
   sig = 0.0;
-  e = 2.0*fc/epsc0;
+  e = 2.0*params->fc/params->epsc0;
 
   return 0;
 }
@@ -249,13 +273,13 @@ int
 Concrete02::sendSelf(int commitTag, Channel &theChannel)
 {
   static Vector data(13);
-  data(0) =fc;    
-  data(1) =epsc0; 
-  data(2) =fcu;   
-  data(3) =epscu; 
-  data(4) =rat;   
-  data(5) =ft;    
-  data(6) =Ets;   
+  data(0) =params->fc;    
+  data(1) =params->epsc0; 
+  data(2) =params->fcu;   
+  data(3) =params->epscu; 
+  data(4) =params->rat;   
+  data(5) =params->ft;    
+  data(6) =params->Ets;   
   data(7) =ecminP;
   data(8) =deptP; 
   data(9) =epsP;  
@@ -282,13 +306,14 @@ Concrete02::recvSelf(int commitTag, Channel &theChannel,
     return -1;
   }
 
-  fc = data(0);
-  epsc0 = data(1);
-  fcu = data(2);
-  epscu = data(3);
-  rat = data(4);
-  ft = data(5);
-  Ets = data(6);
+  unshareParameterBlock(params);
+  params->fc = data(0);
+  params->epsc0 = data(1);
+  params->fcu = data(2);
+  params->epscu = data(3);
+  params->rat = data(4);
+  params->ft = data(5);
+  params->Ets = data(6);
   ecminP = data(7);
   deptP = data(8);
   epsP = data(9);
@@ -326,17 +351,17 @@ Concrete02::Tens_Envlp (double epsc, double &sigc, double &Ect)
 !    Ect  = tangent concrete modulus
 !-----------------------------------------------------------------------*/
   
-  double Ec0  = 2.0*fc/epsc0;
+  double Ec0  = 2.0*params->fc/params->epsc0;
 
-  double eps0 = ft/Ec0;
-  double epsu = ft*(1.0/Ets+1.0/Ec0);
+  double eps0 = params->ft/Ec0;
+  double epsu = params->ft*(1.0/params->Ets+1.0/Ec0);
   if (epsc<=eps0) {
     sigc = epsc*Ec0;
     Ect  = Ec0;
   } else {
     if (epsc<=epsu) {
-      Ect  = -Ets;
-      sigc = ft-Ets*(epsc-eps0);
+      Ect  = -params->Ets;
+      sigc = params->ft-params->Ets*(epsc-eps0);
     } else {
       //      Ect  = 0.0
       Ect  = 1.0e-10;
@@ -365,23 +390,23 @@ Concrete02::Compr_Envlp (double epsc, double &sigc, double &Ect)
 !   Ect   = tangent concrete modulus
 -----------------------------------------------------------------------*/
 
-  double Ec0  = 2.0*fc/epsc0;
+  double Ec0  = 2.0*params->fc/params->epsc0;
 
-  double ratLocal = epsc/epsc0;
-  if (epsc>=epsc0) {
-    sigc = fc*ratLocal*(2.0-ratLocal);
+  double ratLocal = epsc/params->epsc0;
+  if (epsc>=params->epsc0) {
+    sigc = params->fc*ratLocal*(2.0-ratLocal);
     Ect  = Ec0*(1.0-ratLocal);
   } else {
     
     //   linear descending branch between epsc0 and epscu
-    if (epsc>epscu) {
-      sigc = (fcu-fc)*(epsc-epsc0)/(epscu-epsc0)+fc;
-      Ect  = (fcu-fc)/(epscu-epsc0);
+    if (epsc>params->epscu) {
+      sigc = (params->fcu-params->fc)*(epsc-params->epsc0)/(params->epscu-params->epsc0)+params->fc;
+      Ect  = (params->fcu-params->fc)/(params->epscu-params->epsc0);
     } else {
 	   
       // flat friction branch for strains larger than epscu
       
-      sigc = fcu;
+      sigc = params->fcu;
       Ect  = 1.0e-10;
       //       Ect  = 0.0
     }
@@ -393,7 +418,7 @@ int
 Concrete02::getVariable(const char *varName, Information &theInfo)
 {
   if (strcmp(varName,"ec") == 0) {
-    theInfo.theDouble = epsc0;
+    theInfo.theDouble = params->epsc0;
     return 0;
   } else
     return -1;
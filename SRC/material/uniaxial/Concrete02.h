@@ -41,6 +41,20 @@
 #define Concrete02_h
 
 #include <UniaxialMaterial.h>
+#include <MaterialParameterBlock.h>
+
+// matpar : Concrete FIXED PROPERTIES, shared by the copies of a Concrete02
+class Concrete02Parameters : public MaterialParameterBlock
+{
+  public:
+    double fc;    // concrete compression strength           : mp(1)
+    double epsc0; // strain at compression strength          : mp(2)
+    double fcu;   // stress at ultimate (crushing) strain    : mp(3)
+    double epscu; // ultimate (crushing) strain              : mp(4)       
+    double rat;   // ratio between unloading slope at epscu and original slope : mp(5)
+    double ft;    // concrete tensile strength               : mp(6)
+    double Ets;   // tension stiffening slope                : mp(7)
+};
 
 class Concrete02 : public UniaxialMaterial
 {
@@ -79,14 +93,10 @@ class Concrete02 : public UniaxialMaterial
     void Tens_Envlp (double epsc, double &sigc, double &Ect);
     void Compr_Envlp (double epsc, double &sigc, double &Ect);
 
+    Concrete02(int tag, Concrete02Parameters &theParams);
+
     // matpar : Concrete FIXED PROPERTIES
-    double fc;    // concrete compression strength           : mp(1)
-    double epsc0; // strain at compression strength          : mp(2)
-    double fcu;   // stress at ultimate (crushing) strain    : mp(3)
-    double epscu; // ultimate (crushing) strain              : mp(4)       
-    double rat;   // ratio between unloading slope at epscu and original slope : mp(5)
-    double ft;    // concrete tensile strength               : mp(6)
-    double Ets;   // tension stiffening slope                : mp(7)
+    Concrete02Parameters *params;
 
     // hstvP : Concerete HISTORY VARIABLES last committed step
     double ecminP;  //  hstP(1)
@@ -42,30 +42,40 @@ HystereticMaterial::HystereticMaterial(int tag,
 			double m1p, double r1p, double m2p, double r2p, double m3p, double r3p,
 			double m1n, double r1n, double m2n, double r2n, double m3n, double r3n,
 			double px, double py, double d1, double d2, double b):
-UniaxialMaterial(tag, MAT_TAG_Hysteretic),
-pinchX(px), pinchY(py), damfc1(d1), damfc2(d2), beta(b),
-mom1p(m1p), rot1p(r1p), mom2p(m2p), rot2p(r2p), mom3p(m3p), rot3p(r3p),
-mom1n(m1n), rot1n(r1n), mom2n(m2n), rot2n(r2n), mom3n(m3n), rot3n(r3n)
+UniaxialMaterial(tag, MAT_TAG_Hysteretic), params(0)
 {
+	params = new HystereticParameters;
+	params->pinchX = px;
+	params->pinchY = py;
+	params->damfc1 = d1;
+	params->damfc2 = d2;
+	params->beta = b;
+	params->mom1p = m1p; params->rot1p = r1p;
+	params->mom2p = m2p; params->rot2p = r2p;
+	params->mom3p = m3p; params->rot3p = r3p;
+	params->mom1n = m1n; params->rot1n = r1n;
+	params->mom2n = m2n; params->rot2n = r2n;
+	params->mom3n = m3n; params->rot3n = r3n;
+
 	bool error = false;
 	// Positive backbone parameters
-	if (rot1p <= 0.0)
+	if (params->rot1p <= 0.0)
 		error = true;
 
-	if (rot2p <= rot1p)
+	if (params->rot2p <= params->rot1p)
 		error = true;
 
-	if (rot3p <= rot2p)
+	if (params->rot3p <= params->rot2p)
 		error = true;
 
 	// Negative backbone parameters
-	if (rot1n >= 0.0)
+	if (params->rot1n >= 0.0)
 		error = true;
 
-	if (rot2n >= rot1n)
+	if (params->rot2n >= params->rot1n)
 		error = true;
 
-	if (rot3n >= rot2n)
+	if (params->rot3n >= params->rot2n)
 		error = true;
 	
 	if (error) {
@@ -73,8 +83,8 @@ mom1n(m1n), rot1n(r1n), mom2n(m2n), rot2n(r2n), mom3n(m3n), rot3n(r3n)
 	  exit(-1);
 	}		
 
-	energyA = 0.5 * (rot1p*mom1p + (rot2p-rot1p)*(mom2p+mom1p) + (rot3p-rot2p)*(mom3p+mom2p) +
-		rot1n*mom1n + (rot2n-rot1n)*(mom2n+mom1n) + (rot3n-rot2n)*(mom3n+mom2n));
+	params->energyA = 0.5 * (params->rot1p*params->mom1p + (params->rot2p-params->rot1p)*(params->mom2p+params->mom1p) + (params->rot3p-params->rot2p)*(params->mom3p+params->mom2p) +
+		params->rot1n*params->mom1n + (params->rot2n-params->rot1n)*(params->mom2n+params->mom1n) + (params->rot3n-params->rot2n)*(params->mom3n+params->mom2n));
 
 	// Set envelope slopes
 	this->setEnvelope();
@@ -89,25 +99,33 @@ HystereticMaterial::HystereticMaterial(int tag,
 			double m1p, double r1p, double m2p, double r2p,
 			double m1n, double r1n, double m2n, double r2n,
 			double px, double py, double d1, double d2, double b):
-UniaxialMaterial(tag, MAT_TAG_Hysteretic),
-pinchX(px), pinchY(py), damfc1(d1), damfc2(d2), beta(b),
-mom1p(m1p), rot1p(r1p), mom3p(m2p), rot3p(r2p),
-mom1n(m1n), rot1n(r1n), mom3n(m2n), rot3n(r2n)
+UniaxialMaterial(tag, MAT_TAG_Hysteretic), params(0)
 {
+	params = new HystereticParameters;
+	params->pinchX = px;
+	params->pinchY = py;
+	params->damfc1 = d1;
+	params->damfc2 = d2;
+	params->beta = b;
+	params->mom1p = m1p; params->rot1p = r1p;
+	params->mom3p = m2p; params->rot3p = r2p;
+	params->mom1n = m1n; params->rot1n = r1n;
+	params->mom3n = m2n; params->rot3n = r2n;
+
 	bool error = false;
 	
 	// Positive backbone parameters
-	if (rot1p <= 0.0)
+	if (params->rot1p <= 0.0)
 		error = true;
 
-	if (rot3p <= rot1p)
+	if (params->rot3p <= params->rot1p)
 		error = true;
 
 	// Negative backbone parameters
-	if (rot1n >= 0.0)
+	if (params->rot1n >= 0.0)
 		error = true;
 
-	if (rot3n >= rot1n)
+	if (params->rot3n >= params->rot1n)
 		error = true;
 
 	if (error) {
@@ -117,16 +135,16 @@ mom1n(m1n), rot1n(r1n), mom3n(m2n), rot3n(r2n)
 
 				      
 
-	energyA = 0.5 * (rot1p*mom1p + (rot3p-rot1p)*(mom3p+mom1p) +
-		rot1n*mom1n + (rot3n-rot1n)*(mom3n+mom1n));
+	params->energyA = 0.5 * (params->rot1p*params->mom1p + (params->rot3p-params->rot1p)*(params->mom3p+params->mom1p) +
+		params->rot1n*params->mom1n + (params->rot3n-params->rot1n)*(params->mom3n+params->mom1n));
 
-	mom2p = 0.5*(mom1p+mom3p);
-	mom2n = 0.5*(mom1n+mom3n);
+	params->mom2p = 0.5*(params->mom1p+params->mom3p);
+	params->mom2n = 0.5*(params->mom1n+params->mom3n);
 
-	rot2p = 0.5*(rot1p+rot3p);
-	rot2n = 0.5*(rot1n+rot3n);
+	params->rot2p = 0.5*(params->rot1p+params->rot3p);
+	params->rot2n = 0.5*(params->rot1n+params->rot3n);
 
-	opserr << mom1p << " " << mom2p << " " << mom3p << " " << rot1p << " " << rot2p << " " << rot3p << endln;
+	opserr << params->mom1p << " " << params->mom2p << " " << params->mom3p << " " << params->rot1p << " " << params->rot2p << " " << params->rot3p << endln;
 
 	// Set envelope slopes
 	this->setEnvelope();
@@ -137,17 +155,38 @@ mom1n(m1n), rot1n(r1n), mom3n(m2n), rot3n(r2n)
 }
 
 HystereticMaterial::HystereticMaterial():
-UniaxialMaterial(0, MAT_TAG_Hysteretic),
-pinchX(0.0), pinchY(0.0), damfc1(0.0), damfc2(0.0), beta(0.0),
-mom1p(0.0), rot1p(0.0), mom2p(0.0), rot2p(0.0), mom3p(0.0), rot3p(0.0),
-mom1n(0.0), rot1n(0.0), mom2n(0.0), rot2n(0.0), mom3n(0.0), rot3n(0.0)
+UniaxialMaterial(0, MAT_TAG_Hysteretic), params(0)
+{
+	params = new HystereticParameters;
+	params->pinchX = 0.0;
+	params->pinchY = 0.0;
+	params->damfc1 = 0.0;
+	params->damfc2 = 0.0;
+	params->beta = 0.0;
+	params->mom1p = 0.0; params->rot1p = 0.0;
+	params->mom2p = 0.0; params->rot2p = 0.0;
+	params->mom3p = 0.0; params->rot3p = 0.0;
+	params->mom1n = 0.0; params->rot1n = 0.0;
+	params->mom2n = 0.0; params->rot2n = 0.0;
+	params->mom3n = 0.0; params->rot3n = 0.0;
+	params->energyA = 0.0;
+}
+
+// constructor used by getCopy(), the copy shares the backbone, the 
+// envelope slopes and the pinching, damage and unloading parameters
+HystereticMaterial::HystereticMaterial(int tag, HystereticParameters &theParams):
+UniaxialMaterial(tag, MAT_TAG_Hysteretic), params(&theParams)
 {
+	params->attach();
 
+	// Initialize history variables
+	this->revertToStart();
+	this->revertToLastCommit();
 }
 
 HystereticMaterial::~HystereticMaterial()
 {
-	// Nothing to do
+	params->detach();
 }
 
 int
@@ -223,20 +262,20 @@ HystereticMaterial::getTangent(void)
 void
 HystereticMaterial::positiveIncrement(double dStrain)
 {
-	double kn = pow(CrotMin/rot1n,beta);
+	double kn = pow(CrotMin/params->rot1n,params->beta);
 	kn = (kn < 1.0) ? 1.0 : 1.0/kn;
-	double kp = pow(CrotMax/rot1p,beta);
+	double kp = pow(CrotMax/params->rot1p,params->beta);
 	kp = (kp < 1.0) ? 1.0 : 1.0/kp;
 
 	if (TloadIndicator == 2) {
 		TloadIndicator = 1;
 		if (Cstress <= 0.0) {
-			TrotNu = Cstrain - Cstress/(Eun*kn);
-			double energy = CenergyD - 0.5*Cstress/(Eun*kn)*Cstress;
+			TrotNu = Cstrain - Cstress/(params->Eun*kn);
+			double energy = CenergyD - 0.5*Cstress/(params->Eun*kn)*Cstress;
 			double damfc = 0.0;
-			if (CrotMin < rot1n) {
-				damfc = damfc2*energy/energyA;
-				damfc += damfc1*(CrotMin-rot1n)/rot1n;
+			if (CrotMin < params->rot1n) {
+				damfc = params->damfc2*energy/params->energyA;
+				damfc += params->damfc1*(CrotMin-params->rot1n)/params->rot1n;
 			}
 
 			TrotMax = CrotMax*(1.0+damfc);
@@ -245,7 +284,7 @@ HystereticMaterial::positiveIncrement(double dStrain)
 
   TloadIndicator = 1;
 
-	TrotMax = (TrotMax > rot1p) ? TrotMax : rot1p;
+	TrotMax = (TrotMax > params->rot1p) ? TrotMax : params->rot1p;
 
 	double maxmom = posEnvlpStress(TrotMax);
 	double rotlim = negEnvlpRotlim(CrotMin);
@@ -257,35 +296,35 @@ HystereticMaterial::positiveIncrement(double dStrain)
 	
 	//	double rotmp1 = rotrel + pinchY*(TrotMax-rotrel);
 
-	double rotmp2 = TrotMax - (1.0-pinchY)*maxmom/(Eup*kp);
+	double rotmp2 = TrotMax - (1.0-params->pinchY)*maxmom/(params->Eup*kp);
 	//double rotmp2 = TrotMax-(1-pinchY)*maxmom/Eup;
 	//	double rotch = rotmp1 + (rotmp2-rotmp1)*pinchX;
-	double rotch = rotrel + (rotmp2-rotrel)*pinchX;                   // changed on 7/11/2006
+	double rotch = rotrel + (rotmp2-rotrel)*params->pinchX;                   // changed on 7/11/2006
 
 	double tmpmo1;
 	double tmpmo2;
 
 	if (Tstrain < TrotNu) {
-		Ttangent = Eun*kn;
+		Ttangent = params->Eun*kn;
 		Tstress = Cstress + Ttangent*dStrain;
 		if (Tstress >= 0.0) {
 			Tstress = 0.0;
-			Ttangent = Eun*1.0e-9;
+			Ttangent = params->Eun*1.0e-9;
 		}
 	}
 
 	else if (Tstrain >= TrotNu && Tstrain < rotch) {
 		if (Tstrain <= rotrel) {
 			Tstress = 0.0;
-			Ttangent = Eup*1.0e-9;
+			Ttangent = params->Eup*1.0e-9;
 		}
 		else {
-			Ttangent = maxmom*pinchY/(rotch-rotrel);
-			tmpmo1 = Cstress + Eup*kp*dStrain;
+			Ttangent = maxmom*params->pinchY/(rotch-rotrel);
+			tmpmo1 = Cstress + params->Eup*kp*dStrain;
 			tmpmo2 = (Tstrain-rotrel)*Ttangent;
 			if (tmpmo1 < tmpmo2) {
 				Tstress = tmpmo1;
-				Ttangent = Eup*kp;
+				Ttangent = params->Eup*kp;
 			}
 			else
 				Tstress = tmpmo2;
@@ -293,12 +332,12 @@ HystereticMaterial::positiveIncrement(double dStrain)
 	}
 
 	else {
-		Ttangent = (1.0-pinchY)*maxmom/(TrotMax-rotch);
-		tmpmo1 = Cstress + Eup*kp*dStrain;
-		tmpmo2 = pinchY*maxmom + (Tstrain-rotch)*Ttangent;
+		Ttangent = (1.0-params->pinchY)*maxmom/(TrotMax-rotch);
+		tmpmo1 = Cstress + params->Eup*kp*dStrain;
+		tmpmo2 = params->pinchY*maxmom + (Tstrain-rotch)*Ttangent;
 		if (tmpmo1 < tmpmo2) {
 			Tstress = tmpmo1;
-			Ttangent = Eup*kp;
+			Ttangent = params->Eup*kp;
 		}
 		else
 			Tstress = tmpmo2;
@@ -308,20 +347,20 @@ HystereticMaterial::positiveIncrement(double dStrain)
 void
 HystereticMaterial::negativeIncrement(double dStrain)
 {
-	double kn = pow(CrotMin/rot1n,beta);
+	double kn = pow(CrotMin/params->rot1n,params->beta);
 	kn = (kn < 1.0) ? 1.0 : 1.0/kn;
-	double kp = pow(CrotMax/rot1p,beta);
+	double kp = pow(CrotMax/params->rot1p,params->beta);
 	kp = (kp < 1.0) ? 1.0 : 1.0/kp;
 
 	if (TloadIndicator == 1) {
 		TloadIndicator = 2;
 		if (Cstress >= 0.0) {
-			TrotPu = Cstrain - Cstress/(Eup*kp);
-			double energy = CenergyD - 0.5*Cstress/(Eup*kp)*Cstress;
+			TrotPu = Cstrain - Cstress/(params->Eup*kp);
+			double energy = CenergyD - 0.5*Cstress/(params->Eup*kp)*Cstress;
 			double damfc = 0.0;
-			if (CrotMax > rot1p) {
-				damfc = damfc2*energy/energyA;
-				damfc += damfc1*(CrotMax-rot1p)/rot1p;
+			if (CrotMax > params->rot1p) {
+				damfc = params->damfc2*energy/params->energyA;
+				damfc += params->damfc1*(CrotMax-params->rot1p)/params->rot1p;
 			}
 
 			TrotMin = CrotMin*(1.0+damfc);
@@ -330,7 +369,7 @@ HystereticMaterial::negativeIncrement(double dStrain)
 
   TloadIndicator = 2;
 
-	TrotMin = (TrotMin < rot1n) ? TrotMin : rot1n;
+	TrotMin = (TrotMin < params->rot1n) ? TrotMin : params->rot1n;
 
 	double minmom = negEnvlpStress(TrotMin);
 	double rotlim = posEnvlpRotlim(CrotMax);
@@ -341,35 +380,35 @@ HystereticMaterial::negativeIncrement(double dStrain)
 	//  rotrel = rotlim;
 
 	//double rotmp1 = rotrel + pinchY*(TrotMin-rotrel);
-	double rotmp2 = TrotMin - (1.0-pinchY)*minmom/(Eun*kn);
+	double rotmp2 = TrotMin - (1.0-params->pinchY)*minmom/(params->Eun*kn);
 	//double rotmp2 = TrotMin-(1-pinchY)*minmom/Eun;	
 	//double rotch = rotmp1 + (rotmp2-rotmp1)*pinchX;
-	double rotch = rotrel + (rotmp2-rotrel)*pinchX;                   // changed on 7/11/2006
+	double rotch = rotrel + (rotmp2-rotrel)*params->pinchX;                   // changed on 7/11/2006
 
 	double tmpmo1;
 	double tmpmo2;
 
 	if (Tstrain > TrotPu) {
-		Ttangent = Eup*kp;
+		Ttangent = params->Eup*kp;
 		Tstress = Cstress + Ttangent*dStrain;
 		if (Tstress <= 0.0) {
 			Tstress = 0.0;
-			Ttangent = Eup*1.0e-9;
+			Ttangent = params->Eup*1.0e-9;
 		}
 	}
 
 	else if (Tstrain <= TrotPu && Tstrain > rotch) {
 		if (Tstrain >= rotrel) {
 			Tstress = 0.0;
-			Ttangent = Eun*1.0e-9;
+			Ttangent = params->Eun*1.0e-9;
 		}
 		else {
-			Ttangent = minmom*pinchY/(rotch-rotrel);
-			tmpmo1 = Cstress + Eun*kn*dStrain;
+			Ttangent = minmom*params->pinchY/(rotch-rotrel);
+			tmpmo1 = Cstress + params->Eun*kn*dStrain;
 			tmpmo2 = (Tstrain-rotrel)*Ttangent;
 			if (tmpmo1 > tmpmo2) {
 				Tstress = tmpmo1;
-				Ttangent = Eun*kn;
+				Ttangent = params->Eun*kn;
 			}
 			else
 				Tstress = tmpmo2;
@@ -377,12 +416,12 @@ HystereticMaterial::negativeIncrement(double dStrain)
 	}
 
 	else {
-		Ttangent = (1.0-pinchY)*minmom/(TrotMin-rotch);
-		tmpmo1 = Cstress + Eun*kn*dStrain;
-		tmpmo2 = pinchY*minmom + (Tstrain-rotch)*Ttangent;
+		Ttangent = (1.0-params->pinchY)*minmom/(TrotMin-rotch);
+		tmpmo1 = Cstress + params->Eun*kn*dStrain;
+		tmpmo2 = params->pinchY*minmom + (Tstrain-rotch)*Ttangent;
 		if (tmpmo1 > tmpmo2) {
 			Tstress = tmpmo1;
-			Ttangent = Eun*kn;
+			Ttangent = params->Eun*kn;
 		}
 		else
 			Tstress = tmpmo2;
@@ -435,7 +474,7 @@ HystereticMaterial::revertToStart(void)
 
 	Tstrain = 0;
 	Tstress = 0;
-	Ttangent = E1p;
+	Ttangent = params->E1p;
 
 	return 0;
 }
@@ -443,10 +482,7 @@ HystereticMaterial::revertToStart(void)
 UniaxialMaterial*
 HystereticMaterial::getCopy(void)
 {
-	HystereticMaterial *theCopy = new HystereticMaterial (this->getTag(),
-		mom1p, rot1p, mom2p, rot2p, mom3p, rot3p,
-		mom1n, rot1n, mom2n, rot2n, mom3n, rot3n,
-		pinchX, pinchY, damfc1, damfc2, beta);
+	HystereticMaterial *theCopy = new HystereticMaterial (this->getTag(), *params);
 
 	theCopy->CrotMax = CrotMax;
 	theCopy->CrotMin = CrotMin;
@@ -469,23 +505,23 @@ HystereticMaterial::sendSelf(int commitTag, Channel &theChannel)
   static Vector data(27);
   
   data(0) = this->getTag();
-  data(1) = mom1p;
-  data(2) = rot1p;
-  data(3) = mom2p;
-  data(4) = rot2p;
-  data(5) = mom3p;
-  data(6) = rot3p;
-  data(7) = mom1n;
-  data(8) = rot1n;
-  data(9) = mom2n;
-  data(10) = rot2n;
-  data(11) = mom3n;
-  data(12) = rot3n;
-  data(13) = pinchX;
-  data(14) = pinchY;
-  data(15) = damfc1;
-  data(16) = damfc2;
-  data(17) = beta;
+  data(1) = params->mom1p;
+  data(2) = params->rot1p;
+  data(3) = params->mom2p;
+  data(4) = params->rot2p;
+  data(5) = params->mom3p;
+  data(6) = params->rot3p;
+  data(7) = params->mom1n;
+  data(8) = params->rot1n;
+  data(9) = params->mom2n;
+  data(10) = params->rot2n;
+  data(11) = params->mom3n;
+  data(12) = params->rot3n;
+  data(13) = params->pinchX;
+  data(14) = params->pinchY;
+  data(15) = params->damfc1;
+  data(16) = params->damfc2;
+  data(17) = params->beta;
   data(18) = CrotMax;
   data(19) = CrotMin;
   data(20) = CrotPu;
@@ -519,23 +555,24 @@ HystereticMaterial::recvSelf(int commitTag, Channel &theChannel,
   }
   else {
     this->setTag((int)data(0));
-    mom1p = data(1);
-    rot1p = data(2);
-    mom2p = data(3);
-    rot2p = data(4);
-    mom3p = data(5);
-    rot3p = data(6);
-    mom1n = data(7);
-    rot1n = data(8);
-    mom2n = data(9);
-    rot2n = data(10);
-    mom3n = data(11);
-    rot3n = data(12);
-    pinchX = data(13);
-    pinchY = data(14);
-    damfc1 = data(15);
-    damfc2 = data(16);
-    beta = data(17);
+    unshareParameterBlock(params);
+    params->mom1p = data(1);
+    params->rot1p = data(2);
+    params->mom2p = data(3);
+    params->rot2p = data(4);
+    params->mom3p = data(5);
+    params->rot3p = data(6);
+    params->mom1n = data(7);
+    params->rot1n = data(8);
+    params->mom2n = data(9);
+    params->rot2n = data(10);
+    params->mom3n = data(11);
+    params->rot3n = data(12);
+    params->pinchX = data(13);
+    params->pinchY = data(14);
+    params->damfc1 = data(15);
+    params->damfc2 = data(16);
+    params->beta = data(17);
 
     CrotMax = data(18);
     CrotMin = data(19);
@@ -568,52 +605,52 @@ void
 HystereticMaterial::Print(OPS_Stream &s, int flag)
 {
 	s << "Hysteretic Material, tag: " << this->getTag() << endln;
-	s << "mom1p: " << mom1p << endln;
-	s << "rot1p: " << rot1p << endln;
-	s << "E1p: " << E1p << endln;
-	s << "mom2p: " << mom2p << endln;
-	s << "rot2p: " << rot2p << endln;
-	s << "E2p: " << E2p << endln;
-	s << "mom3p: " << mom3p << endln;
-	s << "rot3p: " << rot3p << endln;
-	s << "E3p: " << E3p << endln;
-
-	s << "mom1n: " << mom1n << endln;
-	s << "rot1n: " << rot1n << endln;
-	s << "E1n: " << E1n << endln;
-	s << "mom2n: " << mom2n << endln;
-	s << "rot2n: " << rot2n << endln;
-	s << "E2n: " << E2n << endln;
-	s << "mom3n: " << mom3n << endln;
-	s << "rot3n: " << rot3n << endln;
-	s << "E3n: " << E3n << endln;
-
-	s << "pinchX: " << pinchX << endln;
-	s << "pinchY: " << pinchY << endln;
-	s << "damfc1: " << damfc1 << endln;
-	s << "damfc2: " << damfc2 << endln;
-	s << "energyA: " << energyA << endln;
-	s << "beta: " << beta << endln;
+	s << "mom1p: " << params->mom1p << endln;
+	s << "rot1p: " << params->rot1p << endln;
+	s << "E1p: " << params->E1p << endln;
+	s << "mom2p: " << params->mom2p << endln;
+	s << "rot2p: " << params->rot2p << endln;
+	s << "E2p: " << params->E2p << endln;
+	s << "mom3p: " << params->mom3p << endln;
+	s << "rot3p: " << params->rot3p << endln;
+	s << "E3p: " << params->E3p << endln;
+
+	s << "mom1n: " << params->mom1n << endln;
+	s << "rot1n: " << params->rot1n << endln;
+	s << "E1n: " << params->E1n << endln;
+	s << "mom2n: " << params->mom2n << endln;
+	s << "rot2n: " << params->rot2n << endln;
+	s << "E2n: " << params->E2n << endln;
+	s << "mom3n: " << params->mom3n << endln;
+	s << "rot3n: " << params->rot3n << endln;
+	s << "E3n: " << params->E3n << endln;
+
+	s << "pinchX: " << params->pinchX << endln;
+	s << "pinchY: " << params->pinchY << endln;
+	s << "damfc1: " << params->damfc1 << endln;
+	s << "damfc2: " << params->damfc2 << endln;
+	s << "energyA: " << params->energyA << endln;
+	s << "beta: " << params->beta << endln;
 }
 
 void
 HystereticMaterial::setEnvelope(void)
 {
-	E1p = mom1p/rot1p;
-	E2p = (mom2p-mom1p)/(rot2p-rot1p);
-	E3p = (mom3p-mom2p)/(rot3p-rot2p);
+	params->E1p = params->mom1p/params->rot1p;
+	params->E2p = (params->mom2p-params->mom1p)/(params->rot2p-params->rot1p);
+	params->E3p = (params->mom3p-params->mom2p)/(params->rot3p-params->rot2p);
 
-	E1n = mom1n/rot1n;
-	E2n = (mom2n-mom1n)/(rot2n-rot1n);
-	E3n = (mom3n-mom2n)/(rot3n-rot2n);
+	params->E1n = params->mom1n/params->rot1n;
+	params->E2n = (params->mom2n-params->mom1n)/(params->rot2n-params->rot1n);
+	params->E3n = (params->mom3n-params->mom2n)/(params->rot3n-params->rot2n);
 
-	Eup = E1p;
-	if (E2p > Eup) Eup = E2p;
-	if (E3p > Eup) Eup = E3p;
+	params->Eup = params->E1p;
+	if (params->E2p > params->Eup) params->Eup = params->E2p;
+	if (params->E3p > params->Eup) params->Eup = params->E3p;
 
-	Eun = E1n;
-	if (E2n > Eun) Eun = E2n;
-	if (E3n > Eun) Eun = E3n;
+	params->Eun = params->E1n;
+	if (params->E2n > params->Eun) params->Eun = params->E2n;
+	if (params->E3n > params->Eun) params->Eun = params->E3n;
 }
 
 double
@@ -621,14 +658,14 @@ HystereticMaterial::posEnvlpStress(double strain)
 {
 	if (strain <= 0.0)
 		return 0.0;
-	else if (strain <= rot1p)
-		return E1p*strain;
-	else if (strain <= rot2p)
-		return mom1p + E2p*(strain-rot1p);
-	else if (strain <= rot3p || E3p > 0.0)
-		return mom2p + E3p*(strain-rot2p);
+	else if (strain <= params->rot1p)
+		return params->E1p*strain;
+	else if (strain <= params->rot2p)
+		return params->mom1p + params->E2p*(strain-params->rot1p);
+	else if (strain <= params->rot3p || params->E3p > 0.0)
+		return params->mom2p + params->E3p*(strain-params->rot2p);
 	else
-		return mom3p;
+		return params->mom3p;
 }
 
 double
@@ -636,44 +673,44 @@ HystereticMaterial::negEnvlpStress(double strain)
 {
 	if (strain >= 0.0)
 		return 0.0;
-	else if (strain >= rot1n)
-		return E1n*strain;
-	else if (strain >= rot2n)
-		return mom1n + E2n*(strain-rot1n);
-	else if (strain >= rot3n || E3n > 0.0)
-		return mom2n + E3n*(strain-rot2n);
+	else if (strain >= params->rot1n)
+		return params->E1n*strain;
+	else if (strain >= params->rot2n)
+		return params->mom1n + params->E2n*(strain-params->rot1n);
+	else if (strain >= params->rot3n || params->E3n > 0.0)
+		return params->mom2n + params->E3n*(strain-params->rot2n);
 	else
-		return mom3n;
+		return params->mom3n;
 }
 
 double
 HystereticMaterial::posEnvlpTangent(double strain)
 {
   if (strain < 0.0)
-    return E1p*1.0e-9;
-  else if (strain <= rot1p)
-    return E1p;
-  else if (strain <= rot2p)
-    return E2p;
-  else if (strain <= rot3p || E3p > 0.0)
-    return E3p;
+    return params->E1p*1.0e-9;
+  else if (strain <= params->rot1p)
+    return params->E1p;
+  else if (strain <= params->rot2p)
+    return params->E2p;
+  else if (strain <= params->rot3p || params->E3p > 0.0)
+    return params->E3p;
   else
-    return E1p*1.0e-9;
+    return params->E1p*1.0e-9;
 }
 
 double
 HystereticMaterial::negEnvlpTangent(double strain)
 {
   if (strain > 0.0)
-    return E1n*1.0e-9;
-  else if (strain >= rot1n)
-    return E1n;
-  else if (strain >= rot2n)
-    return E2n;
-  else if (strain >= rot3n || E3n > 0.0)
-    return E3n;
+    return params->E1n*1.0e-9;
+  else if (strain >= params->rot1n)
+    return params->E1n;
+  else if (strain >= params->rot2n)
+    return params->E2n;
+  else if (strain >= params->rot3n || params->E3n > 0.0)
+    return params->E3n;
   else
-    return E1n*1.0e-9;
+    return params->E1n*1.0e-9;
 }
 
 double
@@ -681,12 +718,12 @@ HystereticMaterial::posEnvlpRotlim(double strain)
 {
   double strainLimit = POS_INF_STRAIN;
 
-  if (strain <= rot1p)
+  if (strain <= params->rot1p)
     return POS_INF_STRAIN;
-  if (strain > rot1p && strain <= rot2p && E2p < 0.0)
-    strainLimit = rot1p - mom1p/E2p;
-  if (strain > rot2p && E3p < 0.0)
-    strainLimit = rot2p - mom2p/E3p;
+  if (strain > params->rot1p && strain <= params->rot2p && params->E2p < 0.0)
+    strainLimit = params->rot1p - params->mom1p/params->E2p;
+  if (strain > params->rot2p && params->E3p < 0.0)
+    strainLimit = params->rot2p - params->mom2p/params->E3p;
 
   if (strainLimit == POS_INF_STRAIN)
     return POS_INF_STRAIN;
@@ -701,12 +738,12 @@ HystereticMaterial::negEnvlpRotlim(double strain)
 {
   double strainLimit = NEG_INF_STRAIN;
 
-  if (strain >= rot1n)
+  if (strain >= params->rot1n)
     return NEG_INF_STRAIN;
-  if (strain < rot1n && strain >= rot2n && E2n < 0.0)
-    strainLimit = rot1n - mom1n/E2n;
-  if (strain < rot2n && E3n < 0.0)
-    strainLimit = rot2n - mom2n/E3n;
+  if (strain < params->rot1n && strain >= params->rot2n && params->E2n < 0.0)
+    strainLimit = params->rot1n - params->mom1n/params->E2n;
+  if (strain < params->rot2n && params->E3n < 0.0)
+    strainLimit = params->rot2n - params->mom2n/params->E3n;
 
   if (strainLimit == NEG_INF_STRAIN)
     return NEG_INF_STRAIN;
@@ -36,6 +36,39 @@
 #define HystereticMaterial_h
 
 #include <UniaxialMaterial.h>
+#include <MaterialParameterBlock.h>
+
+// fixed material properties, and the envelope slopes derived from them,
+// shared by the copies of a HystereticMaterial object
+class HystereticParameters : public MaterialParameterBlock
+{
+ public:
+  // Pinching parameters
+  double pinchX;		// Deformation pinching
+  double pinchY;		// Force pinching
+  
+  // Damage parameters
+  double damfc1;		// Deformation
+  double damfc2;		// Energy
+  
+  // Unloading parameter
+  double beta;
+
+  // Backbone parameters
+  double mom1p, rot1p;
+  double mom2p, rot2p;
+  double mom3p, rot3p;
+  double mom1n, rot1n;
+  double mom2n, rot2n;
+  double mom3n, rot3n;
+  
+  double E1p, E1n;
+  double E2p, E2n;
+  double E3p, E3n;
+  double Eup, Eun;
+
+  double energyA;
+};
 
 class HystereticMaterial : public UniaxialMaterial
 {
@@ -63,7 +96,7 @@ class HystereticMaterial : public UniaxialMaterial
   double getStrain(void);
   double getStress(void);
   double getTangent(void);
-  double getInitialTangent(void) {return E1p;};
+  double getInitialTangent(void) {return params->E1p;};
   
   int commitState(void);
   int revertToLastCommit(void);
@@ -80,16 +113,8 @@ class HystereticMaterial : public UniaxialMaterial
  protected:
   
  private:
-  // Pinching parameters
-  double pinchX;		// Deformation pinching
-  double pinchY;		// Force pinching
-  
-  // Damage parameters
-  double damfc1;		// Deformation
-  double damfc2;		// Energy
-  
-  // Unloading parameter
-  double beta;
+  // Backbone, pinching, damage and unloading parameters, shared with copies
+  HystereticParameters *params;
   
   // Trial history variables
   double TrotMax;
@@ -116,21 +141,8 @@ class HystereticMaterial : public UniaxialMaterial
   double Cstress;
   double Cstrain;
   
-  // Backbone parameters
-  double mom1p, rot1p;
-  double mom2p, rot2p;
-  double mom3p, rot3p;
-  double mom1n, rot1n;
-  double mom2n, rot2n;
-  double mom3n, rot3n;
-  
-  double E1p, E1n;
-  double E2p, E2n;
-  double E3p, E3n;
-  double Eup, Eun;
+  HystereticMaterial(int tag, HystereticParameters &theParams);
 
-  double energyA;
-  
   void setEnvelope(void);
   
   double posEnvlpStress(double strain);
@@ -45,9 +45,17 @@
 Steel01::Steel01
 (int tag, double FY, double E, double B,
  double A1, double A2, double A3, double A4):
-   UniaxialMaterial(tag,MAT_TAG_Steel01),
-   fy(FY), E0(E), b(B), a1(A1), a2(A2), a3(A3), a4(A4)
+   UniaxialMaterial(tag,MAT_TAG_Steel01), params(0)
 {
+   params = new Steel01Parameters;
+   params->fy = FY;
+   params->E0 = E;
+   params->b = B;
+   params->a1 = A1;
+   params->a2 = A2;
+   params->a3 = A3;
+   params->a4 = A4;
+
    // Sets all history and state variables to initial values
    // History variables
    CminStrain = 0.0;
@@ -65,11 +73,11 @@ Steel01::Steel01
    // State variables
    Cstrain = 0.0;
    Cstress = 0.0;
-   Ctangent = E0;
+   Ctangent = params->E0;
 
    Tstrain = 0.0;
    Tstress = 0.0;
-   Ttangent = E0;
+   Ttangent = params->E0;
 
 // AddingSensitivity:BEGIN /////////////////////////////////////
 	parameterID = 0;
@@ -77,9 +85,16 @@ Steel01::Steel01
 // AddingSensitivity:END //////////////////////////////////////
 }
 
-Steel01::Steel01():UniaxialMaterial(0,MAT_TAG_Steel01),
- fy(0.0), E0(0.0), b(0.0), a1(0.0), a2(0.0), a3(0.0), a4(0.0)
+Steel01::Steel01():UniaxialMaterial(0,MAT_TAG_Steel01), params(0)
 {
+   params = new Steel01Parameters;
+   params->fy = 0.0;
+   params->E0 = 0.0;
+   params->b = 0.0;
+   params->a1 = 0.0;
+   params->a2 = 0.0;
+   params->a3 = 0.0;
+   params->a4 = 0.0;
 
 // AddingSensitivity:BEGIN /////////////////////////////////////
 	parameterID = 0;
@@ -88,8 +103,22 @@ Steel01::Steel01():UniaxialMaterial(0,MAT_TAG_Steel01),
 
 }
 
+// constructor used by getCopy(), the copy shares the material properties
+Steel01::Steel01(int tag, Steel01Parameters &theParams)
+  :UniaxialMaterial(tag,MAT_TAG_Steel01), params(&theParams)
+{
+   params->attach();
+
+// AddingSensitivity:BEGIN /////////////////////////////////////
+	parameterID = 0;
+	SHVs = 0;
+// AddingSensitivity:END //////////////////////////////////////
+}
+
 Steel01::~Steel01 ()
 {
+   params->detach();
+
 // AddingSensitivity:BEGIN /////////////////////////////////////
 	if (SHVs != 0) 
 		delete SHVs;
@@ -155,10 +184,10 @@ int Steel01::setTrial (double strain, double &stress, double &tangent, double st
 
 void Steel01::determineTrialState (double dStrain)
 {
-      double fyOneMinusB = fy * (1.0 - b);
+      double fyOneMinusB = params->fy * (1.0 - params->b);
 
-      double Esh = b*E0;
-      double epsy = fy/E0;
+      double Esh = params->b*params->E0;
+      double epsy = params->fy/params->E0;
       
       double c1 = Esh*Tstrain;
       
@@ -166,7 +195,7 @@ void Steel01::determineTrialState (double dStrain)
 
       double c3 = TshiftP*fyOneMinusB;
 
-      double c = Cstress + E0*dStrain;
+      double c = Cstress + params->E0*dStrain;
 
       /**********************************************************
          removal of the following lines due to problems with
@@ -195,7 +224,7 @@ void Steel01::determineTrialState (double dStrain)
       **************************************************************/
 
       if (fabs(Tstress-c) < DBL_EPSILON)
-	  Ttangent = E0;
+	  Ttangent = params->E0;
       else
 	Ttangent = Esh;
 
@@ -217,7 +246,7 @@ void Steel01::determineTrialState (double dStrain)
 	  Tloading = -1;
 	  if (Cstrain > TmaxStrain)
 	    TmaxStrain = Cstrain;
-	  TshiftN = 1 + a1*pow((TmaxStrain-TminStrain)/(2.0*a2*epsy),0.8);
+	  TshiftN = 1 + params->a1*pow((TmaxStrain-TminStrain)/(2.0*params->a2*epsy),0.8);
       }
 
       // Transition from unloading to loading, i.e. negative strain increment
@@ -226,7 +255,7 @@ void Steel01::determineTrialState (double dStrain)
 	  Tloading = 1;
 	  if (Cstrain < TminStrain)
 	    TminStrain = Cstrain;
-	  TshiftP = 1 + a3*pow((TmaxStrain-TminStrain)/(2.0*a4*epsy),0.8);
+	  TshiftP = 1 + params->a3*pow((TmaxStrain-TminStrain)/(2.0*params->a4*epsy),0.8);
       }
 }
 
@@ -241,7 +270,7 @@ void Steel01::detectLoadReversal (double dStrain)
          Tloading = -1;
    }
 
-   double epsy = fy/E0;
+   double epsy = params->fy/params->E0;
 
    // Transition from loading to unloading, i.e. positive strain increment
    // to negative strain increment
@@ -250,7 +279,7 @@ void Steel01::detectLoadReversal (double dStrain)
       Tloading = -1;
       if (Cstrain > TmaxStrain)
          TmaxStrain = Cstrain;
-      TshiftN = 1 + a1*pow((TmaxStrain-TminStrain)/(2.0*a2*epsy),0.8);
+      TshiftN = 1 + params->a1*pow((TmaxStrain-TminStrain)/(2.0*params->a2*epsy),0.8);
    }
 
    // Transition from unloading to loading, i.e. negative strain increment
@@ -260,7 +289,7 @@ void Steel01::detectLoadReversal (double dStrain)
       Tloading = 1;
       if (Cstrain < TminStrain)
          TminStrain = Cstrain;
-      TshiftP = 1 + a3*pow((TmaxStrain-TminStrain)/(2.0*a4*epsy),0.8);
+      TshiftP = 1 + params->a3*pow((TmaxStrain-TminStrain)/(2.0*params->a4*epsy),0.8);
    }
 }
 
@@ -331,11 +360,11 @@ int Steel01::revertToStart ()
    // State variables
    Cstrain = 0.0;
    Cstress = 0.0;
-   Ctangent = E0;
+   Ctangent = params->E0;
 
    Tstrain = 0.0;
    Tstress = 0.0;
-   Ttangent = E0;
+   Ttangent = params->E0;
 
 // AddingSensitivity:BEGIN /////////////////////////////////
 	if (SHVs != 0) 
@@ -347,8 +376,7 @@ int Steel01::revertToStart ()
 
 UniaxialMaterial* Steel01::getCopy ()
 {
-   Steel01* theCopy = new Steel01(this->getTag(), fy, E0, b,
-				  a1, a2, a3, a4);
+   Steel01* theCopy = new Steel01(this->getTag(), *params);
 
    // Converged history variables
    theCopy->CminStrain = CminStrain;
@@ -384,13 +412,13 @@ int Steel01::sendSelf (int commitTag, Channel& theChannel)
    data(0) = this->getTag();
 
    // Material properties
-   data(1) = fy;
-   data(2) = E0;
-   data(3) = b;
-   data(4) = a1;
-   data(5) = a2;
-   data(6) = a3;
-   data(7) = a4;
+   data(1) = params->fy;
+   data(2) = params->E0;
+   data(3) = params->b;
+   data(4) = params->a1;
+   data(5) = params->a2;
+   data(6) = params->a3;
+   data(7) = params->a4;
 
    // History variables from last converged state
    data(8) = CminStrain;
@@ -429,13 +457,14 @@ int Steel01::recvSelf (int commitTag, Channel& theChannel,
       this->setTag(int(data(0)));
 
       // Material properties
-      fy = data(1);
-      E0 = data(2);
-      b = data(3);
-      a1 = data(4);
-      a2 = data(5);
-      a3 = data(6);
-      a4 = data(7);
+      unshareParameterBlock(params);
+      params->fy = data(1);
+      params->E0 = data(2);
+      params->b = data(3);
+      params->a1 = data(4);
+      params->a2 = data(5);
+      params->a3 = data(6);
+      params->a4 = data(7);
 
       // History variables from last converged state
       CminStrain = data(8);
@@ -469,13 +498,13 @@ int Steel01::recvSelf (int commitTag, Channel& theChannel,
 void Steel01::Print (OPS_Stream& s, int flag)
 {
    s << "Steel01 tag: " << this->getTag() << endln;
-   s << "  fy: " << fy << " ";
-   s << "  E0: " << E0 << " ";
-   s << "  b:  " << b << " ";
-   s << "  a1: " << a1 << " ";
-   s << "  a2: " << a2 << " ";
-   s << "  a3: " << a3 << " ";
-   s << "  a4: " << a4 << " ";
+   s << "  fy: " << params->fy << " ";
+   s << "  E0: " << params->E0 << " ";
+   s << "  b:  " << params->b << " ";
+   s << "  a1: " << params->a1 << " ";
+   s << "  a2: " << params->a2 << " ";
+   s << "  a3: " << params->a3 << " ";
+   s << "  a4: " << params->a4 << " ";
 }
 
 
@@ -515,35 +544,38 @@ Steel01::setParameter(const char **argv, int argc, Parameter &param)
 int
 Steel01::updateParameter(int parameterID, Information &info)
 {
+	if (parameterID >= 1 && parameterID <= 7)
+		unshareParameterBlock(params);
+
 	switch (parameterID) {
 	case -1:
 		return -1;
 	case 1:
-		this->fy = info.theDouble;
+		params->fy = info.theDouble;
 		break;
 	case 2:
-		this->E0 = info.theDouble;
+		params->E0 = info.theDouble;
 		break;
 	case 3:
-		this->b = info.theDouble;
+		params->b = info.theDouble;
 		break;
 	case 4:
-		this->a1 = info.theDouble;
+		params->a1 = info.theDouble;
 		break;
 	case 5:
-		this->a2 = info.theDouble;
+		params->a2 = info.theDouble;
 		break;
 	case 6:
-		this->a3 = info.theDouble;
+		params->a3 = info.theDouble;
 		break;
 	case 7:
-		this->a4 = info.theDouble;
+		params->a4 = info.theDouble;
 		break;
 	default:
 		return -1;
 	}
 
-	Ttangent = E0;          // Initial stiffness
+	Ttangent = params->E0;          // Initial stiffness
 
 	return 0;
 }
@@ -595,9 +627,9 @@ Steel01::getStressSensitivity(int gradIndex, bool conditional)
 	// Compute min and max stress
 	double Tstress;
 	double dStrain = Tstrain-Cstrain;
-	double sigmaElastic = Cstress + E0*dStrain;
-	double fyOneMinusB = fy * (1.0 - b);
-	double Esh = b*E0;
+	double sigmaElastic = Cstress + params->E0*dStrain;
+	double fyOneMinusB = params->fy * (1.0 - params->b);
+	double Esh = params->b*params->E0;
 	double c1 = Esh*Tstrain;
 	double c2 = TshiftN*fyOneMinusB;
 	double c3 = TshiftP*fyOneMinusB;
@@ -608,20 +640,20 @@ Steel01::getStressSensitivity(int gradIndex, bool conditional)
 	// Evaluate stress sensitivity 
 	if ( (sigmaMax < sigmaElastic) && (fabs(sigmaMax-sigmaElastic)>1e-5) ) {
 		Tstress = sigmaMax;
-		gradient = E0Sensitivity*b*Tstrain 
-				 + E0*bSensitivity*Tstrain
-				 + TshiftP*(fySensitivity*(1-b)-fy*bSensitivity);
+		gradient = E0Sensitivity*params->b*Tstrain 
+				 + params->E0*bSensitivity*Tstrain
+				 + TshiftP*(fySensitivity*(1-params->b)-params->fy*bSensitivity);
 	}
 	else {
 		Tstress = sigmaElastic;
 		gradient = CstressSensitivity 
 			     + E0Sensitivity*(Tstrain-Cstrain)
-				 - E0*CstrainSensitivity;
+				 - params->E0*CstrainSensitivity;
 	}
 	if (sigmaMin > Tstress) {
-		gradient = E0Sensitivity*b*Tstrain
-			     + E0*bSensitivity*Tstrain
-				 - TshiftN*(fySensitivity*(1-b)-fy*bSensitivity);
+		gradient = E0Sensitivity*params->b*Tstrain
+			     + params->E0*bSensitivity*Tstrain
+				 - TshiftN*(fySensitivity*(1-params->b)-params->fy*bSensitivity);
 	}
 
 	return gradient;
@@ -682,9 +714,9 @@ Steel01::commitSensitivity(double TstrainSensitivity, int gradIndex, int numGrad
 	// Compute min and max stress
 	double Tstress;
 	double dStrain = Tstrain-Cstrain;
-	double sigmaElastic = Cstress + E0*dStrain;
-	double fyOneMinusB = fy * (1.0 - b);
-	double Esh = b*E0;
+	double sigmaElastic = Cstress + params->E0*dStrain;
+	double fyOneMinusB = params->fy * (1.0 - params->b);
+	double Esh = params->b*params->E0;
 	double c1 = Esh*Tstrain;
 	double c2 = TshiftN*fyOneMinusB;
 	double c3 = TshiftP*fyOneMinusB;
@@ -695,22 +727,22 @@ Steel01::commitSensitivity(double TstrainSensitivity, int gradIndex, int numGrad
 	// Evaluate stress sensitivity ('gradient')
 	if ( (sigmaMax < sigmaElastic) && (fabs(sigmaMax-sigmaElastic)>1e-5) ) {
 		Tstress = sigmaMax;
-		gradient = E0Sensitivity*b*Tstrain 
-				 + E0*bSensitivity*Tstrain
-				 + E0*b*TstrainSensitivity
-				 + TshiftP*(fySensitivity*(1-b)-fy*bSensitivity);
+		gradient = E0Sensitivity*params->b*Tstrain 
+				 + params->E0*bSensitivity*Tstrain
+				 + params->E0*params->b*TstrainSensitivity
+				 + TshiftP*(fySensitivity*(1-params->b)-params->fy*bSensitivity);
 	}
 	else {
 		Tstress = sigmaElastic;
 		gradient = CstressSensitivity 
 			     + E0Sensitivity*(Tstrain-Cstrain)
-				 + E0*(TstrainSensitivity-CstrainSensitivity);
+				 + params->E0*(TstrainSensitivity-CstrainSensitivity);
 	}
 	if (sigmaMin > Tstress) {
-		gradient = E0Sensitivity*b*Tstrain
-			     + E0*bSensitivity*Tstrain
-			     + E0*b*TstrainSensitivity
-				 - TshiftN*(fySensitivity*(1-b)-fy*bSensitivity);
+		gradient = E0Sensitivity*params->b*Tstrain
+			     + params->E0*bSensitivity*Tstrain
+			     + params->E0*params->b*TstrainSensitivity
+				 - TshiftN*(fySensitivity*(1-params->b)-params->fy*bSensitivity);
 	}
 
 
@@ -39,6 +39,7 @@
 
 
 #include <UniaxialMaterial.h>
+#include <MaterialParameterBlock.h>
 
 // Default values for isotropic hardening parameters a1, a2, a3, and a4
 #define STEEL_01_DEFAULT_A1        0.0
@@ -46,6 +47,19 @@
 #define STEEL_01_DEFAULT_A3        0.0
 #define STEEL_01_DEFAULT_A4       55.0
 
+// fixed material properties, shared by the copies of a Steel01 object
+class Steel01Parameters : public MaterialParameterBlock
+{
+  public:
+    double fy;  // Yield stress
+    double E0;  // Initial stiffness
+    double b;   // Hardening ratio (b = Esh/E0)
+    double a1;
+    double a2;
+    double a3;
+    double a4;  // a1 through a4 are coefficients for isotropic hardening
+};
+
 class Steel01 : public UniaxialMaterial
 {
   public:
@@ -62,7 +76,7 @@ class Steel01 : public UniaxialMaterial
     double getStrain(void);              
     double getStress(void);
     double getTangent(void);
-    double getInitialTangent(void) {return E0;};
+    double getInitialTangent(void) {return params->E0;};
 
     int commitState(void);
     int revertToLastCommit(void);    
@@ -88,14 +102,8 @@ class Steel01 : public UniaxialMaterial
  protected:
     
  private:
-    /*** Material Properties ***/
-    double fy;  // Yield stress
-    double E0;  // Initial stiffness
-    double b;   // Hardening ratio (b = Esh/E0)
-    double a1;
-    double a2;
-    double a3;
-    double a4;  // a1 through a4 are coefficients for isotropic hardening
+    /*** Material Properties, shared with copies ***/
+    Steel01Parameters *params;
     
     /*** CONVERGED History Variables ***/
     double CminStrain;  // Minimum strain in compression
@@ -131,6 +139,8 @@ class Steel01 : public UniaxialMaterial
     // Determines if a load reversal has occurred based on the trial strain
     void detectLoadReversal (double dStrain);
 
+    Steel01(int tag, Steel01Parameters &theParams);
+
 // AddingSensitivity:BEGIN //////////////////////////////////////////
     int parameterID;
 	Matrix *SHVs;
@@ -45,20 +45,31 @@ Steel02::Steel02(int tag,
 		 double _Fy, double _E0, double _b,
 		 double _R0, double _cR1, double _cR2,
 		 double _a1, double _a2, double _a3, double _a4, double sigInit):
-  UniaxialMaterial(tag, MAT_TAG_Steel02),
-  Fy(_Fy), E0(_E0), b(_b), R0(_R0), cR1(_cR1), cR2(_cR2), a1(_a1), a2(_a2), a3(_a3), a4(_a4), 
-  sigini(sigInit)
+  UniaxialMaterial(tag, MAT_TAG_Steel02), params(0)
 {
+  params = new Steel02Parameters;
+  params->Fy = _Fy;
+  params->E0 = _E0;
+  params->b = _b;
+  params->R0 = _R0;
+  params->cR1 = _cR1;
+  params->cR2 = _cR2;
+  params->a1 = _a1;
+  params->a2 = _a2;
+  params->a3 = _a3;
+  params->a4 = _a4;
+  params->sigini = sigInit;
+
   konP = 0;
   kon = 0;
-  eP = E0;
+  eP = params->E0;
   epsP = 0.0;
   sigP = 0.0;
   sig = 0.0;
   eps = 0.0;
-  e = E0;
+  e = params->E0;
 
-  epsmaxP = Fy/E0;
+  epsmaxP = params->Fy/params->E0;
   epsminP = -epsmaxP;
   epsplP = 0.0;
   epss0P = 0.0;
@@ -66,34 +77,42 @@ Steel02::Steel02(int tag,
   epssrP = 0.0;
   sigsrP = 0.0;
 
-  if (sigini != 0.0) {
-    epsP = sigini/E0;
-    sigP = sigini;
+  if (params->sigini != 0.0) {
+    epsP = params->sigini/params->E0;
+    sigP = params->sigini;
   } 
 }
 
 Steel02::Steel02(int tag,
 		 double _Fy, double _E0, double _b,
 		 double _R0, double _cR1, double _cR2):
-  UniaxialMaterial(tag, MAT_TAG_Steel02),
-  Fy(_Fy), E0(_E0), b(_b), R0(_R0), cR1(_cR1), cR2(_cR2), sigini(0.0)
+  UniaxialMaterial(tag, MAT_TAG_Steel02), params(0)
 {
+  params = new Steel02Parameters;
+  params->Fy = _Fy;
+  params->E0 = _E0;
+  params->b = _b;
+  params->R0 = _R0;
+  params->cR1 = _cR1;
+  params->cR2 = _cR2;
+  params->sigini = 0.0;
+
   konP = 0;
 
   // Default values for no isotropic hardening
-  a1 = 0.0;
-  a2 = 1.0;
-  a3 = 0.0;
-  a4 = 1.0;
+  params->a1 = 0.0;
+  params->a2 = 1.0;
+  params->a3 = 0.0;
+  params->a4 = 1.0;
 
-  eP = E0;
+  eP = params->E0;
   epsP = 0.0;
   sigP = 0.0;
   sig = 0.0;
   eps = 0.0;
-  e = E0;
+  e = params->E0;
 
-  epsmaxP = Fy/E0;
+  epsmaxP = params->Fy/params->E0;
   epsminP = -epsmaxP;
   epsplP = 0.0;
   epss0P = 0.0;
@@ -103,30 +122,35 @@ Steel02::Steel02(int tag,
 }
 
 Steel02::Steel02(int tag, double _Fy, double _E0, double _b):
-  UniaxialMaterial(tag, MAT_TAG_Steel02),
-  Fy(_Fy), E0(_E0), b(_b), sigini(0.0)
+  UniaxialMaterial(tag, MAT_TAG_Steel02), params(0)
 {
+  params = new Steel02Parameters;
+  params->Fy = _Fy;
+  params->E0 = _E0;
+  params->b = _b;
+  params->sigini = 0.0;
+
   konP = 0;
 
   // Default values for elastic to hardening transitions
-  R0 = 15.0;
-  cR1 = 0.925;
-  cR2 = 0.15;
+  params->R0 = 15.0;
+  params->cR1 = 0.925;
+  params->cR2 = 0.15;
 
   // Default values for no isotropic hardening
-  a1 = 0.0;
-  a2 = 1.0;
-  a3 = 0.0;
-  a4 = 1.0;
+  params->a1 = 0.0;
+  params->a2 = 1.0;
+  params->a3 = 0.0;
+  params->a4 = 1.0;
 
-  eP = E0;
+  eP = params->E0;
   epsP = 0.0;
   sigP = 0.0;
   sig = 0.0;
   eps = 0.0;
-  e = E0;
+  e = params->E0;
 
-  epsmaxP = Fy/E0;
+  epsmaxP = params->Fy/params->E0;
   epsminP = -epsmaxP;
   epsplP = 0.0;
   epss0P = 0.0;
@@ -136,20 +160,43 @@ Steel02::Steel02(int tag, double _Fy, double _E0, double _b):
 }
 
 Steel02::Steel02(void):
-  UniaxialMaterial(0, MAT_TAG_Steel02)
+  UniaxialMaterial(0, MAT_TAG_Steel02), params(0)
 {
+  params = new Steel02Parameters;
+  params->Fy = 0.0;
+  params->E0 = 0.0;
+  params->b = 0.0;
+  params->R0 = 0.0;
+  params->cR1 = 0.0;
+  params->cR2 = 0.0;
+  params->a1 = 0.0;
+  params->a2 = 0.0;
+  params->a3 = 0.0;
+  params->a4 = 0.0;
+  params->sigini = 0.0;
+
   konP = 0;
 }
 
+// constructor used by getCopy(), the copy shares the material properties
+Steel02::Steel02(int tag, Steel02Parameters &theParams):
+  UniaxialMaterial(tag, MAT_TAG_Steel02), params(&theParams)
+{
+  params->attach();
+
+  kon = 0;
+  this->revertToStart();
+}
+
 Steel02::~Steel02(void)
 {
-  // Does nothing
+  params->detach();
 }
 
 UniaxialMaterial*
 Steel02::getCopy(void)
 {
-  Steel02 *theCopy = new Steel02(this->getTag(), Fy, E0, b, R0, cR1, cR2, a1, a2, a3, a4, sigini);
+  Steel02 *theCopy = new Steel02(this->getTag(), *params);
   
   return theCopy;
 }
@@ -157,18 +204,18 @@ Steel02::getCopy(void)
 double
 Steel02::getInitialTangent(void)
 {
-  return E0;
+  return params->E0;
 }
 
 int
 Steel02::setTrialStrain(double trialStrain, double strainRate)
 {
-  double Esh = b * E0;
-  double epsy = Fy / E0;
+  double Esh = params->b * params->E0;
+  double epsy = params->Fy / params->E0;
 
   // modified C-P. Lamarche 2006
-  if (sigini != 0.0) {
-    double epsini = sigini/E0;
+  if (params->sigini != 0.0) {
+    double epsini = params->sigini/params->E0;
     eps = trialStrain+epsini;
   } else
     eps = trialStrain;
@@ -190,8 +237,8 @@ Steel02::setTrialStrain(double trialStrain, double strainRate)
 
     if (fabs(deps) < 10.0*DBL_EPSILON) {
 
-      e = E0;
-      sig = sigini;                // modified C-P. Lamarche 2006
+      e = params->E0;
+      sig = params->sigini;                // modified C-P. Lamarche 2006
       kon = 3;                     // modified C-P. Lamarche 2006 flag to impose initial stess/strain
       return 0;
 
@@ -202,12 +249,12 @@ Steel02::setTrialStrain(double trialStrain, double strainRate)
       if (deps < 0.0) {
 	kon = 2;
 	epss0 = epsmin;
-	sigs0 = -Fy;
+	sigs0 = -params->Fy;
 	epspl = epsmin;
       } else {
 	kon = 1;
 	epss0 = epsmax;
-	sigs0 = Fy;
+	sigs0 = params->Fy;
 	epspl = epsmax;
       }
     }
@@ -230,10 +277,10 @@ Steel02::setTrialStrain(double trialStrain, double strainRate)
     //epsmin = min(epsP, epsmin);
     if (epsP < epsmin)
       epsmin = epsP;
-    double d1 = (epsmax - epsmin) / (2.0*(a4 * epsy));
-    double shft = 1.0 + a3 * pow(d1, 0.8);
-    epss0 = (Fy * shft - Esh * epsy * shft - sigr + E0 * epsr) / (E0 - Esh);
-    sigs0 = Fy * shft + Esh * (epss0 - epsy * shft);
+    double d1 = (epsmax - epsmin) / (2.0*(params->a4 * epsy));
+    double shft = 1.0 + params->a3 * pow(d1, 0.8);
+    epss0 = (params->Fy * shft - Esh * epsy * shft - sigr + params->E0 * epsr) / (params->E0 - Esh);
+    sigs0 = params->Fy * shft + Esh * (epss0 - epsy * shft);
     epspl = epsmax;
 
   } else if (kon == 1 && deps < 0.0) {
@@ -252,10 +299,10 @@ Steel02::setTrialStrain(double trialStrain, double strainRate)
     if (epsP > epsmax)
       epsmax = epsP;
     
-    double d1 = (epsmax - epsmin) / (2.0*(a2 * epsy));
-    double shft = 1.0 + a1 * pow(d1, 0.8);
-    epss0 = (-Fy * shft + Esh * epsy * shft - sigr + E0 * epsr) / (E0 - Esh);
-    sigs0 = -Fy * shft + Esh * (epss0 + epsy * shft);
+    double d1 = (epsmax - epsmin) / (2.0*(params->a2 * epsy));
+    double shft = 1.0 + params->a1 * pow(d1, 0.8);
+    epss0 = (-params->Fy * shft + Esh * epsy * shft - sigr + params->E0 * epsr) / (params->E0 - Esh);
+    sigs0 = -params->Fy * shft + Esh * (epss0 + epsy * shft);
     epspl = epsmin;
   }
 
@@ -263,15 +310,15 @@ Steel02::setTrialStrain(double trialStrain, double strainRate)
   // calculate current stress sig and tangent modulus E 
 
   double xi     = fabs((epspl-epss0)/epsy);
-  double R      = R0*(1.0 - (cR1*xi)/(cR2+xi));
+  double R      = params->R0*(1.0 - (params->cR1*xi)/(params->cR2+xi));
   double epsrat = (eps-epsr)/(epss0-epsr);
   double dum1  = 1.0 + pow(fabs(epsrat),R);
   double dum2  = pow(dum1,(1/R));
 
-  sig   = b*epsrat +(1.0-b)*epsrat/dum2;
+  sig   = params->b*epsrat +(1.0-params->b)*epsrat/dum2;
   sig   = sig*(sigs0-sigr)+sigr;
 
-  e = b + (1.0-b)/(dum1*dum2);
+  e = params->b + (1.0-params->b)/(dum1*dum2);
   e = e*(sigs0-sigr)/(epss0-epsr);
 
   return 0;
@@ -337,15 +384,15 @@ Steel02::revertToLastCommit(void)
 int 
 Steel02::revertToStart(void)
 {
-  eP = E0;
+  eP = params->E0;
   epsP = 0.0;
   sigP = 0.0;
   sig = 0.0;
   eps = 0.0;
-  e = E0;  
+  e = params->E0;  
 
   konP = 0;
-  epsmaxP = Fy/E0;
+  epsmaxP = params->Fy/params->E0;
   epsminP = -epsmaxP;
   epsplP = 0.0;
   epss0P = 0.0;
@@ -353,9 +400,9 @@ Steel02::revertToStart(void)
   epssrP = 0.0;
   sigsrP = 0.0;
 
-  if (sigini != 0.0) {
-	  epsP = sigini/E0;
-	  sigP = sigini;
+  if (params->sigini != 0.0) {
+	  epsP = params->sigini/params->E0;
+	  sigP = params->sigini;
    } 
 
   return 0;
@@ -365,16 +412,16 @@ int
 Steel02::sendSelf(int commitTag, Channel &theChannel)
 {
   static Vector data(23);
-  data(0) = Fy;
-  data(1) = E0;
-  data(2) = b;
-  data(3) = R0;
-  data(4) = cR1;
-  data(5) = cR2;
-  data(6) = a1;
-  data(7) = a2;
-  data(8) = a3;
-  data(9) = a4;
+  data(0) = params->Fy;
+  data(1) = params->E0;
+  data(2) = params->b;
+  data(3) = params->R0;
+  data(4) = params->cR1;
+  data(5) = params->cR2;
+  data(6) = params->a1;
+  data(7) = params->a2;
+  data(8) = params->a3;
+  data(9) = params->a4;
   data(10) = epsminP;
   data(11) = epsmaxP;
   data(12) = epsplP;
@@ -387,7 +434,7 @@ Steel02::sendSelf(int commitTag, Channel &theChannel)
   data(19) = sigP;  
   data(20) = eP;    
   data(21) = this->getTag();
-  data(22) = sigini;
+  data(22) = params->sigini;
 
   if (theChannel.sendVector(this->getDbTag(), commitTag, data) < 0) {
     opserr << "Steel02::sendSelf() - failed to sendSelf\n";
@@ -407,16 +454,17 @@ Steel02::recvSelf(int commitTag, Channel &theChannel,
     return -1;
   }
 
-  Fy = data(0);
-  E0 = data(1);
-  b = data(2); 
-  R0 = data(3);
-  cR1 = data(4);
-  cR2 = data(5);
-  a1 = data(6); 
-  a2 = data(7); 
-  a3 = data(8); 
-  a4 = data(9); 
+  unshareParameterBlock(params);
+  params->Fy = data(0);
+  params->E0 = data(1);
+  params->b = data(2); 
+  params->R0 = data(3);
+  params->cR1 = data(4);
+  params->cR2 = data(5);
+  params->a1 = data(6); 
+  params->a2 = data(7); 
+  params->a3 = data(8); 
+  params->a4 = data(9); 
   epsminP = data(10);
   epsmaxP = data(11);
   epsplP = data(12); 
@@ -429,7 +477,7 @@ Steel02::recvSelf(int commitTag, Channel &theChannel,
   sigP = data(19);   
   eP   = data(20);   
   this->setTag(data(21));
-  sigini = data(22);
+  params->sigini = data(22);
 
   e = eP;
   sig = sigP;
@@ -65,6 +65,10 @@ void OPS_clearAllUniaxialMaterial(void) {
   theUniaxialMaterialObjects.clearAll();
 }
 
+TaggedObjectIter &OPS_getAllUniaxialMaterial(void) {
+  return theUniaxialMaterialObjects.getComponents();
+}
+
 
 UniaxialMaterial::UniaxialMaterial(int tag, int clasTag)
 :Material(tag,clasTag)
@@ -48,6 +48,7 @@ class Information;
 class Response;
 
 class SectionForceDeformation;
+class TaggedObjectIter;
 
 class UniaxialMaterial : public Material
 {
@@ -94,6 +95,7 @@ class UniaxialMaterial : public Material
 extern bool OPS_addUniaxialMaterial(UniaxialMaterial *newComponent);
 extern UniaxialMaterial *OPS_getUniaxialMaterial(int tag);
 extern void OPS_clearAllUniaxialMaterial(void);
+extern TaggedObjectIter &OPS_getAllUniaxialMaterial(void);
 
 #endif
 
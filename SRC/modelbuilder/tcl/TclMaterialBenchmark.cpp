@@ -0,0 +1,464 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// Description: This file contains the implementation of the 
+// TclMaterialBenchmark class and its benchmarkMaterials command:
+//
+//   benchmarkMaterials <-uniaxial> <-nD> <-section> <-tag tag?> 
+//                      <-cycles numCycles?> <-steps numStepsPerCycle?>
+//                      <-strain amplitude?> <-sectionStrain amplitude?>
+//                      <-nDType type?> <-repeat numRepeat?> <-file fileName?>
+//
+// If none of -uniaxial, -nD and -section are given all three are run, -tag
+// (which may be repeated) restricts the run to the objects with those tags.
+// Each object is copied and the copy is taken through numCycles sinusoidal
+// cycles of numStepsPerCycle steps each, the amplitude growing linearly to
+// the given amplitude (default 0.01, 0.001 for sections); nD materials are
+// copied with getCopy(nDType) and strained along a fixed proportional path.
+// At each step setTrial..(), get..() and commitState() are invoked. The
+// fastest of numRepeat (default 3) runs is reported, one line per object:
+//
+//   kind tag classType numSteps nsPerStep allocsPerStep checksum
+//
+// to the file if given, opserr otherwise; the same lines are returned as a
+// Tcl list. allocsPerStep is the number of calls to operator new per step, 
+// counted only when built with _COUNT_ALLOCATIONS (which replaces the global
+// operator new and delete), -1 otherwise. checksum is the sum of the first
+// stress (resultant) component over the history and changes only if the
+// response of the model changes.
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+
+#ifdef _WIN32
+#include <time.h>
+#else
+#include <sys/time.h>
+#endif
+
+#include <Vector.h>
+#include <ID.h>
+#include <TaggedObject.h>
+#include <TaggedObjectIter.h>
+#include <UniaxialMaterial.h>
+#include <NDMaterial.h>
+#include <SectionForceDeformation.h>
+#include <TclMaterialBenchmark.h>
+
+#ifdef _COUNT_ALLOCATIONS
+#include <new>
+
+static bool countAllocations = false;
+static long numAllocations = 0;
+
+void *
+operator new(size_t size)
+{
+  if (countAllocations == true)
+    numAllocations++;
+  void *p = malloc(size > 0 ? size : 1);
+  if (p == 0)
+    throw std::bad_alloc();
+  return p;
+}
+
+void
+operator delete(void *p) throw()
+{
+  free(p);
+}
+#endif
+
+//
+// SOME STATIC POINTERS USED IN THE FUNCTIONS INVOKED BY THE INTERPRETER
+//
+
+static TclMaterialBenchmark *theTclBuilder =0;
+
+// 
+// THE PROTOTYPES OF THE FUNCTIONS INVOKED BY THE INTERPRETER
+//
+
+int  TclMaterialBenchmark_benchmarkMaterials(ClientData clientData, Tcl_Interp *interp, 
+					     int argc, TCL_Char **argv);
+
+//
+// CLASS CONSTRUCTOR & DESTRUCTOR
+//
+
+// constructor: the constructor will add certain commands to the interpreter
+TclMaterialBenchmark::TclMaterialBenchmark(Domain &theDomain, Tcl_Interp *interp, int ndm, int ndf)
+  :TclModelBuilder(theDomain, interp, ndm, ndf), theInterp(interp)
+{
+  Tcl_CreateCommand(interp, "benchmarkMaterials", TclMaterialBenchmark_benchmarkMaterials,
+		    (ClientData)NULL, NULL);
+
+  // set the static pointers in this file
+  theTclBuilder = this;
+}
+
+TclMaterialBenchmark::~TclMaterialBenchmark()
+{
+  theTclBuilder =0;
+
+  Tcl_DeleteCommand(theInterp, "benchmarkMaterials");
+}
+
+
+//
+// THE BENCHMARK LOOPS
+//
+
+struct MaterialBenchmarkResult {
+  double nsPerStep;
+  double allocsPerStep;
+  double checksum;
+};
+
+static double
+getBenchmarkTime(void)
+{
+#ifdef _WIN32
+  return (double)clock()/CLOCKS_PER_SEC;
+#else
+  struct timeval tp;
+  gettimeofday(&tp, 0);
+  return tp.tv_sec + 1.0e-6*tp.tv_usec;
+#endif
+}
+
+static void
+startBenchmarkRun(double &startTime)
+{
+#ifdef _COUNT_ALLOCATIONS
+  numAllocations = 0;
+  countAllocations = true;
+#endif
+  startTime = getBenchmarkTime();
+}
+
+static void
+endBenchmarkRun(double startTime, int numSteps, double checksum, int run, 
+		MaterialBenchmarkResult &result)
+{
+  double ns = (getBenchmarkTime() - startTime)*1.0e9/numSteps;
+
+#ifdef _COUNT_ALLOCATIONS
+  countAllocations = false;
+  double allocs = (double)numAllocations/numSteps;
+#else
+  double allocs = -1.0;
+#endif
+
+  if (run == 0 || ns < result.nsPerStep)
+    result.nsPerStep = ns;
+  result.allocsPerStep = allocs;
+  result.checksum = checksum;
+}
+
+static int
+benchmarkUniaxialMaterial(UniaxialMaterial &theOrig, const double *history, int numSteps,
+			  double amplitude, int numRepeat, MaterialBenchmarkResult &result)
+{
+  UniaxialMaterial *theMaterial = theOrig.getCopy();
+  if (theMaterial == 0)
+    return -1;
+
+  for (int run=0; run<numRepeat; run++) {
+    theMaterial->revertToStart();
+
+    double checksum = 0.0;
+    double startTime;
+    startBenchmarkRun(startTime);
+    for (int i=0; i<numSteps; i++) {
+      theMaterial->setTrialStrain(amplitude*history[i]);
+      checksum += theMaterial->getStress();
+      theMaterial->commitState();
+    }
+    endBenchmarkRun(startTime, numSteps, checksum, run, result);
+  }
+
+  delete theMaterial;
+  return 0;
+}
+
+static int
+benchmarkNDMaterial(NDMaterial &theOrig, const char *type, const double *history, int numSteps,
+		    double amplitude, int numRepeat, MaterialBenchmarkResult &result)
+{
+  NDMaterial *theMaterial = theOrig.getCopy(type);
+  if (theMaterial == 0)
+    return -1;
+
+  // a fixed proportional strain path, dominated by the first component
+  int order = theMaterial->getStrain().Size();
+  if (order < 1) {
+    delete theMaterial;
+    return -1;
+  }
+  Vector shape(order);
+  Vector strain(order);
+  shape(0) = 1.0;
+  for (int j=1; j<order; j++)
+    shape(j) = (j%2 == 1) ? -0.5/j : 0.5/j;
+
+  for (int run=0; run<numRepeat; run++) {
+    theMaterial->revertToStart();
+
+    double checksum = 0.0;
+    double startTime;
+    startBenchmarkRun(startTime);
+    for (int i=0; i<numSteps; i++) {
+      strain.addVector(0.0, shape, amplitude*history[i]);
+      theMaterial->setTrialStrain(strain);
+      checksum += theMaterial->getStress()(0);
+      theMaterial->commitState();
+    }
+    endBenchmarkRun(startTime, numSteps, checksum, run, result);
+  }
+
+  delete theMaterial;
+  return 0;
+}
+
+static int
+benchmarkSection(SectionForceDeformation &theOrig, const double *history, int numSteps,
+		 double amplitude, int numRepeat, MaterialBenchmarkResult &result)
+{
+  SectionForceDeformation *theSection = theOrig.getCopy();
+  if (theSection == 0)
+    return -1;
+
+  // axial and shear deformations an order of magnitude below the curvatures
+  int order = theSection->getOrder();
+  const ID &code = theSection->getType();
+  Vector shape(order);
+  Vector deformation(order);
+  for (int j=0; j<order; j++) {
+    if (code(j) == SECTION_RESPONSE_MZ)
+      shape(j) = 1.0;
+    else if (code(j) == SECTION_RESPONSE_MY)
+      shape(j) = 0.5;
+    else
+      shape(j) = 0.1;
+  }
+
+  for (int run=0; run<numRepeat; run++) {
+    theSection->revertToStart();
+
+    double checksum = 0.0;
+    double startTime;
+    startBenchmarkRun(startTime);
+    for (int i=0; i<numSteps; i++) {
+      deformation.addVector(0.0, shape, amplitude*history[i]);
+      theSection->setTrialSectionDeformation(deformation);
+      checksum += theSection->getStressResultant()(0);
+      theSection->commitState();
+    }
+    endBenchmarkRun(startTime, numSteps, checksum, run, result);
+  }
+
+  delete theSection;
+  return 0;
+}
+
+static void
+reportMaterialBenchmark(Tcl_Interp *interp, FILE *theFile, const char *kind, 
+			TaggedObject &theObject, const char *classType, int numSteps,
+			MaterialBenchmarkResult &result)
+{
+  char buffer[256];
+  sprintf(buffer, "%s %d %s %d %.2f %.2f %.10e", kind, theObject.getTag(), classType, numSteps,
+	  result.nsPerStep, result.allocsPerStep, result.checksum);
+
+  if (theFile != 0)
+    fprintf(theFile, "%s\n", buffer);
+  else
+    opserr << buffer << endln;
+
+  Tcl_AppendElement(interp, buffer);
+}
+
+
+//
+// THE FUNCTIONS INVOKED BY THE INTERPRETER
+//
+
+int
+TclMaterialBenchmark_benchmarkMaterials(ClientData clientData, Tcl_Interp *interp, int argc,   
+					TCL_Char **argv)
+{
+  // ensure the destructor has not been called - 
+  if (theTclBuilder == 0) {
+    Tcl_SetResult(interp, "WARNING builder has been destroyed", TCL_STATIC);
+    return TCL_ERROR;
+  }
+
+  bool doUniaxial = false;
+  bool doND = false;
+  bool doSection = false;
+  int numCycles = 10;
+  int numStepsPerCycle = 100;
+  int numRepeat = 3;
+  double strainAmplitude = 0.01;
+  double sectionAmplitude = 0.001;
+  const char *nDType = "ThreeDimensional";
+  const char *fileName = 0;
+  ID tags(0, 8);
+  int numTags = 0;
+
+  int argi = 1;
+  while (argi < argc) {
+    TCL_Char *option = argv[argi];
+    if (strcmp(option,"-uniaxial") == 0) {
+      doUniaxial = true;
+      argi++;
+      continue;
+    } else if (strcmp(option,"-nD") == 0 || strcmp(option,"-nd") == 0) {
+      doND = true;
+      argi++;
+      continue;
+    } else if (strcmp(option,"-section") == 0) {
+      doSection = true;
+      argi++;
+      continue;
+    }
+
+    if (argi+1 >= argc) {
+      opserr << "WARNING benchmarkMaterials - missing value for option " << option << endln;
+      return TCL_ERROR;
+    }
+    TCL_Char *value = argv[argi+1];
+    int ok = TCL_OK;
+
+    if (strcmp(option,"-tag") == 0) {
+      int tag;
+      ok = Tcl_GetInt(interp, value, &tag);
+      tags[numTags++] = tag;
+    } else if (strcmp(option,"-cycles") == 0) {
+      ok = Tcl_GetInt(interp, value, &numCycles);
+      if (numCycles < 1) ok = TCL_ERROR;
+    } else if (strcmp(option,"-steps") == 0) {
+      ok = Tcl_GetInt(interp, value, &numStepsPerCycle);
+      if (numStepsPerCycle < 1) ok = TCL_ERROR;
+    } else if (strcmp(option,"-repeat") == 0) {
+      ok = Tcl_GetInt(interp, value, &numRepeat);
+      if (numRepeat < 1) ok = TCL_ERROR;
+    } else if (strcmp(option,"-strain") == 0) {
+      ok = Tcl_GetDouble(interp, value, &strainAmplitude);
+    } else if (strcmp(option,"-sectionStrain") == 0) {
+      ok = Tcl_GetDouble(interp, value, &sectionAmplitude);
+    } else if (strcmp(option,"-nDType") == 0) {
+      nDType = value;
+    } else if (strcmp(option,"-file") == 0) {
+      fileName = value;
+    } else {
+      opserr << "WARNING benchmarkMaterials - unknown option " << option << endln;
+      return TCL_ERROR;
+    }
+
+    if (ok != TCL_OK) {
+      opserr << "WARNING benchmarkMaterials - invalid value " << value;
+      opserr << " for option " << option << endln;
+      return TCL_ERROR;
+    }
+    argi += 2;
+  }
+
+  if (doUniaxial == false && doND == false && doSection == false)
+    doUniaxial = doND = doSection = true;
+
+  FILE *theFile = 0;
+  if (fileName != 0) {
+    theFile = fopen(fileName, "w");
+    if (theFile == 0) {
+      opserr << "WARNING benchmarkMaterials - could not open file " << fileName << endln;
+      return TCL_ERROR;
+    }
+    fprintf(theFile, "# kind tag classType numSteps nsPerStep allocsPerStep checksum\n");
+  }
+
+  // the history, a sine whose amplitude grows linearly to 1.0
+  int numSteps = numCycles*numStepsPerCycle;
+  double *history = new double[numSteps];
+  const double twoPi = 2.0*3.14159265358979323846;
+  for (int c=0; c<numCycles; c++)
+    for (int s=0; s<numStepsPerCycle; s++)
+      history[c*numStepsPerCycle + s] = (c+1.0)/numCycles*sin(twoPi*(s+1.0)/numStepsPerCycle);
+
+  Tcl_ResetResult(interp);
+
+  MaterialBenchmarkResult result;
+  TaggedObject *theObject;
+
+  if (doUniaxial == true) {
+    TaggedObjectIter &theMaterials = OPS_getAllUniaxialMaterial();
+    while ((theObject = theMaterials()) != 0) {
+      if (numTags > 0 && tags.getLocation(theObject->getTag()) < 0)
+	continue;
+      UniaxialMaterial *theMaterial = (UniaxialMaterial *)theObject;
+      if (benchmarkUniaxialMaterial(*theMaterial, history, numSteps, strainAmplitude, 
+				    numRepeat, result) == 0)
+	reportMaterialBenchmark(interp, theFile, "uniaxial", *theMaterial, 
+				theMaterial->getClassType(), numSteps, result);
+      else
+	opserr << "WARNING benchmarkMaterials - could not copy uniaxialMaterial " << theObject->getTag() << endln;
+    }
+  }
+
+  if (doND == true) {
+    TaggedObjectIter &theMaterials = theTclBuilder->getNDMaterials();
+    while ((theObject = theMaterials()) != 0) {
+      if (numTags > 0 && tags.getLocation(theObject->getTag()) < 0)
+	continue;
+      NDMaterial *theMaterial = (NDMaterial *)theObject;
+      if (benchmarkNDMaterial(*theMaterial, nDType, history, numSteps, strainAmplitude, 
+			      numRepeat, result) == 0)
+	reportMaterialBenchmark(interp, theFile, "nD", *theMaterial, 
+				theMaterial->getClassType(), numSteps, result);
+      else
+	opserr << "WARNING benchmarkMaterials - could not get a " << nDType 
+	       << " copy of nDMaterial " << theObject->getTag() << endln;
+    }
+  }
+
+  if (doSection == true) {
+    TaggedObjectIter &theSections = theTclBuilder->getSections();
+    while ((theObject = theSections()) != 0) {
+      if (numTags > 0 && tags.getLocation(theObject->getTag()) < 0)
+	continue;
+      SectionForceDeformation *theSection = (SectionForceDeformation *)theObject;
+      if (benchmarkSection(*theSection, history, numSteps, sectionAmplitude, 
+			   numRepeat, result) == 0)
+	reportMaterialBenchmark(interp, theFile, "section", *theSection, 
+				theSection->getClassType(), numSteps, result);
+      else
+	opserr << "WARNING benchmarkMaterials - could not copy section " << theObject->getTag() << endln;
+    }
+  }
+
+  delete [] history;
+  if (theFile != 0)
+    fclose(theFile);
+
+  return TCL_OK;
+}
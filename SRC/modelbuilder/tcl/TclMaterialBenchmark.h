@@ -0,0 +1,47 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// Description: This file contains the class definition for 
+// TclMaterialBenchmark. A TclMaterialBenchmark is a model builder that,
+// in addition to the usual material and section commands, adds the 
+// benchmarkMaterials command. The command drives copies of the defined
+// uniaxial materials, nD materials and sections through a standard cyclic
+// strain history and reports the time per setTrial/commit pair.
+
+#ifndef TclMaterialBenchmark_h
+#define TclMaterialBenchmark_h
+
+#include <TclModelBuilder.h>
+
+#include <tcl.h>
+
+class TclMaterialBenchmark : public TclModelBuilder
+{
+  public:
+    TclMaterialBenchmark(Domain &theDomain, Tcl_Interp *interp, int ndm, int ndf);
+    ~TclMaterialBenchmark();    
+
+  protected:
+
+  private:
+    Tcl_Interp *theInterp;
+};
+
+#endif
@@ -258,6 +258,10 @@ int
 TclCommand_doBlock3D(ClientData clientData, Tcl_Interp *interp, int argc, 
 		     TCL_Char **argv);
 
+int
+TclCommand_doModelImport(ClientData clientData, Tcl_Interp *interp, int argc, 
+			 TCL_Char **argv);
+
 int
 TclCommand_addRemoPatch(ClientData clientData, 
 			Tcl_Interp *interp, 
@@ -384,6 +388,10 @@ extern int
 TclCommand_addGeomTransf(ClientData, Tcl_Interp *, int, TCL_Char **,
 			 Domain*, TclModelBuilder *);   
 
+extern int
+TclCommand_modelImport(ClientData, Tcl_Interp *, int, TCL_Char **,
+		       Domain*, TclModelBuilder *);   
+
 
 extern int
 Tcl_AddLimitCurveCommand(Tcl_Interp *interp, Domain *theDomain);
@@ -534,6 +542,9 @@ TclModelBuilder::TclModelBuilder(Domain &theDomain, Tcl_Interp *interp, int NDM,
   Tcl_CreateCommand(interp, "block3D", TclCommand_doBlock3D,
 		    (ClientData)NULL, NULL);
 
+  Tcl_CreateCommand(interp, "modelImport", TclCommand_doModelImport,
+		    (ClientData)NULL, NULL);
+
   Tcl_CreateCommand(interp, "patch", TclCommand_addRemoPatch,
 		    (ClientData)NULL, NULL);  
 
@@ -686,6 +697,7 @@ TclModelBuilder::~TclModelBuilder()
   Tcl_DeleteCommand(theInterp, "TzSimple1Gen");  // Added by Scott J. Brandenberg
   Tcl_DeleteCommand(theInterp, "block2D");
   Tcl_DeleteCommand(theInterp, "block3D");
+  Tcl_DeleteCommand(theInterp, "modelImport");
   Tcl_DeleteCommand(theInterp, "patch");
   Tcl_DeleteCommand(theInterp, "layer");
 
@@ -838,6 +850,12 @@ TclModelBuilder::getNDMaterial(int tag)
   return result;
 }
 
+TaggedObjectIter &
+TclModelBuilder::getNDMaterials(void)
+{
+  return theNDMaterials->getComponents();
+}
+
 int 
 TclModelBuilder::addSection(SectionForceDeformation &theSection)
 {
@@ -864,6 +882,12 @@ TclModelBuilder::getSection(int tag)
   return result;
 }
 
+TaggedObjectIter &
+TclModelBuilder::getSections(void)
+{
+  return theSections->getComponents();
+}
+
 int
 TclModelBuilder::addYS_EvolutionModel(YS_Evolution &theModel)
 {
@@ -3211,6 +3235,14 @@ TclCommand_doBlock3D(ClientData clientData, Tcl_Interp *interp, int argc,
 
 
 
+int
+TclCommand_doModelImport(ClientData clientData, Tcl_Interp *interp, int argc,   
+			 TCL_Char **argv)
+{
+  return TclCommand_modelImport(clientData, interp, argc, argv,
+				theTclDomain, theTclBuilder);
+}
+
 int
 TclCommand_addRemoPatch(ClientData clientData, Tcl_Interp *interp, int argc,   
 			   TCL_Char **argv)
@@ -46,6 +46,7 @@ class SectionRepres;
 class UniaxialMaterial;
 class NDMaterial;
 class TaggedObjectStorage;
+class TaggedObjectIter;
 class YieldSurface_BC;
 class YS_Evolution;
 class PlasticHardeningMaterial;
@@ -78,11 +79,13 @@ class TclModelBuilder : public ModelBuilder
     // models to add/get ND material models
     int addNDMaterial(NDMaterial &theMaterial);
     NDMaterial *getNDMaterial(int tag);
+    TaggedObjectIter &getNDMaterials(void);
     
     // methods needed for the nonlinear beam column elements to
     // add/get section objects
     int addSection(SectionForceDeformation &theSection);
     SectionForceDeformation *getSection(int tag);    
+    TaggedObjectIter &getSections(void);
     int addSectionRepres(SectionRepres &theSectionRepres);
     SectionRepres *getSectionRepres(int tag);
 
@@ -0,0 +1,511 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// Description: This file contains the modelImport command, which creates
+// the nodes, elements, fixities and nodal masses of a model from a binary
+// mesh file in one call instead of one interpreter command per object.
+//
+//   modelImport fileName?
+//
+// The file is written in the native byte order, ints are 4 byte and
+// doubles are 8 byte:
+//
+//   header:  char magic[8] = "OPSMESH1"
+//            int ndm, ndf, numNodes, numBlocks, numFix, numMass
+//   nodes:   int tag[numNodes]
+//            double crd[numNodes][ndm]
+//   blocks:  for each element block
+//              int eleType, numEle, numNodesPerEle, numIntArgs, numDblArgs
+//              int tag[numEle]
+//              int nodes[numEle][numNodesPerEle]
+//              int iArgs[numEle][numIntArgs]
+//              double dArgs[numEle][numDblArgs]
+//   fix:     int data[numFix][1+ndf]        (nodeTag followed by fixities)
+//   mass:    int tag[numMass]
+//            double mass[numMass][ndf]
+//
+// ndm and ndf must match those of the current model builder. The element
+// types and their per element arguments are (trailing double args may be
+// omitted, they then default to 0.0):
+//
+//   1 truss              2 nodes  iArgs: matTag   dArgs: A <rho>
+//   2 elasticBeamColumn  2 nodes  iArgs: transfTag
+//                        dArgs: A E I <rho>              (ndm = 2)
+//                               A E G J Iy Iz <rho>      (ndm = 3)
+//   3 quad               4 nodes  iArgs: matTag type (0 PlaneStrain, 1 PlaneStress)
+//                        dArgs: thick <pressure rho b1 b2>
+//   4 stdBrick           8 nodes  iArgs: matTag   dArgs: <b1 b2 b3>
+//   5 bbarBrick          8 nodes  iArgs: matTag   dArgs: <b1 b2 b3>
+//
+// The materials and transformations referenced must already exist. The
+// elements are constructed on the calling thread: element constructors and
+// material getCopy() methods can write class-wide storage and are not safe to
+// run concurrently.
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <tcl.h>
+#include <OPS_Globals.h>
+
+#include <Matrix.h>
+#include <Domain.h>
+#include <Node.h>
+#include <SP_Constraint.h>
+#include <TclModelBuilder.h>
+
+#include <UniaxialMaterial.h>
+#include <NDMaterial.h>
+#include <CrdTransf.h>
+
+#include <Truss.h>
+#include <ElasticBeam2d.h>
+#include <ElasticBeam3d.h>
+#include <FourNodeQuad.h>
+#include <Brick.h>
+#include <BbarBrick.h>
+
+static const char *modelImportMagic = "OPSMESH1";
+
+#define MODELIMPORT_TRUSS          1
+#define MODELIMPORT_ELASTICBEAM    2
+#define MODELIMPORT_QUAD           3
+#define MODELIMPORT_STDBRICK       4
+#define MODELIMPORT_BBARBRICK      5
+
+// the data of one element block, as read from the file
+struct ModelImportBlock {
+  int eleType;
+  int numEle;
+  int numNodes;
+  int numIntArgs;
+  int numDblArgs;
+  int ndm;
+  int *tags;
+  int *nodes;
+  int *iArgs;
+  double *dArgs;
+  TaggedObject **theObjects;  // material or transformation of each element
+  Element **theElements;
+};
+
+static int
+readModelImportData(FILE *theFile, void *data, size_t size, size_t num, 
+		    const char *fileName, const char *what)
+{
+  if (num == 0)
+    return 0;
+
+  if (fread(data, size, num, theFile) != num) {
+    opserr << "WARNING modelImport - failed to read " << what;
+    opserr << " from file " << fileName << endln;
+    return -1;
+  }
+  return 0;
+}
+
+static double
+getModelImportArg(ModelImportBlock &theBlock, int ele, int arg)
+{
+  if (arg < theBlock.numDblArgs)
+    return theBlock.dArgs[ele*theBlock.numDblArgs + arg];
+  else
+    return 0.0;
+}
+
+// number of node, int and min/max double args of each element type
+static int
+getModelImportArgCounts(int eleType, int ndm, int &numNodes, int &numIntArgs, 
+			int &minDblArgs, int &maxDblArgs)
+{
+  switch(eleType) {
+  case MODELIMPORT_TRUSS:
+    numNodes = 2; numIntArgs = 1; minDblArgs = 1; maxDblArgs = 2;
+    return 0;
+  case MODELIMPORT_ELASTICBEAM:
+    numNodes = 2; numIntArgs = 1; 
+    if (ndm == 2) {
+      minDblArgs = 3; maxDblArgs = 4;
+    } else {
+      minDblArgs = 6; maxDblArgs = 7;
+    }
+    return 0;
+  case MODELIMPORT_QUAD:
+    numNodes = 4; numIntArgs = 2; minDblArgs = 1; maxDblArgs = 5;
+    return 0;
+  case MODELIMPORT_STDBRICK:
+  case MODELIMPORT_BBARBRICK:
+    numNodes = 8; numIntArgs = 1; minDblArgs = 0; maxDblArgs = 3;
+    return 0;
+  default:
+    return -1;
+  }
+}
+
+static Element *
+createModelImportElement(ModelImportBlock &theBlock, int i)
+{
+  int tag = theBlock.tags[i];
+  int *nd = &theBlock.nodes[i*theBlock.numNodes];
+  int *iArgs = &theBlock.iArgs[i*theBlock.numIntArgs];
+  TaggedObject *theObject = theBlock.theObjects[i];
+
+  switch(theBlock.eleType) {
+  case MODELIMPORT_TRUSS: {
+    UniaxialMaterial *theMaterial = (UniaxialMaterial *)theObject;
+    return new Truss(tag, theBlock.ndm, nd[0], nd[1], *theMaterial, 
+		     getModelImportArg(theBlock, i, 0), 
+		     getModelImportArg(theBlock, i, 1));
+  }
+
+  case MODELIMPORT_ELASTICBEAM: {
+    CrdTransf *theTransf = (CrdTransf *)theObject;
+    if (theBlock.ndm == 2)
+      return new ElasticBeam2d(tag, 
+			       getModelImportArg(theBlock, i, 0), 
+			       getModelImportArg(theBlock, i, 1), 
+			       getModelImportArg(theBlock, i, 2), 
+			       nd[0], nd[1], *theTransf, 0.0, 0.0,
+			       getModelImportArg(theBlock, i, 3));
+    else
+      return new ElasticBeam3d(tag, 
+			       getModelImportArg(theBlock, i, 0), 
+			       getModelImportArg(theBlock, i, 1), 
+			       getModelImportArg(theBlock, i, 2), 
+			       getModelImportArg(theBlock, i, 3), 
+			       getModelImportArg(theBlock, i, 4), 
+			       getModelImportArg(theBlock, i, 5), 
+			       nd[0], nd[1], *theTransf,
+			       getModelImportArg(theBlock, i, 6));
+  }
+
+  case MODELIMPORT_QUAD: {
+    NDMaterial *theMaterial = (NDMaterial *)theObject;
+    const char *type = (iArgs[1] == 1) ? "PlaneStress" : "PlaneStrain";
+    return new FourNodeQuad(tag, nd[0], nd[1], nd[2], nd[3], *theMaterial, type,
+			    getModelImportArg(theBlock, i, 0), 
+			    getModelImportArg(theBlock, i, 1), 
+			    getModelImportArg(theBlock, i, 2), 
+			    getModelImportArg(theBlock, i, 3), 
+			    getModelImportArg(theBlock, i, 4));
+  }
+
+  case MODELIMPORT_STDBRICK: {
+    NDMaterial *theMaterial = (NDMaterial *)theObject;
+    return new Brick(tag, nd[0], nd[1], nd[2], nd[3], nd[4], nd[5], nd[6], nd[7],
+		     *theMaterial, 
+		     getModelImportArg(theBlock, i, 0), 
+		     getModelImportArg(theBlock, i, 1), 
+		     getModelImportArg(theBlock, i, 2));
+  }
+
+  case MODELIMPORT_BBARBRICK: {
+    NDMaterial *theMaterial = (NDMaterial *)theObject;
+    return new BbarBrick(tag, nd[0], nd[1], nd[2], nd[3], nd[4], nd[5], nd[6], nd[7],
+			 *theMaterial, 
+			 getModelImportArg(theBlock, i, 0), 
+			 getModelImportArg(theBlock, i, 1), 
+			 getModelImportArg(theBlock, i, 2));
+  }
+
+  default:
+    return 0;
+  }
+}
+
+// constructs the elements of a block
+static int
+buildModelImportBlock(ModelImportBlock &theBlock)
+{
+  int result = 0;
+  for (int i=0; i<theBlock.numEle; i++) {
+    theBlock.theElements[i] = createModelImportElement(theBlock, i);
+    if (theBlock.theElements[i] == 0)
+      result = -1;
+  }
+  return result;
+}
+
+int
+TclCommand_modelImport(ClientData clientData, Tcl_Interp *interp, int argc, 
+		       TCL_Char **argv, Domain *theDomain, TclModelBuilder *theBuilder)
+{
+  if (argc < 2) {
+    opserr << "WARNING insufficient args - modelImport fileName?\n";
+    return TCL_ERROR;
+  }
+
+  const char *fileName = argv[1];
+  FILE *theFile = fopen(fileName, "rb");
+  if (theFile == 0) {
+    opserr << "WARNING modelImport - could not open file " << fileName << endln;
+    return TCL_ERROR;
+  }
+
+  // read and check the header
+  char magic[8];
+  int header[6];
+  if (readModelImportData(theFile, magic, 1, 8, fileName, "header") != 0 ||
+      readModelImportData(theFile, header, sizeof(int), 6, fileName, "header") != 0) {
+    fclose(theFile);
+    return TCL_ERROR;
+  }
+
+  if (strncmp(magic, modelImportMagic, 8) != 0) {
+    opserr << "WARNING modelImport - file " << fileName << " is not a binary mesh file\n";
+    fclose(theFile);
+    return TCL_ERROR;
+  }
+
+  int ndm = header[0];
+  int ndf = header[1];
+  int numNodes = header[2];
+  int numBlocks = header[3];
+  int numFix = header[4];
+  int numMass = header[5];
+
+  if (ndm != theBuilder->getNDM() || ndf != theBuilder->getNDF()) {
+    opserr << "WARNING modelImport - file " << fileName << " has ndm " << ndm << " ndf " << ndf;
+    opserr << ", model has ndm " << theBuilder->getNDM() << " ndf " << theBuilder->getNDF() << endln;
+    fclose(theFile);
+    return TCL_ERROR;
+  }
+
+  if (ndm < 1 || ndm > 3 || numNodes < 0 || numBlocks < 0 || numFix < 0 || numMass < 0) {
+    opserr << "WARNING modelImport - invalid header in file " << fileName << endln;
+    fclose(theFile);
+    return TCL_ERROR;
+  }
+
+  //
+  // the nodes
+  //
+
+  int *nodeTags = new int[numNodes];
+  double *nodeCrds = new double[numNodes*ndm];
+  if (readModelImportData(theFile, nodeTags, sizeof(int), numNodes, fileName, "node tags") != 0 ||
+      readModelImportData(theFile, nodeCrds, sizeof(double), numNodes*ndm, fileName, "node coordinates") != 0) {
+    delete [] nodeTags;
+    delete [] nodeCrds;
+    fclose(theFile);
+    return TCL_ERROR;
+  }
+
+  int result = TCL_OK;
+  for (int i=0; i<numNodes && result == TCL_OK; i++) {
+    double *crd = &nodeCrds[i*ndm];
+    Node *theNode = 0;
+    if (ndm == 1)
+      theNode = new Node(nodeTags[i], ndf, crd[0]);
+    else if (ndm == 2)
+      theNode = new Node(nodeTags[i], ndf, crd[0], crd[1]);
+    else
+      theNode = new Node(nodeTags[i], ndf, crd[0], crd[1], crd[2]);
+
+    if (theDomain->addNode(theNode) == false) {
+      opserr << "WARNING modelImport - failed to add node " << nodeTags[i] << " to the domain\n";
+      delete theNode;
+      result = TCL_ERROR;
+    }
+  }
+
+  delete [] nodeTags;
+  delete [] nodeCrds;
+
+  //
+  // the element blocks
+  //
+
+  int numElements = 0;
+  for (int b=0; b<numBlocks && result == TCL_OK; b++) {
+
+    int blockHeader[5];
+    if (readModelImportData(theFile, blockHeader, sizeof(int), 5, fileName, "element block header") != 0) {
+      result = TCL_ERROR;
+      break;
+    }
+
+    ModelImportBlock theBlock;
+    theBlock.eleType = blockHeader[0];
+    theBlock.numEle = blockHeader[1];
+    theBlock.numNodes = blockHeader[2];
+    theBlock.numIntArgs = blockHeader[3];
+    theBlock.numDblArgs = blockHeader[4];
+    theBlock.ndm = ndm;
+
+    int numNodesEle, numIntArgs, minDblArgs, maxDblArgs;
+    if (getModelImportArgCounts(theBlock.eleType, ndm, numNodesEle, numIntArgs, minDblArgs, maxDblArgs) != 0) {
+      opserr << "WARNING modelImport - unknown element type " << theBlock.eleType;
+      opserr << " in block " << b+1 << endln;
+      result = TCL_ERROR;
+      break;
+    }
+
+    if (theBlock.numEle < 0 || theBlock.numNodes != numNodesEle || 
+	theBlock.numIntArgs != numIntArgs ||
+	theBlock.numDblArgs < minDblArgs || theBlock.numDblArgs > maxDblArgs) {
+      opserr << "WARNING modelImport - block " << b+1 << " has wrong number of nodes or args";
+      opserr << " for element type " << theBlock.eleType << endln;
+      result = TCL_ERROR;
+      break;
+    }
+
+    if ((theBlock.eleType == MODELIMPORT_QUAD && ndm != 2) ||
+	((theBlock.eleType == MODELIMPORT_STDBRICK || theBlock.eleType == MODELIMPORT_BBARBRICK) && ndm != 3) ||
+	(theBlock.eleType == MODELIMPORT_ELASTICBEAM && ndm == 1)) {
+      opserr << "WARNING modelImport - element type " << theBlock.eleType;
+      opserr << " in block " << b+1 << " not available for ndm " << ndm << endln;
+      result = TCL_ERROR;
+      break;
+    }
+
+    int numEle = theBlock.numEle;
+    theBlock.tags = new int[numEle];
+    theBlock.nodes = new int[numEle*theBlock.numNodes];
+    theBlock.iArgs = new int[numEle*theBlock.numIntArgs];
+    theBlock.dArgs = new double[numEle*theBlock.numDblArgs + 1];
+    theBlock.theObjects = new TaggedObject *[numEle];
+    theBlock.theElements = new Element *[numEle];
+
+    if (readModelImportData(theFile, theBlock.tags, sizeof(int), numEle, fileName, "element tags") != 0 ||
+	readModelImportData(theFile, theBlock.nodes, sizeof(int), numEle*theBlock.numNodes, fileName, "element nodes") != 0 ||
+	readModelImportData(theFile, theBlock.iArgs, sizeof(int), numEle*theBlock.numIntArgs, fileName, "element args") != 0 ||
+	readModelImportData(theFile, theBlock.dArgs, sizeof(double), numEle*theBlock.numDblArgs, fileName, "element args") != 0)
+      result = TCL_ERROR;
+
+    // look up the materials/transformations once for a run of elements
+    int lastTag = 0;
+    TaggedObject *lastObject = 0;
+    for (int i=0; i<numEle && result == TCL_OK; i++) {
+      int objTag = theBlock.iArgs[i*theBlock.numIntArgs];
+      if (lastObject == 0 || objTag != lastTag) {
+	lastTag = objTag;
+	if (theBlock.eleType == MODELIMPORT_TRUSS)
+	  lastObject = OPS_getUniaxialMaterial(objTag);
+	else if (theBlock.eleType == MODELIMPORT_ELASTICBEAM)
+	  lastObject = OPS_GetCrdTransf(objTag);
+	else
+	  lastObject = theBuilder->getNDMaterial(objTag);
+
+	if (lastObject == 0) {
+	  opserr << "WARNING modelImport - element " << theBlock.tags[i];
+	  if (theBlock.eleType == MODELIMPORT_ELASTICBEAM)
+	    opserr << " - no geomTransf with tag " << objTag << endln;
+	  else
+	    opserr << " - no material with tag " << objTag << endln;
+	  result = TCL_ERROR;
+	}
+      }
+      theBlock.theObjects[i] = lastObject;
+    }
+
+    if (result == TCL_OK) {
+      for (int i=0; i<numEle; i++)
+	theBlock.theElements[i] = 0;
+
+      if (buildModelImportBlock(theBlock) != 0) {
+	opserr << "WARNING modelImport - ran out of memory creating elements of block " << b+1 << endln;
+	result = TCL_ERROR;
+      }
+
+      // add them in file order, the domain checks the nodes and tags
+      for (int i=0; i<numEle; i++) {
+	Element *theEle = theBlock.theElements[i];
+	if (theEle == 0)
+	  continue;
+	if (result != TCL_OK) {
+	  delete theEle;
+	} else if (theDomain->addElement(theEle) == false) {
+	  opserr << "WARNING modelImport - could not add element " << theBlock.tags[i] << " to the domain\n";
+	  delete theEle;
+	  result = TCL_ERROR;
+	} else
+	  numElements++;
+      }
+    }
+
+    delete [] theBlock.tags;
+    delete [] theBlock.nodes;
+    delete [] theBlock.iArgs;
+    delete [] theBlock.dArgs;
+    delete [] theBlock.theObjects;
+    delete [] theBlock.theElements;
+  }
+
+  //
+  // the fixities
+  //
+
+  if (result == TCL_OK && numFix > 0) {
+    int *fixData = new int[numFix*(1+ndf)];
+    if (readModelImportData(theFile, fixData, sizeof(int), numFix*(1+ndf), fileName, "fixities") != 0)
+      result = TCL_ERROR;
+
+    for (int i=0; i<numFix && result == TCL_OK; i++) {
+      int nodeTag = fixData[i*(1+ndf)];
+      for (int j=0; j<ndf && result == TCL_OK; j++) {
+	if (fixData[i*(1+ndf)+1+j] != 0) {
+	  SP_Constraint *theSP = new SP_Constraint(nodeTag, j, 0.0, true);
+	  if (theDomain->addSP_Constraint(theSP) == false) {
+	    opserr << "WARNING modelImport - could not fix node " << nodeTag << " dof " << j+1 << endln;
+	    delete theSP;
+	    result = TCL_ERROR;
+	  }
+	}
+      }
+    }
+    delete [] fixData;
+  }
+
+  //
+  // the nodal masses
+  //
+
+  if (result == TCL_OK && numMass > 0) {
+    int *massTags = new int[numMass];
+    double *massData = new double[numMass*ndf];
+    if (readModelImportData(theFile, massTags, sizeof(int), numMass, fileName, "mass node tags") != 0 ||
+	readModelImportData(theFile, massData, sizeof(double), numMass*ndf, fileName, "masses") != 0)
+      result = TCL_ERROR;
+
+    Matrix mass(ndf,ndf);
+    for (int i=0; i<numMass && result == TCL_OK; i++) {
+      for (int j=0; j<ndf; j++)
+	mass(j,j) = massData[i*ndf+j];
+      if (theDomain->setMass(mass, massTags[i]) != 0) {
+	opserr << "WARNING modelImport - failed to set mass at node " << massTags[i] << endln;
+	result = TCL_ERROR;
+      }
+    }
+    delete [] massTags;
+    delete [] massData;
+  }
+
+  fclose(theFile);
+
+  if (result == TCL_OK) {
+    char buffer[40];
+    sprintf(buffer, "%d %d", numNodes, numElements);
+    Tcl_SetResult(interp, buffer, TCL_VOLATILE);
+  }
+
+  return result;
+}
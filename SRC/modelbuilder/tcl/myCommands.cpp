@@ -35,6 +35,7 @@
 #include "TclModelBuilder.h"
 #include "TclUniaxialMaterialTester.h"
 #include "TclSectionTester.h"
+#include "TclMaterialBenchmark.h"
 
 #include <tcl.h>
 
@@ -196,6 +197,38 @@ specifyModelBuilder(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Cha
     }
   }
   
+  else if ((strcmp(argv[1],"materialBenchmark") == 0) || (strcmp(argv[1],"MaterialBenchmark") == 0)) {
+    int ndm = 2;
+    int ndf = 0;
+    int argPos = 2;
+    while (argPos+1 < argc) {
+      if (strcmp(argv[argPos],"-ndm") == 0 || strcmp(argv[argPos],"-NDM") == 0) {
+	if (Tcl_GetInt(interp, argv[argPos+1], &ndm) != TCL_OK) {
+	  opserr << "WARNING error reading ndm: " << argv[argPos+1];
+	  opserr << "\nmodel materialBenchmark <-ndm ndm?> <-ndf ndf?>\n";
+	  return TCL_ERROR;
+	}
+      } else if (strcmp(argv[argPos],"-ndf") == 0 || strcmp(argv[argPos],"-NDF") == 0) {
+	if (Tcl_GetInt(interp, argv[argPos+1], &ndf) != TCL_OK) {
+	  opserr << "WARNING error reading ndf: " << argv[argPos+1];
+	  opserr << "\nmodel materialBenchmark <-ndm ndm?> <-ndf ndf?>\n";
+	  return TCL_ERROR;
+	}
+      }
+      argPos += 2;
+    }
+    if (ndf == 0)
+      ndf = (ndm == 1) ? 1 : ((ndm == 2) ? 3 : 6);
+
+    TclMaterialBenchmark *theTclBuilder = new TclMaterialBenchmark(theDomain, interp, ndm, ndf);
+    if (theTclBuilder == 0) {
+      opserr << "WARNING ran out of memory in creating TclMaterialBenchmark model\n";
+      return TCL_ERROR;
+    }
+    OPS_ResetInput(clientData, interp, 0, argc, argv, &theDomain, theTclBuilder);
+    theBuilder = theTclBuilder;
+  }
+  
   else {
     Tcl_SetResult(interp, "WARNING unknown model builder type", TCL_STATIC);
     
@@ -0,0 +1,272 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the implementation of
+// ClassStatsRecorder.
+//
+// What: "@(#) ClassStatsRecorder.cpp, revA"
+
+#include <ClassStatsRecorder.h>
+#include <Domain.h>
+#include <Element.h>
+#include <ElementIter.h>
+#include <Profiler.h>
+#include <ClassTagNames.h>
+#include <classTags.h>
+
+#include <stdio.h>
+#include <string.h>
+
+#include <iomanip>
+using std::ios;
+
+// the regions of an element timed by the Profiler
+static const char *eleRegions[] = {"update", "tangent", "residual"};
+static const int numEleRegions = 3;
+
+// the ClassStatsRecorders alive, and whether they started the Profiler;
+// the Profiler is stopped when the last of them is destroyed
+static int numRecorders = 0;
+static bool startedProfiler = false;
+
+ClassStatsRecorder::ClassStatsRecorder(Domain &theDom, const char *theFileName)
+  :Recorder(RECORDER_TAGS_ClassStatsRecorder),
+   theDomain(&theDom), fileName(0),
+   eleClassTags(0,16), numElements(0,16), numClasses(0), numCommits(0),
+   baseTime(0), baseCalls(0), numBaseClasses(0),
+   baseCounts(0), numBaseCounters(0)
+{
+  // create char array to store file name
+  int fileNameLength = strlen(theFileName) + 1;
+  fileName = new char[fileNameLength];
+  if (fileName == 0) {
+    opserr << "ClassStatsRecorder::ClassStatsRecorder - out of memory creating string" << endln;
+    return;
+  }
+  strcpy(fileName, theFileName);
+
+  // open the file now, so a bad file name is reported before the analysis
+  theFile.open(fileName, ios::out);
+  if (theFile.bad()) {
+    opserr << "WARNING - ClassStatsRecorder::ClassStatsRecorder()";
+    opserr << " - could not open file " << fileName << endln;
+  }
+
+  if (Profiler::on == false) {
+    Profiler::start();
+    startedProfiler = Profiler::on;
+  }
+  numRecorders++;
+
+  this->addElementClasses();
+}
+
+
+ClassStatsRecorder::~ClassStatsRecorder()
+{
+  this->writeStats();
+  theFile.close();
+
+  numRecorders--;
+  if (numRecorders == 0 && startedProfiler == true) {
+    Profiler::stop();
+    startedProfiler = false;
+  }
+
+  if (fileName != 0)
+    delete [] fileName;
+  if (baseTime != 0)
+    delete [] baseTime;
+  if (baseCalls != 0)
+    delete [] baseCalls;
+  if (baseCounts != 0)
+    delete [] baseCounts;
+}
+
+
+int
+ClassStatsRecorder::record(int commitTag, double timeStamp)
+{
+  numCommits++;
+  return 0;
+}
+
+
+// starts the statistics again, as after the model is reset; the current
+// values of the Profiler are kept as the baseline, as other users of the
+// Profiler still need them
+int
+ClassStatsRecorder::restart(void)
+{
+  if (baseTime != 0)
+    delete [] baseTime;
+  if (baseCalls != 0)
+    delete [] baseCalls;
+  if (baseCounts != 0)
+    delete [] baseCounts;
+  baseTime = 0;
+  baseCalls = 0;
+  baseCounts = 0;
+  numBaseClasses = 0;
+  numBaseCounters = 0;
+
+  if (numClasses > 0) {
+    baseTime = new double[numClasses*numEleRegions];
+    baseCalls = new long[numClasses*numEleRegions];
+    if (baseTime == 0 || baseCalls == 0) {
+      opserr << "ClassStatsRecorder::restart - out of memory\n";
+      return -1;
+    }
+    for (int i=0; i<numClasses; i++)
+      for (int j=0; j<numEleRegions; j++)
+	Profiler::getElementTime(eleClassTags(i), eleRegions[j],
+				 baseTime[i*numEleRegions+j],
+				 baseCalls[i*numEleRegions+j]);
+    numBaseClasses = numClasses;
+  }
+
+  int numCounters = Profiler::getNumCounters();
+  if (numCounters > 0) {
+    baseCounts = new long[numCounters];
+    if (baseCounts == 0) {
+      opserr << "ClassStatsRecorder::restart - out of memory\n";
+      return -1;
+    }
+    for (int i=0; i<numCounters; i++) {
+      const char *counter;
+      const char *className;
+      int classTag;
+      Profiler::getCounter(i, counter, classTag, className, baseCounts[i]);
+    }
+    numBaseCounters = numCounters;
+  }
+
+  numCommits = 0;
+  return 0;
+}
+
+
+int
+ClassStatsRecorder::domainChanged(void)
+{
+  this->addElementClasses();
+  return 0;
+}
+
+
+int
+ClassStatsRecorder::setDomain(Domain &theDom)
+{
+  theDomain = &theDom;
+  this->addElementClasses();
+  return 0;
+}
+
+
+// adds the element classes in the domain and updates the number of their
+// elements; an empty domain leaves the classes as they were
+void
+ClassStatsRecorder::addElementClasses(void)
+{
+  if (theDomain == 0 || theDomain->getNumElements() == 0)
+    return;
+
+  for (int i=0; i<numClasses; i++)
+    numElements(i) = 0;
+
+  Element *theEle;
+  ElementIter &theElements = theDomain->getElements();
+  while ((theEle = theElements()) != 0) {
+    int classTag = theEle->getClassTag();
+
+    int loc = 0;
+    while (loc < numClasses && eleClassTags(loc) != classTag)
+      loc++;
+
+    if (loc == numClasses) {
+      eleClassTags[numClasses] = classTag;
+      numElements[numClasses] = 0;
+      numClasses++;
+    }
+    numElements(loc)++;
+  }
+}
+
+
+void
+ClassStatsRecorder::writeStats(void)
+{
+  if (theFile.bad() || !theFile.is_open())
+    return;
+
+  char line[512];
+
+  theFile << "# ClassStatsRecorder - " << numCommits << " commits\n";
+  theFile << "# class classTag numElements region calls time(s) meanTime(s)\n";
+
+  for (int i=0; i<numClasses; i++) {
+    int classTag = eleClassTags(i);
+    const char *className = getElementClassName(classTag);
+
+    for (int j=0; j<numEleRegions; j++) {
+      double time;
+      long numCalls;
+      Profiler::getElementTime(classTag, eleRegions[j], time, numCalls);
+
+      // the classes are only added, so those of the baseline keep their place
+      if (i < numBaseClasses) {
+	time -= baseTime[i*numEleRegions+j];
+	numCalls -= baseCalls[i*numEleRegions+j];
+      }
+
+      char name[80];
+      if (className != 0)
+	sprintf(name, "%.64s", className);
+      else
+	sprintf(name, "Element%d", classTag);
+
+      sprintf(line, "%s %d %d %s %ld %.6e %.6e\n", name, classTag,
+	      numElements(i), eleRegions[j], numCalls, time,
+	      (numCalls > 0) ? time/numCalls : 0.0);
+      theFile << line;
+    }
+  }
+
+  theFile << "# class classTag counter count\n";
+
+  int numCounters = Profiler::getNumCounters();
+  for (int i=0; i<numCounters; i++) {
+    const char *counter;
+    const char *className;
+    int classTag;
+    long n;
+    Profiler::getCounter(i, counter, classTag, className, n);
+    if (i < numBaseCounters)
+      n -= baseCounts[i];
+
+    if (className != 0)
+      sprintf(line, "%.64s %d %.160s %ld\n", className, classTag, counter, n);
+    else
+      sprintf(line, "Class%d %d %.160s %ld\n", classTag, classTag, counter, n);
+    theFile << line;
+  }
+
+  theFile.flush();
+}
@@ -0,0 +1,82 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+#ifndef ClassStatsRecorder_h
+#define ClassStatsRecorder_h
+
+// Description: This file contains the class definition for
+// ClassStatsRecorder. A ClassStatsRecorder writes, per element class in
+// the Domain, the number of calls and the wall time of the update,
+// tangent and residual of its elements, followed by the counters kept
+// by the classes, e.g. the local iterations of ForceBeamColumn2d and the
+// planeStressFailures of J2PlaneStress. The times and counts are those
+// of the Profiler, which the recorders start if it is not on and stop
+// when the last of them is destroyed. A restart makes the recorder
+// count from the values at that point; the Profiler is not reset. The
+// file is written when the recorder is destroyed, i.e. at the end of
+// the analysis when the model is wiped or the program exits.
+//
+// What: "@(#) ClassStatsRecorder.h, revA"
+
+#include <Recorder.h>
+#include <ID.h>
+
+#include <fstream>
+using std::ofstream;
+class Domain;
+
+class ClassStatsRecorder: public Recorder
+{
+  public:
+    ClassStatsRecorder(Domain &theDomain, const char *fileName);
+    ~ClassStatsRecorder();
+
+    int record(int commitTag, double timeStamp);
+    int restart(void);
+    int domainChanged(void);
+    int setDomain(Domain &theDomain);
+
+  protected:
+
+  private:
+    void addElementClasses(void);
+    void writeStats(void);
+
+    Domain *theDomain;
+    char *fileName;
+    ofstream theFile;
+
+    // the element classes in the domain, kept after the elements are
+    // removed as the file is written when the domain is cleared
+    ID eleClassTags;
+    ID numElements;
+    int numClasses;
+    int numCommits;
+
+    // the Profiler values at the last restart, subtracted from those
+    // written; the classes and counters added since have no baseline
+    double *baseTime;
+    long *baseCalls;
+    int numBaseClasses;
+    long *baseCounts;
+    int numBaseCounters;
+};
+
+#endif
@@ -220,15 +220,17 @@ NodeRecorder::record(int commitTag, double timeStamp)
 
     //
     // if need nodal reactions get the domain to calculate them
-    // before we iterate over the nodes
+    // before we iterate over the nodes, only those at recorded nodes
+    // are formed if the nodes were specified
     //
 
-    if (dataFlag == 7)
-      theDomain->calculateNodalReactions(0);
-    else if (dataFlag == 8)
-      theDomain->calculateNodalReactions(1);
-    if (dataFlag == 9)
-      theDomain->calculateNodalReactions(2);
+    if (dataFlag == 7 || dataFlag == 8 || dataFlag == 9) {
+      int flag = dataFlag - 7;
+      if (theNodalTags != 0)
+        theDomain->calculateNodalReactions(flag, *theNodalTags);
+      else
+        theDomain->calculateNodalReactions(flag);
+    }
     //
     // add time information if requested
     //
@@ -47,6 +47,7 @@
  #include <EnvelopeNodeRecorder.h>
  #include <EnvelopeElementRecorder.h>
  #include <PatternRecorder.h>
+ #include <ClassStatsRecorder.h>
  #include <DriftRecorder.h>
  #include <EnvelopeDriftRecorder.h>
  #include <ElementRecorder.h>
@@ -1259,6 +1260,21 @@
        (*theRecorder) = new PatternRecorder(patternTag, theDomain, argv[2], 0.0, flag);
      }
 
+     // Create a recorder to write the times and counters of the element
+     // and material classes at the end of the analysis
+     else if (strcmp(argv[1],"ClassStats") == 0) {
+       if (argc < 4 || strcmp(argv[2],"-file") != 0) {
+	 opserr << "WARNING recorder ClassStats -file fileName\n";
+	 return TCL_ERROR;
+       }
+
+       fileName = argv[3];
+       const char *pwd = getInterpPWD(interp);
+       simulationInfo.addOutputFile(fileName, pwd);
+
+       (*theRecorder) = new ClassStatsRecorder(theDomain, fileName);
+     }
+
      // Create a recorder to write nodal drifts to a file
      else if ((strcmp(argv[1],"Drift") == 0) || (strcmp(argv[1],"EnvelopeDrift") == 0)) {
 
@@ -38,10 +38,14 @@
 #include <LinearSOE.h>
 #include <EquiSolnAlgo.h>
 #include <Vector.h>
+#include <Matrix.h>
 #include <Domain.h>
 #include <Parameter.h>
 #include <ParameterIter.h>
 
+// number of parameters whose sensitivities are solved for together
+#define SENSITIVITY_BLOCK_SIZE 32
+
 
 SensitivityAlgorithm::SensitivityAlgorithm(Domain *passedDomain,
 					   EquiSolnAlgo *passedAlgorithm,
@@ -112,36 +116,89 @@ SensitivityAlgorithm::computeSensitivities(void)
 	while ((theParam = paramIter()) != 0)
 	  theParam->activate(false);
 
-	// Now, compute sensitivity wrt each parameter
+	// Now, compute sensitivity wrt each parameter. The right-hand sides
+	// of a block of parameters are formed first and then solved for
+	// together, so that the factored tangent is swept once per block.
 	int numGrads = theDomain->getNumParameters();
+	if (numGrads == 0)
+	  return 0;
+
+	int numEqn = theSOE->getNumEqn();
+	int blockSize = (numGrads < SENSITIVITY_BLOCK_SIZE) ? numGrads : SENSITIVITY_BLOCK_SIZE;
+
+	Parameter **theParams = new Parameter *[blockSize];
+	Matrix theRHS(numEqn, blockSize);
+	Matrix theSens(numEqn, blockSize);
+
 	paramIter = theDomain->getParameters();
-	while ((theParam = paramIter()) != 0) {
+	theParam = paramIter();
+	while (theParam != 0) {
 
-	  // Activate this parameter
-	  theParam->activate(true);
+	  // Form the RHS for the parameters in this block
+	  int numParams = 0;
+	  while (theParam != 0 && numParams < blockSize) {
 
-	  // Zero the RHS vector
-	  theSOE->zeroB();
+	    // Activate this parameter
+	    theParam->activate(true);
 
-	  // Get the grad index for this parameter
-	  int gradIndex = theParam->getGradIndex();
+	    // Zero the RHS vector
+	    theSOE->zeroB();
 
-	  // Form the RHS
-	  theSensitivityIntegrator->formSensitivityRHS(gradIndex);
+	    // Form the RHS
+	    theSensitivityIntegrator->formSensitivityRHS(theParam->getGradIndex());
 
-	  // Solve for displacement sensitivity
-	  theSOE->solve();
+	    const Vector &theB = theSOE->getB();
+	    for (int i=0; i<numEqn; i++)
+	      theRHS(i,numParams) = theB(i);
 
-	  // Save sensitivity to nodes
-	  theSensitivityIntegrator->saveSensitivity( theSOE->getX(), gradIndex, numGrads );
-	  
-	  // Commit unconditional history variables (also for elastic problems; strain sens may be needed anyway)
-	  theSensitivityIntegrator->commitSensitivity(gradIndex, numGrads);
-	  
-	  // De-activate this parameter for next sensitivity calc
-	  theParam->activate(false);
+	    theParam->activate(false);
+
+	    theParams[numParams++] = theParam;
+	    theParam = paramIter();
+	  }
+
+	  // Solve for displacement sensitivities
+	  Matrix *theRHSBlock = &theRHS;
+	  Matrix *theSensBlock = &theSens;
+	  if (numParams < blockSize) {
+	    theRHSBlock = new Matrix(numEqn, numParams);
+	    theRHSBlock->Extract(theRHS, 0, 0);
+	    theSensBlock = new Matrix(numEqn, numParams);
+	  }
+
+	  int res = theSOE->solveMultiple(*theRHSBlock, *theSensBlock);
+
+	  for (int j=0; j<numParams && res >= 0; j++) {
+
+	    int gradIndex = theParams[j]->getGradIndex();
+	    theParams[j]->activate(true);
+
+	    // Save sensitivity to nodes
+	    Vector theX(&(*theSensBlock)(0,j), numEqn);
+	    theSensitivityIntegrator->saveSensitivity(theX, gradIndex, numGrads);
+
+	    // Commit unconditional history variables (also for elastic problems; strain sens may be needed anyway)
+	    theSensitivityIntegrator->commitSensitivity(gradIndex, numGrads);
+
+	    // De-activate this parameter for next sensitivity calc
+	    theParams[j]->activate(false);
+	  }
+
+	  if (theSensBlock != &theSens) {
+	    delete theRHSBlock;
+	    delete theSensBlock;
+	  }
+
+	  if (res < 0) {
+	    opserr << "WARNING SensitivityAlgorithm::computeSensitivities() -";
+	    opserr << "the LinearSOE failed in solveMultiple()\n";
+	    delete [] theParams;
+	    return -1;
+	  }
 	}
 
+	delete [] theParams;
+
 	return 0;
 }
 
@@ -0,0 +1,513 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 2001, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** Reliability module developed by:                                   **
+**   Terje Haukaas (haukaas@ce.berkeley.edu)                          **
+**   Armen Der Kiureghian (adk@ce.berkeley.edu)                       **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// Description: This file contains the class implementation for
+// CompiledLimitStateFunction.
+//
+// What: "@(#) CompiledLimitStateFunction.cpp, revA"
+
+#include <CompiledLimitStateFunction.h>
+#include <ReliabilityDomain.h>
+#include <Domain.h>
+#include <Node.h>
+#include <Vector.h>
+#include <OPS_Globals.h>
+
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <math.h>
+
+// operation codes of the program
+#define LSF_CONST   0
+#define LSF_RV      1
+#define LSF_DISP    2
+#define LSF_VEL     3
+#define LSF_ACCEL   4
+#define LSF_ADD     5
+#define LSF_SUB     6
+#define LSF_MUL     7
+#define LSF_DIV     8
+#define LSF_POW     9
+#define LSF_NEG    10
+#define LSF_ABS    11
+#define LSF_SQRT   12
+#define LSF_EXP    13
+#define LSF_LOG    14
+#define LSF_LOG10  15
+#define LSF_SIN    16
+#define LSF_COS    17
+#define LSF_TAN    18
+#define LSF_ATAN   19
+#define LSF_IDIV   20
+#define LSF_IPOW   21
+
+static const char *lsfFunctionNames[] = {"abs", "sqrt", "exp", "log10", "log",
+					 "sin", "cos", "tan", "atan"};
+static const int lsfFunctionOps[] = {LSF_ABS, LSF_SQRT, LSF_EXP, LSF_LOG10, LSF_LOG,
+				     LSF_SIN, LSF_COS, LSF_TAN, LSF_ATAN};
+static const int lsfNumFunctions = 9;
+
+CompiledLimitStateFunction::CompiledLimitStateFunction(const char *expression,
+						       ReliabilityDomain &theRelDomain,
+						       Domain &theOpenSeesDomain)
+  :theReliabilityDomain(&theRelDomain), theDomain(&theOpenSeesDomain),
+   theExpression(0), pos(0), intResult(false), valid(false), 
+   ops(0), args1(0), args2(0), values(0), numOps(0), maxOps(0), stack(0)
+{
+  int length = strlen(expression);
+  theExpression = new char[length+1];
+  strcpy(theExpression, expression);
+
+  // every operation consumes at least one character of the expression
+  maxOps = length + 1;
+  ops = new int[maxOps];
+  args1 = new int[maxOps];
+  args2 = new int[maxOps];
+  values = new double[maxOps];
+  stack = new double[maxOps];
+
+  pos = theExpression;
+  if (this->parseSum() == 0) {
+    this->skipSpaces();
+    if (*pos == '\0')
+      valid = true;
+  }
+}
+
+CompiledLimitStateFunction::~CompiledLimitStateFunction()
+{
+  if (theExpression != 0)
+    delete [] theExpression;
+  if (ops != 0)
+    delete [] ops;
+  if (args1 != 0)
+    delete [] args1;
+  if (args2 != 0)
+    delete [] args2;
+  if (values != 0)
+    delete [] values;
+  if (stack != 0)
+    delete [] stack;
+}
+
+bool
+CompiledLimitStateFunction::isValid(void) const
+{
+  return valid;
+}
+
+bool
+CompiledLimitStateFunction::isExpression(const char *expression) const
+{
+  return (strcmp(theExpression, expression) == 0);
+}
+
+double
+CompiledLimitStateFunction::evaluate(const Vector &x)
+{
+  if (valid == false) {
+    opserr << "CompiledLimitStateFunction::evaluate() - expression \"" << theExpression 
+	   << "\" could not be compiled\n";
+    return 0.0;
+  }
+
+  int top = -1;
+  Node *theNode;
+
+  for (int i=0; i<numOps; i++) {
+    switch (ops[i]) {
+    case LSF_CONST:
+      stack[++top] = values[i];
+      break;
+    case LSF_RV:
+      stack[++top] = x(args1[i]);
+      break;
+    case LSF_DISP: case LSF_VEL: case LSF_ACCEL:
+      theNode = theDomain->getNode(args1[i]);
+      if (theNode == 0 || args2[i] < 1 || args2[i] > theNode->getNumberDOF()) {
+	opserr << "CompiledLimitStateFunction::evaluate() - no node " << args1[i] 
+	       << " with dof " << args2[i] << endln;
+	return 0.0;
+      }
+      if (ops[i] == LSF_DISP)
+	stack[++top] = (theNode->getDisp())(args2[i]-1);
+      else if (ops[i] == LSF_VEL)
+	stack[++top] = (theNode->getVel())(args2[i]-1);
+      else
+	stack[++top] = (theNode->getAccel())(args2[i]-1);
+      break;
+    case LSF_ADD:
+      top--; stack[top] += stack[top+1];
+      break;
+    case LSF_SUB:
+      top--; stack[top] -= stack[top+1];
+      break;
+    case LSF_MUL:
+      top--; stack[top] *= stack[top+1];
+      break;
+    case LSF_DIV:
+      top--; stack[top] /= stack[top+1];
+      break;
+    case LSF_IDIV:
+      // integer division rounds towards minus infinity, as in Tcl
+      top--; stack[top] = floor(stack[top]/stack[top+1]);
+      break;
+    case LSF_POW:
+      top--; stack[top] = pow(stack[top], stack[top+1]);
+      break;
+    case LSF_IPOW:
+      // a negative integer power of an integer other than 1 or -1 is 0
+      top--; 
+      stack[top] = pow(stack[top], stack[top+1]);
+      stack[top] = (stack[top] < 0.0) ? ceil(stack[top]) : floor(stack[top]);
+      break;
+    case LSF_NEG:
+      stack[top] = -stack[top];
+      break;
+    case LSF_ABS:
+      stack[top] = fabs(stack[top]);
+      break;
+    case LSF_SQRT:
+      stack[top] = sqrt(stack[top]);
+      break;
+    case LSF_EXP:
+      stack[top] = exp(stack[top]);
+      break;
+    case LSF_LOG:
+      stack[top] = log(stack[top]);
+      break;
+    case LSF_LOG10:
+      stack[top] = log10(stack[top]);
+      break;
+    case LSF_SIN:
+      stack[top] = sin(stack[top]);
+      break;
+    case LSF_COS:
+      stack[top] = cos(stack[top]);
+      break;
+    case LSF_TAN:
+      stack[top] = tan(stack[top]);
+      break;
+    case LSF_ATAN:
+      stack[top] = atan(stack[top]);
+      break;
+    default:
+      break;
+    }
+  }
+
+  return stack[0];
+}
+
+int
+CompiledLimitStateFunction::addOp(int op, int arg1, int arg2, double value)
+{
+  if (numOps == maxOps)
+    return -1;
+
+  ops[numOps] = op;
+  args1[numOps] = arg1;
+  args2[numOps] = arg2;
+  values[numOps] = value;
+  numOps++;
+
+  return 0;
+}
+
+// adds a binary operation, intLeft is the type of the left operand and 
+// intResult that of the right one on entry and of the result on return
+int
+CompiledLimitStateFunction::addBinaryOp(int op, bool intLeft)
+{
+  intResult = (intLeft == true && intResult == true);
+
+  if (intResult == true) {
+    if (op == LSF_DIV)
+      op = LSF_IDIV;
+    else if (op == LSF_POW)
+      op = LSF_IPOW;
+  }
+
+  return this->addOp(op);
+}
+
+void
+CompiledLimitStateFunction::skipSpaces(void)
+{
+  while (*pos != '\0' && isspace(*pos))
+    pos++;
+}
+
+bool
+CompiledLimitStateFunction::match(const char *token)
+{
+  this->skipSpaces();
+  int length = strlen(token);
+  if (strncmp(pos, token, length) == 0) {
+    pos += length;
+    return true;
+  }
+  return false;
+}
+
+int
+CompiledLimitStateFunction::parseSum(void)
+{
+  if (this->parseProduct() != 0)
+    return -1;
+
+  while (true) {
+    bool intLeft = intResult;
+    if (this->match("+")) {
+      if (this->parseProduct() != 0 || this->addBinaryOp(LSF_ADD, intLeft) != 0)
+	return -1;
+    } else if (this->match("-")) {
+      if (this->parseProduct() != 0 || this->addBinaryOp(LSF_SUB, intLeft) != 0)
+	return -1;
+    } else
+      return 0;
+  }
+}
+
+int
+CompiledLimitStateFunction::parseProduct(void)
+{
+  if (this->parsePower() != 0)
+    return -1;
+
+  while (true) {
+    bool intLeft = intResult;
+    if (this->match("*")) {
+      if (this->parsePower() != 0 || this->addBinaryOp(LSF_MUL, intLeft) != 0)
+	return -1;
+    } else if (this->match("/")) {
+      if (this->parsePower() != 0 || this->addBinaryOp(LSF_DIV, intLeft) != 0)
+	return -1;
+    } else
+      return 0;
+  }
+}
+
+int
+CompiledLimitStateFunction::parsePower(void)
+{
+  // as in Tcl, ** binds less tightly than unary minus and is right associative
+  if (this->parseUnary() != 0)
+    return -1;
+
+  if (this->match("**")) {
+    bool intLeft = intResult;
+    if (this->parsePower() != 0 || this->addBinaryOp(LSF_POW, intLeft) != 0)
+      return -1;
+  }
+
+  return 0;
+}
+
+int
+CompiledLimitStateFunction::parseUnary(void)
+{
+  if (this->match("-")) {
+    if (this->parseUnary() != 0 || this->addOp(LSF_NEG) != 0)
+      return -1;
+    return 0;
+  } 
+
+  if (this->match("+"))
+    return this->parseUnary();
+
+  return this->parsePrimary();
+}
+
+int
+CompiledLimitStateFunction::parsePrimary(void)
+{
+  this->skipSpaces();
+
+  if (this->match("(")) {
+    if (this->parseSum() != 0 || this->match(")") == false)
+      return -1;
+    return 0;
+  }
+
+  // the random variables and response quantities are doubles
+  intResult = false;
+
+  if (this->match("$"))
+    return this->parseQuantity();
+
+  if (this->match("["))
+    return this->parseCommand();
+
+  if (isdigit(*pos) || *pos == '.') {
+    const char *start = pos;
+    double value;
+    if (this->parseNumber(value) != 0)
+      return -1;
+
+    // a number without a decimal point or exponent is an integer
+    intResult = true;
+    for (const char *c = start; c < pos; c++)
+      if (*c == '.' || *c == 'e' || *c == 'E')
+	intResult = false;
+
+    return this->addOp(LSF_CONST, 0, 0, value);
+  }
+
+  // functions, all but abs() return a double
+  if (this->match("pow(")) {
+    if (this->parseSum() != 0 || this->match(",") == false ||
+	this->parseSum() != 0 || this->match(")") == false)
+      return -1;
+    intResult = false;
+    return this->addOp(LSF_POW);
+  }
+
+  for (int i=0; i<lsfNumFunctions; i++) {
+    const char *start = pos;
+    if (this->match(lsfFunctionNames[i]) && this->match("(")) {
+      if (this->parseSum() != 0 || this->match(")") == false)
+	return -1;
+      if (lsfFunctionOps[i] != LSF_ABS)
+	intResult = false;
+      return this->addOp(lsfFunctionOps[i]);
+    }
+    pos = start;
+  }
+
+  return -1;
+}
+
+int
+CompiledLimitStateFunction::parseQuantity(void)
+{
+  int tag, dof;
+
+  // random variables, by tag
+  if (strncmp(pos, "xrv(", 4) == 0) {
+    pos += 4;
+    if (this->parseInt(tag) != 0 || this->match(")") == false)
+      return -1;
+  } 
+  else if (strncmp(pos, "x_", 2) == 0) {
+    pos += 2;
+    if (this->parseInt(tag) != 0)
+      return -1;
+  }
+  else
+    tag = -1;
+
+  if (tag != -1) {
+    int index = theReliabilityDomain->getRandomVariableIndex(tag);
+    if (index < 0)
+      return -1;
+    return this->addOp(LSF_RV, index);
+  }
+
+  // nodal response quantities
+  int op = -1;
+  if (strncmp(pos, "udd(", 4) == 0) {
+    pos += 4;
+    op = LSF_ACCEL;
+  } else if (strncmp(pos, "ud(", 3) == 0) {
+    pos += 3;
+    op = LSF_VEL;
+  } else if (strncmp(pos, "u(", 2) == 0) {
+    pos += 2;
+    op = LSF_DISP;
+  }
+
+  if (op != -1) {
+    if (this->parseInt(tag) != 0 || this->match(",") == false ||
+	this->parseInt(dof) != 0 || this->match(")") == false)
+      return -1;
+    return this->addOp(op, tag, dof);
+  }
+
+  if (strncmp(pos, "node(", 5) == 0) {
+    pos += 5;
+    if (this->parseInt(tag) != 0 || this->match(",") == false ||
+	this->parseInt(dof) != 0 || this->match(",") == false)
+      return -1;
+    if (this->match("disp)"))
+      return this->addOp(LSF_DISP, tag, dof);
+    if (this->match("vel)"))
+      return this->addOp(LSF_VEL, tag, dof);
+    if (this->match("accel)"))
+      return this->addOp(LSF_ACCEL, tag, dof);
+  }
+
+  // anything else is left to the interpreter
+  return -1;
+}
+
+int
+CompiledLimitStateFunction::parseCommand(void)
+{
+  int op, tag, dof;
+  
+  if (this->match("nodeDisp "))
+    op = LSF_DISP;
+  else if (this->match("nodeVel "))
+    op = LSF_VEL;
+  else if (this->match("nodeAccel "))
+    op = LSF_ACCEL;
+  else
+    return -1;
+
+  if (this->parseInt(tag) != 0 || this->parseInt(dof) != 0 || this->match("]") == false)
+    return -1;
+
+  return this->addOp(op, tag, dof);
+}
+
+int
+CompiledLimitStateFunction::parseInt(int &value)
+{
+  this->skipSpaces();
+
+  char *end;
+  long result = strtol(pos, &end, 10);
+  if (end == pos)
+    return -1;
+
+  value = (int)result;
+  pos = end;
+  return 0;
+}
+
+int
+CompiledLimitStateFunction::parseNumber(double &value)
+{
+  this->skipSpaces();
+
+  char *end;
+  value = strtod(pos, &end);
+  if (end == pos)
+    return -1;
+
+  pos = end;
+  return 0;
+}
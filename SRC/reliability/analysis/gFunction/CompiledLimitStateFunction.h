@@ -0,0 +1,102 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 2001, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** Reliability module developed by:                                   **
+**   Terje Haukaas (haukaas@ce.berkeley.edu)                          **
+**   Armen Der Kiureghian (adk@ce.berkeley.edu)                       **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+#ifndef CompiledLimitStateFunction_h
+#define CompiledLimitStateFunction_h
+
+// Description: This file contains the class definition for 
+// CompiledLimitStateFunction. A CompiledLimitStateFunction is a limit-state
+// function expression translated once into a small postfix program that is
+// evaluated natively, i.e. the random variables are taken from the vector
+// of realizations and the response quantities directly from the nodes of 
+// the domain, without setting Tcl variables or calling Tcl_ExprDouble.
+//
+// The supported subset of the Tcl expression syntax is: numbers, the 
+// operators + - * / ** and parentheses, the functions abs, sqrt, exp, log,
+// log10, sin, cos, tan, atan and pow, and the quantities
+//    $xrv(rvTag) $x_rvTag              random variable
+//    $u(node,dof) $ud(node,dof) $udd(node,dof)  
+//    $node(node,dof,disp|vel|accel)    nodal response
+//    [nodeDisp node dof] [nodeVel node dof] [nodeAccel node dof]
+// isValid() returns false for any other expression, which then has to be
+// evaluated by the interpreter. As in Tcl, an operation on two integer
+// operands gives an integer, e.g. 1/2 is 0; the random variables and the
+// response quantities are doubles.
+//
+// What: "@(#) CompiledLimitStateFunction.h, revA"
+
+class Vector;
+class Domain;
+class ReliabilityDomain;
+
+class CompiledLimitStateFunction
+{
+  public:
+    CompiledLimitStateFunction(const char *expression,
+			       ReliabilityDomain &theReliabilityDomain,
+			       Domain &theDomain);
+    ~CompiledLimitStateFunction();
+
+    bool isValid(void) const;
+    bool isExpression(const char *expression) const;
+    double evaluate(const Vector &x);
+    
+  protected:
+    
+  private:
+    // recursive descent parser, each method appends to the program
+    int parseSum(void);
+    int parseProduct(void);
+    int parseUnary(void);
+    int parsePower(void);
+    int parsePrimary(void);
+    int parseQuantity(void);
+    int parseCommand(void);
+    int parseInt(int &value);
+    int parseNumber(double &value);
+    bool match(const char *token);
+    void skipSpaces(void);
+    int addOp(int op, int arg1 = 0, int arg2 = 0, double value = 0.0);
+    int addBinaryOp(int op, bool intLeft);
+
+    ReliabilityDomain *theReliabilityDomain;
+    Domain *theDomain;
+
+    char *theExpression;
+    const char *pos;   // current position while parsing
+    bool intResult;    // whether the value last parsed is an integer
+    bool valid;
+
+    // the program: operation codes and their arguments
+    int *ops;
+    int *args1;
+    int *args2;
+    double *values;
+    int numOps;
+    int maxOps;
+
+    double *stack;     // of size maxOps
+};
+
+#endif
@@ -40,6 +40,7 @@
 #include <RandomVariableIter.h>
 #include <RandomVariablePositioner.h>
 #include <RandomVariablePositionerIter.h>
+#include <CompiledLimitStateFunction.h>
 
 #include <tcl.h>
 #include <stdlib.h>
@@ -53,6 +54,10 @@ using std::ios;
 using std::setw;
 using std::setprecision;
 
+// in commands.cpp
+extern int OPS_ResetModel(void);
+extern int OPS_AnalyzeModel(int numIncr, double dT);
+
 OpenSeesGFunEvaluator::OpenSeesGFunEvaluator(Tcl_Interp *passedTclInterp,
 					     ReliabilityDomain *passedReliabilityDomain,
 					     Domain *passedOpenSeesDomain,
@@ -83,7 +88,86 @@ OpenSeesGFunEvaluator::OpenSeesGFunEvaluator(Tcl_Interp *passedTclInterp,
 
 OpenSeesGFunEvaluator::~OpenSeesGFunEvaluator()
 {
-  
+  map<int, CompiledLimitStateFunction *>::iterator theLSF;
+  for (theLSF = theCompiledLSFs.begin(); theLSF != theCompiledLSFs.end(); theLSF++)
+    delete (*theLSF).second;
+}
+
+int
+OpenSeesGFunEvaluator::runGFunAnalysis(const Vector &x)
+{
+	// Zero out the response in the structural domain to make ready for next analysis
+	if (OPS_ResetModel() < 0) {
+		opserr << "ERROR OpenSeesGFunEvaluator -- error in resetting the domain" << endln;
+		return -1;
+	}
+
+	// Put random variables into the structural domain according to the RandomVariablePositioners
+	int rvIndex;
+	RandomVariablePositionerIter rvPosIter = theReliabilityDomain->getRandomVariablePositioners();
+	RandomVariablePositioner *theRVPos;
+	while ((theRVPos = rvPosIter()) != 0) {
+		rvIndex = theRVPos->getRvIndex();
+		theRVPos->update(x(rvIndex));
+	}
+
+	// Set random variable values in Tcl namespace, for the analysis
+	// script and for the expressions and scripts evaluated after it
+	if (setTclRandomVariables(x) != 0) {
+		opserr << "ERROR OpenSeesGFunEvaluator::runGFunAnalysis -- error in setTclRandomVariables" << endln;
+		return -1;
+	}
+
+	// User has given "nsteps" and possibly "dt", the analysis is 
+	// run directly on the analysis objects built by the script
+	if (nsteps > 0) {
+		int result = OPS_AnalyzeModel(nsteps, dt);
+		if (result < 0) {
+			opserr << "ERROR OpenSeesGFunEvaluator -- analysis failed, returned " << result << endln;
+			return -1;
+		}
+		return 0;
+	}
+
+	// Read commands from file and execute them
+	if (strlen(fileName) > 0) {
+		if (Tcl_EvalFile(theTclInterp, fileName) == TCL_ERROR) {
+			opserr << "ERROR OpenSeesGFunEvaluator -- error in Tcl_EvalFile" << endln;
+			return -1;
+		}
+	}
+
+	return 0;
+}
+
+CompiledLimitStateFunction *
+OpenSeesGFunEvaluator::getCompiledLSF(int lsfTag, const char *theExpression)
+{
+  // compile the limit-state function the first time it is evaluated, or
+  // again if its expression has been changed since
+  CompiledLimitStateFunction *theLSF = 0;
+  map<int, CompiledLimitStateFunction *>::iterator theEntry = theCompiledLSFs.find(lsfTag);
+
+  if (theEntry != theCompiledLSFs.end()) {
+    theLSF = (*theEntry).second;
+    if (theLSF->isExpression(theExpression) == false) {
+      delete theLSF;
+      theCompiledLSFs.erase(theEntry);
+      theLSF = 0;
+    }
+  }
+
+  if (theLSF == 0) {
+    theLSF = new CompiledLimitStateFunction(theExpression, *theReliabilityDomain, 
+					    *theOpenSeesDomain);
+    theCompiledLSFs[lsfTag] = theLSF;
+  }
+
+  // the expressions that could not be compiled are left to Tcl_ExprDouble
+  if (theLSF->isValid() == false)
+    return 0;
+
+  return theLSF;
 }
 
 int
@@ -137,12 +221,6 @@ OpenSeesGFunEvaluator::evaluateGMHS(const Vector &x)
 {
   double g = 0.0;
 
-  // Set random variable values in Tcl namespace
-  if (this->setTclRandomVariables(x) != 0) {
-    opserr << "ERROR TclGFunEvaluator::evaluateG -- error in setTclRandomVariables" << endln;
-    return -1;
-  }
-
   // "Download" limit-state function from reliability domain
   int lsf = theReliabilityDomain->getTagOfActiveLimitStateFunction();
   LimitStateFunction *theLimitStateFunction = theReliabilityDomain->getLimitStateFunctionPtr(lsf);
@@ -150,6 +228,17 @@ OpenSeesGFunEvaluator::evaluateGMHS(const Vector &x)
   // Get the limit-state function expression
   const char *theExpression = theLimitStateFunction->getExpression();
 
+  // Evaluate it directly if it only refers to random variables and nodal response
+  CompiledLimitStateFunction *theCompiledLSF = this->getCompiledLSF(lsf, theExpression);
+  if (theCompiledLSF != 0)
+    return theCompiledLSF->evaluate(x);
+
+  // Set random variable values in Tcl namespace
+  if (this->setTclRandomVariables(x) != 0) {
+    opserr << "ERROR TclGFunEvaluator::evaluateG -- error in setTclRandomVariables" << endln;
+    return -1;
+  }
+
   if (Tcl_ExprDouble( theTclInterp, theExpression, &g) != TCL_OK) {
     opserr << "OpenSeesGFunEvaluator::evaluateGnoRecompute -- expression \"" << theExpression;
     opserr << "\" caused error:" << endln << theTclInterp->result << endln;
@@ -40,6 +40,11 @@
 #include <ReliabilityDomain.h>
 #include <tcl.h>
 
+#include <map>
+using std::map;
+
+class CompiledLimitStateFunction;
+
 //#include <fstream>
 //using std::ofstream;
 
@@ -59,7 +64,7 @@ class OpenSeesGFunEvaluator : public GFunEvaluator
   ~OpenSeesGFunEvaluator();
   
 
-  int		runGFunAnalysis(const Vector &x) {return 0;}
+  int		runGFunAnalysis(const Vector &x);
   int		tokenizeSpecials(TCL_Char *theExpression, Tcl_Obj *passedList) {return 0;}
   double evaluateGMHS(const Vector &x);
   /*  
@@ -74,6 +79,7 @@ class OpenSeesGFunEvaluator : public GFunEvaluator
  private:
 
   int setTclRandomVariables(const Vector &x);
+  CompiledLimitStateFunction *getCompiledLSF(int lsfTag, const char *theExpression);
 
   Tcl_Interp *theTclInterp;
   ReliabilityDomain *theReliabilityDomain;
@@ -82,6 +88,9 @@ class OpenSeesGFunEvaluator : public GFunEvaluator
   char fileName[256];
   int nsteps;
   double dt;
+
+  // limit-state functions evaluated without the interpreter, by tag
+  map<int, CompiledLimitStateFunction *> theCompiledLSFs;
 	
 };
 
@@ -43,6 +43,10 @@
 #include <LimitStateFunctionIter.h>
 #include <tcl.h>
 
+#ifdef _PARALLEL_INTERPRETERS
+#include <mpi.h>
+#endif
+
 #include <fstream>
 #include <iomanip>
 #include <iostream>
@@ -112,7 +116,7 @@ FiniteDifferenceGradGEvaluator::computeGradG(double gFunValue,
 	double gFunLocal = gFunValue;
 
 	// Possibly re-compute limit-state function value
-	int result;
+	int result = 0;
 	if (reComputeG) {
 		result = theGFunEvaluator->runGFunAnalysis(passed_x);
 		if (result < 0) {
@@ -140,6 +144,12 @@ FiniteDifferenceGradGEvaluator::computeGradG(double gFunValue,
 	double h;
 	double gFunValueAStepAhead;
 	double stdv;
+	int pid, np;
+	this->getProcessInfo(pid, np);
+
+	// each process evaluates its share of the perturbed analyses,
+	// the others are left zero and summed over all processes below
+	grad_g->Zero();
 
 	//RandomVariableIter rvIter = theReliabilityDomain->getRandomVariables();
 	// For each random variable: perturb and run analysis again
@@ -147,6 +157,9 @@ FiniteDifferenceGradGEvaluator::computeGradG(double gFunValue,
 	// above the rvIter going on inside GFunEvaluator
 	for ( int i=0; i < numberOfRandomVariables; i++ ) {
 	//while ((theRandomVariable = rvIter()) != 0) {
+
+		if (i % np != pid)
+			continue;
 	  
 		theRandomVariable = theReliabilityDomain->getRandomVariablePtrFromIndex(i);
 		//int rvTag = theRandomVariable->getTag();
@@ -168,13 +181,13 @@ FiniteDifferenceGradGEvaluator::computeGradG(double gFunValue,
 		if (result < 0) {
 			opserr << "FiniteDifferenceGradGEvaluator::evaluate_grad_g() - " << endln
 				<< " could not run analysis to evaluate limit-state function values. " << endln;
-			return -1;
+			break;
 		}
 		result = theGFunEvaluator->evaluateG(perturbed_x);
 		if (result < 0) {
 			opserr << "FiniteDifferenceGradGEvaluator::evaluate_grad_g() - " << endln
 				<< " could not evaluate limit-state function. " << endln;
-			return -1;
+			break;
 		}
 		gFunValueAStepAhead = theGFunEvaluator->getG();
 
@@ -183,6 +196,10 @@ FiniteDifferenceGradGEvaluator::computeGradG(double gFunValue,
 		(*grad_g)(i) = (gFunValueAStepAhead - gFunLocal) / h;
 	}
 
+	// gather the gradient; all processes must get here, even if one failed
+	if (this->sumOverProcesses(&(*grad_g)(0), numberOfRandomVariables, result) < 0)
+		return -1;
+
 	if (doGradientCheck) {
 		char myString[100];
 		ofstream outputFile( "FFDgradients.out", ios::out );
@@ -224,14 +241,19 @@ FiniteDifferenceGradGEvaluator::computeAllGradG(const Vector &gFunValues,
 	double h;
 	double gFunValueAStepAhead;
 	double stdv;
-	int result;
+	int result = 0;
+	int pid, np;
+	this->getProcessInfo(pid, np);
 
 	//RandomVariableIter rvIter = theReliabilityDomain->getRandomVariables();
 	// For each random variable: perturb and run analysis again
 	// KRM -- note I changed this back to for-loop  because this rvIter is nested 
 	// above the rvIter going on inside GFunEvaluator
-	for ( int i=0; i < nrv; i++ ) {
+	for ( int i=0; i < nrv && result >= 0; i++ ) {
 	//while ((theRandomVariable = rvIter()) != 0) {
+
+		if (i % np != pid)
+			continue;
 	  
 		theRandomVariable = theReliabilityDomain->getRandomVariablePtrFromIndex(i);
 		//int rvTag = theRandomVariable->getTag();
@@ -253,7 +275,7 @@ FiniteDifferenceGradGEvaluator::computeAllGradG(const Vector &gFunValues,
 		if (result < 0) {
 			opserr << "FiniteDifferenceGradGEvaluator::evaluate_grad_g() - " << endln
 				<< " could not run analysis to evaluate limit-state function. " << endln;
-			return -1;
+			break;
 		}
 
 		// not sure if the lsfIter is causing problems here, may need to resort back to 
@@ -275,7 +297,7 @@ FiniteDifferenceGradGEvaluator::computeAllGradG(const Vector &gFunValues,
 			if (result < 0) {
 				opserr << "FiniteDifferenceGradGEvaluator::evaluate_grad_g() - " << endln
 					<< " could not tokenize limit-state function. " << endln;
-				return -1;
+				break;
 			}
 			gFunValueAStepAhead = theGFunEvaluator->getG();
 
@@ -285,11 +307,54 @@ FiniteDifferenceGradGEvaluator::computeAllGradG(const Vector &gFunValues,
 		}
 	}
 
+	// gather the gradients; all processes must get here, even if one failed
+	int lsf = theReliabilityDomain->getNumberOfLimitStateFunctions();
+	if (this->sumOverProcesses(&(*grad_g_matrix)(0,0), nrv*lsf, result) < 0)
+		return -1;
+
 	return 0;
 }
 
 
 
+void
+FiniteDifferenceGradGEvaluator::getProcessInfo(int &pid, int &np)
+{
+	// with parallel interpreters every process holds its own copy
+	// of the model, the perturbed analyses are dealt out among them
+	pid = 0;
+	np = 1;
+#ifdef _PARALLEL_INTERPRETERS
+	MPI_Comm_rank(MPI_COMM_WORLD, &pid);
+	MPI_Comm_size(MPI_COMM_WORLD, &np);
+#endif
+}
+
+
+
+int
+FiniteDifferenceGradGEvaluator::sumOverProcesses(double *data, int size, int status)
+{
+	// sums data over the processes, returns the lowest status of all
+#ifdef _PARALLEL_INTERPRETERS
+	int np;
+	MPI_Comm_size(MPI_COMM_WORLD, &np);
+	if (np > 1) {
+		double *sum = new double[size];
+		MPI_Allreduce(data, sum, size, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+		for (int i=0; i<size; i++)
+			data[i] = sum[i];
+		delete [] sum;
+
+		int myStatus = (status < 0) ? -1 : 0;
+		MPI_Allreduce(&myStatus, &status, 1, MPI_INT, MPI_MIN, MPI_COMM_WORLD);
+	}
+#endif
+	return (status < 0) ? -1 : 0;
+}
+
+
+
 
 
 Matrix
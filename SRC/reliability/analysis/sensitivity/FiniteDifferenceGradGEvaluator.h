@@ -70,6 +70,8 @@ protected:
 
 private:
 //	int computeDgDsomething();
+	void getProcessInfo(int &pid, int &np);
+	int sumOverProcesses(double *data, int size, int status);
 
 	Vector *grad_g;
 	Matrix *grad_g_matrix;
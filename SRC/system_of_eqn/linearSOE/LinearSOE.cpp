@@ -32,6 +32,9 @@
 
 #include<LinearSOE.h>
 #include<LinearSOESolver.h>
+#include<Matrix.h>
+#include<Vector.h>
+#include<Profiler.h>
 
 LinearSOE::LinearSOE(LinearSOESolver &theLinearSOESolver, int classtag)
 :MovableObject(classtag), theSolver(&theLinearSOESolver)
@@ -55,6 +58,7 @@ LinearSOE::~LinearSOE()
 int 
 LinearSOE::solve(void)
 {
+  ProfileScope scope("LinearSOE::solve");
   if (theSolver != 0)
     return (theSolver->solve());
   else 
@@ -62,6 +66,44 @@ LinearSOE::solve(void)
 }
 
 
+// solves A X = B for the columns of B. if the solver has no blocked
+// solve, the columns are solved one at a time, the factored A being
+// reused; B of the SOE is left holding the last column.
+int 
+LinearSOE::solveMultiple(const Matrix &B, Matrix &X)
+{
+  int n = this->getNumEqn();
+  int numRHS = B.noCols();
+  if (B.noRows() != n || X.noRows() != n || X.noCols() != numRHS) {
+    opserr << "LinearSOE::solveMultiple() - B and X must both be numEqn x numRHS\n";
+    return -1;
+  }
+
+  if (theSolver == 0)
+    return -1;
+
+  int res = theSolver->solveMultiple(B, X);
+  if (res <= 0)
+    return res;
+
+  Vector b(n);
+  for (int j=0; j<numRHS; j++) {
+    for (int i=0; i<n; i++)
+      b(i) = B(i,j);
+    this->setB(b);
+
+    res = this->solve();
+    if (res < 0)
+      return res;
+
+    const Vector &x = this->getX();
+    for (int i=0; i<n; i++)
+      X(i,j) = x(i);
+  }
+
+  return 0;
+}
+
 double
 LinearSOE::getDeterminant(void)
 {
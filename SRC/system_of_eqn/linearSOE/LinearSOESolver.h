@@ -39,6 +39,7 @@
 
 #include <MovableObject.h>
 class LinearSOE;
+class Matrix;
 
 class LinearSOESolver : public MovableObject
 {
@@ -47,6 +48,10 @@ class LinearSOESolver : public MovableObject
     virtual ~LinearSOESolver();
 
     virtual int solve(void) = 0;
+
+    // blocked solve for the columns of B; a return > 0 indicates the
+    // solver has none and the SOE is to solve one column at a time
+    virtual int solveMultiple(const Matrix &B, Matrix &X) {return 1;};
     virtual int setSize(void) = 0;
     virtual double getDeterminant(void) {return 1.0;};
     
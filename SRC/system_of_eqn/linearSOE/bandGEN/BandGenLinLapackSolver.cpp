@@ -37,6 +37,7 @@
 
 #include <BandGenLinLapackSolver.h>
 #include <BandGenLinSOE.h>
+#include <Matrix.h>
 #include <math.h>
 
 
@@ -142,6 +143,64 @@ BandGenLinLapackSolver::solve(void)
     
 
 
+// all the rhs are passed to LAPACK at once
+int
+BandGenLinLapackSolver::solveMultiple(const Matrix &B, Matrix &X)
+{
+    if (theSOE == 0) {
+	opserr << "WARNING BandGenLinLapackSolver::solveMultiple()- ";
+	opserr << " No LinearSOE object has been set\n";
+	return -1;
+    }
+
+    int n = theSOE->size;    
+    int nrhs = B.noCols();
+    if (n == 0 || nrhs == 0)
+	return 0;
+
+    if (iPivSize < n) {
+	opserr << "WARNING BandGenLinLapackSolver::solveMultiple()- ";
+	opserr << " iPiv not large enough - has setSize() been called?\n";
+	return -1;
+    }	    
+
+    int kl = theSOE->numSubD;
+    int ku = theSOE->numSuperD;
+    int ldA = 2*kl + ku +1;
+    int ldB = n;
+    int info;
+    double *Aptr = theSOE->A;
+    int    *iPIV = iPiv;
+
+    // first copy B into X, the columns of which are contiguous
+    X = B;
+    double *Xptr = &X(0,0);
+
+#ifdef _WIN32
+    {if (theSOE->factored == false)  
+	DGBSV(&n,&kl,&ku,&nrhs,Aptr,&ldA,iPIV,Xptr,&ldB,&info);	
+    else 
+	DGBTRS("N", &n,&kl,&ku,&nrhs,Aptr,&ldA,iPIV,Xptr,&ldB,&info);
+    }
+#else
+    {if (theSOE->factored == false)      
+	dgbsv_(&n,&kl,&ku,&nrhs,Aptr,&ldA,iPIV,Xptr,&ldB,&info);
+    else
+	dgbtrs_("N",&n,&kl,&ku,&nrhs,Aptr,&ldA,iPIV,Xptr,&ldB,&info);
+    }
+#endif
+
+    if (info != 0) {
+	opserr << "WARNING BandGenLinLapackSolver::solveMultiple() -";
+	opserr << "LAPACK routine returned " << info << endln;
+	return -info;
+    }
+
+    theSOE->factored = true;
+    return 0;
+}
+
+
 int
 BandGenLinLapackSolver::setSize()
 {
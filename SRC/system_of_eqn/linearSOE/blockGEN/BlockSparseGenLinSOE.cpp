@@ -0,0 +1,646 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+
+// Description: This file contains the implementation for
+// BlockSparseGenLinSOE.
+//
+// What: "@(#) BlockSparseGenLinSOE.C, revA"
+
+#include <stdlib.h>
+#include <math.h>
+
+#include <BlockSparseGenLinSOE.h>
+#include <BlockSparseGenLinSolver.h>
+#include <Matrix.h>
+#include <Graph.h>
+#include <Vertex.h>
+#include <AnalysisModel.h>
+#include <DOF_Group.h>
+#include <DOF_GrpIter.h>
+#include <Channel.h>
+#include <FEM_ObjectBroker.h>
+
+static int
+compareBlocks(const void *a, const void *b)
+{
+  return *((const int *)a) - *((const int *)b);
+}
+
+
+BlockSparseGenLinSOE::BlockSparseGenLinSOE(BlockSparseGenLinSolver &the_Solver)
+:LinearSOE(the_Solver, LinSOE_TAGS_BlockSparseGenLinSOE),
+ size(0), B(0), X(0), vectX(0), vectB(0), Bsize(0), factored(false),
+ theModel(0), blockSize(0), numBlocks(0), eqnSlot(0), slotEqn(0),
+ rowStart(0), colIndex(0), diagPos(0), numNonZeroBlocks(0), A(0),
+ eleSlot(0), runStart(0), sizeEle(0)
+{
+    the_Solver.setLinearSOE(*this);
+}
+
+
+BlockSparseGenLinSOE::~BlockSparseGenLinSOE()
+{
+    if (B != 0) delete [] B;
+    if (X != 0) delete [] X;
+    if (vectX != 0) delete vectX;
+    if (vectB != 0) delete vectB;
+    if (eqnSlot != 0) delete [] eqnSlot;
+    if (slotEqn != 0) delete [] slotEqn;
+    if (rowStart != 0) delete [] rowStart;
+    if (colIndex != 0) delete [] colIndex;
+    if (diagPos != 0) delete [] diagPos;
+    if (A != 0) delete [] A;
+    if (eleSlot != 0) delete [] eleSlot;
+    if (runStart != 0) delete [] runStart;
+}
+
+
+int
+BlockSparseGenLinSOE::getNumEqn(void) const
+{
+    return size;
+}
+
+
+int
+BlockSparseGenLinSOE::getBlockSize(void) const
+{
+    return blockSize;
+}
+
+
+int
+BlockSparseGenLinSOE::getNumBlocks(void) const
+{
+    return numBlocks;
+}
+
+
+int
+BlockSparseGenLinSOE::setLinks(AnalysisModel &theAnalysisModel)
+{
+    theModel = &theAnalysisModel;
+    return 0;
+}
+
+
+int
+BlockSparseGenLinSOE::setSize(Graph &theGraph)
+{
+    int oldSize = size;
+    size = theGraph.getNumVertex();
+
+    // remove the old structure
+    if (eqnSlot != 0) delete [] eqnSlot;
+    if (slotEqn != 0) delete [] slotEqn;
+    if (rowStart != 0) delete [] rowStart;
+    if (colIndex != 0) delete [] colIndex;
+    if (diagPos != 0) delete [] diagPos;
+    if (A != 0) delete [] A;
+    eqnSlot = 0; slotEqn = 0; rowStart = 0; colIndex = 0; diagPos = 0; A = 0;
+    blockSize = 0; numBlocks = 0; numNonZeroBlocks = 0;
+
+    factored = false;
+
+    if (size > Bsize) { // we have to get space for the vectors
+
+	if (B != 0) delete [] B;
+	if (X != 0) delete [] X;
+
+	B = new double[size];
+	X = new double[size];
+	Bsize = size;
+    }
+
+    for (int j=0; j<size; j++) {
+	B[j] = 0;
+	X[j] = 0;
+    }
+
+    if (size != oldSize) {
+	if (vectX != 0)
+	    delete vectX;
+	if (vectB != 0)
+	    delete vectB;
+
+	vectX = new Vector(X,size);
+	vectB = new Vector(B,size);
+    }
+
+    if (size == 0)
+      return 0;
+
+    int n = size;
+
+    for (int a=0; a<n; a++) {
+	if (theGraph.getVertexPtr(a) == 0) {
+	    opserr << "WARNING BlockSparseGenLinSOE::setSize :";
+	    opserr << " vertex " << a << " not in graph! - size set to 0\n";
+	    size = 0;
+	    return -1;
+	}
+    }
+
+    //
+    // the DOF_Group of each equation; a DOF_Group claims the equations of
+    // its ID not claimed by an earlier one, as the ID of a
+    // TransformationDOF_Group also holds the equations it is retained by
+    //
+
+    int *eqnGroup = new int[n];
+    for (int i=0; i<n; i++)
+	eqnGroup[i] = -1;
+
+    int maxTag = -1;
+    if (theModel != 0) {
+	DOF_GrpIter &theDOFs = theModel->getDOFs();
+	DOF_Group *dofPtr;
+	while ((dofPtr = theDOFs()) != 0) {
+	    int tag = dofPtr->getTag();
+	    if (tag > maxTag)
+		maxTag = tag;
+	    const ID &theID = dofPtr->getID();
+	    for (int i=0; i<theID.Size(); i++) {
+		int eqn = theID(i);
+		if (eqn >= 0 && eqn < n && eqnGroup[eqn] < 0)
+		    eqnGroup[eqn] = tag;
+	    }
+	}
+    }
+
+    //
+    // number the blocks in the order of their first equation, so that the
+    // block order follows the DOF_Numberer; an equation of no DOF_Group
+    // is a block of its own
+    //
+
+    int *groupBlock = new int[maxTag+2];
+    for (int i=0; i<=maxTag; i++)
+	groupBlock[i] = -1;
+
+    int *blockGroup = new int[n];
+    int *blockCount = new int[n];
+    int *eqnBlock = new int[n];
+    for (int eqn=0; eqn<n; eqn++) {
+	int tag = eqnGroup[eqn];
+	int block;
+	if (tag >= 0 && groupBlock[tag] >= 0)
+	    block = groupBlock[tag];
+	else {
+	    block = numBlocks++;
+	    blockGroup[block] = tag;
+	    blockCount[block] = 0;
+	    if (tag >= 0)
+		groupBlock[tag] = block;
+	}
+	eqnBlock[eqn] = block;
+	eqnGroup[eqn] = blockCount[block]++;   // now the slot in the block
+    }
+
+    for (int b=0; b<numBlocks; b++)
+	if (blockCount[b] > blockSize)
+	    blockSize = blockCount[b];
+
+    int numSlots = numBlocks*blockSize;
+    eqnSlot = new int[n];
+    slotEqn = new int[numSlots];
+    for (int s=0; s<numSlots; s++)
+	slotEqn[s] = -1;
+    for (int eqn=0; eqn<n; eqn++) {
+	int slot = eqnBlock[eqn]*blockSize + eqnGroup[eqn];
+	eqnSlot[eqn] = slot;
+	slotEqn[slot] = eqn;
+    }
+
+    //
+    // the block structure: the DOF_Group pairs coupled in the
+    // DOF_GroupGraph, and those coupled only through the equations of
+    // their IDs, as by the retained DOF_Groups of a TransformationFE
+    //
+
+    Graph *theGroupGraph = 0;
+    if (theModel != 0 && maxTag >= 0)
+	theGroupGraph = &(theModel->getDOFGroupGraph());
+
+    int *marker = new int[numBlocks];
+    for (int b=0; b<numBlocks; b++)
+	marker[b] = -1;
+
+    int sizeCols = 8*numBlocks;
+    int *cols = new int[sizeCols];
+    rowStart = new int[numBlocks+1];
+    rowStart[0] = 0;
+    int numCols = 0;
+
+    for (int I=0; I<numBlocks; I++) {
+
+	// make sure a row of numBlocks more fits
+	if (numCols + numBlocks > sizeCols) {
+	    int newSize = 2*sizeCols;
+	    if (newSize < numCols + numBlocks)
+		newSize = numCols + numBlocks;
+	    int *newCols = new int[newSize];
+	    for (int i=0; i<numCols; i++)
+		newCols[i] = cols[i];
+	    delete [] cols;
+	    cols = newCols;
+	    sizeCols = newSize;
+	}
+
+	marker[I] = I;
+	cols[numCols++] = I;
+
+	int tag = blockGroup[I];
+	if (theGroupGraph != 0 && tag >= 0) {
+	    Vertex *theVertex = theGroupGraph->getVertexPtr(tag);
+	    if (theVertex != 0) {
+		const ID &theAdjacency = theVertex->getAdjacency();
+		for (int i=0; i<theAdjacency.Size(); i++) {
+		    int otherTag = theAdjacency(i);
+		    if (otherTag < 0 || otherTag > maxTag)
+			continue;
+		    int J = groupBlock[otherTag];
+		    if (J >= 0 && marker[J] != I) {
+			marker[J] = I;
+			cols[numCols++] = J;
+		    }
+		}
+	    }
+	}
+
+	for (int k=0; k<blockSize; k++) {
+	    int eqn = slotEqn[I*blockSize+k];
+	    if (eqn < 0)
+		continue;
+	    const ID &theAdjacency = theGraph.getVertexPtr(eqn)->getAdjacency();
+	    for (int i=0; i<theAdjacency.Size(); i++) {
+		int other = theAdjacency(i);
+		if (other < 0 || other >= n)
+		    continue;
+		int J = eqnBlock[other];
+		if (marker[J] != I) {
+		    marker[J] = I;
+		    cols[numCols++] = J;
+		}
+	    }
+	}
+
+	qsort(&cols[rowStart[I]], numCols - rowStart[I], sizeof(int), compareBlocks);
+	rowStart[I+1] = numCols;
+    }
+
+    numNonZeroBlocks = numCols;
+    colIndex = new int[numNonZeroBlocks];
+    for (int i=0; i<numNonZeroBlocks; i++)
+	colIndex[i] = cols[i];
+
+    diagPos = new int[numBlocks];
+    for (int I=0; I<numBlocks; I++)
+	for (int p=rowStart[I]; p<rowStart[I+1]; p++)
+	    if (colIndex[p] == I) {
+		diagPos[I] = p;
+		break;
+	    }
+
+    delete [] cols;
+    delete [] marker;
+    delete [] eqnBlock;
+    delete [] blockCount;
+    delete [] blockGroup;
+    delete [] groupBlock;
+    delete [] eqnGroup;
+
+    //
+    // space for the blocks
+    //
+
+    A = new double[numNonZeroBlocks*blockSize*blockSize];
+    this->zeroA();
+
+    // invoke setSize() on the Solver
+    LinearSOESolver *the_Solver = this->getSolver();
+    int solverOK = the_Solver->setSize();
+    if (solverOK < 0) {
+	opserr << "WARNING:BlockSparseGenLinSOE::setSize :";
+	opserr << " solver failed setSize()\n";
+	return solverOK;
+    }
+
+    return 0;
+}
+
+
+int
+BlockSparseGenLinSOE::addA(const Matrix &m, const ID &id, double fact)
+{
+    // check for a quick return
+    if (fact == 0.0)  return 0;
+
+    // check that m and id are of similar size
+    int idSize = id.Size();
+    if (idSize != m.noRows() && idSize != m.noCols()) {
+	opserr << "BlockSparseGenLinSOE::addA() - Matrix and ID not of similar sizes\n";
+	return -1;
+    }
+
+    if (idSize > sizeEle) {
+	if (eleSlot != 0) delete [] eleSlot;
+	if (runStart != 0) delete [] runStart;
+	eleSlot = new int[idSize];
+	runStart = new int[idSize+1];
+	sizeEle = idSize;
+    }
+
+    // the slots of the equations, and the runs of the equations that are
+    // in one block; the entries of a pair of runs go into a single block
+    int bs = blockSize;
+    int numRuns = 0;
+    int lastBlock = -1;
+    for (int i=0; i<idSize; i++) {
+	int eqn = id(i);
+	if (eqn < 0 || eqn >= size) {
+	    eleSlot[i] = -1;
+	    continue;
+	}
+	int slot = eqnSlot[eqn];
+	eleSlot[i] = slot;
+	if (slot/bs != lastBlock) {
+	    runStart[numRuns++] = i;
+	    lastBlock = slot/bs;
+	}
+    }
+    runStart[numRuns] = idSize;
+
+    int bs2 = bs*bs;
+    for (int ri=0; ri<numRuns; ri++) {
+	int I = eleSlot[runStart[ri]]/bs;
+	const int *rowCols = &colIndex[rowStart[I]];
+	int numRowCols = rowStart[I+1] - rowStart[I];
+
+	for (int rj=0; rj<numRuns; rj++) {
+	    int J = eleSlot[runStart[rj]]/bs;
+
+	    // binary search the block columns of the row
+	    int low = 0;
+	    int high = numRowCols - 1;
+	    int pos = -1;
+	    while (low <= high) {
+		int middle = (low+high)/2;
+		int middleCol = rowCols[middle];
+		if (middleCol < J)
+		    low = middle+1;
+		else if (middleCol > J)
+		    high = middle-1;
+		else {
+		    pos = rowStart[I] + middle;
+		    break;
+		}
+	    }
+	    if (pos < 0) {
+		opserr << "BlockSparseGenLinSOE::addA() - block (" << I << ",";
+		opserr << J << ") not in the structure of A\n";
+		return -1;
+	    }
+
+	    double *block = &A[pos*bs2];
+	    for (int i=runStart[ri]; i<runStart[ri+1]; i++) {
+		if (eleSlot[i] < 0)
+		    continue;
+		double *blockRow = &block[(eleSlot[i] - I*bs)*bs];
+		if (fact == 1.0) {
+		    for (int j=runStart[rj]; j<runStart[rj+1]; j++)
+			if (eleSlot[j] >= 0)
+			    blockRow[eleSlot[j] - J*bs] += m(i,j);
+		} else {
+		    for (int j=runStart[rj]; j<runStart[rj+1]; j++)
+			if (eleSlot[j] >= 0)
+			    blockRow[eleSlot[j] - J*bs] += m(i,j)*fact;
+		}
+	    }
+	}
+    }
+
+    return 0;
+}
+
+
+int
+BlockSparseGenLinSOE::addB(const Vector &v, const ID &id, double fact)
+{
+    // check for a quick return
+    if (fact == 0.0)  return 0;
+
+    // check that m and id are of similar size
+    int idSize = id.Size();
+    if (idSize != v.Size() ) {
+	opserr << "BlockSparseGenLinSOE::addB() - Vector and ID not of similar sizes\n";
+	return -1;
+    }
+
+    if (fact == 1.0) { // do not need to multiply if fact == 1.0
+	for (int i=0; i<idSize; i++) {
+	    int pos = id(i);
+	    if (pos <size && pos >= 0)
+		B[pos] += v(i);
+	}
+    } else if (fact == -1.0) {
+	for (int i=0; i<idSize; i++) {
+	    int pos = id(i);
+	    if (pos <size && pos >= 0)
+		B[pos] -= v(i);
+	}
+    } else {
+	for (int i=0; i<idSize; i++) {
+	    int pos = id(i);
+	    if (pos <size && pos >= 0)
+		B[pos] += v(i) * fact;
+	}
+    }
+    return 0;
+}
+
+
+int
+BlockSparseGenLinSOE::setB(const Vector &v, double fact)
+{
+    // check for a quick return
+    if (fact == 0.0)  return 0;
+
+    if (v.Size() != size) {
+	opserr << "WARNING BlockSparseGenLinSOE::setB() -";
+	opserr << " incomptable sizes " << size << " and " << v.Size() << endln;
+	return -1;
+    }
+
+    if (fact == 1.0) { // do not need to multiply if fact == 1.0
+	for (int i=0; i<size; i++) {
+	    B[i] = v(i);
+	}
+    } else if (fact == -1.0) {
+	for (int i=0; i<size; i++) {
+	    B[i] = -v(i);
+	}
+    } else {
+	for (int i=0; i<size; i++) {
+	    B[i] = v(i) * fact;
+	}
+    }
+    return 0;
+}
+
+
+void
+BlockSparseGenLinSOE::zeroA(void)
+{
+    int bs = blockSize;
+    int numA = numNonZeroBlocks*bs*bs;
+    double *Aptr = A;
+    for (int i=0; i<numA; i++)
+	*Aptr++ = 0;
+
+    // the identity diagonal of the padding
+    for (int I=0; I<numBlocks; I++) {
+	double *diag = &A[diagPos[I]*bs*bs];
+	for (int k=0; k<bs; k++)
+	    if (slotEqn[I*bs+k] < 0)
+		diag[k*bs+k] = 1.0;
+    }
+
+    factored = false;
+}
+
+
+void
+BlockSparseGenLinSOE::zeroB(void)
+{
+    double *Bptr = B;
+    for (int i=0; i<size; i++)
+	*Bptr++ = 0;
+}
+
+
+void
+BlockSparseGenLinSOE::setX(int loc, double value)
+{
+    if (loc < size && loc >= 0)
+	X[loc] = value;
+}
+
+
+void
+BlockSparseGenLinSOE::setX(const Vector &x)
+{
+    if (x.Size() == size && vectX != 0)
+	*vectX = x;
+}
+
+
+const Vector &
+BlockSparseGenLinSOE::getX(void)
+{
+    if (vectX == 0) {
+	opserr << "FATAL BlockSparseGenLinSOE::getX - vectX == 0";
+	exit(-1);
+    }
+    return *vectX;
+}
+
+
+const Vector &
+BlockSparseGenLinSOE::getB(void)
+{
+    if (vectB == 0) {
+	opserr << "FATAL BlockSparseGenLinSOE::getB - vectB == 0";
+	exit(-1);
+    }
+    return *vectB;
+}
+
+
+double
+BlockSparseGenLinSOE::normRHS(void)
+{
+    double norm =0.0;
+    for (int i=0; i<size; i++) {
+	double Yi = B[i];
+	norm += Yi*Yi;
+    }
+    return sqrt(norm);
+}
+
+
+void
+BlockSparseGenLinSOE::formAx(const double *x, double *y) const
+{
+    int bs = blockSize;
+    int bs2 = bs*bs;
+
+    for (int I=0; I<numBlocks; I++) {
+	double *yI = &y[I*bs];
+	for (int k=0; k<bs; k++)
+	    yI[k] = 0.0;
+
+	for (int p=rowStart[I]; p<rowStart[I+1]; p++) {
+	    const double *block = &A[p*bs2];
+	    const double *xJ = &x[colIndex[p]*bs];
+	    for (int k=0; k<bs; k++) {
+		double sum = 0.0;
+		for (int l=0; l<bs; l++)
+		    sum += block[l]*xJ[l];
+		yI[k] += sum;
+		block += bs;
+	    }
+	}
+    }
+}
+
+
+int
+BlockSparseGenLinSOE::setBlockSparseGenSolver(BlockSparseGenLinSolver &newSolver)
+{
+    newSolver.setLinearSOE(*this);
+
+    if (size != 0) {
+	int solverOK = newSolver.setSize();
+	if (solverOK < 0) {
+	    opserr << "WARNING:BlockSparseGenLinSOE::setSolver :";
+	    opserr << "the new solver could not setSeize() - staying with old\n";
+	    return -1;
+	}
+    }
+
+    return this->LinearSOE::setSolver(newSolver);
+}
+
+
+int
+BlockSparseGenLinSOE::sendSelf(int commitTag, Channel &theChannel)
+{
+    return 0;
+}
+
+
+int
+BlockSparseGenLinSOE::recvSelf(int commitTag, Channel &theChannel,
+			       FEM_ObjectBroker &theBroker)
+{
+    return 0;
+}
@@ -0,0 +1,107 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+
+#ifndef BlockSparseGenLinSOE_h
+#define BlockSparseGenLinSOE_h
+
+// Description: This file contains the class definition for
+// BlockSparseGenLinSOE. BlockSparseGenLinSOE is a subclass of LinearSOE.
+// It stores a general sparse A in block sparse row form keyed by the
+// DOF_Groups of the AnalysisModel: every DOF_Group is one block row and
+// column of blockSize equations, blockSize being the largest number of
+// equations of a DOF_Group, and A is stored as the dense blockSize x
+// blockSize blocks of the DOF_Group pairs coupled in the DOF_GroupGraph.
+// The slots of a block not used by an equation are padded with an
+// identity diagonal. The DOF_Groups are obtained in setLinks(); without
+// an AnalysisModel every equation is a block of size 1.
+//
+// What: "@(#) BlockSparseGenLinSOE.h, revA"
+
+#include <LinearSOE.h>
+#include <Vector.h>
+
+class BlockSparseGenLinSolver;
+
+class BlockSparseGenLinSOE : public LinearSOE
+{
+  public:
+    BlockSparseGenLinSOE(BlockSparseGenLinSolver &theSolver);
+
+    ~BlockSparseGenLinSOE();
+
+    int getNumEqn(void) const;
+    int setSize(Graph &theGraph);
+    int setLinks(AnalysisModel &theModel);
+    int addA(const Matrix &, const ID &, double fact = 1.0);
+    int addB(const Vector &, const ID &, double fact = 1.0);
+    int setB(const Vector &, double fact = 1.0);
+
+    void zeroA(void);
+    void zeroB(void);
+
+    const Vector &getX(void);
+    const Vector &getB(void);
+    double normRHS(void);
+
+    void setX(int loc, double value);
+    void setX(const Vector &x);
+    int setBlockSparseGenSolver(BlockSparseGenLinSolver &newSolver);
+
+    int getBlockSize(void) const;
+    int getNumBlocks(void) const;
+
+    // y = A x for vectors of numBlocks*blockSize entries in block order
+    void formAx(const double *x, double *y) const;
+
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel,
+		 FEM_ObjectBroker &theBroker);
+
+    friend class BlockSparseGenLinSolver;
+
+  protected:
+
+  private:
+    int size;            // order of A
+    double *B, *X;       // 1d arrays containing coefficients of B and X
+    Vector *vectX;
+    Vector *vectB;
+    int Bsize;
+    bool factored;
+
+    AnalysisModel *theModel;
+
+    int blockSize;       // number of equations in a block
+    int numBlocks;       // number of block rows
+    int *eqnSlot;        // block*blockSize+slot of each equation
+    int *slotEqn;        // equation in each slot, or -1 for the padding
+    int *rowStart;       // start of each block row in colIndex, numBlocks+1
+    int *colIndex;       // block columns of each block row, increasing
+    int *diagPos;        // position of the diagonal block of each row
+    int numNonZeroBlocks;
+    double *A;           // the blocks, row major blockSize x blockSize each
+
+    int *eleSlot;        // slots of an element's equations in addA()
+    int *runStart;       // runs of an element's equations in one block
+    int sizeEle;
+};
+
+#endif
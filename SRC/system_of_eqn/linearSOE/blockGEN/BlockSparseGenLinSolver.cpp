@@ -0,0 +1,531 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+
+// Description: This file contains the implementation for
+// BlockSparseGenLinSolver.
+//
+// What: "@(#) BlockSparseGenLinSolver.C, revA"
+
+#include <math.h>
+
+#include <BlockSparseGenLinSolver.h>
+#include <BlockSparseGenLinSOE.h>
+
+static double
+dotProduct(const double *a, const double *b, int n)
+{
+    double sum = 0.0;
+    for (int i=0; i<n; i++)
+	sum += a[i]*b[i];
+    return sum;
+}
+
+
+BlockSparseGenLinSolver::BlockSparseGenLinSolver(int precond, int meth,
+						 double tolerance, int maxIterations)
+:LinearSOESolver(SOLVER_TAGS_BlockSparseGenLinSolver),
+ theSOE(0), preconditioner(precond), method(meth), tol(tolerance),
+ maxIter(maxIterations), numIter(0),
+ M(0), sizeM(0), marker(0), work(0), sizeWork(0), blockWork(0)
+{
+
+}
+
+
+BlockSparseGenLinSolver::~BlockSparseGenLinSolver()
+{
+    if (M != 0) delete [] M;
+    if (marker != 0) delete [] marker;
+    if (work != 0) delete [] work;
+    if (blockWork != 0) delete [] blockWork;
+}
+
+
+int
+BlockSparseGenLinSolver::getNumIterations(void) const
+{
+    return numIter;
+}
+
+
+int
+BlockSparseGenLinSolver::solve(void)
+{
+    if (theSOE == 0) {
+	opserr << "WARNING BlockSparseGenLinSolver::solve(void)- ";
+	opserr << " No LinearSOE object has been set\n";
+	return -1;
+    }
+
+    int n = theSOE->size;
+    if (n == 0)
+	return 0;
+
+    if (work == 0) {
+	opserr << "WARNING BlockSparseGenLinSolver::solve(void)- ";
+	opserr << " setSize() has not been called\n";
+	return -1;
+    }
+
+    // form the preconditioner if A has changed
+    if (theSOE->factored == false) {
+	int result = this->factor();
+	if (result < 0)
+	    return result;
+	theSOE->factored = true;
+    }
+
+    // gather B into block order
+    int numSlots = theSOE->numBlocks*theSOE->blockSize;
+    const int *slotEqn = theSOE->slotEqn;
+    double *B = theSOE->B;
+    double *X = theSOE->X;
+    double *b = work;
+    double *x = &work[numSlots];
+
+    for (int s=0; s<numSlots; s++) {
+	int eqn = slotEqn[s];
+	b[s] = (eqn >= 0) ? B[eqn] : 0.0;
+	x[s] = 0.0;
+    }
+
+    int result = 0;
+    double normB = sqrt(dotProduct(b, b, numSlots));
+    numIter = 0;
+    if (normB != 0.0) {
+	if (method == BlockSparseBiCGStab)
+	    result = this->solveBiCGStab(b, x, normB);
+	else
+	    result = this->solveCG(b, x, normB);
+    }
+
+    // scatter the solution
+    for (int s=0; s<numSlots; s++) {
+	int eqn = slotEqn[s];
+	if (eqn >= 0)
+	    X[eqn] = x[s];
+    }
+
+    return result;
+}
+
+
+int
+BlockSparseGenLinSolver::solveCG(const double *b, double *x, double normB)
+{
+    int n = theSOE->numBlocks*theSOE->blockSize;
+    double *r = &work[2*n];
+    double *z = &work[3*n];
+    double *p = &work[4*n];
+    double *q = &work[5*n];
+
+    for (int i=0; i<n; i++)
+	r[i] = b[i];
+    this->precondition(r, z);
+    for (int i=0; i<n; i++)
+	p[i] = z[i];
+    double rz = dotProduct(r, z, n);
+
+    int maxIterations = (maxIter > 0) ? maxIter : n;
+    double normR = normB;
+
+    while (numIter < maxIterations) {
+	numIter++;
+
+	theSOE->formAx(p, q);
+	double pq = dotProduct(p, q, n);
+	if (pq == 0.0)
+	    break;
+
+	double alpha = rz/pq;
+	for (int i=0; i<n; i++) {
+	    x[i] += alpha*p[i];
+	    r[i] -= alpha*q[i];
+	}
+
+	normR = sqrt(dotProduct(r, r, n));
+	if (normR <= tol*normB)
+	    return 0;
+
+	this->precondition(r, z);
+	double rzNew = dotProduct(r, z, n);
+	double beta = rzNew/rz;
+	rz = rzNew;
+	for (int i=0; i<n; i++)
+	    p[i] = z[i] + beta*p[i];
+    }
+
+    opserr << "WARNING BlockSparseGenLinSolver::solve() - CG failed to converge in ";
+    opserr << numIter << " iterations, relative residual " << normR/normB << endln;
+    return -3;
+}
+
+
+int
+BlockSparseGenLinSolver::solveBiCGStab(const double *b, double *x, double normB)
+{
+    int n = theSOE->numBlocks*theSOE->blockSize;
+    double *r = &work[2*n];
+    double *rHat = &work[3*n];
+    double *p = &work[4*n];
+    double *v = &work[5*n];
+    double *pHat = &work[6*n];
+    double *s = &work[7*n];
+    double *sHat = &work[8*n];
+    double *t = &work[9*n];
+
+    for (int i=0; i<n; i++) {
+	r[i] = b[i];
+	rHat[i] = b[i];
+	p[i] = 0.0;
+	v[i] = 0.0;
+    }
+
+    double rho = 1.0;
+    double alpha = 1.0;
+    double omega = 1.0;
+
+    int maxIterations = (maxIter > 0) ? maxIter : n;
+    double normR = normB;
+
+    while (numIter < maxIterations) {
+	numIter++;
+
+	double rhoNew = dotProduct(rHat, r, n);
+	if (rhoNew == 0.0)
+	    break;
+
+	double beta = (rhoNew/rho)*(alpha/omega);
+	rho = rhoNew;
+	for (int i=0; i<n; i++)
+	    p[i] = r[i] + beta*(p[i] - omega*v[i]);
+
+	this->precondition(p, pHat);
+	theSOE->formAx(pHat, v);
+	double rHatv = dotProduct(rHat, v, n);
+	if (rHatv == 0.0)
+	    break;
+	alpha = rho/rHatv;
+
+	for (int i=0; i<n; i++)
+	    s[i] = r[i] - alpha*v[i];
+	normR = sqrt(dotProduct(s, s, n));
+	if (normR <= tol*normB) {
+	    for (int i=0; i<n; i++)
+		x[i] += alpha*pHat[i];
+	    return 0;
+	}
+
+	this->precondition(s, sHat);
+	theSOE->formAx(sHat, t);
+	double tt = dotProduct(t, t, n);
+	if (tt == 0.0)
+	    break;
+	omega = dotProduct(t, s, n)/tt;
+
+	for (int i=0; i<n; i++) {
+	    x[i] += alpha*pHat[i] + omega*sHat[i];
+	    r[i] = s[i] - omega*t[i];
+	}
+
+	normR = sqrt(dotProduct(r, r, n));
+	if (normR <= tol*normB)
+	    return 0;
+	if (omega == 0.0)
+	    break;
+    }
+
+    opserr << "WARNING BlockSparseGenLinSolver::solve() - BiCGStab failed to converge in ";
+    opserr << numIter << " iterations, relative residual " << normR/normB << endln;
+    return -3;
+}
+
+
+int
+BlockSparseGenLinSolver::factor(void)
+{
+    int bs = theSOE->blockSize;
+    int bs2 = bs*bs;
+    int numBlocks = theSOE->numBlocks;
+    const int *rowStart = theSOE->rowStart;
+    const int *colIndex = theSOE->colIndex;
+    const int *diagPos = theSOE->diagPos;
+    const double *A = theSOE->A;
+
+    if (preconditioner == BlockSparseJacobi) {
+	for (int I=0; I<numBlocks; I++) {
+	    double *diag = &M[I*bs2];
+	    const double *Aptr = &A[diagPos[I]*bs2];
+	    for (int k=0; k<bs2; k++)
+		diag[k] = Aptr[k];
+	    if (this->invertBlock(diag) < 0) {
+		opserr << "WARNING BlockSparseGenLinSolver::solve() - diagonal block ";
+		opserr << I << " is singular\n";
+		return -2;
+	    }
+	}
+	return 0;
+    }
+
+    //
+    // incomplete block LU with the structure of A, row by row: the blocks
+    // L(I,J) = A(I,J) inv(U(J,J)) left of the diagonal eliminate the block
+    // rows J above; the inverse of U(I,I) is stored for the diagonal
+    //
+
+    int numA = theSOE->numNonZeroBlocks*bs2;
+    for (int i=0; i<numA; i++)
+	M[i] = A[i];
+
+    double *product = &blockWork[bs2];
+
+    for (int I=0; I<numBlocks; I++) {
+	for (int p=rowStart[I]; p<rowStart[I+1]; p++)
+	    marker[colIndex[p]] = p;
+
+	for (int p=rowStart[I]; p<diagPos[I]; p++) {
+	    int J = colIndex[p];
+	    double *LIJ = &M[p*bs2];
+	    const double *invUJJ = &M[diagPos[J]*bs2];
+
+	    // L(I,J) = A(I,J) inv(U(J,J))
+	    for (int i=0; i<bs; i++)
+		for (int j=0; j<bs; j++) {
+		    double sum = 0.0;
+		    for (int k=0; k<bs; k++)
+			sum += LIJ[i*bs+k]*invUJJ[k*bs+j];
+		    product[i*bs+j] = sum;
+		}
+	    for (int k=0; k<bs2; k++)
+		LIJ[k] = product[k];
+
+	    // A(I,K) -= L(I,J) U(J,K) for the blocks K of row I right of J
+	    for (int q=diagPos[J]+1; q<rowStart[J+1]; q++) {
+		int pos = marker[colIndex[q]];
+		if (pos < 0)
+		    continue;
+		double *AIK = &M[pos*bs2];
+		const double *UJK = &M[q*bs2];
+		for (int i=0; i<bs; i++)
+		    for (int j=0; j<bs; j++) {
+			double sum = 0.0;
+			for (int k=0; k<bs; k++)
+			    sum += LIJ[i*bs+k]*UJK[k*bs+j];
+			AIK[i*bs+j] -= sum;
+		    }
+	    }
+	}
+
+	for (int p=rowStart[I]; p<rowStart[I+1]; p++)
+	    marker[colIndex[p]] = -1;
+
+	if (this->invertBlock(&M[diagPos[I]*bs2]) < 0) {
+	    opserr << "WARNING BlockSparseGenLinSolver::solve() - pivot block ";
+	    opserr << I << " of the incomplete factorization is singular\n";
+	    return -2;
+	}
+    }
+
+    return 0;
+}
+
+
+void
+BlockSparseGenLinSolver::precondition(const double *r, double *z) const
+{
+    int bs = theSOE->blockSize;
+    int bs2 = bs*bs;
+    int numBlocks = theSOE->numBlocks;
+
+    if (preconditioner == BlockSparseJacobi) {
+	for (int I=0; I<numBlocks; I++) {
+	    const double *invD = &M[I*bs2];
+	    const double *rI = &r[I*bs];
+	    double *zI = &z[I*bs];
+	    for (int i=0; i<bs; i++) {
+		double sum = 0.0;
+		for (int j=0; j<bs; j++)
+		    sum += invD[i*bs+j]*rI[j];
+		zI[i] = sum;
+	    }
+	}
+	return;
+    }
+
+    const int *rowStart = theSOE->rowStart;
+    const int *colIndex = theSOE->colIndex;
+    const int *diagPos = theSOE->diagPos;
+
+    // forward substitution with the unit lower blocks
+    for (int I=0; I<numBlocks; I++) {
+	double *zI = &z[I*bs];
+	for (int i=0; i<bs; i++)
+	    zI[i] = r[I*bs+i];
+	for (int p=rowStart[I]; p<diagPos[I]; p++) {
+	    const double *LIJ = &M[p*bs2];
+	    const double *zJ = &z[colIndex[p]*bs];
+	    for (int i=0; i<bs; i++) {
+		double sum = 0.0;
+		for (int j=0; j<bs; j++)
+		    sum += LIJ[i*bs+j]*zJ[j];
+		zI[i] -= sum;
+	    }
+	}
+    }
+
+    // back substitution with the upper blocks
+    double *t = blockWork;
+    for (int I=numBlocks-1; I>=0; I--) {
+	double *zI = &z[I*bs];
+	for (int p=diagPos[I]+1; p<rowStart[I+1]; p++) {
+	    const double *UIK = &M[p*bs2];
+	    const double *zK = &z[colIndex[p]*bs];
+	    for (int i=0; i<bs; i++) {
+		double sum = 0.0;
+		for (int j=0; j<bs; j++)
+		    sum += UIK[i*bs+j]*zK[j];
+		zI[i] -= sum;
+	    }
+	}
+	const double *invUII = &M[diagPos[I]*bs2];
+	for (int i=0; i<bs; i++) {
+	    double sum = 0.0;
+	    for (int j=0; j<bs; j++)
+		sum += invUII[i*bs+j]*zI[j];
+	    t[i] = sum;
+	}
+	for (int i=0; i<bs; i++)
+	    zI[i] = t[i];
+    }
+}
+
+
+int
+BlockSparseGenLinSolver::invertBlock(double *block)
+{
+    // Gauss-Jordan elimination with partial pivoting on a copy of the
+    // block, the block being turned into the inverse
+    int n = theSOE->blockSize;
+    double *a = blockWork;
+    for (int k=0; k<n*n; k++) {
+	a[k] = block[k];
+	block[k] = 0.0;
+    }
+    for (int i=0; i<n; i++)
+	block[i*n+i] = 1.0;
+
+    for (int c=0; c<n; c++) {
+	int pivot = c;
+	double maxValue = fabs(a[c*n+c]);
+	for (int r=c+1; r<n; r++)
+	    if (fabs(a[r*n+c]) > maxValue) {
+		maxValue = fabs(a[r*n+c]);
+		pivot = r;
+	    }
+	if (maxValue == 0.0)
+	    return -1;
+
+	if (pivot != c)
+	    for (int k=0; k<n; k++) {
+		double tmp = a[c*n+k]; a[c*n+k] = a[pivot*n+k]; a[pivot*n+k] = tmp;
+		tmp = block[c*n+k]; block[c*n+k] = block[pivot*n+k]; block[pivot*n+k] = tmp;
+	    }
+
+	double d = 1.0/a[c*n+c];
+	for (int k=0; k<n; k++) {
+	    a[c*n+k] *= d;
+	    block[c*n+k] *= d;
+	}
+
+	for (int r=0; r<n; r++) {
+	    if (r == c)
+		continue;
+	    double f = a[r*n+c];
+	    if (f == 0.0)
+		continue;
+	    for (int k=0; k<n; k++) {
+		a[r*n+k] -= f*a[c*n+k];
+		block[r*n+k] -= f*block[c*n+k];
+	    }
+	}
+    }
+
+    return 0;
+}
+
+
+int
+BlockSparseGenLinSolver::setSize(void)
+{
+    if (M != 0) delete [] M;
+    if (marker != 0) delete [] marker;
+    if (work != 0) delete [] work;
+    if (blockWork != 0) delete [] blockWork;
+    M = 0; marker = 0; work = 0; blockWork = 0;
+    sizeM = 0; sizeWork = 0;
+
+    int bs = theSOE->blockSize;
+    int numBlocks = theSOE->numBlocks;
+    if (numBlocks == 0)
+	return 0;
+
+    if (preconditioner == BlockSparseJacobi)
+	sizeM = numBlocks*bs*bs;
+    else
+	sizeM = theSOE->numNonZeroBlocks*bs*bs;
+    M = new double[sizeM];
+
+    marker = new int[numBlocks];
+    for (int I=0; I<numBlocks; I++)
+	marker[I] = -1;
+
+    // B and X, and the vectors of the Krylov method
+    sizeWork = 10*numBlocks*bs;
+    work = new double[sizeWork];
+    blockWork = new double[2*bs*bs];
+
+    return 0;
+}
+
+
+int
+BlockSparseGenLinSolver::setLinearSOE(BlockSparseGenLinSOE &theLinearSOE)
+{
+    theSOE = &theLinearSOE;
+    return 0;
+}
+
+
+int
+BlockSparseGenLinSolver::sendSelf(int cTag, Channel &theChannel)
+{
+    // nothing to do
+    return 0;
+}
+
+
+int
+BlockSparseGenLinSolver::recvSelf(int cTag, Channel &theChannel,
+				  FEM_ObjectBroker &theBroker)
+{
+    // nothing to do
+    return 0;
+}
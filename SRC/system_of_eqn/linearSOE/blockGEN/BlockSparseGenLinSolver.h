@@ -0,0 +1,90 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+
+#ifndef BlockSparseGenLinSolver_h
+#define BlockSparseGenLinSolver_h
+
+// Description: This file contains the class definition for
+// BlockSparseGenLinSolver. It solves a BlockSparseGenLinSOE object by a
+// preconditioned Krylov method working on the blocks of the SOE: BiCGStab,
+// the default as A is general, or the conjugate gradient method, which
+// requires A to be symmetric positive definite. The
+// preconditioner is either an incomplete block LU factorization with the
+// block structure of A, ILU(0), or the inverted diagonal blocks.
+//
+// What: "@(#) BlockSparseGenLinSolver.h, revA"
+
+#include <LinearSOESolver.h>
+
+// preconditioners
+#define BlockSparseJacobi   0
+#define BlockSparseILU      1
+
+// Krylov methods
+#define BlockSparseCG       0
+#define BlockSparseBiCGStab 1
+
+class BlockSparseGenLinSOE;
+
+class BlockSparseGenLinSolver : public LinearSOESolver
+{
+  public:
+    BlockSparseGenLinSolver(int preconditioner = BlockSparseILU,
+			    int method = BlockSparseBiCGStab,
+			    double tol = 1.0e-10, int maxIter = 0);
+    ~BlockSparseGenLinSolver();
+
+    int solve(void);
+    int setSize(void);
+
+    int setLinearSOE(BlockSparseGenLinSOE &theSOE);
+    int getNumIterations(void) const;
+
+    int sendSelf(int cTag, Channel &theChannel);
+    int recvSelf(int cTag,
+		 Channel &theChannel,
+		 FEM_ObjectBroker &theBroker);
+
+  protected:
+
+  private:
+    int factor(void);
+    void precondition(const double *r, double *z) const;
+    int solveCG(const double *b, double *x, double normB);
+    int solveBiCGStab(const double *b, double *x, double normB);
+    int invertBlock(double *block);
+
+    BlockSparseGenLinSOE *theSOE;
+    int preconditioner;
+    int method;
+    double tol;          // on the norm of the residual relative to that of B
+    int maxIter;         // 0 for the number of equations
+    int numIter;         // iterations of the last solve
+
+    double *M;           // the preconditioner blocks
+    int sizeM;
+    int *marker;         // positions of the block columns of a row
+    double *work;        // the Krylov vectors, of numBlocks*blockSize each
+    int sizeWork;
+    double *blockWork;   // two blocks for the inversion and products
+};
+
+#endif
@@ -0,0 +1,462 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the implementation for
+// OutOfCoreProfileSPDLinSOE.
+//
+// What: "@(#) OutOfCoreProfileSPDLinSOE.cpp, revA"
+
+#include <OutOfCoreProfileSPDLinSOE.h>
+#include <OutOfCoreProfileSPDLinSolver.h>
+#include <Matrix.h>
+#include <Graph.h>
+#include <Vertex.h>
+#include <VertexIter.h>
+#include <classTags.h>
+
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <limits.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+OutOfCoreProfileSPDLinSOE::OutOfCoreProfileSPDLinSOE(OutOfCoreProfileSPDLinSolver &the_Solver,
+						     double budget,
+						     const char *name)
+:ProfileSPDLinSOE(the_Solver, LinSOE_TAGS_OutOfCoreProfileSPDLinSOE),
+ memoryBudget(budget), fileName(0), fd(-1), pageSize(sysconf(_SC_PAGESIZE)),
+ diagLoc(0), numEntries(0), numBlocks(0), blockStart(0), colBlock(0), numWindows(0)
+{
+    if (name != 0) {
+	fileName = new char[strlen(name)+1];
+	strcpy(fileName, name);
+    }
+
+    the_Solver.setLinearSOE(*this);
+}
+
+
+OutOfCoreProfileSPDLinSOE::~OutOfCoreProfileSPDLinSOE()
+{
+    this->releaseWindows();
+
+    if (fd >= 0) close(fd);
+    if (fileName != 0) delete [] fileName;
+    if (diagLoc != 0) delete [] diagLoc;
+    if (blockStart != 0) delete [] blockStart;
+    if (colBlock != 0) delete [] colBlock;
+}
+
+
+int
+OutOfCoreProfileSPDLinSOE::setSize(Graph &theGraph)
+{
+    int oldSize = size;
+    int result = 0;
+    size = theGraph.getNumVertex();
+
+    this->releaseWindows();
+
+    // the column heights, as in ProfileSPDLinSOE::setSize()
+    if (size > Bsize) {
+	if (diagLoc != 0) delete [] diagLoc;
+	if (colBlock != 0) delete [] colBlock;
+	if (blockStart != 0) delete [] blockStart;
+	diagLoc = new long long[size];
+	colBlock = new int[size];
+	blockStart = new int[size+1];
+
+	if (diagLoc == 0 || colBlock == 0 || blockStart == 0) {
+	    opserr << "WARNING OutOfCoreProfileSPDLinSOE::setSize() : ";
+	    opserr << " - ran out of memory for diagLoc\n";
+	    size = 0;
+	    return -1;
+	}
+    }
+
+    for (int i=0; i<size; i++)
+	diagLoc[i] = 0;
+
+    Vertex *vertexPtr;
+    VertexIter &theVertices = theGraph.getVertices();
+
+    while ((vertexPtr = theVertices()) != 0) {
+	int vertexNum = vertexPtr->getTag();
+	const ID &theAdjacency = vertexPtr->getAdjacency();
+	for (int i=0; i<theAdjacency.Size(); i++) {
+	    int diff = vertexNum - theAdjacency(i);
+	    if (diff > diagLoc[vertexNum])
+		diagLoc[vertexNum] = diff;
+	}
+    }
+
+    if (size > 0)
+	diagLoc[0] = 1; // NOTE FORTRAN ARRAY LOCATION
+
+    // the heights are ints, their sum fits easily in a long long
+    for (int j=1; j<size; j++)
+	diagLoc[j] = diagLoc[j] + 1 + diagLoc[j-1];
+
+    numEntries = (size > 0) ? diagLoc[size-1] : 0;
+    profileSize = 0;   // the int of ProfileSPDLinSOE is not used
+
+    // the offsets in the file must fit in an off_t
+    off_t maxEntries = (off_t)((sizeof(off_t) >= sizeof(long long)) ? LLONG_MAX : LONG_MAX)
+	/ (off_t)sizeof(double);
+    if (numEntries > (long long)maxEntries) {
+	opserr << "WARNING OutOfCoreProfileSPDLinSOE::setSize() : ";
+	opserr << " the profile of " << (double)numEntries;
+	opserr << " entries is larger than a file can be addressed\n";
+	size = 0; numEntries = 0;
+	return -1;
+    }
+
+    // group the columns into blocks that, once page aligned, need no
+    // more than a third of the budget; a column larger than that is a
+    // block of its own. the size is formed as a double and clamped, a
+    // large budget gives more terms than a block can map
+    double maxBlockSize = memoryBudget/(OUT_OF_CORE_NUM_WINDOWS*sizeof(double))
+	- (double)(pageSize/sizeof(double));
+    double maxMapSize = (double)((size_t)-1/(2*sizeof(double)));
+    if (maxBlockSize > maxMapSize)
+	maxBlockSize = maxMapSize;
+    long long maxBlock;
+    if (maxBlockSize < 1.0)
+	maxBlock = 1;
+    else
+	maxBlock = (long long)maxBlockSize;
+    bool overBudget = false;
+
+    numBlocks = 0;
+    int blockFirst = 0;
+    for (int j=0; j<size; j++) {
+	long long first = (blockFirst == 0) ? 0 : diagLoc[blockFirst-1];
+	if (j > blockFirst && diagLoc[j] - first > maxBlock) {
+	    blockStart[numBlocks++] = blockFirst;
+	    blockFirst = j;
+	}
+	if (diagLoc[j] - ((j == 0) ? 0 : diagLoc[j-1]) > maxBlock)
+	    overBudget = true;
+	colBlock[j] = numBlocks;
+    }
+    if (size > 0) {
+	blockStart[numBlocks++] = blockFirst;
+	blockStart[numBlocks] = size;
+    }
+
+    if (overBudget == true) {
+	opserr << "WARNING OutOfCoreProfileSPDLinSOE::setSize() : ";
+	opserr << " a column of A needs more than a third of the memory budget of ";
+	opserr << memoryBudget << " bytes, the budget will be exceeded\n";
+    }
+
+    // open the scratch file and size it; a file extended by ftruncate()
+    // reads as zeros, so A is zeroed without touching the disk
+    if (fd < 0) {
+	if (fileName != 0)
+	    fd = open(fileName, O_RDWR | O_CREAT | O_EXCL, 0600);
+	else {
+	    const char *dir = getenv("TMPDIR");
+	    if (dir == 0) dir = "/tmp";
+	    char *tmpName = new char[strlen(dir) + 32];
+	    strcpy(tmpName, dir);
+	    strcat(tmpName, "/OpenSeesProfileXXXXXX");
+	    fd = mkstemp(tmpName);
+	    if (fd >= 0) unlink(tmpName);
+	    delete [] tmpName;
+	}
+	if (fd >= 0 && fileName != 0)
+	    unlink(fileName);
+
+	if (fd < 0) {
+	    opserr << "WARNING OutOfCoreProfileSPDLinSOE::setSize() : ";
+	    opserr << " could not open the scratch file: " << strerror(errno) << endln;
+	    size = 0; numEntries = 0;
+	    return -1;
+	}
+    }
+
+    off_t fileSize = (off_t)numEntries * (off_t)sizeof(double);
+    if (ftruncate(fd, 0) != 0 || ftruncate(fd, fileSize) != 0) {
+	opserr << "WARNING OutOfCoreProfileSPDLinSOE::setSize() : ";
+	opserr << " could not size the scratch file for " << (double)numEntries;
+	opserr << " entries: " << strerror(errno) << endln;
+	size = 0; numEntries = 0;
+	return -1;
+    }
+
+    isAfactored = false;
+    isAcondensed = false;
+
+    if (size > Bsize) {
+	if (B != 0) delete [] B;
+	if (X != 0) delete [] X;
+
+	B = new double[size];
+	X = new double[size];
+
+        if (B == 0 || X == 0 ) {
+            opserr << "OutOfCoreProfileSPDLinSOE::setSize() :";
+	    opserr << " ran out of memory for vectors (size) (";
+	    opserr << size << ") \n";
+	    size = 0; Bsize = 0;
+	    return -1;
+        }
+    }
+
+    for (int l=0; l<size; l++) {
+	B[l] = 0;
+	X[l] = 0;
+    }
+
+    if (size != oldSize) {
+	if (vectX != 0)
+	    delete vectX;
+	if (vectB != 0)
+	    delete vectB;
+
+	vectX = new Vector(X,size);
+	vectB = new Vector(B,size);
+
+	if (size > Bsize)
+	    Bsize = size;
+    }
+
+    // invoke setSize() on the Solver
+    LinearSOESolver *the_Solver = this->getSolver();
+    int solverOK = the_Solver->setSize();
+    if (solverOK < 0) {
+	opserr << "WARNING OutOfCoreProfileSPDLinSOE::setSize :";
+	opserr << " solver failed setSize()\n";
+	return solverOK;
+    }
+
+    return result;
+}
+
+
+int
+OutOfCoreProfileSPDLinSOE::addA(const Matrix &m, const ID &id, double fact)
+{
+    // check for a quick return
+    if (fact == 0.0)  return 0;
+
+    // check that m and id are of similar size
+    int idSize = id.Size();
+    if (idSize != m.noRows() && idSize != m.noCols()) {
+	opserr << "OutOfCoreProfileSPDLinSOE::addA()	- Matrix and ID not of similar sizes\n";
+	return -1;
+    }
+
+    for (int i=0; i<idSize; i++) {
+	int col = id(i);
+	if (col < size && col >= 0) {
+	    int block = colBlock[col];
+	    double *theBlock = this->getWindow(block);
+	    if (theBlock == 0)
+		return -1;
+
+	    int first = blockStart[block];
+	    long long blockOffset = (first == 0) ? 0 : diagLoc[first-1];
+	    double *coliiPtr = theBlock + (diagLoc[col] - 1 - blockOffset);
+	    int minColRow;
+	    if (col == 0)
+		minColRow = 0;
+	    else
+		minColRow = col - (int)(diagLoc[col] - diagLoc[col-1]) +1;
+	    for (int j=0; j<idSize; j++) {
+		int row = id(j);
+		if (row <size && row >= 0 &&
+		    row <= col && row >= minColRow) {
+
+		    // we only add upper and inside profile
+		    double *APtr = coliiPtr + (row-col);
+		    *APtr += m(j,i) * fact;
+		}
+	    }  // for j
+	}
+    }  // for i
+
+    return 0;
+}
+
+
+void
+OutOfCoreProfileSPDLinSOE::zeroA(void)
+{
+    this->releaseWindows();
+
+    if (fd >= 0) {
+	off_t fileSize = (off_t)numEntries * (off_t)sizeof(double);
+	if (ftruncate(fd, 0) != 0 || ftruncate(fd, fileSize) != 0) {
+	    opserr << "WARNING OutOfCoreProfileSPDLinSOE::zeroA() : ";
+	    opserr << " could not zero the scratch file: " << strerror(errno) << endln;
+	}
+    }
+
+    isAfactored = false;
+}
+
+
+int
+OutOfCoreProfileSPDLinSOE::setProfileSPDSolver(ProfileSPDLinSolver &newSolver)
+{
+    if (newSolver.getClassTag() != SOLVER_TAGS_OutOfCoreProfileSPDLinSolver) {
+	opserr << "WARNING:OutOfCoreProfileSPDLinSOE::setSolver :";
+	opserr << " the new solver is not an OutOfCoreProfileSPDLinSolver - staying with old\n";
+	return -1;
+    }
+
+    ((OutOfCoreProfileSPDLinSolver &)newSolver).setLinearSOE(*this);
+
+    if (size != 0) {
+	int solverOK = newSolver.setSize();
+	if (solverOK < 0) {
+	    opserr << "WARNING:OutOfCoreProfileSPDLinSOE::setSolver :";
+	    opserr << "the new solver could not setSeize() - staying with old\n";
+	    return -1;
+	}
+    }
+
+    return this->setSolver(newSolver);
+}
+
+
+int
+OutOfCoreProfileSPDLinSOE::getNumBlocks(void) const
+{
+    return numBlocks;
+}
+
+
+double
+OutOfCoreProfileSPDLinSOE::getMemoryBudget(void) const
+{
+    return memoryBudget;
+}
+
+
+// maps the part of the file holding block; the mapping starts at the page
+// holding its first entry, the pointer returned is to that entry
+double *
+OutOfCoreProfileSPDLinSOE::mapBlock(int block)
+{
+    int first = blockStart[block];
+    int last = blockStart[block+1] - 1;
+    off_t start = (off_t)((first == 0) ? 0 : diagLoc[first-1]) * (off_t)sizeof(double);
+    off_t end = (off_t)diagLoc[last] * (off_t)sizeof(double);
+    off_t mapStart = start - start % pageSize;
+
+    void *theMap = mmap(0, (size_t)(end - mapStart), PROT_READ | PROT_WRITE, MAP_SHARED,
+			fd, mapStart);
+    if (theMap == MAP_FAILED) {
+	opserr << "WARNING OutOfCoreProfileSPDLinSOE::mapBlock() : ";
+	opserr << " could not map block " << block << ": " << strerror(errno) << endln;
+	return 0;
+    }
+
+    return (double *)((char *)theMap + (start - mapStart));
+}
+
+
+void
+OutOfCoreProfileSPDLinSOE::unmapBlock(int block, double *theBlock, bool write)
+{
+    if (theBlock == 0)
+	return;
+
+    int first = blockStart[block];
+    int last = blockStart[block+1] - 1;
+    off_t start = (off_t)((first == 0) ? 0 : diagLoc[first-1]) * (off_t)sizeof(double);
+    off_t end = (off_t)diagLoc[last] * (off_t)sizeof(double);
+    off_t mapStart = start - start % pageSize;
+    char *theMap = (char *)theBlock - (start - mapStart);
+
+    // start the write back of a modified block before it is released
+    if (write == true)
+	msync(theMap, (size_t)(end - mapStart), MS_ASYNC);
+    munmap(theMap, (size_t)(end - mapStart));
+}
+
+
+// asks the kernel to start reading block in, so that it is in the page
+// cache by the time it is mapped
+void
+OutOfCoreProfileSPDLinSOE::prefetchBlock(int block)
+{
+    if (block < 0 || block >= numBlocks)
+	return;
+
+    int first = blockStart[block];
+    int last = blockStart[block+1] - 1;
+    off_t start = (off_t)((first == 0) ? 0 : diagLoc[first-1]) * (off_t)sizeof(double);
+    off_t end = (off_t)diagLoc[last] * (off_t)sizeof(double);
+
+    posix_fadvise(fd, start, end - start, POSIX_FADV_WILLNEED);
+}
+
+
+// returns the mapping of block used by addA(), replacing the least
+// recently used mapping if all the windows are in use
+double *
+OutOfCoreProfileSPDLinSOE::getWindow(int block)
+{
+    for (int i=numWindows-1; i>=0; i--)
+	if (windowBlock[i] == block) {
+	    double *theBlock = window[i];
+	    for (int j=i; j<numWindows-1; j++) {
+		windowBlock[j] = windowBlock[j+1];
+		window[j] = window[j+1];
+	    }
+	    windowBlock[numWindows-1] = block;
+	    window[numWindows-1] = theBlock;
+	    return theBlock;
+	}
+
+    if (numWindows == OUT_OF_CORE_NUM_WINDOWS) {
+	this->unmapBlock(windowBlock[0], window[0], true);
+	for (int j=0; j<numWindows-1; j++) {
+	    windowBlock[j] = windowBlock[j+1];
+	    window[j] = window[j+1];
+	}
+	numWindows--;
+    }
+
+    double *theBlock = this->mapBlock(block);
+    if (theBlock == 0)
+	return 0;
+
+    windowBlock[numWindows] = block;
+    window[numWindows] = theBlock;
+    numWindows++;
+
+    return theBlock;
+}
+
+
+void
+OutOfCoreProfileSPDLinSOE::releaseWindows(void)
+{
+    for (int i=0; i<numWindows; i++)
+	this->unmapBlock(windowBlock[i], window[i], true);
+    numWindows = 0;
+}
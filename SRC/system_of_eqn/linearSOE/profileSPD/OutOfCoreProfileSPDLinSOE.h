@@ -0,0 +1,91 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+#ifndef OutOfCoreProfileSPDLinSOE_h
+#define OutOfCoreProfileSPDLinSOE_h
+
+// Description: This file contains the class definition for
+// OutOfCoreProfileSPDLinSOE. OutOfCoreProfileSPDLinSOE is a subclass of
+// ProfileSPDLinSOE that keeps the profile of A in a scratch file instead
+// of in memory. The columns are grouped into blocks of at most a third
+// of the memory budget; a block is accessed by mapping its part of the
+// file, and at most three blocks are mapped at any time, so the memory
+// used for A is bounded by the budget. The scratch file is unlinked as
+// soon as it is opened and so does not outlive the SOE. B, X and the
+// locations of the diagonal in diagLoc are kept in memory; they are 64
+// bit, so the profile is not limited to the 2^31-1 entries of the int
+// iDiagLoc and profileSize of ProfileSPDLinSOE, which are not used.
+// POSIX only.
+//
+// What: "@(#) OutOfCoreProfileSPDLinSOE.h, revA"
+
+#include <ProfileSPDLinSOE.h>
+
+class OutOfCoreProfileSPDLinSolver;
+
+#define OUT_OF_CORE_NUM_WINDOWS 3
+
+class OutOfCoreProfileSPDLinSOE : public ProfileSPDLinSOE
+{
+  public:
+    OutOfCoreProfileSPDLinSOE(OutOfCoreProfileSPDLinSolver &theSolver,
+			      double memoryBudget = 64.0e6,
+			      const char *fileName = 0);
+    ~OutOfCoreProfileSPDLinSOE();
+
+    int setSize(Graph &theGraph);
+    int addA(const Matrix &, const ID &, double fact = 1.0);
+    void zeroA(void);
+
+    int setProfileSPDSolver(ProfileSPDLinSolver &newSolver);
+
+    int getNumBlocks(void) const;
+    double getMemoryBudget(void) const;
+
+    friend class OutOfCoreProfileSPDLinSolver;
+
+  protected:
+
+  private:
+    double *mapBlock(int block);
+    void unmapBlock(int block, double *theBlock, bool write);
+    void prefetchBlock(int block);
+    double *getWindow(int block);
+    void releaseWindows(void);
+
+    double memoryBudget;   // bytes of A mapped at any one time
+    char *fileName;        // scratch file, or 0 for one in TMPDIR
+    int fd;                // descriptor of the scratch file, -1 if not open
+    long pageSize;
+
+    long long *diagLoc;    // location of the diagonal of each column, from 1
+    long long numEntries;  // entries in the profile of A
+
+    int numBlocks;
+    int *blockStart;       // first column of each block, numBlocks+1
+    int *colBlock;         // block of each column
+
+    // the blocks mapped for addA(), least recently used first
+    int numWindows;
+    int windowBlock[OUT_OF_CORE_NUM_WINDOWS];
+    double *window[OUT_OF_CORE_NUM_WINDOWS];
+};
+
+#endif
@@ -0,0 +1,341 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the implementation for
+// OutOfCoreProfileSPDLinSolver.
+//
+// What: "@(#) OutOfCoreProfileSPDLinSolver.cpp, revA"
+
+#include <OutOfCoreProfileSPDLinSolver.h>
+#include <OutOfCoreProfileSPDLinSOE.h>
+#include <math.h>
+#include <classTags.h>
+
+OutOfCoreProfileSPDLinSolver::OutOfCoreProfileSPDLinSolver(double tol)
+:ProfileSPDLinSolver(SOLVER_TAGS_OutOfCoreProfileSPDLinSolver),
+ theOutOfCoreSOE(0), minDiagTol(tol), size(0), RowTop(0), colStart(0), invD(0)
+{
+
+}
+
+
+OutOfCoreProfileSPDLinSolver::~OutOfCoreProfileSPDLinSolver()
+{
+    if (RowTop != 0) delete [] RowTop;
+    if (colStart != 0) delete [] colStart;
+    if (invD != 0) delete [] invD;
+}
+
+
+int
+OutOfCoreProfileSPDLinSolver::setLinearSOE(ProfileSPDLinSOE &theProfileSPDSOE)
+{
+    // only an OutOfCoreProfileSPDLinSOE can be solved, it is set below
+    theSOE = &theProfileSPDSOE;
+    theOutOfCoreSOE = 0;
+    return 0;
+}
+
+
+int
+OutOfCoreProfileSPDLinSolver::setLinearSOE(OutOfCoreProfileSPDLinSOE &theProfileSPDSOE)
+{
+    theSOE = &theProfileSPDSOE;
+    theOutOfCoreSOE = &theProfileSPDSOE;
+    return 0;
+}
+
+
+int
+OutOfCoreProfileSPDLinSolver::setSize(void)
+{
+    if (theOutOfCoreSOE == 0) {
+	opserr << "OutOfCoreProfileSPDLinSolver::setSize()";
+	opserr << " No OutOfCoreProfileSPDLinSOE has been set\n";
+	return -1;
+    }
+
+    // check for quick return
+    if (theOutOfCoreSOE->size == 0)
+	return 0;
+
+    size = theOutOfCoreSOE->size;
+
+    if (RowTop != 0) delete [] RowTop;
+    if (colStart != 0) delete [] colStart;
+    if (invD != 0) delete [] invD;
+
+    RowTop = new int[size];
+    colStart = new long long[size];
+    invD = new double[size];
+
+    if (RowTop == 0 || colStart == 0 || invD == 0) {
+	opserr << "Warning :OutOfCoreProfileSPDLinSolver::setSize() :";
+	opserr << " ran out of memory for work areas \n";
+	return -1;
+    }
+
+    long long *diagLoc = theOutOfCoreSOE->diagLoc;
+
+    RowTop[0] = 0;
+    colStart[0] = 0;
+    for (int j=1; j<size; j++) {
+	int icolsz = (int)(diagLoc[j] - diagLoc[j-1]);
+	RowTop[j] = j - icolsz +  1;
+	colStart[j] = diagLoc[j-1]; // FORTRAN array indexing in diagLoc
+    }
+
+    return 0;
+}
+
+
+int
+OutOfCoreProfileSPDLinSolver::solve(void)
+{
+    if (theOutOfCoreSOE == 0) {
+	opserr << "OutOfCoreProfileSPDLinSolver::solve(void): ";
+	opserr << " - No OutOfCoreProfileSPDLinSOE has been assigned\n";
+	return -1;
+    }
+
+    OutOfCoreProfileSPDLinSOE *theSOE = theOutOfCoreSOE;
+    if (theSOE->size == 0)
+	return 0;
+
+    // the mappings used in assembly count against the budget
+    theSOE->releaseWindows();
+
+    if (theSOE->isAfactored == false) {
+	int res = this->factor();
+	if (res < 0)
+	    return res;
+	theSOE->isAfactored = true;
+	theSOE->numInt = 0;
+    }
+
+    double *B = theSOE->B;
+    double *X = theSOE->X;
+    int numBlocks = theSOE->numBlocks;
+    int *blockStart = theSOE->blockStart;
+
+    for (int ii=0; ii<size; ii++)
+	X[ii] = B[ii];
+
+    // forward substitution, streaming the blocks forwards
+    theSOE->prefetchBlock(0);
+    for (int b=0; b<numBlocks; b++) {
+	theSOE->prefetchBlock(b+1);
+	double *theBlock = theSOE->mapBlock(b);
+	if (theBlock == 0)
+	    return -1;
+	long long blockOffset = colStart[blockStart[b]];
+
+	for (int i=blockStart[b]; i<blockStart[b+1]; i++) {
+	    int rowitop = RowTop[i];
+	    double *ajiPtr = theBlock + (colStart[i] - blockOffset);
+	    double *bjPtr  = &X[rowitop];
+	    double tmp = 0;
+
+	    for (int j=rowitop; j<i; j++)
+		tmp -= *ajiPtr++ * *bjPtr++;
+
+	    X[i] += tmp;
+	}
+
+	theSOE->unmapBlock(b, theBlock, false);
+    }
+
+    // divide by diag term
+    for (int j=0; j<size; j++)
+	X[j] *= invD[j];
+
+    // now the back substitution, streaming the blocks backwards
+    theSOE->prefetchBlock(numBlocks-1);
+    for (int b=numBlocks-1; b>=0; b--) {
+	theSOE->prefetchBlock(b-1);
+	double *theBlock = theSOE->mapBlock(b);
+	if (theBlock == 0)
+	    return -1;
+	long long blockOffset = colStart[blockStart[b]];
+
+	for (int k=blockStart[b+1]-1; k>=blockStart[b]; k--) {
+	    int rowktop = RowTop[k];
+	    double bk = X[k];
+	    double *ajiPtr = theBlock + (colStart[k] - blockOffset);
+
+	    for (int j=rowktop; j<k; j++)
+		X[j] -= *ajiPtr++ * bk;
+	}
+
+	theSOE->unmapBlock(b, theBlock, false);
+    }
+
+    return 0;
+}
+
+
+// factors A into U^t D U a block at a time; the operations, and their
+// order, are those of ProfileSPDLinDirectSolver::solve()
+int
+OutOfCoreProfileSPDLinSolver::factor(void)
+{
+    OutOfCoreProfileSPDLinSOE *theSOE = theOutOfCoreSOE;
+    int numBlocks = theSOE->numBlocks;
+    int *blockStart = theSOE->blockStart;
+    int *colBlock = theSOE->colBlock;
+
+    for (int b=0; b<numBlocks; b++) {
+
+	double *theBlock = theSOE->mapBlock(b);
+	if (theBlock == 0)
+	    return -1;
+	long long blockOffset = colStart[blockStart[b]];
+
+	// the earlier blocks holding rows of the profile of this block
+	int minTop = blockStart[b];
+	for (int i=blockStart[b]; i<blockStart[b+1]; i++)
+	    if (RowTop[i] < minTop)
+		minTop = RowTop[i];
+	int firstSource = (minTop < blockStart[b]) ? colBlock[minTop] : b;
+
+	// stream them past the block in order, prefetching the next one and,
+	// with the last, the next block to be factored
+	theSOE->prefetchBlock(firstSource);
+	for (int s=firstSource; s<b; s++) {
+	    theSOE->prefetchBlock((s+1 < b) ? s+1 : b+1);
+	    double *source = theSOE->mapBlock(s);
+	    if (source == 0) {
+		theSOE->unmapBlock(b, theBlock, true);
+		return -1;
+	    }
+	    long long sourceOffset = colStart[blockStart[s]];
+
+	    for (int i=blockStart[b]; i<blockStart[b+1]; i++) {
+		int rowitop = RowTop[i];
+		double *coli = theBlock + (colStart[i] - blockOffset);
+		int jFirst = (rowitop > blockStart[s]) ? rowitop : blockStart[s];
+
+		for (int j=jFirst; j<blockStart[s+1]; j++) {
+		    int rowjtop = RowTop[j];
+		    int k0 = (rowitop > rowjtop) ? rowitop : rowjtop;
+		    double *akjPtr = source + (colStart[j] - sourceOffset) + (k0-rowjtop);
+		    double *akiPtr = coli + (k0-rowitop);
+		    double tmp = coli[j-rowitop];
+
+		    for (int k=k0; k<j; k++)
+			tmp -= *akjPtr++ * *akiPtr++ ;
+
+		    coli[j-rowitop] = tmp;
+		}
+	    }
+
+	    theSOE->unmapBlock(s, source, false);
+	}
+
+	int res = this->factorBlock(b, theBlock);
+	theSOE->unmapBlock(b, theBlock, true);
+	if (res < 0)
+	    return res;
+    }
+
+    return 0;
+}
+
+
+// completes the columns of block with the updates from its own columns
+// and forms the columns of U and D
+int
+OutOfCoreProfileSPDLinSolver::factorBlock(int block, double *theBlock)
+{
+    int *blockStart = theOutOfCoreSOE->blockStart;
+    int first = blockStart[block];
+    long long blockOffset = colStart[first];
+
+    for (int i=first; i<blockStart[block+1]; i++) {
+
+	int rowitop = RowTop[i];
+	double *coli = theBlock + (colStart[i] - blockOffset);
+	int jFirst = (rowitop > first) ? rowitop : first;
+
+	for (int j=jFirst; j<i; j++) {
+	    int rowjtop = RowTop[j];
+	    int k0 = (rowitop > rowjtop) ? rowitop : rowjtop;
+	    double *akjPtr = theBlock + (colStart[j] - blockOffset) + (k0-rowjtop);
+	    double *akiPtr = coli + (k0-rowitop);
+	    double tmp = coli[j-rowitop];
+
+	    for (int k=k0; k<j; k++)
+		tmp -= *akjPtr++ * *akiPtr++ ;
+
+	    coli[j-rowitop] = tmp;
+	}
+
+	/* now form i'th col of [U] and determine [dii] */
+
+	double aii = coli[i-rowitop];
+	double *ajiPtr = coli;
+
+	for (int jj=rowitop; jj<i; jj++) {
+	    double aji = *ajiPtr;
+	    double lij = aji * invD[jj];
+	    *ajiPtr++ = lij;
+	    aii = aii - lij*aji;
+	}
+
+	// as in ProfileSPDLinDirectSolver the first pivot must be positive
+	if (i == 0 && aii <= 0.0) {
+	    opserr << "OutOfCoreProfileSPDLinSolver::solve() - ";
+	    opserr << " aii < 0 (i, aii): (0,0)\n";
+	    return(-2);
+	}
+
+	// check that the diag > the tolerance specified
+	if (aii == 0.0) {
+	    opserr << "OutOfCoreProfileSPDLinSolver::solve() - ";
+	    opserr << " aii < 0 (i, aii): (" << i << ", " << aii << ")\n";
+	    return(-2);
+	}
+	if (fabs(aii) <= minDiagTol) {
+	    opserr << "OutOfCoreProfileSPDLinSolver::solve() - ";
+	    opserr << " aii < minDiagTol (i, aii): (" << i;
+	    opserr << ", " << aii << ")\n";
+	    return(-2);
+	}
+	invD[i] = 1.0/aii;
+    }
+
+    return 0;
+}
+
+
+int
+OutOfCoreProfileSPDLinSolver::sendSelf(int cTag, Channel &theChannel)
+{
+    return 0;
+}
+
+
+int
+OutOfCoreProfileSPDLinSolver::recvSelf(int cTag,
+				       Channel &theChannel,
+				       FEM_ObjectBroker &theBroker)
+{
+    return 0;
+}
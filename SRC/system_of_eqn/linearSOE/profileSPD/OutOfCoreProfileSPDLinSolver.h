@@ -0,0 +1,69 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+#ifndef OutOfCoreProfileSPDLinSolver_h
+#define OutOfCoreProfileSPDLinSolver_h
+
+// Description: This file contains the class definition for
+// OutOfCoreProfileSPDLinSolver. It solves an OutOfCoreProfileSPDLinSOE
+// with the same U^t D U factorization as ProfileSPDLinDirectSolver, one
+// block of columns at a time: the active block is mapped, the earlier
+// blocks holding rows of its profile are streamed past it in order, it is
+// then factored within itself and written back. The next block to be
+// streamed is prefetched while the current one is in use. The forward and
+// back substitutions stream the blocks forwards and backwards.
+//
+// What: "@(#) OutOfCoreProfileSPDLinSolver.h, revA"
+
+#include <ProfileSPDLinSolver.h>
+
+class OutOfCoreProfileSPDLinSOE;
+
+class OutOfCoreProfileSPDLinSolver : public ProfileSPDLinSolver
+{
+  public:
+    OutOfCoreProfileSPDLinSolver(double tol = 1.0e-12);
+    ~OutOfCoreProfileSPDLinSolver();
+
+    int solve(void);
+    int setSize(void);
+
+    int setLinearSOE(ProfileSPDLinSOE &theSOE);
+    int setLinearSOE(OutOfCoreProfileSPDLinSOE &theSOE);
+
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel,
+		 FEM_ObjectBroker &theBroker);
+
+  protected:
+
+  private:
+    int factor(void);
+    int factorBlock(int block, double *theBlock);
+
+    OutOfCoreProfileSPDLinSOE *theOutOfCoreSOE;
+    double minDiagTol;
+    int size;
+    int *RowTop;         // first row in the profile of each column
+    long long *colStart; // offset of the first entry of each column in A
+    double *invD;
+};
+
+#endif
@@ -39,6 +39,7 @@
 
 #include <ProfileSPDLinDirectSolver.h>
 #include <ProfileSPDLinSOE.h>
+#include <Matrix.h>
 #include <math.h>
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
@@ -297,6 +298,87 @@ ProfileSPDLinDirectSolver::solve(void)
     return 0;
 }
 
+// the forward and back substitutions for all the right hand sides are
+// done in one sweep of the factored matrix, the rhs being held row by
+// row in a work array so the inner loops run over contiguous memory.
+int 
+ProfileSPDLinDirectSolver::solveMultiple(const Matrix &B, Matrix &X)
+{
+    if (theSOE == 0) {
+	opserr << "ProfileSPDLinDirectSolver::solveMultiple(): ";
+	opserr << " - No ProfileSPDSOE has been assigned\n";
+	return -1;
+    }
+
+    int theSize = theSOE->size;
+    int numRHS = B.noCols();
+    if (theSize == 0 || numRHS == 0)
+	return 0;
+
+    // factor A if not already done
+    if (theSOE->isAfactored == false) {
+	int res = this->solve();
+	if (res < 0)
+	    return res;
+    }
+
+    double *W = new double[theSize*numRHS];
+    if (W == 0) {
+	opserr << "ProfileSPDLinDirectSolver::solveMultiple() - out of memory\n";
+	return -1;
+    }
+
+    int i, r;
+    double *wPtr = W;
+    for (i=0; i<theSize; i++)
+	for (r=0; r<numRHS; r++)
+	    *wPtr++ = B(i,r);
+
+    // do forward substitution 
+    for (i=1; i<theSize; i++) {
+	int rowitop = RowTop[i];	    
+	double *ajiPtr = topRowPtr[i];
+	double *wi = &W[i*numRHS];
+	for (int j=rowitop; j<i; j++) {
+	    double aji = *ajiPtr++;
+	    double *wj = &W[j*numRHS];
+	    for (r=0; r<numRHS; r++)
+		wi[r] -= aji * wj[r];
+	}
+    }
+
+    // divide by diag term 
+    for (i=0; i<theSize; i++) {
+	double dii = invD[i];
+	double *wi = &W[i*numRHS];
+	for (r=0; r<numRHS; r++)
+	    wi[r] *= dii;
+    }
+
+    // now do the back substitution
+    for (int k=(theSize-1); k>0; k--) {
+	int rowktop = RowTop[k];
+	double *ajiPtr = topRowPtr[k]; 		
+	double *wk = &W[k*numRHS];
+	for (int j=rowktop; j<k; j++) {
+	    double ajk = *ajiPtr++;
+	    double *wj = &W[j*numRHS];
+	    for (r=0; r<numRHS; r++)
+		wj[r] -= ajk * wk[r];
+	}
+    }   	 
+
+    wPtr = W;
+    for (i=0; i<theSize; i++)
+	for (r=0; r<numRHS; r++)
+	    X(i,r) = *wPtr++;
+
+    delete [] W;
+
+    return 0;
+}
+
+
 double
 ProfileSPDLinDirectSolver::getDeterminant(void) 
 {
@@ -49,6 +49,7 @@ class ProfileSPDLinDirectSolver : public ProfileSPDLinSolver
     virtual ~ProfileSPDLinDirectSolver();
 
     virtual int solve(void);        
+    virtual int solveMultiple(const Matrix &B, Matrix &X);
     virtual int setSize(void);    
     double getDeterminant(void);
 
@@ -53,6 +53,7 @@ class ProfileSPDLinSubstrSolver : public ProfileSPDLinDirectSolver,
     ~ProfileSPDLinSubstrSolver();
 
     int solve(void);
+    int solveMultiple(const Matrix &B, Matrix &X) {return 1;}; // one rhs at a time
     int condenseA(int numInt);
     int condenseRHS(int numInt, Vector *v =0);
     int computeCondensedMatVect(int numInt, const Vector &u);    
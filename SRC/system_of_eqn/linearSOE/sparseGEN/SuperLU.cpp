@@ -34,6 +34,7 @@
 
 #include <SuperLU.h>
 #include <SparseGenColLinSOE.h>
+#include <Matrix.h>
 #include <math.h>
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
@@ -198,6 +199,49 @@ SuperLU::solve(void)
 
 
 
+// one substitution over the factors for all the columns of B
+int
+SuperLU::solveMultiple(const Matrix &theB, Matrix &theX)
+{
+    if (theSOE == 0) {
+	opserr << "WARNING SuperLU::solveMultiple()- ";
+	opserr << " No LinearSOE object has been set\n";
+	return -1;
+    }
+    
+    int n = theSOE->size;
+    int nrhs = theB.noCols();
+    if (n == 0 || nrhs == 0)
+	return 0;
+
+    // factor the matrix if not already done
+    if (theSOE->factored == false) {
+	int res = this->solve();
+	if (res < 0)
+	    return res;
+    }
+
+    theX = theB;
+
+    SuperMatrix BX;
+    dCreate_Dense_Matrix(&BX, n, nrhs, &theX(0,0), n, SLU_DN, SLU_D, SLU_GE);
+
+    trans_t trans = NOTRANS;
+    int info;
+    dgstrs (trans, &L, &U, perm_c, perm_r, &BX, &stat, &info);    
+
+    SUPERLU_FREE(BX.Store);
+
+    if (info != 0) {	
+       opserr << "WARNING SuperLU::solveMultiple()- ";
+       opserr << " Error " << info << " returned in substitution dgstrs()\n";
+       return -info;
+    }
+
+    return 0;
+}
+
+
 int
 SuperLU::setSize()
 {
@@ -59,6 +59,7 @@ class SuperLU : public SparseGenColLinSolver
     ~SuperLU();
 
     int solve(void);
+    int solveMultiple(const Matrix &B, Matrix &X);
     int setSize(void);
 
     int sendSelf(int commitTag, Channel &theChannel);
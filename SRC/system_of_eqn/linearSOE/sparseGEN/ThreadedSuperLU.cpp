@@ -42,21 +42,22 @@
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 
-ThreadedSuperLU::
-ThreadedSuperLU(int numT, int perm, int relx, 
-			     int panel, double thrsh) 
+ThreadedSuperLU::ThreadedSuperLU(int numT, int perm, int panel, 
+				 int relx, double thrsh) 
 :SparseGenColLinSolver(SOLVER_TAGS_ThreadedSuperLU),
  perm_r(0),perm_c(0), 
  etree(0), sizePerm(0),
  relax(relx), permSpec(perm), panelSize(panel),
  thresh(thrsh), numThreads(numT), 
- refact(NO), usepr(NO), fact(DOFACT), work(NULL), lwork(0)
+ refact(NO), usepr(NO), fact(DOFACT), work(NULL), lwork(0), sizeStat(0)
 {
-  refact = NO;
-  fact = DOFACT;
-  usepr = NO;
-  work = NULL;
-  lwork = 0;
+  if (numThreads < 1)
+    numThreads = 1;
+
+  L.ncol = 0;
+  U.ncol = 0;
+  A.ncol = 0;
+  B.ncol = 0;
 }
 
 
@@ -68,11 +69,29 @@ ThreadedSuperLU::~ThreadedSuperLU()
 	delete [] perm_c;
   if (etree != 0)
 	delete [] etree;
-  if (lwork >= 0) {
+
+  if (L.ncol != 0)
     Destroy_SuperNode_SCP(&L);
+  if (U.ncol != 0)
     Destroy_CompCol_NCP(&U);
+  if (refact == YES) {
+    SUPERLU_FREE(pdgstrf_options.etree);
+    SUPERLU_FREE(pdgstrf_options.colcnt_h);
+    SUPERLU_FREE(pdgstrf_options.part_super_h);
   }
-  StatFree(&gStat);
+  if (A.ncol != 0)
+    Destroy_SuperMatrix_Store(&A);
+  if (B.ncol != 0)
+    Destroy_SuperMatrix_Store(&B);
+
+  if (sizeStat != 0)
+    StatFree(&gStat);
+}
+
+int
+ThreadedSuperLU::getNumThreads(void) const
+{
+  return numThreads;
 }
 
 int
@@ -108,19 +127,40 @@ ThreadedSuperLU::solve(void)
 
 	StatInit(n, numThreads, &gStat);
 
+	// the column ordering perm_c was found in setSize(); on a 
+	// refactorization the storage of L and U, and with usepr the row 
+	// permutation, of the previous factorization are reused
 	pdgstrf_init(numThreads, refact, panelSize, relax, thresh, usepr,
 		     0.0, perm_c, perm_r, work, lwork, &A, &AC, 
 		     &pdgstrf_options, &gStat);
 
 	pdgstrf(&pdgstrf_options, &AC, perm_r, &L, &U, &gStat, &info);
 
+	// free the permuted matrix; the elimination tree, column counts and 
+	// supernode partition in pdgstrf_options are kept for the next one
+	Destroy_CompCol_Permuted(&AC);
+
 	if (info != 0) {	
 	   opserr << "WARNING ThreadedSuperLU::solve(void)- ";
-	   opserr << " Error " << info << " returned in factorization dgstrf()\n";
-	   return info;
+	   opserr << " Error " << info << " returned in factorization pdgstrf()\n";
+
+	   // the factors are not valid for a refactorization
+	   if (L.ncol != 0) {
+	     Destroy_SuperNode_SCP(&L);
+	     Destroy_CompCol_NCP(&U);
+	     L.ncol = 0;
+	     U.ncol = 0;
+	   }
+	   SUPERLU_FREE(pdgstrf_options.etree);
+	   SUPERLU_FREE(pdgstrf_options.colcnt_h);
+	   SUPERLU_FREE(pdgstrf_options.part_super_h);
+	   refact = NO;
+	   usepr = NO;
+	   return -info;
 	}
 
 	refact = YES;	
+	usepr = YES;
 	theSOE->factored = true;
     }	
 
@@ -132,7 +172,7 @@ ThreadedSuperLU::solve(void)
     if (info != 0) {	
        opserr << "WARNING ThreadedSuperLU::solve(void)- ";
        opserr << " Error " << info << " returned in substitution dgstrs()\n";
-       return info;
+       return -info;
     }
 
     return 0;
@@ -172,17 +212,37 @@ ThreadedSuperLU::setSize()
 	sizePerm = n;
       }
 
+      // the factors and ordering of the old structure cannot be reused
+      if (L.ncol != 0) {
+	Destroy_SuperNode_SCP(&L);
+	Destroy_CompCol_NCP(&U);
+	L.ncol = 0;
+	U.ncol = 0;
+      }
+      if (refact == YES) {
+	SUPERLU_FREE(pdgstrf_options.etree);
+	SUPERLU_FREE(pdgstrf_options.colcnt_h);
+	SUPERLU_FREE(pdgstrf_options.part_super_h);
+      }
+      if (A.ncol != 0)
+	Destroy_SuperMatrix_Store(&A);
+      if (B.ncol != 0)
+	Destroy_SuperMatrix_Store(&B);
+
       // initialisation
+      if (sizeStat != 0)
+	StatFree(&gStat);
       StatAlloc(n, numThreads, panelSize, relax, &gStat);
+      sizeStat = n;
 
       // create the SuperMatrixMT A	
       dCreate_CompCol_Matrix(&A, n, n, theSOE->nnz, theSOE->A, 
 			     theSOE->rowA, theSOE->colStartA, 
 			     NC, _D, GE);
 
-      // obtain and apply column permutation to give SuperMatrixMT AC
+      // obtain the column permutation, it is kept for all the 
+      // factorizations until the structure of A changes
       get_perm_c(permSpec, &A, perm_c);
-      //      sp_preorder(refact, &A, perm_c, etree, &AC);
 
       // create the rhs SuperMatrixMT B 
       dCreate_Dense_Matrix(&B, n, 1, theSOE->X, n, DN, _D, GE);
@@ -190,6 +250,7 @@ ThreadedSuperLU::setSize()
       // set the refact variable to 'N' after first factorization with new size 
       // can set to 'Y'.
       refact = NO;
+      usepr = NO;
 
     } else if (n == 0)
 	return 0;
@@ -53,6 +53,8 @@ class ThreadedSuperLU : public SparseGenColLinSolver
     int solve(void);
     int setSize(void);
 
+    int getNumThreads(void) const;
+
     int sendSelf(int commitTag, Channel &theChannel);
     int recvSelf(int commitTag, Channel &theChannel, 
 		 FEM_ObjectBroker &theBroker);        
@@ -76,6 +78,7 @@ class ThreadedSuperLU : public SparseGenColLinSolver
     void *work;
     int lwork;
     Gstat_t gStat;
+    int sizeStat;       // size gStat was allocated for, 0 if not allocated
 };
 
 #endif
@@ -0,0 +1,837 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the implementation for
+// SupernodalSPDLinSOE.
+//
+// What: "@(#) SupernodalSPDLinSOE.C, revA"
+
+#include <stdlib.h>
+#include <math.h>
+
+#include <SupernodalSPDLinSOE.h>
+#include <SupernodalSPDLinSolver.h>
+#include <Matrix.h>
+#include <Graph.h>
+#include <Vertex.h>
+#include <VertexIter.h>
+#include <Channel.h>
+#include <FEM_ObjectBroker.h>
+
+// the multiple minimum degree ordering in genmmd.f
+#ifdef _WIN32
+extern "C" int MYGENMMD(int *neq, int *fxadj, int *adjncy, int *winvp,
+			int *wperm, int *delta, int *fchild, int *parent,
+			int *sibling, int *marker, int *maxint, int *nofsub,
+			int *kdx);
+#else
+extern "C" int mygenmmd_(int *neq, int *fxadj, int *adjncy, int *winvp,
+			 int *wperm, int *delta, int *fchild, int *parent,
+			 int *sibling, int *marker, int *maxint, int *nofsub,
+			 int *kdx);
+#endif
+
+static int
+compareRows(const void *a, const void *b)
+{
+  return *((const int *)a) - *((const int *)b);
+}
+
+// binary search of row in the increasing rows, -1 if not there
+static int
+findRow(const int *rows, int numRows, int row)
+{
+  int low = 0;
+  int high = numRows - 1;
+  while (low <= high) {
+    int middle = (low+high)/2;
+    int middleRow = rows[middle];
+    if (middleRow < row)
+      low = middle+1;
+    else if (middleRow > row)
+      high = middle-1;
+    else
+      return middle;
+  }
+  return -1;
+}
+
+
+SupernodalSPDLinSOE::SupernodalSPDLinSOE(SupernodalSPDLinSolver &the_Solver,
+					 bool mixed)
+:LinearSOE(the_Solver, LinSOE_TAGS_SupernodalSPDLinSOE),
+ size(0), B(0), X(0), vectX(0), vectB(0), Bsize(0), factored(false),
+ invp(0), numSuper(0), superStart(0), colSuper(0), superParent(0),
+ rowStart(0), rowIndex(0), valStart(0), L(0), Lsize(0), maxRows(0), maxCols(0),
+ mixedPrecision(mixed), singleFactor(mixed), Ls(0),
+ Astart(0), Arow(0), Apos(0), Aval(0), Asize(0)
+{
+    the_Solver.setLinearSOE(*this);
+}
+
+
+SupernodalSPDLinSOE::~SupernodalSPDLinSOE()
+{
+    if (B != 0) delete [] B;
+    if (X != 0) delete [] X;
+    if (vectX != 0) delete vectX;
+    if (vectB != 0) delete vectB;
+    if (invp != 0) delete [] invp;
+    if (superStart != 0) delete [] superStart;
+    if (colSuper != 0) delete [] colSuper;
+    if (superParent != 0) delete [] superParent;
+    if (rowStart != 0) delete [] rowStart;
+    if (rowIndex != 0) delete [] rowIndex;
+    if (valStart != 0) delete [] valStart;
+    if (L != 0) delete [] L;
+    if (Ls != 0) delete [] Ls;
+    if (Astart != 0) delete [] Astart;
+    if (Arow != 0) delete [] Arow;
+    if (Apos != 0) delete [] Apos;
+    if (Aval != 0) delete [] Aval;
+}
+
+
+int
+SupernodalSPDLinSOE::getNumEqn(void) const
+{
+    return size;
+}
+
+
+int
+SupernodalSPDLinSOE::setSize(Graph &theGraph)
+{
+    int result = 0;
+    int oldSize = size;
+    size = theGraph.getNumVertex();
+
+    // remove the old structure
+    if (invp != 0) delete [] invp;
+    if (superStart != 0) delete [] superStart;
+    if (colSuper != 0) delete [] colSuper;
+    if (superParent != 0) delete [] superParent;
+    if (rowStart != 0) delete [] rowStart;
+    if (rowIndex != 0) delete [] rowIndex;
+    if (valStart != 0) delete [] valStart;
+    if (L != 0) delete [] L;
+    if (Ls != 0) delete [] Ls;
+    if (Astart != 0) delete [] Astart;
+    if (Arow != 0) delete [] Arow;
+    if (Apos != 0) delete [] Apos;
+    if (Aval != 0) delete [] Aval;
+    invp = 0; superStart = 0; colSuper = 0; superParent = 0;
+    rowStart = 0; rowIndex = 0; valStart = 0; L = 0;
+    numSuper = 0; Lsize = 0; maxRows = 0; maxCols = 0;
+    Ls = 0; Astart = 0; Arow = 0; Apos = 0; Aval = 0; Asize = 0;
+
+    factored = false;
+    singleFactor = mixedPrecision;
+
+    if (size > Bsize) { // we have to get space for the vectors
+
+	if (B != 0) delete [] B;
+	if (X != 0) delete [] X;
+
+	B = new double[size];
+	X = new double[size];
+	Bsize = size;
+    }
+
+    for (int j=0; j<size; j++) {
+	B[j] = 0;
+	X[j] = 0;
+    }
+
+    if (size != oldSize) {
+	if (vectX != 0)
+	    delete vectX;
+	if (vectB != 0)
+	    delete vectB;
+
+	vectX = new Vector(X,size);
+	vectB = new Vector(B,size);
+    }
+
+    if (size == 0)
+      return 0;
+
+    int n = size;
+
+    //
+    // the adjacency of the equations, without the diagonal
+    //
+
+    int *xadj = new int[n+1];
+    xadj[0] = 0;
+    for (int a=0; a<n; a++) {
+	Vertex *theVertex = theGraph.getVertexPtr(a);
+	if (theVertex == 0) {
+	    opserr << "WARNING SupernodalSPDLinSOE::setSize :";
+	    opserr << " vertex " << a << " not in graph! - size set to 0\n";
+	    size = 0;
+	    delete [] xadj;
+	    return -1;
+	}
+	const ID &theAdjacency = theVertex->getAdjacency();
+	int numAdj = 0;
+	for (int i=0; i<theAdjacency.Size(); i++)
+	    if (theAdjacency(i) != a)
+		numAdj++;
+	xadj[a+1] = xadj[a] + numAdj;
+    }
+
+    int nnz = xadj[n];
+    int *adjncy = new int[nnz+1];
+    for (int a=0; a<n; a++) {
+	const ID &theAdjacency = theGraph.getVertexPtr(a)->getAdjacency();
+	int loc = xadj[a];
+	for (int i=0; i<theAdjacency.Size(); i++)
+	    if (theAdjacency(i) != a)
+		adjncy[loc++] = theAdjacency(i);
+    }
+
+    //
+    // order the equations by multiple minimum degree, genmmd uses fortran
+    // subscripts and destroys the adjacency it is given
+    //
+
+    int *perm = new int[n+1];
+    invp = new int[n+1];
+    {
+	int *fxadj = new int[n+1];
+	int *fadjncy = new int[nnz+1];
+	int *dhead = new int[n+1];
+	int *qsize = new int[n+1];
+	int *llist = new int[n+1];
+	int *marker = new int[n+1];
+
+	for (int i=0; i<=n; i++)
+	    fxadj[i] = xadj[i] + 1;
+	for (int i=0; i<nnz; i++)
+	    fadjncy[i] = adjncy[i] + 1;
+
+	int delta = 1;
+	int maxint = 99999999;
+	int nofsub = 99999999;
+	int kdx = 0;
+
+#ifdef _WIN32
+	MYGENMMD(&n, fxadj, fadjncy, invp, perm, &delta, dhead, qsize,
+		 llist, marker, &maxint, &nofsub, &kdx);
+#else
+	mygenmmd_(&n, fxadj, fadjncy, invp, perm, &delta, dhead, qsize,
+		  llist, marker, &maxint, &nofsub, &kdx);
+#endif
+
+	for (int i=0; i<n; i++) {
+	    perm[i]--;
+	    invp[i]--;
+	}
+
+	delete [] fxadj;
+	delete [] fadjncy;
+	delete [] dhead;
+	delete [] qsize;
+	delete [] llist;
+	delete [] marker;
+    }
+
+    //
+    // the elimination tree of the reordered matrix
+    //
+
+    int *parent = new int[n];
+    int *ancestor = new int[n];
+    for (int k=0; k<n; k++) {
+	parent[k] = -1;
+	ancestor[k] = -1;
+	int oldK = perm[k];
+	for (int p=xadj[oldK]; p<xadj[oldK+1]; p++) {
+	    int i = invp[adjncy[p]];
+	    // climb from i to the root of its current subtree
+	    while (i != -1 && i < k) {
+		int next = ancestor[i];
+		ancestor[i] = k;
+		if (next == -1)
+		    parent[i] = k;
+		i = next;
+	    }
+	}
+    }
+
+    //
+    // postorder the elimination tree, so that the columns of a supernode
+    // and the supernodes of a subtree are numbered consecutively
+    //
+
+    int *firstChild = ancestor;
+    int *sibling = new int[n];
+    int *post = new int[n];
+    for (int k=0; k<n; k++)
+	firstChild[k] = -1;
+    for (int k=n-1; k>=0; k--)
+	if (parent[k] != -1) {
+	    sibling[k] = firstChild[parent[k]];
+	    firstChild[parent[k]] = k;
+	}
+
+    {
+	int *stack = new int[n];
+	int numPost = 0;
+	for (int root=n-1; root>=0; root--) {
+	    if (parent[root] != -1)
+		continue;
+	    int top = 0;
+	    stack[0] = root;
+	    while (top >= 0) {
+		int k = stack[top];
+		int child = firstChild[k];
+		if (child == -1) {
+		    post[k] = numPost++;
+		    top--;
+		} else {
+		    firstChild[k] = sibling[child];
+		    stack[++top] = child;
+		}
+	    }
+	}
+	delete [] stack;
+    }
+
+    // renumber the equations and the tree in postorder
+    for (int k=0; k<n; k++)
+	sibling[post[k]] = perm[k];
+    for (int k=0; k<n; k++) {
+	perm[k] = sibling[k];
+	invp[perm[k]] = k;
+    }
+    for (int k=0; k<n; k++)
+	sibling[post[k]] = (parent[k] == -1) ? -1 : post[parent[k]];
+    for (int k=0; k<n; k++)
+	parent[k] = sibling[k];
+
+    delete [] post;
+    delete [] sibling;
+
+    //
+    // the number of nonzeros in each column of L, from the row subtrees
+    //
+
+    int *colCount = new int[n];
+    int *mark = ancestor;
+    for (int k=0; k<n; k++) {
+	colCount[k] = 1;
+	mark[k] = -1;
+    }
+    for (int i=0; i<n; i++) {
+	mark[i] = i;
+	int oldI = perm[i];
+	for (int p=xadj[oldI]; p<xadj[oldI+1]; p++) {
+	    int k = invp[adjncy[p]];
+	    if (k > i)
+		continue;
+	    while (mark[k] != i) {
+		colCount[k]++;
+		mark[k] = i;
+		k = parent[k];
+	    }
+	}
+    }
+
+    //
+    // the fundamental supernodes: column k joins the supernode of column
+    // k-1 when it is the only child of k and its structure is that of k-1
+    // without the diagonal
+    //
+
+    int *numChild = mark;
+    for (int k=0; k<n; k++)
+	numChild[k] = 0;
+    for (int k=0; k<n; k++)
+	if (parent[k] != -1)
+	    numChild[parent[k]]++;
+
+    colSuper = new int[n];
+    numSuper = 0;
+    for (int k=0; k<n; k++) {
+	if (k == 0 || parent[k-1] != k || numChild[k] != 1 ||
+	    colCount[k-1] != colCount[k]+1)
+	    numSuper++;
+	colSuper[k] = numSuper-1;
+    }
+
+    superStart = new int[numSuper+1];
+    superParent = new int[numSuper];
+    rowStart = new int[numSuper+1];
+    valStart = new int[numSuper+1];
+
+    for (int k=n-1; k>=0; k--)
+	superStart[colSuper[k]] = k;
+    superStart[numSuper] = n;
+
+    rowStart[0] = 0;
+    valStart[0] = 0;
+    for (int s=0; s<numSuper; s++) {
+	int numCols = superStart[s+1] - superStart[s];
+	int numRows = colCount[superStart[s]];
+	rowStart[s+1] = rowStart[s] + numRows;
+	valStart[s+1] = valStart[s] + numRows*numCols;
+	if (numRows > maxRows) maxRows = numRows;
+	if (numCols > maxCols) maxCols = numCols;
+	int lastCol = superStart[s+1]-1;
+	superParent[s] = (parent[lastCol] == -1) ? -1 : colSuper[parent[lastCol]];
+    }
+
+    //
+    // the row structure of each supernode, the union of the structure of
+    // its columns in A and of the structures of its children
+    //
+
+    rowIndex = new int[rowStart[numSuper]];
+
+    int *superChild = new int[numSuper];
+    int *superSibling = new int[numSuper];
+    for (int s=0; s<numSuper; s++)
+	superChild[s] = -1;
+    for (int s=numSuper-1; s>=0; s--)
+	if (superParent[s] != -1) {
+	    superSibling[s] = superChild[superParent[s]];
+	    superChild[superParent[s]] = s;
+	}
+
+    for (int k=0; k<n; k++)
+	mark[k] = -1;
+
+    for (int s=0; s<numSuper; s++) {
+	int firstCol = superStart[s];
+	int lastCol = superStart[s+1]-1;
+	int *rows = &rowIndex[rowStart[s]];
+	int numRows = 0;
+
+	for (int k=firstCol; k<=lastCol; k++) {
+	    rows[numRows++] = k;
+	    mark[k] = s;
+	}
+
+	for (int k=firstCol; k<=lastCol; k++) {
+	    int oldK = perm[k];
+	    for (int p=xadj[oldK]; p<xadj[oldK+1]; p++) {
+		int i = invp[adjncy[p]];
+		if (i > lastCol && mark[i] != s) {
+		    rows[numRows++] = i;
+		    mark[i] = s;
+		}
+	    }
+	}
+
+	for (int c=superChild[s]; c != -1; c = superSibling[c]) {
+	    int numColsC = superStart[c+1] - superStart[c];
+	    for (int p=rowStart[c]+numColsC; p<rowStart[c+1]; p++) {
+		int i = rowIndex[p];
+		if (i > lastCol && mark[i] != s) {
+		    rows[numRows++] = i;
+		    mark[i] = s;
+		}
+	    }
+	}
+
+	if (numRows != rowStart[s+1]-rowStart[s]) {
+	    opserr << "WARNING SupernodalSPDLinSOE::setSize :";
+	    opserr << " symbolic factorization failed for supernode " << s << endln;
+	    result = -1;
+	    break;
+	}
+
+	int numCols = lastCol - firstCol + 1;
+	qsort(rows+numCols, numRows-numCols, sizeof(int), compareRows);
+    }
+
+    //
+    // with a single precision factor, the lower triangle of A is kept by
+    // columns in double precision; Apos is where each entry goes in the
+    // supernode blocks
+    //
+
+    if (mixedPrecision == true && result == 0) {
+	Astart = new int[n+1];
+	Astart[0] = 0;
+	for (int k=0; k<n; k++) {
+	    int oldK = perm[k];
+	    int numRowsK = 1;
+	    for (int p=xadj[oldK]; p<xadj[oldK+1]; p++)
+		if (invp[adjncy[p]] > k)
+		    numRowsK++;
+	    Astart[k+1] = Astart[k] + numRowsK;
+	}
+
+	Asize = Astart[n];
+	Arow = new int[Asize];
+	Apos = new int[Asize];
+	Aval = new double[Asize];
+
+	for (int k=0; k<n; k++) {
+	    int oldK = perm[k];
+	    int *rows = &Arow[Astart[k]];
+	    int numRowsK = 0;
+	    rows[numRowsK++] = k;
+	    for (int p=xadj[oldK]; p<xadj[oldK+1]; p++) {
+		int i = invp[adjncy[p]];
+		if (i > k)
+		    rows[numRowsK++] = i;
+	    }
+	    qsort(rows+1, numRowsK-1, sizeof(int), compareRows);
+
+	    int s = colSuper[k];
+	    int firstCol = superStart[s];
+	    int numCols = superStart[s+1] - firstCol;
+	    int numRows = rowStart[s+1] - rowStart[s];
+	    const int *offRows = &rowIndex[rowStart[s]+numCols];
+	    int colPos = valStart[s] + (k-firstCol)*numRows;
+
+	    for (int q=0; q<numRowsK; q++) {
+		int row = rows[q];
+		int pos;
+		if (row < firstCol + numCols)
+		    pos = row - firstCol;
+		else
+		    pos = numCols + findRow(offRows, numRows-numCols, row);
+		Apos[Astart[k]+q] = colPos + pos;
+	    }
+	}
+
+	for (int q=0; q<Asize; q++)
+	    Aval[q] = 0.0;
+    }
+
+    delete [] superChild;
+    delete [] superSibling;
+    delete [] colCount;
+    delete [] parent;
+    delete [] ancestor;
+    delete [] perm;
+    delete [] xadj;
+    delete [] adjncy;
+
+    if (result < 0) {
+	size = 0;
+	return result;
+    }
+
+    //
+    // space for the factor
+    //
+
+    Lsize = valStart[numSuper];
+    if (mixedPrecision == true)
+	Ls = new float[Lsize];
+    else {
+	L = new double[Lsize];
+	for (int i=0; i<Lsize; i++)
+	    L[i] = 0.0;
+    }
+
+    // invoke setSize() on the Solver
+    LinearSOESolver *the_Solver = this->getSolver();
+    int solverOK = the_Solver->setSize();
+    if (solverOK < 0) {
+	opserr << "WARNING:SupernodalSPDLinSOE::setSize :";
+	opserr << " solver failed setSize()\n";
+	return solverOK;
+    }
+
+    return result;
+}
+
+
+int
+SupernodalSPDLinSOE::addA(const Matrix &m, const ID &id, double fact)
+{
+    // check for a quick return
+    if (fact == 0.0)  return 0;
+
+    // check that m and id are of similar size
+    int idSize = id.Size();
+    if (idSize != m.noRows() && idSize != m.noCols()) {
+	opserr << "SupernodalSPDLinSOE::addA() - Matrix and ID not of similar sizes\n";
+	return -1;
+    }
+
+    if (mixedPrecision == true) {
+	// into the columns of A kept apart
+	for (int i=0; i<idSize; i++) {
+	    int oldCol = id(i);
+	    if (oldCol < 0 || oldCol >= size)
+		continue;
+
+	    int col = invp[oldCol];
+	    const int *rows = &Arow[Astart[col]];
+	    int numRows = Astart[col+1] - Astart[col];
+	    double *colPtr = &Aval[Astart[col]];
+
+	    for (int j=0; j<idSize; j++) {
+		int oldRow = id(j);
+		if (oldRow < 0 || oldRow >= size)
+		    continue;
+
+		int row = invp[oldRow];
+		if (row < col)  // only add lower
+		    continue;
+
+		int pos = 0;
+		if (row != col) {
+		    pos = findRow(rows+1, numRows-1, row);
+		    if (pos < 0) {
+			opserr << "SupernodalSPDLinSOE::addA() - entry (" << oldRow << ",";
+			opserr << oldCol << ") not in the structure of A\n";
+			return -1;
+		    }
+		    pos++;
+		}
+
+		if (fact == 1.0)
+		    colPtr[pos] += m(j,i);
+		else
+		    colPtr[pos] += m(j,i)*fact;
+	    }
+	}
+
+	return 0;
+    }
+
+    for (int i=0; i<idSize; i++) {
+	int oldCol = id(i);
+	if (oldCol < 0 || oldCol >= size)
+	    continue;
+
+	int col = invp[oldCol];
+	int s = colSuper[col];
+	int firstCol = superStart[s];
+	int numCols = superStart[s+1] - firstCol;
+	int numRows = rowStart[s+1] - rowStart[s];
+	const int *offRows = &rowIndex[rowStart[s]+numCols];
+	int numOffRows = numRows - numCols;
+	double *colPtr = &L[valStart[s] + (col-firstCol)*numRows];
+
+	for (int j=0; j<idSize; j++) {
+	    int oldRow = id(j);
+	    if (oldRow < 0 || oldRow >= size)
+		continue;
+
+	    int row = invp[oldRow];
+	    if (row < col)  // only add lower
+		continue;
+
+	    int pos;
+	    if (row < firstCol + numCols)
+		pos = row - firstCol;
+	    else {
+		// binary search the rows below the diagonal block
+		pos = findRow(offRows, numOffRows, row);
+		if (pos < 0) {
+		    opserr << "SupernodalSPDLinSOE::addA() - entry (" << oldRow << ",";
+		    opserr << oldCol << ") not in the structure of A\n";
+		    return -1;
+		}
+		pos += numCols;
+	    }
+
+	    if (fact == 1.0)
+		colPtr[pos] += m(j,i);
+	    else
+		colPtr[pos] += m(j,i)*fact;
+	}
+    }
+
+    return 0;
+}
+
+
+int
+SupernodalSPDLinSOE::addB(const Vector &v, const ID &id, double fact)
+{
+    // check for a quick return
+    if (fact == 0.0)  return 0;
+
+    // check that m and id are of similar size
+    int idSize = id.Size();
+    if (idSize != v.Size() ) {
+	opserr << "SupernodalSPDLinSOE::addB() - Vector and ID not of similar sizes\n";
+	return -1;
+    }
+
+    if (fact == 1.0) { // do not need to multiply if fact == 1.0
+	for (int i=0; i<idSize; i++) {
+	    int pos = id(i);
+	    if (pos <size && pos >= 0)
+		B[pos] += v(i);
+	}
+    } else if (fact == -1.0) {
+	for (int i=0; i<idSize; i++) {
+	    int pos = id(i);
+	    if (pos <size && pos >= 0)
+		B[pos] -= v(i);
+	}
+    } else {
+	for (int i=0; i<idSize; i++) {
+	    int pos = id(i);
+	    if (pos <size && pos >= 0)
+		B[pos] += v(i) * fact;
+	}
+    }
+    return 0;
+}
+
+
+int
+SupernodalSPDLinSOE::setB(const Vector &v, double fact)
+{
+    // check for a quick return
+    if (fact == 0.0)  return 0;
+
+    if (v.Size() != size) {
+	opserr << "WARNING SupernodalSPDLinSOE::setB() -";
+	opserr << " incomptable sizes " << size << " and " << v.Size() << endln;
+	return -1;
+    }
+
+    if (fact == 1.0) { // do not need to multiply if fact == 1.0
+	for (int i=0; i<size; i++) {
+	    B[i] = v(i);
+	}
+    } else if (fact == -1.0) {
+	for (int i=0; i<size; i++) {
+	    B[i] = -v(i);
+	}
+    } else {
+	for (int i=0; i<size; i++) {
+	    B[i] = v(i) * fact;
+	}
+    }
+    return 0;
+}
+
+
+void
+SupernodalSPDLinSOE::zeroA(void)
+{
+    if (mixedPrecision == true) {
+	for (int i=0; i<Asize; i++)
+	    Aval[i] = 0;
+    } else {
+	double *Aptr = L;
+	for (int i=0; i<Lsize; i++)
+	    *Aptr++ = 0;
+    }
+
+    factored = false;
+}
+
+
+void
+SupernodalSPDLinSOE::zeroB(void)
+{
+    double *Bptr = B;
+    for (int i=0; i<size; i++)
+	*Bptr++ = 0;
+}
+
+
+void
+SupernodalSPDLinSOE::setX(int loc, double value)
+{
+    if (loc < size && loc >= 0)
+	X[loc] = value;
+}
+
+
+void
+SupernodalSPDLinSOE::setX(const Vector &x)
+{
+    if (x.Size() == size && vectX != 0)
+	*vectX = x;
+}
+
+
+const Vector &
+SupernodalSPDLinSOE::getX(void)
+{
+    if (vectX == 0) {
+	opserr << "FATAL SupernodalSPDLinSOE::getX - vectX == 0";
+	exit(-1);
+    }
+    return *vectX;
+}
+
+
+const Vector &
+SupernodalSPDLinSOE::getB(void)
+{
+    if (vectB == 0) {
+	opserr << "FATAL SupernodalSPDLinSOE::getB - vectB == 0";
+	exit(-1);
+    }
+    return *vectB;
+}
+
+
+double
+SupernodalSPDLinSOE::normRHS(void)
+{
+    double norm =0.0;
+    for (int i=0; i<size; i++) {
+	double Yi = B[i];
+	norm += Yi*Yi;
+    }
+    return sqrt(norm);
+}
+
+
+int
+SupernodalSPDLinSOE::setSupernodalSPDSolver(SupernodalSPDLinSolver &newSolver)
+{
+    newSolver.setLinearSOE(*this);
+
+    if (size != 0) {
+	int solverOK = newSolver.setSize();
+	if (solverOK < 0) {
+	    opserr << "WARNING:SupernodalSPDLinSOE::setSolver :";
+	    opserr << "the new solver could not setSeize() - staying with old\n";
+	    return -1;
+	}
+    }
+
+    return this->LinearSOE::setSolver(newSolver);
+}
+
+
+int
+SupernodalSPDLinSOE::sendSelf(int commitTag, Channel &theChannel)
+{
+    return 0;
+}
+
+
+int
+SupernodalSPDLinSOE::recvSelf(int commitTag, Channel &theChannel,
+			      FEM_ObjectBroker &theBroker)
+{
+    return 0;
+}
@@ -0,0 +1,108 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+#ifndef SupernodalSPDLinSOE_h
+#define SupernodalSPDLinSOE_h
+
+// Description: This file contains the class definition for
+// SupernodalSPDLinSOE. SupernodalSPDLinSOE is a subclass of LinearSOE.
+// It stores the lower triangle of a symmetric positive definite A, and
+// the fill of its Cholesky factor L, by supernodes. The equations are
+// renumbered with a multiple minimum degree ordering and the elimination
+// tree is postordered in setSize(). The columns of each supernode share
+// one row structure and are stored as a dense column major block, whose
+// first rows are the supernode's own columns; the factor overwrites A.
+// With mixedPrecision the factor is stored in single precision and A is
+// kept apart in double precision, by the columns of its lower triangle,
+// for the iterative refinement of the solution.
+//
+// What: "@(#) SupernodalSPDLinSOE.h, revA"
+
+#include <LinearSOE.h>
+#include <Vector.h>
+
+class SupernodalSPDLinSolver;
+
+class SupernodalSPDLinSOE : public LinearSOE
+{
+  public:
+    SupernodalSPDLinSOE(SupernodalSPDLinSolver &theSolver,
+			bool mixedPrecision = false);
+
+    ~SupernodalSPDLinSOE();
+
+    int getNumEqn(void) const;
+    int setSize(Graph &theGraph);
+    int addA(const Matrix &, const ID &, double fact = 1.0);
+    int addB(const Vector &, const ID &, double fact = 1.0);
+    int setB(const Vector &, double fact = 1.0);
+
+    void zeroA(void);
+    void zeroB(void);
+
+    const Vector &getX(void);
+    const Vector &getB(void);
+    double normRHS(void);
+
+    void setX(int loc, double value);
+    void setX(const Vector &x);
+    int setSupernodalSPDSolver(SupernodalSPDLinSolver &newSolver);
+
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel,
+		 FEM_ObjectBroker &theBroker);
+
+    friend class SupernodalSPDLinSolver;
+
+  protected:
+
+  private:
+    int size;            // order of A
+    double *B, *X;       // 1d arrays containing coefficients of B and X
+    Vector *vectX;
+    Vector *vectB;
+    int Bsize;
+    bool factored;
+
+    int *invp;           // invp[i] is the new number of equation i
+
+    int numSuper;        // number of supernodes
+    int *superStart;     // first column of each supernode, numSuper+1
+    int *colSuper;       // supernode of each column
+    int *superParent;    // parent in the supernodal elimination tree, or -1
+    int *rowStart;       // start of the rows of each supernode in rowIndex
+    int *rowIndex;       // the rows of each supernode, in increasing order
+    int *valStart;       // start of the block of each supernode in L
+    double *L;           // the supernode blocks
+    int Lsize;           // number of entries in L
+    int maxRows;         // largest number of rows in a supernode
+    int maxCols;         // largest number of columns in a supernode
+
+    bool mixedPrecision; // A stored apart from a single precision factor
+    bool singleFactor;   // factor in Ls, false while a fallback uses L
+    float *Ls;           // the supernode blocks in single precision
+    int *Astart;         // start of each column of A in Arow, Aval, Apos
+    int *Arow;           // rows of the lower triangle, the diagonal first
+    int *Apos;           // position of each entry of A in the blocks
+    double *Aval;        // the entries of the lower triangle of A
+    int Asize;           // number of entries in Aval
+};
+
+#endif
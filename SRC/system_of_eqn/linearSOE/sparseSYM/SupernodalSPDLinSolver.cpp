@@ -0,0 +1,979 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the implementation for
+// SupernodalSPDLinSolver.
+//
+// What: "@(#) SupernodalSPDLinSolver.C, revA"
+
+#include <math.h>
+#include <float.h>
+
+#include <SupernodalSPDLinSolver.h>
+#include <SupernodalSPDLinSOE.h>
+#include <Channel.h>
+#include <FEM_ObjectBroker.h>
+
+#ifdef _WIN32
+extern "C" int DPOTRF(char *UPLO, int *N, double *A, int *LDA, int *INFO);
+
+extern "C" int DTRSM(char *SIDE, char *UPLO, char *TRANSA, char *DIAG,
+		     int *M, int *N, double *ALPHA, double *A, int *LDA,
+		     double *B, int *LDB);
+
+extern "C" int DSYRK(char *UPLO, char *TRANS, int *N, int *K, double *ALPHA,
+		     double *A, int *LDA, double *BETA, double *C, int *LDC);
+
+extern "C" int DGEMM(char *TRANSA, char *TRANSB, int *M, int *N, int *K,
+		     double *ALPHA, double *A, int *LDA, double *B, int *LDB,
+		     double *BETA, double *C, int *LDC);
+
+extern "C" int DGEMV(char *TRANS, int *M, int *N, double *ALPHA, double *A,
+		     int *LDA, double *X, int *INCX, double *BETA, double *Y,
+		     int *INCY);
+
+extern "C" int DTRSV(char *UPLO, char *TRANS, char *DIAG, int *N, double *A,
+		     int *LDA, double *X, int *INCX);
+
+extern "C" int SPOTRF(char *UPLO, int *N, float *A, int *LDA, int *INFO);
+
+extern "C" int STRSM(char *SIDE, char *UPLO, char *TRANSA, char *DIAG,
+		     int *M, int *N, float *ALPHA, float *A, int *LDA,
+		     float *B, int *LDB);
+
+extern "C" int SSYRK(char *UPLO, char *TRANS, int *N, int *K, float *ALPHA,
+		     float *A, int *LDA, float *BETA, float *C, int *LDC);
+
+extern "C" int SGEMM(char *TRANSA, char *TRANSB, int *M, int *N, int *K,
+		     float *ALPHA, float *A, int *LDA, float *B, int *LDB,
+		     float *BETA, float *C, int *LDC);
+
+extern "C" int SGEMV(char *TRANS, int *M, int *N, float *ALPHA, float *A,
+		     int *LDA, float *X, int *INCX, float *BETA, float *Y,
+		     int *INCY);
+
+extern "C" int STRSV(char *UPLO, char *TRANS, char *DIAG, int *N, float *A,
+		     int *LDA, float *X, int *INCX);
+
+#define dpotrf_ DPOTRF
+#define dtrsm_  DTRSM
+#define dsyrk_  DSYRK
+#define dgemm_  DGEMM
+#define dgemv_  DGEMV
+#define dtrsv_  DTRSV
+#define spotrf_ SPOTRF
+#define strsm_  STRSM
+#define ssyrk_  SSYRK
+#define sgemm_  SGEMM
+#define sgemv_  SGEMV
+#define strsv_  STRSV
+
+#else
+
+extern "C" int dpotrf_(char *UPLO, int *N, double *A, int *LDA, int *INFO);
+
+extern "C" int dtrsm_(char *SIDE, char *UPLO, char *TRANSA, char *DIAG,
+		      int *M, int *N, double *ALPHA, double *A, int *LDA,
+		      double *B, int *LDB);
+
+extern "C" int dsyrk_(char *UPLO, char *TRANS, int *N, int *K, double *ALPHA,
+		      double *A, int *LDA, double *BETA, double *C, int *LDC);
+
+extern "C" int dgemm_(char *TRANSA, char *TRANSB, int *M, int *N, int *K,
+		      double *ALPHA, double *A, int *LDA, double *B, int *LDB,
+		      double *BETA, double *C, int *LDC);
+
+extern "C" int dgemv_(char *TRANS, int *M, int *N, double *ALPHA, double *A,
+		      int *LDA, double *X, int *INCX, double *BETA, double *Y,
+		      int *INCY);
+
+extern "C" int dtrsv_(char *UPLO, char *TRANS, char *DIAG, int *N, double *A,
+		      int *LDA, double *X, int *INCX);
+
+extern "C" int spotrf_(char *UPLO, int *N, float *A, int *LDA, int *INFO);
+
+extern "C" int strsm_(char *SIDE, char *UPLO, char *TRANSA, char *DIAG,
+		      int *M, int *N, float *ALPHA, float *A, int *LDA,
+		      float *B, int *LDB);
+
+extern "C" int ssyrk_(char *UPLO, char *TRANS, int *N, int *K, float *ALPHA,
+		      float *A, int *LDA, float *BETA, float *C, int *LDC);
+
+extern "C" int sgemm_(char *TRANSA, char *TRANSB, int *M, int *N, int *K,
+		      float *ALPHA, float *A, int *LDA, float *B, int *LDB,
+		      float *BETA, float *C, int *LDC);
+
+extern "C" int sgemv_(char *TRANS, int *M, int *N, float *ALPHA, float *A,
+		      int *LDA, float *X, int *INCX, float *BETA, float *Y,
+		      int *INCY);
+
+extern "C" int strsv_(char *UPLO, char *TRANS, char *DIAG, int *N, float *A,
+		      int *LDA, float *X, int *INCX);
+
+#endif
+
+// the kernels in double and in single precision, for the templates
+static inline void
+potrf(char *UPLO, int *N, double *A, int *LDA, int *INFO)
+{ dpotrf_(UPLO, N, A, LDA, INFO); }
+
+static inline void
+potrf(char *UPLO, int *N, float *A, int *LDA, int *INFO)
+{ spotrf_(UPLO, N, A, LDA, INFO); }
+
+static inline void
+trsm(char *SIDE, char *UPLO, char *TRANSA, char *DIAG, int *M, int *N,
+     double *ALPHA, double *A, int *LDA, double *B, int *LDB)
+{ dtrsm_(SIDE, UPLO, TRANSA, DIAG, M, N, ALPHA, A, LDA, B, LDB); }
+
+static inline void
+trsm(char *SIDE, char *UPLO, char *TRANSA, char *DIAG, int *M, int *N,
+     float *ALPHA, float *A, int *LDA, float *B, int *LDB)
+{ strsm_(SIDE, UPLO, TRANSA, DIAG, M, N, ALPHA, A, LDA, B, LDB); }
+
+static inline void
+syrk(char *UPLO, char *TRANS, int *N, int *K, double *ALPHA, double *A,
+     int *LDA, double *BETA, double *C, int *LDC)
+{ dsyrk_(UPLO, TRANS, N, K, ALPHA, A, LDA, BETA, C, LDC); }
+
+static inline void
+syrk(char *UPLO, char *TRANS, int *N, int *K, float *ALPHA, float *A,
+     int *LDA, float *BETA, float *C, int *LDC)
+{ ssyrk_(UPLO, TRANS, N, K, ALPHA, A, LDA, BETA, C, LDC); }
+
+static inline void
+gemm(char *TRANSA, char *TRANSB, int *M, int *N, int *K, double *ALPHA,
+     double *A, int *LDA, double *B, int *LDB, double *BETA, double *C, int *LDC)
+{ dgemm_(TRANSA, TRANSB, M, N, K, ALPHA, A, LDA, B, LDB, BETA, C, LDC); }
+
+static inline void
+gemm(char *TRANSA, char *TRANSB, int *M, int *N, int *K, float *ALPHA,
+     float *A, int *LDA, float *B, int *LDB, float *BETA, float *C, int *LDC)
+{ sgemm_(TRANSA, TRANSB, M, N, K, ALPHA, A, LDA, B, LDB, BETA, C, LDC); }
+
+static inline void
+gemv(char *TRANS, int *M, int *N, double *ALPHA, double *A, int *LDA,
+     double *X, int *INCX, double *BETA, double *Y, int *INCY)
+{ dgemv_(TRANS, M, N, ALPHA, A, LDA, X, INCX, BETA, Y, INCY); }
+
+static inline void
+gemv(char *TRANS, int *M, int *N, float *ALPHA, float *A, int *LDA,
+     float *X, int *INCX, float *BETA, float *Y, int *INCY)
+{ sgemv_(TRANS, M, N, ALPHA, A, LDA, X, INCX, BETA, Y, INCY); }
+
+static inline void
+trsv(char *UPLO, char *TRANS, char *DIAG, int *N, double *A, int *LDA,
+     double *X, int *INCX)
+{ dtrsv_(UPLO, TRANS, DIAG, N, A, LDA, X, INCX); }
+
+static inline void
+trsv(char *UPLO, char *TRANS, char *DIAG, int *N, float *A, int *LDA,
+     float *X, int *INCX)
+{ strsv_(UPLO, TRANS, DIAG, N, A, LDA, X, INCX); }
+
+#ifdef _THREADS
+// the range of subtrees factored by one thread
+struct SupernodalSPDThreadArgs {
+  SupernodalSPDLinSolver *theSolver;
+  int thread;
+  int result;
+};
+
+static void *
+factorSupernodalSPDSubtrees(void *theArgs)
+{
+  SupernodalSPDThreadArgs *args = (SupernodalSPDThreadArgs *)theArgs;
+  args->result = args->theSolver->factorSubtrees(args->thread);
+  return 0;
+}
+#endif
+
+
+SupernodalSPDLinSolver::SupernodalSPDLinSolver(int numT, int maxR, double t,
+					       bool print)
+:LinearSOESolver(SOLVER_TAGS_SupernodalSPDLinSolver),
+ theSOE(0), numThreads(numT),
+ maxRefine(maxR), tol(t), printRefine(print), numRefine(0), relResidual(0.0),
+ link(0), nextLink(0), nextRow(0), update(0), relPos(0), work(0),
+ workSingle(0), sizeWork(0),
+ numSubtrees(0), subtreeFirst(0), subtreeLast(0), threadStart(0), inTop(0)
+{
+#ifdef _THREADS
+    if (numThreads < 1)
+	numThreads = 1;
+    pthread_mutex_init(&linkMutex, 0);
+#else
+    numThreads = 1;
+#endif
+}
+
+
+SupernodalSPDLinSolver::~SupernodalSPDLinSolver()
+{
+    if (link != 0) delete [] link;
+    if (nextLink != 0) delete [] nextLink;
+    if (nextRow != 0) delete [] nextRow;
+    if (update != 0) delete [] update;
+    if (relPos != 0) delete [] relPos;
+    if (work != 0) delete [] work;
+    if (workSingle != 0) delete [] workSingle;
+    if (subtreeFirst != 0) delete [] subtreeFirst;
+    if (subtreeLast != 0) delete [] subtreeLast;
+    if (threadStart != 0) delete [] threadStart;
+    if (inTop != 0) delete [] inTop;
+#ifdef _THREADS
+    pthread_mutex_destroy(&linkMutex);
+#endif
+}
+
+
+int
+SupernodalSPDLinSolver::getNumThreads(void) const
+{
+    return numThreads;
+}
+
+
+int
+SupernodalSPDLinSolver::getNumRefinements(void) const
+{
+    return numRefine;
+}
+
+
+double
+SupernodalSPDLinSolver::getRelativeResidual(void) const
+{
+    return relResidual;
+}
+
+
+int
+SupernodalSPDLinSolver::solve(void)
+{
+    if (theSOE == 0) {
+	opserr << "WARNING SupernodalSPDLinSolver::solve(void)- ";
+	opserr << " No LinearSOE object has been set\n";
+	return -1;
+    }
+
+    int n = theSOE->size;
+
+    // check for quick return
+    if (n == 0)
+	return 0;
+
+    if (sizeWork < n) {
+	opserr << "WARNING SupernodalSPDLinSolver::solve(void)- ";
+	opserr << " setSize() has not been called\n";
+	return -1;
+    }
+
+    numRefine = 0;
+    relResidual = 0.0;
+
+    if (theSOE->factored == false) {
+	// a fallback to double precision holds for the one A
+	if (theSOE->mixedPrecision == true && theSOE->singleFactor == false) {
+	    if (theSOE->L != 0)
+		delete [] theSOE->L;
+	    theSOE->L = 0;
+	    theSOE->Ls = new float[theSOE->Lsize];
+	    theSOE->singleFactor = true;
+	}
+
+	int result = this->factor();
+	if (result < 0 && theSOE->singleFactor == true) {
+	    opserr << "WARNING SupernodalSPDLinSolver::solve(void)- ";
+	    opserr << " single precision factorization failed, factoring in double precision\n";
+	    result = this->factorDouble();
+	}
+	if (result < 0)
+	    return -1;
+	theSOE->factored = true;
+    }
+
+    if (theSOE->singleFactor == true)
+	return this->solveMixed();
+
+    this->solveDouble();
+
+    if (theSOE->mixedPrecision == true)
+	this->checkResidual();
+
+    return 0;
+}
+
+
+// the forward and backward substitution with the factor, y the rhs in the
+// order of the factor; temp holds the products of the off-diagonal blocks
+template <class T> void
+SupernodalSPDLinSolver::substitute(T *L, T *y, T *temp)
+{
+    int numSuper = theSOE->numSuper;
+    int *superStart = theSOE->superStart;
+    int *rowStart = theSOE->rowStart;
+    int *rowIndex = theSOE->rowIndex;
+    int *valStart = theSOE->valStart;
+
+    char UPLO = 'L';
+    char NOTRANS = 'N';
+    char TRANS = 'T';
+    char DIAG = 'N';
+    int ONE = 1;
+    T oneT = 1.0;
+    T zeroT = 0.0;
+    T minusOneT = -1.0;
+
+    // forward substitution L y = b
+    for (int J=0; J<numSuper; J++) {
+	int firstCol = superStart[J];
+	int numCols = superStart[J+1] - firstCol;
+	int numRows = rowStart[J+1] - rowStart[J];
+	int numOffRows = numRows - numCols;
+	int *rows = &rowIndex[rowStart[J]];
+	T *LJ = &L[valStart[J]];
+
+	trsv(&UPLO, &NOTRANS, &DIAG, &numCols, LJ, &numRows, &y[firstCol], &ONE);
+
+	if (numOffRows > 0) {
+	    gemv(&NOTRANS, &numOffRows, &numCols, &oneT, LJ+numCols, &numRows,
+		 &y[firstCol], &ONE, &zeroT, temp, &ONE);
+	    for (int p=0; p<numOffRows; p++)
+		y[rows[numCols+p]] -= temp[p];
+	}
+    }
+
+    // backward substitution L' x = y
+    for (int J=numSuper-1; J>=0; J--) {
+	int firstCol = superStart[J];
+	int numCols = superStart[J+1] - firstCol;
+	int numRows = rowStart[J+1] - rowStart[J];
+	int numOffRows = numRows - numCols;
+	int *rows = &rowIndex[rowStart[J]];
+	T *LJ = &L[valStart[J]];
+
+	if (numOffRows > 0) {
+	    for (int p=0; p<numOffRows; p++)
+		temp[p] = y[rows[numCols+p]];
+	    gemv(&TRANS, &numOffRows, &numCols, &minusOneT, LJ+numCols, &numRows,
+		 temp, &ONE, &oneT, &y[firstCol], &ONE);
+	}
+
+	trsv(&UPLO, &TRANS, &DIAG, &numCols, LJ, &numRows, &y[firstCol], &ONE);
+    }
+}
+
+
+int
+SupernodalSPDLinSolver::solveDouble(void)
+{
+    int n = theSOE->size;
+    int *invp = theSOE->invp;
+
+    double *y = work;
+    double *temp = work + n;
+    for (int i=0; i<n; i++)
+	y[invp[i]] = theSOE->B[i];
+
+    this->substitute(theSOE->L, y, temp);
+
+    double *X = theSOE->X;
+    for (int i=0; i<n; i++)
+	X[i] = y[invp[i]];
+
+    return 0;
+}
+
+
+// r = b - A x with the double precision A kept by the SOE, all in the
+// order of the factor; returns the square of the norm of r
+double
+SupernodalSPDLinSolver::formResidual(const double *b, const double *x, double *r)
+{
+    int n = theSOE->size;
+    int *Astart = theSOE->Astart;
+    int *Arow = theSOE->Arow;
+    double *Aval = theSOE->Aval;
+
+    for (int i=0; i<n; i++)
+	r[i] = b[i];
+
+    for (int k=0; k<n; k++) {
+	double xk = x[k];
+	double rk = Aval[Astart[k]]*xk;
+	for (int q=Astart[k]+1; q<Astart[k+1]; q++) {
+	    int i = Arow[q];
+	    r[i] -= Aval[q]*xk;
+	    rk += Aval[q]*x[i];
+	}
+	r[k] -= rk;
+    }
+
+    double norm = 0.0;
+    for (int i=0; i<n; i++)
+	norm += r[i]*r[i];
+    return norm;
+}
+
+
+int
+SupernodalSPDLinSolver::solveMixed(void)
+{
+    int n = theSOE->size;
+    int *invp = theSOE->invp;
+
+    double *b = work;
+    double *x = work + n;
+    double *r = work + 2*n;
+    float *y = workSingle;
+    float *temp = workSingle + n;
+
+    double normB = 0.0;
+    for (int i=0; i<n; i++) {
+	double bi = theSOE->B[i];
+	b[invp[i]] = bi;
+	normB += bi*bi;
+    }
+    normB = sqrt(normB);
+
+    for (int i=0; i<n; i++) {
+	x[i] = 0.0;
+	r[i] = b[i];
+    }
+
+    // x += inv(L L') r in single precision until r = b - A x is small
+    double normR = normB;
+    while (normB != 0.0) {
+	for (int i=0; i<n; i++)
+	    y[i] = (float)r[i];
+	this->substitute(theSOE->Ls, y, temp);
+	for (int i=0; i<n; i++)
+	    x[i] += y[i];
+
+	double lastNormR = normR;
+	normR = sqrt(this->formResidual(b, x, r));
+	relResidual = normR/normB;
+	if (relResidual <= tol)
+	    break;
+
+	// no more progress; past the accuracy of the single precision
+	// factor the residual is at that of double precision, which a
+	// double precision factor would not improve on
+	if (numRefine >= maxRefine || normR > 0.5*lastNormR) {
+	    if (relResidual <= FLT_EPSILON)
+		break;
+
+	    opserr << "WARNING SupernodalSPDLinSolver::solve(void)- ";
+	    opserr << " refinement stalled after " << numRefine << " steps with relative residual ";
+	    opserr << relResidual << ", factoring in double precision\n";
+	    if (this->factorDouble() < 0)
+		return -1;
+	    this->solveDouble();
+	    this->checkResidual();
+	    return 0;
+	}
+
+	numRefine++;
+    }
+
+    if (printRefine == true) {
+	opserr << "SupernodalSPDLinSolver::solve() - " << numRefine << " refinement steps, ";
+	opserr << "relative residual " << relResidual;
+	if (relResidual > tol)
+	    opserr << " (the accuracy reached, above tol " << tol << ")";
+	opserr << endln;
+    }
+
+    double *X = theSOE->X;
+    for (int i=0; i<n; i++)
+	X[i] = x[invp[i]];
+
+    return 0;
+}
+
+
+// sets the relative residual of the solution of the double precision
+// factor, the equations in their own order
+void
+SupernodalSPDLinSolver::checkResidual(void)
+{
+    int n = theSOE->size;
+    int *invp = theSOE->invp;
+
+    double *b = work;
+    double *x = work + n;
+    double *r = work + 2*n;
+
+    double normB = 0.0;
+    for (int i=0; i<n; i++) {
+	b[invp[i]] = theSOE->B[i];
+	x[invp[i]] = theSOE->X[i];
+	normB += theSOE->B[i]*theSOE->B[i];
+    }
+
+    relResidual = 0.0;
+    if (normB != 0.0)
+	relResidual = sqrt(this->formResidual(b, x, r)/normB);
+
+    if (printRefine == true) {
+	opserr << "SupernodalSPDLinSolver::solve() - double precision factor, ";
+	opserr << "relative residual " << relResidual << endln;
+    }
+}
+
+
+// replaces the single precision factor by a double precision one
+int
+SupernodalSPDLinSolver::factorDouble(void)
+{
+    theSOE->singleFactor = false;
+    if (theSOE->Ls != 0)
+	delete [] theSOE->Ls;
+    theSOE->Ls = 0;
+    if (theSOE->L == 0)
+	theSOE->L = new double[theSOE->Lsize];
+
+    if (this->factor() < 0)
+	return -1;
+
+    theSOE->factored = true;
+    return 0;
+}
+
+
+int
+SupernodalSPDLinSolver::factor(void)
+{
+    int numSuper = theSOE->numSuper;
+    int result = 0;
+
+    for (int J=0; J<numSuper; J++)
+	link[J] = -1;
+
+    // with A kept apart, place it in the blocks of the factor
+    if (theSOE->mixedPrecision == true) {
+	int Lsize = theSOE->Lsize;
+	int Asize = theSOE->Asize;
+	int *Apos = theSOE->Apos;
+	double *Aval = theSOE->Aval;
+	if (theSOE->singleFactor == true) {
+	    float *Ls = theSOE->Ls;
+	    for (int i=0; i<Lsize; i++)
+		Ls[i] = 0.0;
+	    for (int q=0; q<Asize; q++)
+		Ls[Apos[q]] = (float)Aval[q];
+	} else {
+	    double *L = theSOE->L;
+	    for (int i=0; i<Lsize; i++)
+		L[i] = 0.0;
+	    for (int q=0; q<Asize; q++)
+		L[Apos[q]] = Aval[q];
+	}
+    }
+
+#ifdef _THREADS
+    if (numSubtrees > 0) {
+
+	// the subtrees are factored concurrently, the first thread's by
+	// the calling thread; a thread that could not be started has its
+	// subtrees factored there too
+	SupernodalSPDThreadArgs *theArgs = new SupernodalSPDThreadArgs[numThreads];
+	pthread_t *theThreads = new pthread_t[numThreads];
+	bool *started = new bool[numThreads];
+
+	for (int t=0; t<numThreads; t++) {
+	    theArgs[t].theSolver = this;
+	    theArgs[t].thread = t;
+	    theArgs[t].result = 0;
+	    started[t] = false;
+	}
+
+	for (int t=1; t<numThreads; t++)
+	    if (pthread_create(&theThreads[t], 0, factorSupernodalSPDSubtrees, &theArgs[t]) == 0)
+		started[t] = true;
+
+	factorSupernodalSPDSubtrees(&theArgs[0]);
+	for (int t=1; t<numThreads; t++)
+	    if (started[t] == false)
+		factorSupernodalSPDSubtrees(&theArgs[t]);
+
+	// the threads only return the column at which A was found not
+	// positive definite, the first one is reported here
+	for (int t=0; t<numThreads; t++) {
+	    if (started[t] == true)
+		pthread_join(theThreads[t], 0);
+	    if (theArgs[t].result > 0 && (result == 0 || theArgs[t].result < result))
+		result = theArgs[t].result;
+	}
+
+	delete [] theArgs;
+	delete [] theThreads;
+	delete [] started;
+
+	// then the supernodes above the subtrees
+	for (int J=0; J<numSuper && result == 0; J++)
+	    if (inTop[J] == true)
+		result = this->factorSupernodes(0, J, J);
+    } else
+#endif
+	result = this->factorSupernodes(0, 0, numSuper-1);
+
+    if (result > 0) {
+	// the column of the factor back to the equation number
+	int col = result - 1;
+	int eqn = col;
+	int *invp = theSOE->invp;
+	if (invp != 0)
+	    for (int i=0; i<theSOE->size; i++)
+		if (invp[i] == col) {
+		    eqn = i;
+		    break;
+		}
+	opserr << "WARNING SupernodalSPDLinSolver::solve(void)- ";
+	opserr << " matrix not positive definite at equation " << eqn;
+	opserr << " in supernode " << theSOE->colSuper[col] << endln;
+	return -1;
+    }
+
+    return 0;
+}
+
+
+void
+SupernodalSPDLinSolver::linkSupernode(int K, int target, int thread)
+{
+#ifdef _THREADS
+    // the lists of the top supernodes are shared between the threads
+    if (numSubtrees > 0 && inTop[target] == true) {
+	pthread_mutex_lock(&linkMutex);
+	nextLink[K] = link[target];
+	link[target] = K;
+	pthread_mutex_unlock(&linkMutex);
+	return;
+    }
+#endif
+
+    nextLink[K] = link[target];
+    link[target] = K;
+}
+
+
+// factors the subtrees given to a thread in setSize(); returns as
+// factorSupernodes()
+int
+SupernodalSPDLinSolver::factorSubtrees(int thread)
+{
+    for (int i=threadStart[thread]; i<threadStart[thread+1]; i++) {
+	int result = this->factorSupernodes(thread, subtreeFirst[i], subtreeLast[i]);
+	if (result != 0)
+	    return result;
+    }
+
+    return 0;
+}
+
+
+// factors supernodes first through last in the precision of the factor
+int
+SupernodalSPDLinSolver::factorSupernodes(int thread, int first, int last)
+{
+    if (theSOE->singleFactor == true)
+	return this->factorSupernodes(thread, first, last, theSOE->Ls);
+    else
+	return this->factorSupernodes(thread, first, last, theSOE->L);
+}
+
+
+// factors supernodes first through last of L using the work space of
+// thread; returns 0, or 1 + the column at which A is not positive
+// definite, which is left to the calling thread to report
+template <class T> int
+SupernodalSPDLinSolver::factorSupernodes(int thread, int first, int last, T *L)
+{
+    int n = theSOE->size;
+    int *superStart = theSOE->superStart;
+    int *colSuper = theSOE->colSuper;
+    int *rowStart = theSOE->rowStart;
+    int *rowIndex = theSOE->rowIndex;
+    int *valStart = theSOE->valStart;
+
+    T *threadUpdate = (T *)update + thread * theSOE->maxRows * theSOE->maxCols;
+    int *threadPos = &relPos[thread * n];
+
+    char UPLO = 'L';
+    char NOTRANS = 'N';
+    char TRANS = 'T';
+    char SIDE = 'R';
+    char DIAG = 'N';
+    T oneT = 1.0;
+    T zeroT = 0.0;
+
+    for (int J=first; J<=last; J++) {
+	int firstCol = superStart[J];
+	int numCols = superStart[J+1] - firstCol;
+	int endCol = firstCol + numCols;
+	int numRows = rowStart[J+1] - rowStart[J];
+	int *rows = &rowIndex[rowStart[J]];
+	T *LJ = &L[valStart[J]];
+
+	for (int p=0; p<numRows; p++)
+	    threadPos[rows[p]] = p;
+
+	// apply the updates of the descendants with rows in J
+	int K = link[J];
+	while (K != -1) {
+	    int nextK = nextLink[K];
+
+	    int numColsK = superStart[K+1] - superStart[K];
+	    int numRowsK = rowStart[K+1] - rowStart[K];
+	    int *rowsK = &rowIndex[rowStart[K]];
+	    T *LK = &L[valStart[K]];
+
+	    int p1 = nextRow[K];
+	    int p2 = p1;
+	    while (p2 < numRowsK && rowsK[p2] < endCol)
+		p2++;
+
+	    int nc = p2 - p1;
+	    int nr = numRowsK - p1;
+	    int nb = nr - nc;
+
+	    // update = LK(p1:end,:) * LK(p1:p2,:)', lower part
+	    syrk(&UPLO, &NOTRANS, &nc, &numColsK, &oneT, LK+p1, &numRowsK,
+		 &zeroT, threadUpdate, &nr);
+	    if (nb > 0)
+		gemm(&NOTRANS, &TRANS, &nb, &nc, &numColsK, &oneT, LK+p2, &numRowsK,
+		     LK+p1, &numRowsK, &zeroT, threadUpdate+nc, &nr);
+
+	    for (int j=0; j<nc; j++) {
+		T *colPtr = LJ + (rowsK[p1+j]-firstCol)*numRows;
+		T *updatePtr = threadUpdate + j*nr;
+		for (int i=j; i<nr; i++)
+		    colPtr[threadPos[rowsK[p1+i]]] -= updatePtr[i];
+	    }
+
+	    // K next updates the supernode of its first row below J
+	    nextRow[K] = p2;
+	    if (p2 < numRowsK)
+		this->linkSupernode(K, colSuper[rowsK[p2]], thread);
+
+	    K = nextK;
+	}
+	link[J] = -1;
+
+	// factor the diagonal block and solve for the off-diagonal block
+	int info = 0;
+	potrf(&UPLO, &numCols, LJ, &numRows, &info);
+	if (info != 0)
+	    return firstCol + info;
+
+	int numOffRows = numRows - numCols;
+	if (numOffRows > 0) {
+	    trsm(&SIDE, &UPLO, &TRANS, &DIAG, &numOffRows, &numCols, &oneT,
+		 LJ, &numRows, LJ+numCols, &numRows);
+
+	    nextRow[J] = numCols;
+	    this->linkSupernode(J, colSuper[rows[numCols]], thread);
+	}
+    }
+
+    return 0;
+}
+
+
+int
+SupernodalSPDLinSolver::setSize(void)
+{
+    int n = theSOE->size;
+    int numSuper = theSOE->numSuper;
+
+    if (link != 0) delete [] link;
+    if (nextLink != 0) delete [] nextLink;
+    if (nextRow != 0) delete [] nextRow;
+    if (update != 0) delete [] update;
+    if (relPos != 0) delete [] relPos;
+    if (work != 0) delete [] work;
+    if (workSingle != 0) delete [] workSingle;
+    if (subtreeFirst != 0) delete [] subtreeFirst;
+    if (subtreeLast != 0) delete [] subtreeLast;
+    if (threadStart != 0) delete [] threadStart;
+    if (inTop != 0) delete [] inTop;
+    link = 0; nextLink = 0; nextRow = 0; update = 0; relPos = 0; work = 0;
+    workSingle = 0;
+    subtreeFirst = 0; subtreeLast = 0; threadStart = 0; inTop = 0;
+    numSubtrees = 0;
+    sizeWork = 0;
+
+    if (n == 0)
+	return 0;
+
+    link = new int[numSuper];
+    nextLink = new int[numSuper];
+    nextRow = new int[numSuper];
+    update = new double[numThreads * theSOE->maxRows * theSOE->maxCols];
+    relPos = new int[numThreads * n];
+    if (theSOE->mixedPrecision == true) {
+	// b, x and r of the refinement
+	work = new double[3*n];
+	workSingle = new float[2*n];
+    } else
+	work = new double[2*n];
+    sizeWork = n;
+
+    if (numThreads == 1 || numSuper < 2*numThreads)
+	return 0;
+
+    //
+    // split the supernodal elimination tree into subtrees for the threads:
+    // the largest subtree is replaced by its children, its root going to
+    // the top, until the largest is no more than a share of the total
+    //
+
+    int *superParent = theSOE->superParent;
+    int *superStart = theSOE->superStart;
+    int *rowStart = theSOE->rowStart;
+
+    double *cost = new double[numSuper];
+    int *firstDesc = new int[numSuper];
+    for (int s=0; s<numSuper; s++) {
+	double numCols = superStart[s+1] - superStart[s];
+	double numRows = rowStart[s+1] - rowStart[s];
+	cost[s] = numCols*numRows*numRows;
+	firstDesc[s] = s;
+    }
+    for (int s=0; s<numSuper; s++) {
+	int p = superParent[s];
+	if (p != -1) {
+	    cost[p] += cost[s];
+	    if (firstDesc[s] < firstDesc[p])
+		firstDesc[p] = firstDesc[s];
+	}
+    }
+
+    inTop = new bool[numSuper];
+    int *candidates = new int[numSuper];
+    int numCandidates = 0;
+    for (int s=0; s<numSuper; s++) {
+	inTop[s] = false;
+	if (superParent[s] == -1)
+	    candidates[numCandidates++] = s;
+    }
+
+    int maxCandidates = 16*numThreads;
+    while (numCandidates < maxCandidates) {
+	int largest = 0;
+	double totalCost = 0.0;
+	for (int c=0; c<numCandidates; c++) {
+	    totalCost += cost[candidates[c]];
+	    if (cost[candidates[c]] > cost[candidates[largest]])
+		largest = c;
+	}
+
+	int root = candidates[largest];
+	if (numCandidates >= numThreads && cost[root] <= totalCost/(2*numThreads))
+	    break;
+	if (firstDesc[root] == root)
+	    break;
+
+	// replace the largest subtree by its children
+	inTop[root] = true;
+	candidates[largest] = candidates[--numCandidates];
+	for (int s=firstDesc[root]; s<root; s++)
+	    if (superParent[s] == root)
+		candidates[numCandidates++] = s;
+    }
+
+    // the supernodes in the top and the subtrees are exclusive
+    for (int s=0; s<numSuper; s++)
+	if (inTop[s] == true)
+	    cost[s] = 0.0;
+
+    // assign the subtrees largest first to the least loaded thread
+    double *load = new double[numThreads];
+    int *owner = new int[numCandidates];
+    for (int t=0; t<numThreads; t++)
+	load[t] = 0.0;
+    for (int c=0; c<numCandidates; c++) {
+	int largest = c;
+	for (int d=c+1; d<numCandidates; d++)
+	    if (cost[candidates[d]] > cost[candidates[largest]])
+		largest = d;
+	int root = candidates[largest];
+	candidates[largest] = candidates[c];
+	candidates[c] = root;
+
+	int least = 0;
+	for (int t=1; t<numThreads; t++)
+	    if (load[t] < load[least])
+		least = t;
+	owner[c] = least;
+	load[least] += cost[root];
+    }
+
+    numSubtrees = numCandidates;
+    subtreeFirst = new int[numSubtrees];
+    subtreeLast = new int[numSubtrees];
+    threadStart = new int[numThreads+1];
+    int loc = 0;
+    for (int t=0; t<numThreads; t++) {
+	threadStart[t] = loc;
+	for (int c=0; c<numCandidates; c++)
+	    if (owner[c] == t) {
+		subtreeFirst[loc] = firstDesc[candidates[c]];
+		subtreeLast[loc] = candidates[c];
+		loc++;
+	    }
+    }
+    threadStart[numThreads] = loc;
+
+    delete [] cost;
+    delete [] firstDesc;
+    delete [] candidates;
+    delete [] load;
+    delete [] owner;
+
+    return 0;
+}
+
+
+int
+SupernodalSPDLinSolver::setLinearSOE(SupernodalSPDLinSOE &theLinearSOE)
+{
+    theSOE = &theLinearSOE;
+    return 0;
+}
+
+
+int
+SupernodalSPDLinSolver::sendSelf(int cTag, Channel &theChannel)
+{
+    // nothing to do
+    return 0;
+}
+
+
+int
+SupernodalSPDLinSolver::recvSelf(int cTag,
+				 Channel &theChannel, FEM_ObjectBroker &theBroker)
+{
+    // nothing to do
+    return 0;
+}
@@ -0,0 +1,119 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+#ifndef SupernodalSPDLinSolver_h
+#define SupernodalSPDLinSolver_h
+
+// Description: This file contains the class definition for
+// SupernodalSPDLinSolver. It solves a SupernodalSPDLinSOE object by a
+// left-looking supernodal Cholesky factorization: the updates from the
+// descendants of a supernode are formed with the BLAS-3 dsyrk and dgemm,
+// the diagonal block is factored with dpotrf and the off-diagonal block
+// with dtrsm. When built with _THREADS the elimination tree is split into
+// disjoint subtrees that are factored by numThreads threads; the
+// supernodes above them are then factored by the calling thread.
+// When the SOE stores the factor in single precision, the solution is
+// refined against the double precision A until the relative residual is
+// below tol. A refinement that stops making progress once past the
+// accuracy of the single precision factor has reached that of double
+// precision, about eps*cond(A), and its solution is kept with the
+// residual reached. Otherwise, or if the single precision factorization
+// fails, that A is factored again in double precision; the next A is
+// factored in single precision again.
+//
+// What: "@(#) SupernodalSPDLinSolver.h, revA"
+
+#include <LinearSOESolver.h>
+
+#ifdef _THREADS
+#include <pthread.h>
+#endif
+
+class SupernodalSPDLinSOE;
+
+class SupernodalSPDLinSolver : public LinearSOESolver
+{
+  public:
+    SupernodalSPDLinSolver(int numThreads = 1, int maxRefine = 10,
+			   double tol = 1.0e-10, bool printRefine = false);
+    ~SupernodalSPDLinSolver();
+
+    int solve(void);
+    int setSize(void);
+
+    int setLinearSOE(SupernodalSPDLinSOE &theSOE);
+    int getNumThreads(void) const;
+    int getNumRefinements(void) const;
+    double getRelativeResidual(void) const;
+
+    int sendSelf(int cTag, Channel &theChannel);
+    int recvSelf(int cTag,
+		 Channel &theChannel,
+		 FEM_ObjectBroker &theBroker);
+
+    int factorSubtrees(int thread);
+
+  protected:
+
+  private:
+    int factor(void);
+    int factorDouble(void);
+    int factorSupernodes(int thread, int first, int last);
+    template <class T> int factorSupernodes(int thread, int first, int last,
+					    T *L);
+    template <class T> void substitute(T *L, T *y, T *temp);
+    int solveDouble(void);
+    int solveMixed(void);
+    double formResidual(const double *b, const double *x, double *r);
+    void checkResidual(void);
+    void linkSupernode(int K, int target, int thread);
+
+    SupernodalSPDLinSOE *theSOE;
+    int numThreads;
+
+    int maxRefine;       // refinement steps before the double factorization
+    double tol;          // on the residual relative to the norm of B
+    bool printRefine;    // print the refinement of each solve
+    int numRefine;       // refinement steps of the last solve
+    double relResidual;  // its relative residual
+
+    int *link;           // head of the list of supernodes updating each one
+    int *nextLink;       // next supernode in the same list
+    int *nextRow;        // position of the first row not yet used in updates
+    double *update;      // update block, maxRows*maxCols for each thread
+    int *relPos;         // row positions in the supernode being factored
+    double *work;        // work vector of the substitution
+    float *workSingle;   // work vector of the single precision substitution
+    int sizeWork;
+
+    // subtrees factored concurrently, supernodes first .. last of the
+    // subtrees given to thread t are in subtreeFirst/subtreeLast between
+    // threadStart[t] and threadStart[t+1]; the others are in the top
+    int numSubtrees;
+    int *subtreeFirst;
+    int *subtreeLast;
+    int *threadStart;
+    bool *inTop;
+#ifdef _THREADS
+    pthread_mutex_t linkMutex;  // guards the lists of the top supernodes
+#endif
+};
+
+#endif
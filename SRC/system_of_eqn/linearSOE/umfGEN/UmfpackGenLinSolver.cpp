@@ -34,6 +34,7 @@
 
 #include <UmfpackGenLinSOE.h>
 #include <UmfpackGenLinSolver.h>
+#include <Matrix.h>
 #include <f2c.h>
 #include <math.h>
 #include <Channel.h>
@@ -167,6 +168,66 @@ UmfpackGenLinSolver::solve(void)
 }
 
 
+// umfpack substitutes for one rhs per call, the columns are passed in
+// turn to the factors without going through the SOE
+int
+UmfpackGenLinSolver::solveMultiple(const Matrix &B, Matrix &X)
+{
+    if (theSOE == 0) {
+	opserr << "WARNING UmfpackGenLinSolver::solveMultiple()- ";
+	opserr << " No LinearSOE object has been set\n";
+	return -1;
+    }
+    
+    int n = theSOE->size;
+    int nrhs = B.noCols();
+    if (n == 0 || nrhs == 0)
+	return 0;
+
+    // factor the matrix if not already done
+    if (theSOE->factored == false) {
+	int res = this->solve();
+	if (res < 0)
+	    return res;
+    }
+
+    double *Aptr = theSOE->A;
+    int lValue = theSOE->lValue;
+    int job =0;
+    logical trans = FALSE_;
+
+    double *Bcol = new double[n];
+    if (Bcol == 0) {
+	opserr << "WARNING UmfpackGenLinSolver::solveMultiple()- out of memory\n";
+	return -1;
+    }
+
+    for (int j=0; j<nrhs; j++) {
+	for (int i=0; i<n; i++)
+	    Bcol[i] = B(i,j);
+	double *Xptr = &X(0,j);
+
+#ifdef _WIN32
+	UMD2SO(&n, &job, &trans, &lValue, &lIndex, Aptr, copyIndex, 
+	       keep, Bcol, Xptr, work, cntl, icntl, info, rinfo);    
+#else
+	umd2so_(&n, &job, &trans, &lValue, &lIndex, Aptr, copyIndex, 
+		keep, Bcol, Xptr, work, cntl, icntl, info, rinfo);
+#endif
+
+	if (info[0] != 0) {	
+	    opserr << "WARNING UmfpackGenLinSolver::solveMultiple()- ";
+	    opserr << info[0] << " returned in substitution UMD2SO()\n";
+	    delete [] Bcol;
+	    return -info[0];
+	}
+    }
+
+    delete [] Bcol;
+    return 0;
+}
+
+
 int
 UmfpackGenLinSolver::setSize()
 {
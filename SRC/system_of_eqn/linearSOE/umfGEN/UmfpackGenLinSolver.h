@@ -46,6 +46,7 @@ class UmfpackGenLinSolver : public LinearSOESolver
     ~UmfpackGenLinSolver();
 
     int solve(void);
+    int solveMultiple(const Matrix &B, Matrix &X);
     int setSize(void);
 
     int setLinearSOE(UmfpackGenLinSOE &theSOE);
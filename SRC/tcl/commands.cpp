@@ -75,6 +75,7 @@ OPS_Stream *opserrPtr = &sserr;
 #include <FEM_ObjectBrokerAllClasses.h>
 
 #include <Timer.h>
+#include <Profiler.h>
 #include <ModelBuilder.h>
 #include "commands.h"
 
@@ -92,6 +93,9 @@ OPS_Stream *opserrPtr = &sserr;
 #include <NodeIter.h>
 #include <LoadPattern.h>
 #include <LoadPatternIter.h>
+#include <UniformExcitation.h>
+#include <GroundMotion.h>
+#include <TimeSeries.h>
 #include <ElementalLoad.h>
 #include <ElementalLoadIter.h>
 #include <ParameterIter.h>
@@ -209,6 +213,8 @@ extern TransientIntegrator *OPS_NewGeneralizedAlpha(void);
 #ifndef _WIN32
 #include <ItpackLinSOE.h>
 #include <ItpackLinSolver.h>
+#include <OutOfCoreProfileSPDLinSOE.h>
+#include <OutOfCoreProfileSPDLinSolver.h>
 #endif
 
 #include <FullGenLinSOE.h>
@@ -254,6 +260,10 @@ extern TransientIntegrator *OPS_NewGeneralizedAlpha(void);
 
 #include <SymSparseLinSOE.h>
 #include <SymSparseLinSolver.h>
+#include <SupernodalSPDLinSOE.h>
+#include <SupernodalSPDLinSolver.h>
+#include <BlockSparseGenLinSOE.h>
+#include <BlockSparseGenLinSolver.h>
 #include <UmfpackGenLinSOE.h>
 #include <UmfpackGenLinSolver.h>
 #include <EigenSOE.h>
@@ -289,6 +299,7 @@ extern TransientIntegrator *OPS_NewGeneralizedAlpha(void);
 #endif
 
 #include <FE_Datastore.h>
+#include <MemoryDatastore.h>
 
 #ifdef _RELIABILITY
 // AddingSensitivity:BEGIN /////////////////////////////////////////////////
@@ -345,6 +356,8 @@ ModelBuilder *theBuilder =0;
 #include <ShadowSubdomain.h>
 #include <Metis.h>
 #include <ShedHeaviest.h>
+#include <ReleaseHeavierToLighterNeighbours.h>
+#include <SwapHeavierToLighterNeighbours.h>
 #include <DomainPartitioner.h>
 #include <GraphPartitioner.h>
 #include <FEM_ObjectBrokerAllClasses.h>
@@ -514,6 +527,10 @@ char *neesCentralPasswd =0;
 
 
 FE_Datastore *theDatabase  =0;
+MemoryDatastore *theSnapshots =0;
+
+// response handles created by eleResponseHandle & nodeResponseHandle
+void clearResponseHandles(int eleTag = -1);
 FEM_ObjectBrokerAllClasses theBroker;
 
 // init the global variabled defined in OPS_Globals.h
@@ -552,6 +569,14 @@ opsBarrier(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
 int 
 domainChange(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 
+#ifdef _PARALLEL_PROCESSING
+int 
+partitionWeights(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
+int 
+loadBalance(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+#endif
+
 int 
 record(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 
@@ -596,6 +621,9 @@ convertBinaryToText(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Cha
 int
 convertTextToBinary(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 
+int
+convertTimeSeriesToBinary(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
 
 int Tcl_InterpOpenSeesObjCmd(ClientData clientData,  Tcl_Interp *interp, int objc, Tcl_Obj *CONST objv[])
 {
@@ -681,6 +709,8 @@ int OpenSeesAppInit(Tcl_Interp *interp) {
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
     Tcl_CreateCommand(interp, "analyze", &analyzeModel, 
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
+    Tcl_CreateCommand(interp, "analyzeRecords", &analyzeRecords, 
+		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
     Tcl_CreateCommand(interp, "print", &printModel, 
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
     Tcl_CreateCommand(interp, "analysis", &specifyAnalysis, 
@@ -708,6 +738,8 @@ int OpenSeesAppInit(Tcl_Interp *interp) {
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
     Tcl_CreateCommand(interp, "database", &addDatabase, 
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
+    Tcl_CreateCommand(interp, "snapshot", &domainSnapshot, 
+		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
     Tcl_CreateCommand(interp, "eigen", &eigenAnalysis, 
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);       
     Tcl_CreateCommand(interp, "video", &videoPlayer, 
@@ -731,6 +763,18 @@ int OpenSeesAppInit(Tcl_Interp *interp) {
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);       
     Tcl_CreateCommand(interp, "nodeResponse", &nodeResponse, 
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);       
+    Tcl_CreateCommand(interp, "eleResponses", &eleResponses, 
+		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);       
+    Tcl_CreateCommand(interp, "nodeResponses", &nodeResponses, 
+		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);       
+    Tcl_CreateCommand(interp, "eleResponseHandle", &eleResponseHandle, 
+		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);       
+    Tcl_CreateCommand(interp, "nodeResponseHandle", &nodeResponseHandle, 
+		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);       
+    Tcl_CreateCommand(interp, "getResponse", &getResponse, 
+		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);       
+    Tcl_CreateCommand(interp, "removeResponseHandle", &removeResponseHandle, 
+		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);       
     Tcl_CreateCommand(interp, "reactions", &calculateNodalReactions, 
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);       
     Tcl_CreateCommand(interp, "nodeCoord", &nodeCoord, 
@@ -747,6 +791,8 @@ int OpenSeesAppInit(Tcl_Interp *interp) {
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);       
     Tcl_CreateCommand(interp, "stop", &stopTimer, 
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);       
+    Tcl_CreateCommand(interp, "profiler", &profilerCommand, 
+		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);       
     Tcl_CreateCommand(interp, "rayleigh", &rayleighDamping, 
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);       
     Tcl_CreateCommand(interp, "setElementRayleighDampingFactors", 
@@ -778,6 +824,14 @@ int OpenSeesAppInit(Tcl_Interp *interp) {
 
     Tcl_CreateCommand(interp, "domainChange",  &domainChange,(ClientData)NULL, NULL);
 
+#ifdef _PARALLEL_PROCESSING
+    Tcl_CreateCommand(interp, "partitionWeights", &partitionWeights, 
+		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
+
+    Tcl_CreateCommand(interp, "loadBalance", &loadBalance, 
+		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
+#endif
+
     Tcl_CreateCommand(interp, "record",  &record,(ClientData)NULL, NULL);
 
     Tcl_CreateCommand(interp, "metaData",  &neesMetaData,(ClientData)NULL, NULL);
@@ -786,6 +840,7 @@ int OpenSeesAppInit(Tcl_Interp *interp) {
     Tcl_CreateCommand(interp, "stripXML", &stripOpenSeesXML,(ClientData)NULL, NULL);
     Tcl_CreateCommand(interp, "convertBinaryToText", &convertBinaryToText,(ClientData)NULL, NULL);
     Tcl_CreateCommand(interp, "convertTextToBinary", &convertTextToBinary,(ClientData)NULL, NULL);
+    Tcl_CreateCommand(interp, "convertTimeSeriesToBinary", &convertTimeSeriesToBinary,(ClientData)NULL, NULL);
 
     Tcl_CreateCommand(interp, "getEleTags", &getEleTags, 
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);  
@@ -1200,7 +1255,11 @@ wipeModel(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
 
   if (theDatabase != 0)
     delete theDatabase;
+
+  if (theSnapshots != 0)
+    delete theSnapshots;
   
+  clearResponseHandles();
   theDomain.clearAll();
 
 #ifdef _PARALLEL_PROCESSING
@@ -1230,6 +1289,7 @@ wipeModel(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
 
   theTest = 0;
   theDatabase = 0;
+  theSnapshots = 0;
 
 // AddingSensitivity:BEGIN /////////////////////////////////////////////////
 #ifdef _RELIABILITY
@@ -1300,7 +1360,37 @@ wipeAnalysis(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **arg
 int 
 resetModel(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
 {
-	theDomain.revertToStart();
+	OPS_ResetModel();
+	
+	return TCL_OK;
+}
+
+#ifdef _PARALLEL_PROCESSING
+int partitionModel(void);
+
+// partitions the model before its first analysis, for the analyze
+// command and OPS_AnalyzeModel()
+static int
+partitionModelBeforeAnalysis(void)
+{
+  if (OPS_PARTITIONED == false && OPS_NUM_SUBDOMAINS > 1) 
+    if (partitionModel() < 0) {
+      opserr << "WARNING before analysis; partition failed - too few elements\n";
+      return -1;
+    }
+
+  return 0;
+}
+#endif
+
+//
+// the reset and analyze commands without the interpreter, for code 
+// that runs the analysis many times over, e.g. the g-function evaluators
+//
+int
+OPS_ResetModel(void)
+{
+	int res = theDomain.revertToStart();
 
 
 // AddingSensitivity:BEGIN ////////////////////////////////////
@@ -1312,8 +1402,31 @@ resetModel(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
 	}
 // AddingSensitivity:END //////////////////////////////////////
 
-	
-	return TCL_OK;
+	return res;
+}
+
+int
+OPS_AnalyzeModel(int numIncr, double dT)
+{
+#ifdef _PARALLEL_PROCESSING
+  if (partitionModelBeforeAnalysis() < 0)
+    return -1;
+#endif
+
+  if (theStaticAnalysis != 0)
+    return theStaticAnalysis->analyze(numIncr);
+
+  if (theTransientAnalysis != 0) {
+    if (dT <= 0.0) {
+      opserr << "WARNING transient analysis: no deltaT given\n";
+      return -1;
+    }
+    ops_Dt = dT;
+    return theTransientAnalysis->analyze(numIncr, dT);
+  }
+
+  opserr << "WARNING No Analysis type has been specified \n";
+  return -1;
 }
 
 int
@@ -1429,6 +1542,18 @@ buildModel(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
 
 #ifdef _PARALLEL_PROCESSING
 
+static void
+createDomainPartitioner(void)
+{
+  if (OPS_DOMAIN_PARTITIONER == 0) {
+    //      OPS_BALANCER = new ShedHeaviest();
+    OPS_GRAPH_PARTITIONER  = new Metis;
+    //OPS_DOMAIN_PARTITIONER = new DomainPartitioner(*OPS_GRAPH_PARTITIONER, *OPS_BALANCER);
+    OPS_DOMAIN_PARTITIONER = new DomainPartitioner(*OPS_GRAPH_PARTITIONER);
+    theDomain.setPartitioner(OPS_DOMAIN_PARTITIONER);
+  }
+}
+
 int 
 partitionModel(void)
 {
@@ -1449,13 +1574,7 @@ partitionModel(void)
   }
 
   // create a partitioner & partition the domain
-  if (OPS_DOMAIN_PARTITIONER == 0) {
-    //      OPS_BALANCER = new ShedHeaviest();
-    OPS_GRAPH_PARTITIONER  = new Metis;
-    //OPS_DOMAIN_PARTITIONER = new DomainPartitioner(*OPS_GRAPH_PARTITIONER, *OPS_BALANCER);
-    OPS_DOMAIN_PARTITIONER = new DomainPartitioner(*OPS_GRAPH_PARTITIONER);
-    theDomain.setPartitioner(OPS_DOMAIN_PARTITIONER);
-  }
+  createDomainPartitioner();
 
   result = theDomain.partition(OPS_NUM_SUBDOMAINS, OPS_USING_MAIN_DOMAIN, OPS_MAIN_DOMAIN_PARTITION_ID);
   
@@ -1499,6 +1618,158 @@ partitionModel(void)
   return result;
 }
 
+//
+// command to set how the elements are weighted when the model is partitioned:
+//   partitionWeights <-ele $eleType $weight> <-measure $numSamples> <-constraints $numCon>
+// returns the load imbalance factor of the last partitioning
+//
+int 
+partitionWeights(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  createDomainPartitioner();
+
+  int count = 1;
+  while (count < argc) {
+    if (strcmp(argv[count],"-ele") == 0 && count+2 < argc) {
+      // find the class tag from an element of the type in the model
+      int classTag = -1;
+      ElementIter &theElements = theDomain.getElements();
+      Element *theEle;
+      while (classTag < 0 && (theEle = theElements()) != 0)
+	if (strcmp(theEle->getClassType(), argv[count+1]) == 0)
+	  classTag = theEle->getClassTag();
+
+      if (classTag < 0) {
+	opserr << "WARNING partitionWeights - no element of type " << argv[count+1] << " in the model\n";
+	return TCL_ERROR;
+      }
+
+      double weight;
+      if (Tcl_GetDouble(interp, argv[count+2], &weight) != TCL_OK) {
+	opserr << "WARNING partitionWeights - invalid weight " << argv[count+2] << endln;
+	return TCL_ERROR;
+      }
+      if (OPS_DOMAIN_PARTITIONER->setElementWeight(classTag, weight) < 0)
+	return TCL_ERROR;
+      count += 3;
+    }
+
+    else if (strcmp(argv[count],"-measure") == 0 && count+1 < argc) {
+      int numSamples;
+      if (Tcl_GetInt(interp, argv[count+1], &numSamples) != TCL_OK) {
+	opserr << "WARNING partitionWeights - invalid number of samples " << argv[count+1] << endln;
+	return TCL_ERROR;
+      }
+      if (OPS_DOMAIN_PARTITIONER->setNumWeightSamples(numSamples) < 0)
+	return TCL_ERROR;
+      count += 2;
+    }
+
+    else if (strcmp(argv[count],"-constraints") == 0 && count+1 < argc) {
+      int numCon;
+      if (Tcl_GetInt(interp, argv[count+1], &numCon) != TCL_OK) {
+	opserr << "WARNING partitionWeights - invalid number of constraints " << argv[count+1] << endln;
+	return TCL_ERROR;
+      }
+      if (((Metis *)OPS_GRAPH_PARTITIONER)->setNumConstraints(numCon) < 0)
+	return TCL_ERROR;
+      count += 2;
+    }
+
+    else {
+      opserr << "WARNING partitionWeights <-ele $eleType $weight> <-measure $numSamples> <-constraints $numCon>";
+      opserr << " - unknown option " << argv[count] << endln;
+      return TCL_ERROR;
+    }
+  }
+
+  sprintf(interp->result,"%f",OPS_DOMAIN_PARTITIONER->getImbalance());
+  return TCL_OK;
+}
+
+//
+// command to migrate elements between subdomains during the analysis:
+//   loadBalance $type <-interval $numSteps> <-threshold $imbalance> 
+//               <-factor $factorGreater> <-releases $numReleases>
+// $type is one of ShedHeaviest, ReleaseHeavier or SwapHeavier. Every
+// $numSteps commits, if the subdomain timings are out of balance by more 
+// than $imbalance (max/mean), elements are moved from the slower subdomains.
+//
+int 
+loadBalance(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  if (argc < 2) {
+    opserr << "WARNING loadBalance type <-interval $numSteps> <-threshold $imbalance> <-factor $factor> <-releases $numReleases>\n";
+    return TCL_ERROR;
+  }
+
+  int numSteps = 1;
+  double threshold = 1.1;
+  double factorGreater = 1.0;
+  int numReleases = 1;
+
+  int count = 2;
+  while (count < argc) {
+    if (strcmp(argv[count],"-interval") == 0 && count+1 < argc) {
+      if (Tcl_GetInt(interp, argv[count+1], &numSteps) != TCL_OK) {
+	opserr << "WARNING loadBalance - invalid interval " << argv[count+1] << endln;
+	return TCL_ERROR;
+      }
+    }
+    else if (strcmp(argv[count],"-threshold") == 0 && count+1 < argc) {
+      if (Tcl_GetDouble(interp, argv[count+1], &threshold) != TCL_OK) {
+	opserr << "WARNING loadBalance - invalid threshold " << argv[count+1] << endln;
+	return TCL_ERROR;
+      }
+    }
+    else if (strcmp(argv[count],"-factor") == 0 && count+1 < argc) {
+      if (Tcl_GetDouble(interp, argv[count+1], &factorGreater) != TCL_OK) {
+	opserr << "WARNING loadBalance - invalid factor " << argv[count+1] << endln;
+	return TCL_ERROR;
+      }
+    }
+    else if (strcmp(argv[count],"-releases") == 0 && count+1 < argc) {
+      if (Tcl_GetInt(interp, argv[count+1], &numReleases) != TCL_OK) {
+	opserr << "WARNING loadBalance - invalid number of releases " << argv[count+1] << endln;
+	return TCL_ERROR;
+      }
+    }
+    else {
+      opserr << "WARNING loadBalance - unknown option " << argv[count] << endln;
+      return TCL_ERROR;
+    }
+    count += 2;
+  }
+
+  LoadBalancer *theBalancer = 0;
+  if (strcmp(argv[1],"ShedHeaviest") == 0)
+    theBalancer = new ShedHeaviest(factorGreater, numReleases, true);
+  else if (strcmp(argv[1],"ReleaseHeavier") == 0)
+    theBalancer = new ReleaseHeavierToLighterNeighbours(factorGreater, numReleases, true);
+  else if (strcmp(argv[1],"SwapHeavier") == 0)
+    theBalancer = new SwapHeavierToLighterNeighbours(factorGreater, numReleases);
+  else {
+    opserr << "WARNING loadBalance - unknown type " << argv[1];
+    opserr << ", use ShedHeaviest, ReleaseHeavier or SwapHeavier\n";
+    return TCL_ERROR;
+  }
+
+  createDomainPartitioner();
+
+  if (OPS_DOMAIN_PARTITIONER->setBalanceInterval(numSteps, threshold) < 0) {
+    delete theBalancer;
+    return TCL_ERROR;
+  }
+
+  OPS_DOMAIN_PARTITIONER->setLoadBalancer(*theBalancer);
+
+  if (OPS_BALANCER != 0)
+    delete OPS_BALANCER;
+  OPS_BALANCER = theBalancer;
+
+  return TCL_OK;
+}
+
 #endif
 
 
@@ -1513,14 +1784,11 @@ analyzeModel(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **arg
   int result = 0;
 
 #ifdef _PARALLEL_PROCESSING
-
-  if (OPS_PARTITIONED == false && OPS_NUM_SUBDOMAINS > 1) 
-    if (partitionModel() < 0) {
-      opserr << "WARNING before analysis; partition failed - too few elements\n";
-      OpenSeesExit(clientData, interp, argc, argv);
-      opserr << "WARNING called OpenSeesExit\n";
-      return TCL_ERROR;
-    }
+  if (partitionModelBeforeAnalysis() < 0) {
+    OpenSeesExit(clientData, interp, argc, argv);
+    opserr << "WARNING called OpenSeesExit\n";
+    return TCL_ERROR;
+  }
 #endif
 
   if (theStaticAnalysis != 0) {
@@ -1550,7 +1818,29 @@ analyzeModel(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **arg
     // Set global timestep variable
     ops_Dt = dT;
 
-    if (argc == 6) {
+    // analyze numIncr dT dtMin dtMax -errorTol relTol <absTol>
+    // the error of a step is accepted if <= absTol + relTol*||U||, absTol 
+    // defaults to relTol
+    if ((argc == 7 || argc == 8) && strcmp(argv[5],"-errorTol") == 0) {
+      double dtMin, dtMax, relTol, absTol;
+      if (Tcl_GetDouble(interp, argv[3], &dtMin) != TCL_OK)	
+	return TCL_ERROR;
+      if (Tcl_GetDouble(interp, argv[4], &dtMax) != TCL_OK)	
+	return TCL_ERROR;
+      if (Tcl_GetDouble(interp, argv[6], &relTol) != TCL_OK)	
+	return TCL_ERROR;
+      absTol = relTol;
+      if (argc == 8 && Tcl_GetDouble(interp, argv[7], &absTol) != TCL_OK)	
+	return TCL_ERROR;
+
+      if (theVariableTimeStepTransientAnalysis != 0)
+	result =  theVariableTimeStepTransientAnalysis->analyzeAdaptive(numIncr, dT, dtMin, dtMax, relTol, absTol);
+      else {
+	opserr << "WARNING analyze - no variable time step transient analysis object constructed\n";
+	return TCL_ERROR;
+      }
+
+    } else if (argc == 6) {
       int Jd;
       double dtMin, dtMax;
       if (Tcl_GetDouble(interp, argv[3], &dtMin) != TCL_OK)	
@@ -1586,6 +1876,282 @@ analyzeModel(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **arg
 
 }
 
+extern TimeSeries *
+TclSeriesCommand(ClientData clientData, Tcl_Interp *interp, TCL_Char *arg);
+
+//
+// reverts the nodes and elements to their initial state as
+// Domain::revertToStart does, but without restarting the recorders, so
+// that envelope recorders span all the runs of analyzeRecords; returns
+// the result of the domain update
+//
+static int
+revertModelToStart(void)
+{
+  Node *theNode;
+  NodeIter &theNodes = theDomain.getNodes();
+  while ((theNode = theNodes()) != 0)
+    theNode->revertToStart();
+
+  Element *theEle;
+  ElementIter &theElements = theDomain.getElements();
+  while ((theEle = theElements()) != 0)
+    theEle->revertToStart();
+
+  theDomain.setCommittedTime(0.0);
+  theDomain.setCurrentTime(0.0);
+  theDomain.applyLoad(0.0);
+
+  return theDomain.update();
+}
+
+//
+// command invoked to run the transient analysis for a set of records and
+// scale factors, i.e. an IDA. the ground motion of an existing
+// UniformExcitation pattern is swapped between runs and the model is
+// brought back to its initial state, so the AnalysisModel, the dof
+// numbering and the system of equations (with any symbolic factorization)
+// are built once. the recorders are not restarted between runs and the
+// original motion of the pattern is put back when the runs are done:
+//
+// analyzeRecords patternTag numIncr dT -accel {series1 series2 ..} 
+//                <-factors {f1 f2 ..}> <-init script> <-eval script>
+//
+// numIncr of 0 runs each record for its full duration. the model is
+// reverted to its start and the init script (e.g. to apply gravity)
+// evaluated once, the committed state is then kept in a MemoryDatastore
+// and restored before each later run; if it cannot be stored the model
+// is reverted and the script evaluated before every run. the response
+// handles are not kept across a restore. the eval script is evaluated
+// after each run with the record number, factor and result appended.
+// each record is read once and run for all the factors. with parallel
+// interpreters the runs are dealt out round robin over the processes.
+// returns the analysis result of each run performed.
+//
+int 
+analyzeRecords(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  if (theTransientAnalysis == 0) {
+    opserr << "WARNING analyzeRecords - no transient analysis has been specified\n";
+    return TCL_ERROR;
+  }
+
+  if (argc < 6) {
+    opserr << "WARNING analyzeRecords patternTag numIncr dT -accel {seriesList} <-factors {factorList}> <-init script> <-eval script>\n";
+    return TCL_ERROR;
+  }
+
+  int patternTag, numIncr;
+  double dT;
+  if (Tcl_GetInt(interp, argv[1], &patternTag) != TCL_OK)	
+    return TCL_ERROR;
+  if (Tcl_GetInt(interp, argv[2], &numIncr) != TCL_OK)	
+    return TCL_ERROR;
+  if (Tcl_GetDouble(interp, argv[3], &dT) != TCL_OK)	
+    return TCL_ERROR;
+
+  TCL_Char *seriesList = 0;
+  TCL_Char *factorList = 0;
+  TCL_Char *initScript = 0;
+  TCL_Char *evalScript = 0;
+
+  int currentArg = 4;
+  while (currentArg < argc-1) {
+    if (strcmp(argv[currentArg],"-accel") == 0) 
+      seriesList = argv[currentArg+1];
+    else if (strcmp(argv[currentArg],"-factors") == 0) 
+      factorList = argv[currentArg+1];
+    else if (strcmp(argv[currentArg],"-init") == 0) 
+      initScript = argv[currentArg+1];
+    else if (strcmp(argv[currentArg],"-eval") == 0) 
+      evalScript = argv[currentArg+1];
+    else {
+      opserr << "WARNING analyzeRecords - unknown option " << argv[currentArg] << endln;
+      return TCL_ERROR;
+    }
+    currentArg += 2;
+  }
+
+  if (seriesList == 0) {
+    opserr << "WARNING analyzeRecords - no records given, use -accel {seriesList}\n";
+    return TCL_ERROR;
+  }
+
+  LoadPattern *thePattern = theDomain.getLoadPattern(patternTag);
+  if (thePattern == 0 || thePattern->getClassTag() != PATTERN_TAG_UniformExcitation) {
+    opserr << "WARNING analyzeRecords - no UniformExcitation pattern with tag " << patternTag << endln;
+    return TCL_ERROR;
+  }
+  UniformExcitation *theExcitation = (UniformExcitation *)thePattern;
+
+  int numSeries = 0;
+  TCL_Char **seriesArgv = 0;
+  if (Tcl_SplitList(interp, seriesList, &numSeries, &seriesArgv) != TCL_OK) 
+    return TCL_ERROR;
+
+  int numFactors = 1;
+  TCL_Char **factorArgv = 0;
+  if (factorList != 0) 
+    if (Tcl_SplitList(interp, factorList, &numFactors, &factorArgv) != TCL_OK) {
+      Tcl_Free((char *)seriesArgv);
+      return TCL_ERROR;
+    }
+
+  int pid = 0;
+  int numP = 1;
+#ifdef _PARALLEL_INTERPRETERS
+  if (theMachineBroker != 0) {
+    pid = theMachineBroker->getPID();
+    numP = theMachineBroker->getNP();
+  }
+#endif
+
+  int ok = TCL_OK;
+  int numRun = 0;
+  int numFailed = 0;
+  char buffer[80];
+  ID results(numSeries*numFactors);
+  GroundMotion *origMotion = 0;     // the user's motion of the pattern
+  GroundMotion *theMotion = 0;      // the motion of record motionRecord
+  int motionRecord = -1;
+  MemoryDatastore *initState = 0;   // the state after the init script
+  bool initDone = false;
+
+  for (int i=0; i<numSeries && ok == TCL_OK; i++) {
+    for (int j=0; j<numFactors && ok == TCL_OK; j++) {
+
+      // deal the runs out over the processes
+      int runTag = i*numFactors + j;
+      if (runTag % numP != pid)
+	continue;
+
+      double factor = 1.0;
+      if (factorArgv != 0 && Tcl_GetDouble(interp, factorArgv[j], &factor) != TCL_OK) {
+	ok = TCL_ERROR;
+	break;
+      }
+
+      // the initial state is set up, and later restored, with the user's
+      // motion in the pattern, it is the one stored with the state
+      if (origMotion != 0)
+	theExcitation->setGroundMotion(*origMotion);
+
+      // back to the initial state; no domain change so nothing is rebuilt
+      if (initDone == false || initState == 0) {
+	if (revertModelToStart() < 0) {
+	  opserr << "WARNING analyzeRecords - the model could not be reverted to its start\n";
+	  ok = TCL_ERROR;
+	  break;
+	}
+	if (theTransientIntegrator != 0)
+	  theTransientIntegrator->revertToStart();
+
+	if (initScript != 0 && Tcl_Eval(interp, initScript) != TCL_OK) {
+	  ok = TCL_ERROR;
+	  break;
+	}
+
+	if (initDone == false) {
+	  initDone = true;
+	  initState = new MemoryDatastore(theDomain, theBroker);
+	  if (initState == 0 || initState->commitState(0) < 0) {
+	    opserr << "WARNING analyzeRecords - the initial state could not be stored, ";
+	    opserr << "the init script is evaluated before each run\n";
+	    if (initState != 0)
+	      delete initState;
+	    initState = 0;
+	  }
+	}
+      } else {
+	clearResponseHandles();
+	if (initState->restoreState(0) < 0) {
+	  opserr << "WARNING analyzeRecords - the initial state could not be restored\n";
+	  ok = TCL_ERROR;
+	  break;
+	}
+	theDomain.revertToLastCommit();
+	if (theTransientIntegrator != 0)
+	  theTransientIntegrator->domainChanged();
+      }
+
+      // the series of a record is built once and used for all the factors
+      if (motionRecord != i) {
+	if (theMotion != 0)
+	  delete theMotion;
+	theMotion = 0;
+	motionRecord = -1;
+
+	TimeSeries *accelSeries = TclSeriesCommand(clientData, interp, seriesArgv[i]);
+	if (accelSeries == 0) {
+	  opserr << "WARNING analyzeRecords - invalid accel series " << seriesArgv[i] << endln;
+	  ok = TCL_ERROR;
+	  break;
+	}
+	theMotion = new GroundMotion(0, 0, accelSeries);
+	motionRecord = i;
+      }
+
+      theMotion->setFactor(factor);
+      GroundMotion *oldMotion = theExcitation->setGroundMotion(*theMotion);
+      if (oldMotion == 0) {
+	ok = TCL_ERROR;
+	break;
+      }
+      if (origMotion == 0)
+	origMotion = oldMotion;
+
+      int numSteps = numIncr;
+      if (numSteps <= 0)
+	numSteps = (int)ceil(theMotion->getDuration()/dT);
+
+      ops_Dt = dT;
+      int result = theTransientAnalysis->analyze(numSteps, dT);
+      if (result < 0) {
+	opserr << "analyzeRecords - record " << i+1 << " with factor " << factor 
+	       << " failed, returned: " << result << " error flag\n";
+	numFailed++;
+      }
+      numRun++;
+
+      if (evalScript != 0) {
+	sprintf(buffer," %d %.15g %d", i+1, factor, result);
+	if (Tcl_VarEval(interp, evalScript, buffer, (char *)NULL) != TCL_OK) {
+	  ok = TCL_ERROR;
+	  break;
+	}
+	Tcl_ResetResult(interp);
+      }
+
+      results[numRun-1] = result;
+    }
+  }
+
+  Tcl_Free((char *)seriesArgv);
+  if (factorArgv != 0)
+    Tcl_Free((char *)factorArgv);
+
+  // put the original motion back in the pattern
+  if (origMotion != 0)
+    theExcitation->setGroundMotion(*origMotion);
+  if (theMotion != 0)
+    delete theMotion;
+  if (initState != 0)
+    delete initState;
+
+  if (ok != TCL_OK)
+    return ok;
+
+  opserr << "analyzeRecords - " << numRun << " runs performed, " << numFailed << " failed\n";
+
+  Tcl_ResetResult(interp);
+  for (int k=0; k<numRun; k++) {
+    sprintf(buffer, "%d ", results(k));
+    Tcl_AppendResult(interp, buffer, NULL);
+  }
+
+  return TCL_OK;
+}
+
 int 
 printElement(ClientData clientData, Tcl_Interp *interp, int argc, 
 	     TCL_Char **argv, OPS_Stream &output);
@@ -2420,6 +2986,37 @@ specifySOE(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
 #endif
 
 
+#ifndef _WIN32
+  else if (strcmp(argv[1],"OutOfCoreProfileSPD") == 0) {
+    // the profile kept in a scratch file, no more than -memory MB of it
+    // mapped at any one time
+    double memory = 64.0;
+    const char *fileName = 0;
+    int count = 2;
+    while (count < argc) {
+      if (strcmp(argv[count],"-memory") == 0) {
+	count++;
+	if (count >= argc || Tcl_GetDouble(interp, argv[count], &memory) != TCL_OK
+	    || memory <= 0.0) {
+	  opserr << "WARNING system OutOfCoreProfileSPD -memory MB - invalid MB\n";
+	  return TCL_ERROR;
+	}
+      } else if (strcmp(argv[count],"-file") == 0) {
+	count++;
+	if (count >= argc) {
+	  opserr << "WARNING system OutOfCoreProfileSPD -file fileName - no fileName\n";
+	  return TCL_ERROR;
+	}
+	fileName = argv[count];
+      }
+      count++;
+    }
+
+    OutOfCoreProfileSPDLinSolver *theSolver = new OutOfCoreProfileSPDLinSolver();
+    theSOE = new OutOfCoreProfileSPDLinSOE(*theSolver, memory*1.0e6, fileName);
+  }
+#endif
+
   // SPARSE GENERAL SOE * SOLVER
   else if ((strcmp(argv[1],"SparseGeneral") == 0) || (strcmp(argv[1],"SuperLU") == 0) ||
 	   (strcmp(argv[1],"SparseGEN") == 0)) {
@@ -2439,11 +3036,16 @@ specifySOE(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
 	  (strcmp(argv[count],"-piv") == 0)) {
 	thresh = 1.0;
       }
-      else if ((strcmp(argv[count],"-np") == 0) || (strcmp(argv[count],"np") == 0)) {
+      else if ((strcmp(argv[count],"-np") == 0) || (strcmp(argv[count],"np") == 0) ||
+	       (strcmp(argv[count],"-threads") == 0)) {
 	count++;
 	if (count < argc)
 	  if (Tcl_GetInt(interp, argv[count], &np) != TCL_OK)
 	    return TCL_ERROR;		     
+	if (np < 1) {
+	  opserr << "WARNING system SparseGeneral -threads np - np must be at least 1\n";
+	  return TCL_ERROR;
+	}
       }
       else if ((strcmp(argv[count],"npRow") == 0) || (strcmp(argv[count],"-npRow") ==0)) {
 	count++;
@@ -2465,8 +3067,12 @@ specifySOE(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
 
 
 #ifdef _THREADS
-    if (np != 0)
-      theSolver = new ThreadedSuperLU(np, permSpec, panelSize, relax, thresh); 	
+    theSolver = new ThreadedSuperLU(np, permSpec, panelSize, relax, thresh); 	
+#else
+#ifndef _PARALLEL_PROCESSING
+    if (np > 1)
+      opserr << "WARNING system SparseGeneral -threads - not built with threads, using SuperLU\n";
+#endif
 #endif
 
 #ifdef _PARALLEL_PROCESSING
@@ -2479,6 +3085,7 @@ specifySOE(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
       opserr << "commands.cpp: DistributedSuperLU\n";
     }
 #else
+#ifndef _THREADS
 
     char symmetric = 'N';
     double drop_tol = 0.0;
@@ -2491,9 +3098,11 @@ specifySOE(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
       count++;
     }
     
-    theSolver = new SuperLU(permSpec, drop_tol, panelSize, relax, symmetric); 	
+    if (theSolver == 0)
+      theSolver = new SuperLU(permSpec, drop_tol, panelSize, relax, symmetric); 	
 
 #endif
+#endif
 
 #ifdef _PARALLEL_PROCESSING
     opserr << "commands.cpp: DistributedSparseGenColLinSOE\n";
@@ -2521,6 +3130,102 @@ specifySOE(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
     SymSparseLinSolver *theSolver = new SymSparseLinSolver();
     theSOE = new SymSparseLinSOE(*theSolver, lSparse);      
   }    
+
+  else if (strcmp(argv[1],"SupernodalSPD") == 0) {
+    // supernodal Cholesky, the subtrees of the elimination tree factored
+    // by numThreads threads when built with _THREADS; with -mixed the
+    // factor is single precision and the solution refined
+    int numThreads = 1;
+    bool mixed = false;
+    int maxRefine = 10;
+    double tol = 1.0e-10;
+    bool print = false;
+    int count = 2;
+    while (count < argc) {
+      if ((strcmp(argv[count],"-threads") == 0) || (strcmp(argv[count],"-np") == 0)) {
+	count++;
+	if (count >= argc || Tcl_GetInt(interp, argv[count], &numThreads) != TCL_OK) {
+	  opserr << "WARNING system SupernodalSPD -threads numThreads - invalid numThreads\n";
+	  return TCL_ERROR;
+	}
+      } else if (strcmp(argv[count],"-mixed") == 0) {
+	mixed = true;
+      } else if (strcmp(argv[count],"-refine") == 0) {
+	count++;
+	if (count >= argc || Tcl_GetInt(interp, argv[count], &maxRefine) != TCL_OK) {
+	  opserr << "WARNING system SupernodalSPD -refine maxSteps - invalid maxSteps\n";
+	  return TCL_ERROR;
+	}
+      } else if (strcmp(argv[count],"-tol") == 0) {
+	count++;
+	if (count >= argc || Tcl_GetDouble(interp, argv[count], &tol) != TCL_OK) {
+	  opserr << "WARNING system SupernodalSPD -tol tol - invalid tol\n";
+	  return TCL_ERROR;
+	}
+      } else if (strcmp(argv[count],"-print") == 0) {
+	print = true;
+      }
+      count++;
+    }
+
+#ifndef _THREADS
+    if (numThreads > 1)
+      opserr << "WARNING system SupernodalSPD -threads - not built with threads, using 1\n";
+#endif
+
+    SupernodalSPDLinSolver *theSolver = 
+      new SupernodalSPDLinSolver(numThreads, maxRefine, tol, print);
+    theSOE = new SupernodalSPDLinSOE(*theSolver, mixed);      
+  }    
+
+  else if (strcmp(argv[1],"BlockSparse") == 0) {
+    // block sparse row storage by DOF_Group, solved by a block ILU(0)
+    // or block Jacobi preconditioned BiCGStab, or CG for an SPD A
+    int precond = BlockSparseILU;
+    int method = BlockSparseBiCGStab;
+    double tol = 1.0e-10;
+    int maxIter = 0;
+    int count = 2;
+    while (count < argc) {
+      if (strcmp(argv[count],"-precond") == 0) {
+	count++;
+	if (count < argc && strcmp(argv[count],"ILU") == 0)
+	  precond = BlockSparseILU;
+	else if (count < argc && strcmp(argv[count],"Jacobi") == 0)
+	  precond = BlockSparseJacobi;
+	else {
+	  opserr << "WARNING system BlockSparse -precond ILU|Jacobi - invalid preconditioner\n";
+	  return TCL_ERROR;
+	}
+      } else if (strcmp(argv[count],"-method") == 0) {
+	count++;
+	if (count < argc && strcmp(argv[count],"CG") == 0)
+	  method = BlockSparseCG;
+	else if (count < argc && strcmp(argv[count],"BiCGStab") == 0)
+	  method = BlockSparseBiCGStab;
+	else {
+	  opserr << "WARNING system BlockSparse -method CG|BiCGStab - invalid method\n";
+	  return TCL_ERROR;
+	}
+      } else if (strcmp(argv[count],"-tol") == 0) {
+	count++;
+	if (count >= argc || Tcl_GetDouble(interp, argv[count], &tol) != TCL_OK) {
+	  opserr << "WARNING system BlockSparse -tol tol - invalid tol\n";
+	  return TCL_ERROR;
+	}
+      } else if (strcmp(argv[count],"-maxIter") == 0) {
+	count++;
+	if (count >= argc || Tcl_GetInt(interp, argv[count], &maxIter) != TCL_OK) {
+	  opserr << "WARNING system BlockSparse -maxIter maxIter - invalid maxIter\n";
+	  return TCL_ERROR;
+	}
+      }
+      count++;
+    }
+
+    BlockSparseGenLinSolver *theSolver = new BlockSparseGenLinSolver(precond, method, tol, maxIter);
+    theSOE = new BlockSparseGenLinSOE(*theSolver);      
+  }    
   
   else if ((strcmp(argv[1],"UmfPack") == 0) || (strcmp(argv[1],"Umfpack") == 0)) {
     
@@ -5420,30 +6125,109 @@ addRecorder(ClientData clientData, Tcl_Interp *interp, int argc,
   return TclAddRecorder(clientData, interp, argc, argv, theDomain);
 }
 
-extern int
-TclAddAlgorithmRecorder(ClientData clientData, Tcl_Interp *interp, int argc, 
-			TCL_Char **argv, Domain &theDomain, EquiSolnAlgo *theAlgorithm);
+extern int
+TclAddAlgorithmRecorder(ClientData clientData, Tcl_Interp *interp, int argc, 
+			TCL_Char **argv, Domain &theDomain, EquiSolnAlgo *theAlgorithm);
+
+int 
+addAlgoRecorder(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+	if (theAlgorithm != 0)
+		return TclAddAlgorithmRecorder(clientData, interp, argc, argv,
+			theDomain, theAlgorithm);
+
+	else
+		return 0;
+}
+
+extern int
+TclAddDatabase(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv, 
+	       Domain &theDomain, 
+	       FEM_ObjectBroker &theBroker);
+
+int 
+addDatabase(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  return TclAddDatabase(clientData, interp, argc, argv, theDomain, theBroker);
+}
+
+
+//
+// command to keep in memory snapshots of the committed state of the domain,
+// so that an analysis can branch from a state more than one commit back:
+//
+// snapshot create tag   - store the committed state, returns bytes used
+// snapshot restore tag  - revert the domain to the stored state
+// snapshot drop tag     - release the memory held for the state
+//
+// the snapshots use the sendSelf/recvSelf of the domain components through
+// a MemoryDatastore, any number of them can coexist. only the committed
+// state is restored, the domain must not have changed since the snapshot.
+//
+int 
+domainSnapshot(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  if (argc < 3) {
+    opserr << "WARNING snapshot create|restore|drop tag?\n";
+    return TCL_ERROR;
+  }
+
+  int tag;
+  if (Tcl_GetInt(interp, argv[2], &tag) != TCL_OK) {
+    opserr << "WARNING snapshot - could not read tag " << argv[2] << endln;
+    return TCL_ERROR;	
+  }	
+
+  if (theSnapshots == 0) {
+    theSnapshots = new MemoryDatastore(theDomain, theBroker);
+    if (theSnapshots == 0) {
+      opserr << "WARNING snapshot - ran out of memory\n";
+      return TCL_ERROR;
+    }
+  }
+
+  if (strcmp(argv[1],"create") == 0) {
+
+    if (theSnapshots->commitState(tag) < 0) {
+      opserr << "WARNING snapshot create - failed to store domain state\n";
+      return TCL_ERROR;
+    }
+
+    sprintf(interp->result,"%d",theSnapshots->getNumBytes(tag));
+
+  } else if (strcmp(argv[1],"restore") == 0) {
+
+    if (theSnapshots->hasState(tag) == false) {
+      opserr << "WARNING snapshot restore - no snapshot with tag " << tag << endln;
+      return TCL_ERROR;
+    }
+
+    // as for the database restore, the handles are not kept across a restore
+    clearResponseHandles();
+
+    if (theSnapshots->restoreState(tag) < 0) {
+      opserr << "WARNING snapshot restore - failed to restore domain state\n";
+      return TCL_ERROR;
+    }
+
+    // bring the trial state of the nodes and elements to the restored state
+    theDomain.revertToLastCommit();
+
+    // the integrator holds the last committed response as well
+    if (theTransientAnalysis != 0 && theTransientIntegrator != 0)
+      theTransientIntegrator->domainChanged();
 
-int 
-addAlgoRecorder(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
-{
-	if (theAlgorithm != 0)
-		return TclAddAlgorithmRecorder(clientData, interp, argc, argv,
-			theDomain, theAlgorithm);
+  } else if (strcmp(argv[1],"drop") == 0) {
 
-	else
-		return 0;
-}
+    if (theSnapshots->dropState(tag) < 0)
+      return TCL_ERROR;
 
-extern int
-TclAddDatabase(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv, 
-	       Domain &theDomain, 
-	       FEM_ObjectBroker &theBroker);
+  } else {
+    opserr << "WARNING snapshot create|restore|drop tag? - unknown option " << argv[1] << endln;
+    return TCL_ERROR;
+  }
 
-int 
-addDatabase(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
-{
-  return TclAddDatabase(clientData, interp, argc, argv, theDomain, theBroker);
+  return TCL_OK;
 }
 
 
@@ -5715,8 +6499,12 @@ eigenAnalysis(ClientData clientData, Tcl_Interp *interp, int argc,
 	int permSpec = 0;
 	int panelSize = 6;
 	int relax = 6;
+#ifdef _THREADS
+	theSolver = new ThreadedSuperLU(1, permSpec, panelSize, relax, 0.0); 	
+#else
 	theSolver = new SuperLU(permSpec, drop_tol, panelSize, relax, symmetric); 	
 #endif
+#endif
 	
 #ifdef _PARALLEL_PROCESSING
 	LinearSOE *theArpackSOE = new DistributedSparseGenColLinSOE(*theSolver);      
@@ -5868,6 +6656,9 @@ removeObject(ClientData clientData, Tcl_Interp *interp, int argc,
     }      
     Element *theEle = theDomain.removeElement(tag);
     if (theEle != 0) {
+      // responses in handles would refer to the element
+      clearResponseHandles(tag);
+
       // we also have to remove any elemental loads from the domain
       LoadPatternIter &theLoadPatterns = theDomain.getLoadPatterns();
       LoadPattern *thePattern;
@@ -6713,6 +7504,457 @@ nodeResponse(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **arg
     return TCL_OK;
 }
 
+//
+// bulk and handle based response queries:
+//   eleResponses {eleTags} eleArgs...
+//   nodeResponses {nodeTags} $type <$dof>
+//   eleResponseHandle {eleTags} eleArgs...     - returns a handle
+//   nodeResponseHandle {nodeTags} $type <$dof> - returns a handle
+//   getResponse $handle
+//   removeResponseHandle $handle <$handle ...> | all
+// $type is disp, vel, accel, incrDisp, incrDeltaDisp, reaction or the 
+// responseID of nodeResponse. The values are returned as a list, with 
+// one sublist per tag if more than one tag is given. The element 
+// responses of a handle are created once, getResponse only obtains 
+// their values.
+//
+
+class ResponseHandle
+{
+  public:
+    ResponseHandle(int numTags);
+    ~ResponseHandle();
+
+    int numTags;
+    ID tags;
+    Response **theResponses;  // 0 for a node handle
+    NodeResponseType nodeResponseType;
+    int dof;
+};
+
+ResponseHandle::ResponseHandle(int num)
+  :numTags(num), tags(num), theResponses(0), nodeResponseType(Disp), dof(-1)
+{
+
+}
+
+ResponseHandle::~ResponseHandle()
+{
+  if (theResponses != 0) {
+    for (int i=0; i<numTags; i++)
+      if (theResponses[i] != 0)
+	delete theResponses[i];
+    delete [] theResponses;
+  }
+}
+
+// handle numbers are never reused: handle firstResponseHandle+i is in
+// slot i, and clearing all the handles moves firstResponseHandle past
+// the handles given out so far
+static ResponseHandle **theResponseHandles = 0;
+static int numResponseHandles = 0;
+static int sizeResponseHandles = 0;
+static int firstResponseHandle = 1;
+
+// deletes all the handles, or if eleTag is not -1 the responses for 
+// the element; the handles with these become invalid
+void
+clearResponseHandles(int eleTag)
+{
+  for (int i=0; i<numResponseHandles; i++) {
+    ResponseHandle *theHandle = theResponseHandles[i];
+    if (theHandle == 0)
+      continue;
+
+    if (eleTag == -1) {
+      delete theHandle;
+      theResponseHandles[i] = 0;
+    } else if (theHandle->theResponses != 0) {
+      for (int j=0; j<theHandle->numTags; j++)
+	if (theHandle->tags(j) == eleTag && theHandle->theResponses[j] != 0) {
+	  delete theHandle->theResponses[j];
+	  theHandle->theResponses[j] = 0;
+	}
+    }
+  }
+
+  if (eleTag == -1) {
+    firstResponseHandle += numResponseHandles;
+    numResponseHandles = 0;
+  }
+}
+
+// returns the handle with the number, 0 if it does not exist
+static ResponseHandle *
+getResponseHandle(int handle)
+{
+  int slot = handle - firstResponseHandle;
+  if (slot < 0 || slot >= numResponseHandles)
+    return 0;
+
+  return theResponseHandles[slot];
+}
+
+// adds the handle, returning its number
+static int
+addResponseHandle(ResponseHandle *theHandle)
+{
+  if (numResponseHandles == sizeResponseHandles) {
+    int newSize = 2*sizeResponseHandles + 16;
+    ResponseHandle **newHandles = new ResponseHandle *[newSize];
+    for (int i=0; i<numResponseHandles; i++)
+      newHandles[i] = theResponseHandles[i];
+    if (theResponseHandles != 0)
+      delete [] theResponseHandles;
+    theResponseHandles = newHandles;
+    sizeResponseHandles = newSize;
+  }
+
+  theResponseHandles[numResponseHandles++] = theHandle;
+  return firstResponseHandle + numResponseHandles - 1;
+}
+
+static int
+getResponseTags(Tcl_Interp *interp, TCL_Char *list, ID &tags, const char *command)
+{
+  TCL_Char **argvTags;
+  int argcTags;
+  if (Tcl_SplitList(interp, list, &argcTags, &argvTags) != TCL_OK) {
+    opserr << "WARNING " << command << " - could not read list of tags " << list << endln;
+    return -1;
+  }
+
+  if (argcTags == 0) {
+    opserr << "WARNING " << command << " - no tags given\n";
+    Tcl_Free((char *)argvTags);
+    return -1;
+  }
+
+  tags.resize(argcTags);
+  for (int i=0; i<argcTags; i++)
+    if (Tcl_GetInt(interp, argvTags[i], &tags(i)) != TCL_OK) {
+      opserr << "WARNING " << command << " - could not read tag " << argvTags[i] << endln;
+      Tcl_Free((char *)argvTags);
+      return -1;
+    }
+
+  Tcl_Free((char *)argvTags);
+  return argcTags;
+}
+
+static int
+getNodeResponseType(Tcl_Interp *interp, TCL_Char *type, NodeResponseType &theType)
+{
+  if (strcmp(type,"disp") == 0)
+    theType = Disp;
+  else if (strcmp(type,"vel") == 0)
+    theType = Vel;
+  else if (strcmp(type,"accel") == 0)
+    theType = Accel;
+  else if (strcmp(type,"incrDisp") == 0)
+    theType = IncrDisp;
+  else if (strcmp(type,"incrDeltaDisp") == 0)
+    theType = IncrDeltaDisp;
+  else if (strcmp(type,"reaction") == 0)
+    theType = Reaction;
+  else {
+    int responseID;
+    if (Tcl_GetInt(interp, type, &responseID) != TCL_OK || responseID < Disp || responseID > Reaction) {
+      opserr << "WARNING unknown node response type " << type << endln;
+      return -1;
+    }
+    theType = (NodeResponseType)responseID;
+  }
+
+  return 0;
+}
+
+static void
+appendResponseValues(Tcl_DString &result, const Vector &data, bool sublist)
+{
+  char buffer[32];
+
+  if (sublist == true)
+    Tcl_DStringStartSublist(&result);
+
+  int size = data.Size();
+  for (int i=0; i<size; i++) {
+    sprintf(buffer,"%.16g",data(i));
+    Tcl_DStringAppendElement(&result, buffer);
+  }
+
+  if (sublist == true)
+    Tcl_DStringEndSublist(&result);
+}
+
+// obtains the element responses into the result, deleting the responses 
+// when deleteResponses is true
+static int
+getEleResponses(Tcl_Interp *interp, Response **theResponses, const ID &tags, 
+		bool deleteResponses)
+{
+  int numTags = tags.Size();
+  bool sublist = (numTags > 1);
+  int res = TCL_OK;
+
+  Tcl_DString result;
+  Tcl_DStringInit(&result);
+
+  for (int i=0; i<numTags; i++) {
+    Response *theResponse = theResponses[i];
+    if (theResponse == 0) {
+      opserr << "WARNING getResponse - no response for element " << tags(i) << endln;
+      res = TCL_ERROR;
+      break;
+    }
+    if (theResponse->getResponse() < 0) {
+      opserr << "WARNING getResponse - element " << tags(i) << " failed to get response\n";
+      res = TCL_ERROR;
+      break;
+    }
+
+    Information &eleInfo = theResponse->getInformation();
+    appendResponseValues(result, eleInfo.getData(), sublist);
+  }
+
+  if (deleteResponses == true)
+    for (int j=0; j<numTags; j++)
+      if (theResponses[j] != 0)
+	delete theResponses[j];
+
+  if (res == TCL_OK)
+    Tcl_DStringResult(interp, &result);
+  else
+    Tcl_DStringFree(&result);
+
+  return res;
+}
+
+static int
+getNodeResponses(Tcl_Interp *interp, const ID &tags, NodeResponseType theType, int dof)
+{
+  int numTags = tags.Size();
+  bool sublist = (numTags > 1 && dof < 0);
+  char buffer[32];
+
+  Tcl_DString result;
+  Tcl_DStringInit(&result);
+
+  for (int i=0; i<numTags; i++) {
+    const Vector *nodalResponse = theDomain.getNodeResponse(tags(i), theType);
+    if (nodalResponse == 0) {
+      opserr << "WARNING nodeResponses - no response for node " << tags(i) << endln;
+      Tcl_DStringFree(&result);
+      return TCL_ERROR;
+    }
+
+    if (dof < 0)
+      appendResponseValues(result, *nodalResponse, sublist);
+    else {
+      if (dof >= nodalResponse->Size()) {
+	opserr << "WARNING nodeResponses - dof " << dof+1 << " too large for node " << tags(i) << endln;
+	Tcl_DStringFree(&result);
+	return TCL_ERROR;
+      }
+      sprintf(buffer,"%.16g",(*nodalResponse)(dof));
+      Tcl_DStringAppendElement(&result, buffer);
+    }
+  }
+
+  Tcl_DStringResult(interp, &result);
+  return TCL_OK;
+}
+
+// creates the responses for the elements, returns 0 if any element 
+// does not exist or does not have the response
+static Response **
+setEleResponses(const ID &tags, TCL_Char **argv, int argc, const char *command)
+{
+  int numTags = tags.Size();
+  Response **theResponses = new Response *[numTags];
+  for (int i=0; i<numTags; i++)
+    theResponses[i] = 0;
+
+  DummyStream dummy;
+  for (int j=0; j<numTags; j++) {
+    Element *theEle = theDomain.getElement(tags(j));
+    if (theEle != 0)
+      theResponses[j] = theEle->setResponse(argv, argc, dummy);
+
+    if (theResponses[j] == 0) {
+      opserr << "WARNING " << command << " - no such response for element " << tags(j) << endln;
+      for (int k=0; k<j; k++)
+	delete theResponses[k];
+      delete [] theResponses;
+      return 0;
+    }
+  }
+
+  return theResponses;
+}
+
+int 
+eleResponses(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  if (argc < 3) {
+    opserr << "WARNING want - eleResponses {eleTags} eleArgs...\n";
+    return TCL_ERROR;
+  }    
+
+  ID tags(0);
+  if (getResponseTags(interp, argv[1], tags, "eleResponses") < 0)
+    return TCL_ERROR;
+
+  Response **theResponses = setEleResponses(tags, argv+2, argc-2, "eleResponses");
+  if (theResponses == 0)
+    return TCL_ERROR;
+
+  int res = getEleResponses(interp, theResponses, tags, true);
+  delete [] theResponses;
+
+  return res;
+}
+
+int 
+nodeResponses(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  if (argc < 3) {
+    opserr << "WARNING want - nodeResponses {nodeTags} type? <dof?>\n";
+    return TCL_ERROR;
+  }    
+
+  ID tags(0);
+  if (getResponseTags(interp, argv[1], tags, "nodeResponses") < 0)
+    return TCL_ERROR;
+
+  NodeResponseType theType;
+  if (getNodeResponseType(interp, argv[2], theType) < 0)
+    return TCL_ERROR;
+
+  int dof = 0;
+  if (argc > 3) 
+    if (Tcl_GetInt(interp, argv[3], &dof) != TCL_OK) {
+      opserr << "WARNING nodeResponses {nodeTags} type? dof? - could not read dof? \n";
+      return TCL_ERROR;	        
+    }   
+
+  return getNodeResponses(interp, tags, theType, dof-1);
+}
+
+int 
+eleResponseHandle(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  if (argc < 3) {
+    opserr << "WARNING want - eleResponseHandle {eleTags} eleArgs...\n";
+    return TCL_ERROR;
+  }    
+
+  ID tags(0);
+  int numTags = getResponseTags(interp, argv[1], tags, "eleResponseHandle");
+  if (numTags < 0)
+    return TCL_ERROR;
+
+  Response **theResponses = setEleResponses(tags, argv+2, argc-2, "eleResponseHandle");
+  if (theResponses == 0)
+    return TCL_ERROR;
+
+  ResponseHandle *theHandle = new ResponseHandle(numTags);
+  theHandle->tags = tags;
+  theHandle->theResponses = theResponses;
+
+  sprintf(interp->result,"%d",addResponseHandle(theHandle));
+  return TCL_OK;
+}
+
+int 
+nodeResponseHandle(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  if (argc < 3) {
+    opserr << "WARNING want - nodeResponseHandle {nodeTags} type? <dof?>\n";
+    return TCL_ERROR;
+  }    
+
+  ID tags(0);
+  int numTags = getResponseTags(interp, argv[1], tags, "nodeResponseHandle");
+  if (numTags < 0)
+    return TCL_ERROR;
+
+  NodeResponseType theType;
+  if (getNodeResponseType(interp, argv[2], theType) < 0)
+    return TCL_ERROR;
+
+  int dof = 0;
+  if (argc > 3) 
+    if (Tcl_GetInt(interp, argv[3], &dof) != TCL_OK) {
+      opserr << "WARNING nodeResponseHandle {nodeTags} type? dof? - could not read dof? \n";
+      return TCL_ERROR;	        
+    }   
+
+  ResponseHandle *theHandle = new ResponseHandle(numTags);
+  theHandle->tags = tags;
+  theHandle->nodeResponseType = theType;
+  theHandle->dof = dof-1;
+
+  sprintf(interp->result,"%d",addResponseHandle(theHandle));
+  return TCL_OK;
+}
+
+int 
+getResponse(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  if (argc < 2) {
+    opserr << "WARNING want - getResponse handle?\n";
+    return TCL_ERROR;
+  }    
+
+  int handle;
+  if (Tcl_GetInt(interp, argv[1], &handle) != TCL_OK) {
+    opserr << "WARNING getResponse handle? - could not read handle? \n";
+    return TCL_ERROR;	        
+  }    
+
+  ResponseHandle *theHandle = getResponseHandle(handle);
+  if (theHandle == 0) {
+    opserr << "WARNING getResponse - no response handle " << handle << endln;
+    return TCL_ERROR;
+  }
+
+  if (theHandle->theResponses != 0)
+    return getEleResponses(interp, theHandle->theResponses, theHandle->tags, false);
+  else
+    return getNodeResponses(interp, theHandle->tags, theHandle->nodeResponseType, theHandle->dof);
+}
+
+int 
+removeResponseHandle(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  if (argc < 2) {
+    opserr << "WARNING want - removeResponseHandle handle? <handle? ...> | all\n";
+    return TCL_ERROR;
+  }    
+
+  if (strcmp(argv[1],"all") == 0) {
+    clearResponseHandles();
+    return TCL_OK;
+  }
+
+  for (int i=1; i<argc; i++) {
+    int handle;
+    if (Tcl_GetInt(interp, argv[i], &handle) != TCL_OK) {
+      opserr << "WARNING removeResponseHandle handle? - could not read handle " << argv[i] << endln;
+      return TCL_ERROR;	        
+    }    
+
+    ResponseHandle *theHandle = getResponseHandle(handle);
+    if (theHandle != 0) {
+      delete theHandle;
+      theResponseHandles[handle - firstResponseHandle] = 0;
+    }
+  }
+
+  return TCL_OK;
+}
+
 int 
 calculateNodalReactions(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
 {
@@ -7281,6 +8523,47 @@ stopTimer(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
   return TCL_OK;
 }
 
+// profiler start|stop|reset|print
+// profiler write fileName <-folded>
+//   the regions of the analysis timed since the profiler was started,
+//   written as JSON or as the folded stacks read by flamegraph.pl
+int 
+profilerCommand(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  if (argc < 2) {
+    opserr << "WARNING want - profiler start|stop|reset|print|write fileName <-folded>\n";
+    return TCL_ERROR;
+  }
+
+  if (strcmp(argv[1],"start") == 0)
+    Profiler::start();
+  else if (strcmp(argv[1],"stop") == 0)
+    Profiler::stop();
+  else if (strcmp(argv[1],"reset") == 0)
+    Profiler::reset();
+  else if (strcmp(argv[1],"print") == 0)
+    Profiler::Print(opserr);
+  else if (strcmp(argv[1],"write") == 0) {
+    if (argc < 3) {
+      opserr << "WARNING want - profiler write fileName <-folded>\n";
+      return TCL_ERROR;
+    }
+    int res;
+    if (argc > 3 && strcmp(argv[3],"-folded") == 0)
+      res = Profiler::writeFolded(argv[2]);
+    else
+      res = Profiler::writeJSON(argv[2]);
+    if (res < 0)
+      return TCL_ERROR;
+  }
+  else {
+    opserr << "WARNING profiler - unknown option " << argv[1] << endln;
+    return TCL_ERROR;
+  }
+
+  return TCL_OK;
+}
+
 int 
 rayleighDamping(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
 {
@@ -8125,6 +9408,45 @@ int convertTextToBinary(ClientData clientData, Tcl_Interp *interp, int argc, TCL
   return textToBinary(inputFile, outputFile);
 }
 
+
+extern int textToBinaryTimeSeries(const char *valuesFileName, const char *outputFileName,
+				  double timeIncr, const char *timesFileName);
+
+int convertTimeSeriesToBinary(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  if (argc < 3) {
+    opserr << "ERROR incorrect # args - convertTimeSeriesToBinary valuesFile outputFile <-dt dt> <-fileTime timeFile>\n";
+    return TCL_ERROR;
+  }
+
+  const char *inputFile = argv[1];
+  const char *outputFile = argv[2];
+  const char *timeFile = 0;
+  double dt = 1.0;
+
+  int count = 3;
+  while (count < argc) {
+    if (strcmp(argv[count],"-dt") == 0 && count+1 < argc) {
+      if (Tcl_GetDouble(interp, argv[count+1], &dt) != TCL_OK) {
+	opserr << "WARNING convertTimeSeriesToBinary - invalid dt " << argv[count+1] << endln;
+	return TCL_ERROR;
+      }
+      count += 2;
+    } else if (strcmp(argv[count],"-fileTime") == 0 && count+1 < argc) {
+      timeFile = argv[count+1];
+      count += 2;
+    } else {
+      opserr << "WARNING convertTimeSeriesToBinary - unknown option " << argv[count] << endln;
+      return TCL_ERROR;
+    }
+  }
+
+  if (textToBinaryTimeSeries(inputFile, outputFile, dt, timeFile) != 0)
+    return TCL_ERROR;
+
+  return TCL_OK;
+}
+
 int domainChange(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
 {
   theDomain.domainChange();
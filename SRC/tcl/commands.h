@@ -53,6 +53,12 @@ wipeAnalysis(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **arg
 int 
 resetModel(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 
+int
+OPS_ResetModel(void);
+
+int
+OPS_AnalyzeModel(int numIncr, double dT);
+
 int 
 initializeAnalysis(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 
@@ -74,6 +80,9 @@ buildModel(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
 int 
 analyzeModel(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 
+int 
+analyzeRecords(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
 int 
 printModel(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 int 
@@ -105,6 +114,9 @@ addAlgoRecorder(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **
 int 
 addDatabase(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 
+int 
+domainSnapshot(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
 int 
 playbackRecorders(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 
@@ -156,6 +168,24 @@ nodeAccel(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 int 
 nodeResponse(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 
+int 
+eleResponses(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
+int 
+nodeResponses(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
+int 
+eleResponseHandle(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
+int 
+nodeResponseHandle(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
+int 
+getResponse(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
+int 
+removeResponseHandle(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
 int 
 calculateNodalReactions(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 
@@ -206,6 +236,9 @@ startTimer(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
 int 
 stopTimer(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 
+int 
+profilerCommand(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
 int 
 rayleighDamping(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 
@@ -0,0 +1,358 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the names of the classes whose tags
+// are defined in classTags.h, for output that reports by class.
+//
+// What: "@(#) ClassTagNames.cpp, revA"
+
+#include <ClassTagNames.h>
+#include <classTags.h>
+
+// a few tags in classTags.h are shared by two classes, e.g. 9903 by
+// Joint3D and FourNodeQuad02; the tag cannot tell them apart, so both
+// entries of such a tag give the two names, e.g. "Joint3D/FourNodeQuad02"
+
+struct ClassTagName {
+  int classTag;
+  const char *name;
+};
+
+// the names are those of the ELE_TAG_ defines
+static ClassTagName elementNames[] = {
+    {ELE_TAG_cont2d01, "cont2d01"},
+    {ELE_TAG_cont2d02, "cont2d02"},
+    {ELE_TAG_CST, "CST"},
+    {ELE_TAG_Subdomain, "Subdomain"},
+    {ELE_TAG_ElasticBeam2d, "ElasticBeam2d"},
+    {ELE_TAG_ModElasticBeam2d, "ModElasticBeam2d"},
+    {ELE_TAG_ElasticBeam3d, "ElasticBeam3d"},
+    {ELE_TAG_Beam2d, "Beam2d"},
+    {ELE_TAG_beam2d02, "beam2d02"},
+    {ELE_TAG_beam2d03, "beam2d03"},
+    {ELE_TAG_beam2d04, "beam2d04"},
+    {ELE_TAG_beam3d01, "beam3d01"},
+    {ELE_TAG_beam3d02, "beam3d02"},
+    {ELE_TAG_Truss, "Truss"},
+    {ELE_TAG_TrussSection, "TrussSection"},
+    {ELE_TAG_CorotTruss, "CorotTruss"},
+    {ELE_TAG_CorotTrussSection, "CorotTrussSection"},
+    {ELE_TAG_fElmt05, "fElmt05"},
+    {ELE_TAG_fElmt02, "fElmt02"},
+    {ELE_TAG_MyTruss, "MyTruss"},
+    {ELE_TAG_ZeroLength, "ZeroLength"},
+    {ELE_TAG_ZeroLengthSection, "ZeroLengthSection"},
+    {ELE_TAG_ZeroLengthND, "ZeroLengthND"},
+    {ELE_TAG_ZeroLengthContact2D, "ZeroLengthContact2D"},
+    {ELE_TAG_ZeroLengthContact3D, "ZeroLengthContact3D"},
+    {ELE_TAG_ZeroLengthContactNTS2D, "ZeroLengthContactNTS2D"},
+    {ELE_TAG_ZeroLengthInterface2D, "ZeroLengthInterface2D"},
+    {ELE_TAG_CoupledZeroLength, "CoupledZeroLength"},
+    {ELE_TAG_NLBeamColumn2d, "NLBeamColumn2d"},
+    {ELE_TAG_NLBeamColumn3d, "NLBeamColumn3d"},
+    {ELE_TAG_LargeDispBeamColumn3d, "LargeDispBeamColumn3d"},
+    {ELE_TAG_FourNodeQuad, "FourNodeQuad"},
+    {ELE_TAG_FourNodeQuad3d, "FourNodeQuad3d"},
+    {ELE_TAG_Tri31, "Tri31"},
+    {ELE_TAG_BeamWithHinges2d, "BeamWithHinges2d"},
+    {ELE_TAG_BeamWithHinges3d, "BeamWithHinges3d"},
+    {ELE_TAG_EightNodeBrick, "EightNodeBrick"},
+    {ELE_TAG_TwentyNodeBrick, "TwentyNodeBrick"},
+    {ELE_TAG_EightNodeBrick_u_p_U, "EightNodeBrick_u_p_U"},
+    {ELE_TAG_TwentyNodeBrick_u_p_U, "TwentyNodeBrick_u_p_U"},
+    {ELE_TAG_FourNodeQuadUP, "FourNodeQuadUP"},
+    {ELE_TAG_TotalLagrangianFD20NodeBrick, "TotalLagrangianFD20NodeBrick"},
+    {ELE_TAG_TotalLagrangianFD8NodeBrick, "TotalLagrangianFD8NodeBrick"},
+    {ELE_TAG_EightNode_LDBrick_u_p, "EightNode_LDBrick_u_p"},
+    {ELE_TAG_EightNode_Brick_u_p, "EightNode_Brick_u_p"},
+    {ELE_TAG_TwentySevenNodeBrick, "TwentySevenNodeBrick"},
+    {ELE_TAG_BrickUP, "BrickUP"},
+    {ELE_TAG_Nine_Four_Node_QuadUP, "Nine_Four_Node_QuadUP"},
+    {ELE_TAG_Twenty_Eight_Node_BrickUP, "Twenty_Eight_Node_BrickUP"},
+    {ELE_TAG_Twenty_Node_Brick, "Twenty_Node_Brick"},
+    {ELE_TAG_BBarFourNodeQuadUP, "BBarFourNodeQuadUP"},
+    {ELE_TAG_BBarBrickUP, "BBarBrickUP"},
+    {ELE_TAG_PlateMITC4, "PlateMITC4"},
+    {ELE_TAG_ShellMITC4, "ShellMITC4"},
+    {ELE_TAG_Plate1, "Plate1"},
+    {ELE_TAG_Brick, "Brick"},
+    {ELE_TAG_BbarBrick, "BbarBrick"},
+    {ELE_TAG_FLBrick, "FLBrick"},
+    {ELE_TAG_EnhancedQuad, "EnhancedQuad"},
+    {ELE_TAG_ConstantPressureVolumeQuad, "ConstantPressureVolumeQuad"},
+    {ELE_TAG_NineNodeMixedQuad, "NineNodeMixedQuad"},
+    {ELE_TAG_DispBeamColumn2d, "DispBeamColumn2d"},
+    {ELE_TAG_DispBeamColumn3d, "DispBeamColumn3d"},
+    {ELE_TAG_HingedBeam2d, "HingedBeam2d"},
+    {ELE_TAG_HingedBeam3d, "HingedBeam3d"},
+    {ELE_TAG_TwoPointHingedBeam2d, "TwoPointHingedBeam2d"},
+    {ELE_TAG_TwoPointHingedBeam3d, "TwoPointHingedBeam3d"},
+    {ELE_TAG_OnePointHingedBeam2d, "OnePointHingedBeam2d"},
+    {ELE_TAG_OnePointHingedBeam3d, "OnePointHingedBeam3d"},
+    {ELE_TAG_BeamColumnJoint2d, "BeamColumnJoint2d"},
+    {ELE_TAG_BeamColumnJoint3d, "BeamColumnJoint3d"},
+    {ELE_TAG_ForceBeamColumn2d, "ForceBeamColumn2d"},
+    {ELE_TAG_ForceBeamColumn3d, "ForceBeamColumn3d"},
+    {ELE_TAG_ElasticForceBeamColumn2d, "ElasticForceBeamColumn2d"},
+    {ELE_TAG_ElasticForceBeamColumn3d, "ElasticForceBeamColumn3d"},
+    {ELE_TAG_DispBeamColumn2dInt, "DispBeamColumn2dInt"},
+    {ELE_TAG_InternalSpring, "InternalSpring"},
+    {ELE_TAG_SimpleJoint2D, "SimpleJoint2D"},
+    {ELE_TAG_Joint2D, "Joint2D"},
+    {ELE_TAG_Joint3D, "Joint3D/FourNodeQuad02"},
+    {ELE_TAG_ElastomericBearing3d, "ElastomericBearing3d"},
+    {ELE_TAG_ElastomericBearing2d, "ElastomericBearing2d"},
+    {ELE_TAG_TwoNodeLink, "TwoNodeLink"},
+    {ELE_TAG_ActuatorCorot, "ActuatorCorot"},
+    {ELE_TAG_Actuator, "Actuator"},
+    {ELE_TAG_Adapter, "Adapter"},
+    {ELE_TAG_FlatSliderSimple2d, "FlatSliderSimple2d"},
+    {ELE_TAG_FlatSliderSimple3d, "FlatSliderSimple3d"},
+    {ELE_TAG_FlatSlider2d, "FlatSlider2d"},
+    {ELE_TAG_FlatSlider3d, "FlatSlider3d"},
+    {ELE_TAG_SingleFPSimple2d, "SingleFPSimple2d"},
+    {ELE_TAG_SingleFPSimple3d, "SingleFPSimple3d"},
+    {ELE_TAG_SingleFP2d, "SingleFP2d"},
+    {ELE_TAG_SingleFP3d, "SingleFP3d"},
+    {ELE_TAG_DoubleFPSimple2d, "DoubleFPSimple2d"},
+    {ELE_TAG_DoubleFPSimple3d, "DoubleFPSimple3d"},
+    {ELE_TAG_DoubleFP2d, "DoubleFP2d"},
+    {ELE_TAG_DoubleFP3d, "DoubleFP3d"},
+    {ELE_TAG_TripleFPSimple2d, "TripleFPSimple2d"},
+    {ELE_TAG_TripleFPSimple3d, "TripleFPSimple3d"},
+    {ELE_TAG_TripleFP2d, "TripleFP2d"},
+    {ELE_TAG_TripleFP3d, "TripleFP3d"},
+    {ELE_TAG_GenericClient, "GenericClient"},
+    {ELE_TAG_GenericCopy, "GenericCopy"},
+    {ELE_TAG_PY_MACRO2D, "PY_MACRO2D"},
+    {ELE_TAG_SimpleContact2D, "SimpleContact2D"},
+    {ELE_TAG_SimpleContact3D, "SimpleContact3D"},
+    {ELE_TAG_BeamContact3D, "BeamContact3D"},
+    {ELE_TAG_SurfaceLoad, "SurfaceLoad"},
+    {ELE_TAG_BeamContact2D, "BeamContact2D"},
+    {ELE_TAG_BeamEndContact3D, "BeamEndContact3D"},
+    {ELE_TAG_SSPquad, "SSPquad"},
+    {ELE_TAG_SSPquadUP, "SSPquadUP"},
+    {ELE_TAG_TPB1D, "TPB1D"},
+    {ELE_TAG_TFP_Bearing, "TFP_Bearing"},
+    {ELE_TAG_TFP_Bearing2d, "TFP_Bearing2d"},
+    {ELE_TAG_FourNodeQuad02, "Joint3D/FourNodeQuad02"},
+    {0, 0}
+};
+
+// the names are those of the ND_TAG_ defines
+static ClassTagName ndMaterialNames[] = {
+    {ND_TAG_WrapperNDMaterial, "WrapperNDMaterial"},
+    {ND_TAG_ElasticIsotropic, "ElasticIsotropic"},
+    {ND_TAG_ElasticIsotropicPlaneStrain2d, "ElasticIsotropicPlaneStrain2d"},
+    {ND_TAG_ElasticIsotropicPlaneStress2d, "ElasticIsotropicPlaneStress2d"},
+    {ND_TAG_ElasticIsotropicAxiSymm, "ElasticIsotropicAxiSymm"},
+    {ND_TAG_ElasticIsotropicPlateFiber, "ElasticIsotropicPlateFiber"},
+    {ND_TAG_ElasticIsotropicBeamFiber, "ElasticIsotropicBeamFiber"},
+    {ND_TAG_ElasticIsotropicBeamFiber2d, "ElasticIsotropicBeamFiber2d"},
+    {ND_TAG_ElasticIsotropic3D, "ElasticIsotropic3D"},
+    {ND_TAG_ElasticCrossAnisotropic3D, "ElasticCrossAnisotropic3D"},
+    {ND_TAG_J2PlaneStrain, "J2PlaneStrain"},
+    {ND_TAG_J2PlaneStress, "J2PlaneStress"},
+    {ND_TAG_J2AxiSymm, "J2AxiSymm"},
+    {ND_TAG_J2ThreeDimensional, "J2ThreeDimensional"},
+    {ND_TAG_J2PlateFiber, "J2PlateFiber"},
+    {ND_TAG_J2BeamFiber, "J2BeamFiber"},
+    {ND_TAG_PressureDependentElastic3D, "PressureDependentElastic3D"},
+    {ND_TAG_Template3Dep, "Template3Dep"},
+    {ND_TAG_NewTemplate3Dep, "NewTemplate3Dep"},
+    {ND_TAG_FluidSolidPorousMaterial, "FluidSolidPorousMaterial"},
+    {ND_TAG_PressureDependMultiYield, "PressureDependMultiYield"},
+    {ND_TAG_PressureIndependMultiYield, "PressureIndependMultiYield"},
+    {ND_TAG_PressureDependMultiYield02, "PressureDependMultiYield02"},
+    {ND_TAG_FeapMaterial, "FeapMaterial"},
+    {ND_TAG_FeapMaterial01, "FeapMaterial01"},
+    {ND_TAG_FeapMaterial02, "FeapMaterial02"},
+    {ND_TAG_FeapMaterial03, "FeapMaterial03"},
+    {ND_TAG_PlaneStressMaterial, "PlaneStressMaterial"},
+    {ND_TAG_PlateFiberMaterial, "PlateFiberMaterial"},
+    {ND_TAG_PlaneStrainMaterial, "PlaneStrainMaterial"},
+    {ND_TAG_BeamFiberMaterial, "BeamFiberMaterial"},
+    {ND_TAG_CompressibleFluid, "CompressibleFluid"},
+    {ND_TAG_GeneralizedPlasticity, "GeneralizedPlasticity"},
+    {ND_TAG_J2Plasticity02, "J2Plasticity02"},
+    {ND_TAG_FiniteDeformationElastic3D, "FiniteDeformationElastic3D"},
+    {ND_TAG_NeoHookeanCompressible3D, "NeoHookeanCompressible3D"},
+    {ND_TAG_FDdecoupledElastic3D, "FDdecoupledElastic3D"},
+    {ND_TAG_FiniteDeformationEP3D, "FiniteDeformationEP3D"},
+    {ND_TAG_ContactMaterial2D, "ContactMaterial2D"},
+    {ND_TAG_ContactMaterial3D, "ContactMaterial3D"},
+    {ND_TAG_DruckerPrager, "DruckerPrager"},
+    {ND_TAG_DruckerPragerThreeDimensional, "DruckerPragerThreeDimensional"},
+    {ND_TAG_DruckerPragerTensionCutoff, "DruckerPragerTensionCutoff"},
+    {ND_TAG_DruckerPrager3D, "DruckerPrager3D"},
+    {ND_TAG_DruckerPragerPlaneStrain, "DruckerPragerPlaneStrain"},
+    {ND_TAG_BoundingCamClay, "BoundingCamClay"},
+    {ND_TAG_BoundingCamClay3D, "BoundingCamClay3D"},
+    {ND_TAG_BoundingCamClayPlaneStrain, "BoundingCamClayPlaneStrain"},
+    {ND_TAG_InitialStateAnalysisWrapper, "InitialStateAnalysisWrapper"},
+    {ND_TAG_ReinforcedConcretePlaneStress, "ReinforcedConcretePlaneStress"},
+    {ND_TAG_FAReinforcedConcretePlaneStress, "FAReinforcedConcretePlaneStress"},
+    {ND_TAG_FAFourSteelRCPlaneStress, "FAFourSteelRCPlaneStress"},
+    {ND_TAG_RAFourSteelRCPlaneStress, "RAFourSteelRCPlaneStress"},
+    {ND_TAG_PrestressedConcretePlaneStress, "PrestressedConcretePlaneStress"},
+    {ND_TAG_FAPrestressedConcretePlaneStress, "FAPrestressedConcretePlaneStress"},
+    {ND_TAG_FAFourSteelPCPlaneStress, "FAFourSteelPCPlaneStress"},
+    {ND_TAG_RAFourSteelPCPlaneStress, "RAFourSteelPCPlaneStress"},
+    {ND_TAG_MultiaxialCyclicPlasticity, "MultiaxialCyclicPlasticity"},
+    {ND_TAG_MultiaxialCyclicPlasticity3D, "MultiaxialCyclicPlasticity3D"},
+    {ND_TAG_MultiaxialCyclicPlasticityAxiSymm, "MultiaxialCyclicPlasticityAxiSymm"},
+    {ND_TAG_MultiaxialCyclicPlasticityPlaneStrain, "MultiaxialCyclicPlasticityPlaneStrain"},
+    {ND_TAG_ConcreteMcftNonLinear5, "ConcreteMcftNonLinear5"},
+    {ND_TAG_ConcreteMcftNonLinear7, "ConcreteMcftNonLinear7"},
+    {0, 0}
+};
+
+// the names are those of the MAT_TAG_ defines
+static ClassTagName uniaxialMaterialNames[] = {
+    {MAT_TAG_ElasticMaterial, "ElasticMaterial"},
+    {MAT_TAG_ElasticPPMaterial, "ElasticPPMaterial"},
+    {MAT_TAG_ParallelMaterial, "ParallelMaterial"},
+    {MAT_TAG_Concrete01, "Concrete01"},
+    {MAT_TAG_Steel01, "Steel01"},
+    {MAT_TAG_Hardening, "Hardening"},
+    {MAT_TAG_Hysteretic, "Hysteretic"},
+    {MAT_TAG_EPPGap, "EPPGap"},
+    {MAT_TAG_Viscous, "Viscous"},
+    {MAT_TAG_Backbone, "Backbone"},
+    {MAT_TAG_PathIndependent, "PathIndependent"},
+    {MAT_TAG_SeriesMaterial, "SeriesMaterial"},
+    {MAT_TAG_CableMaterial, "CableMaterial"},
+    {MAT_TAG_ENTMaterial, "ENTMaterial"},
+    {MAT_TAG_Penalty, "Penalty"},
+    {MAT_TAG_MinMax, "MinMax"},
+    {MAT_TAG_BoucWen, "BoucWen"},
+    {MAT_TAG_Pinching4, "Pinching4"},
+    {MAT_TAG_BarSlip, "BarSlip"},
+    {MAT_TAG_Fatigue, "Fatigue"},
+    {MAT_TAG_SAWSMaterial, "SAWSMaterial"},
+    {MAT_TAG_Steel03, "Steel03"},
+    {MAT_TAG_ReinforcingSteel, "ReinforcingSteel"},
+    {MAT_TAG_ShearPanelMaterial, "ShearPanelMaterial"},
+    {MAT_TAG_ConcreteL01, "ConcreteL01"},
+    {MAT_TAG_ConcreteZ01, "ConcreteZ01"},
+    {MAT_TAG_TendonL01, "TendonL01"},
+    {MAT_TAG_SteelZ01, "SteelZ01"},
+    {MAT_TAG_ElasticBilin, "ElasticBilin"},
+    {MAT_TAG_InitStrain, "InitStrain"},
+    {MAT_TAG_InitStress, "InitStress"},
+    {MAT_TAG_pyUCLA, "pyUCLA"},
+    {MAT_TAG_Maxwell, "Maxwell"},
+    {MAT_TAG_Cast, "Cast/SMA"},
+    {MAT_TAG_SmoothSteel01, "SmoothSteel01"},
+    {MAT_TAG_SmoothConcrete01, "SmoothConcrete01"},
+    {MAT_TAG_Concrete02, "Concrete02"},
+    {MAT_TAG_Steel02, "Steel02"},
+    {MAT_TAG_Bond_SP01, "Bond_SP01"},
+    {MAT_TAG_Hysteretic2, "Hysteretic2"},
+    {MAT_TAG_Concrete04, "Concrete04"},
+    {MAT_TAG_SecantConcrete, "SecantConcrete"},
+    {MAT_TAG_ContinuumUniaxial, "ContinuumUniaxial"},
+    {MAT_TAG_Concrete05, "Concrete05"},
+    {MAT_TAG_Concrete06, "Concrete06"},
+    {MAT_TAG_Concrete07, "Concrete07"},
+    {MAT_TAG_HyperbolicGapMaterial, "HyperbolicGapMaterial"},
+    {MAT_TAG_ImpactMaterial, "ImpactMaterial"},
+    {MAT_TAG_WrapperUniaxialMaterial, "WrapperUniaxialMaterial"},
+    {MAT_TAG_UniaxialJ2Plasticity, "UniaxialJ2Plasticity"},
+    {MAT_TAG_PySimple1, "PySimple1/Pinching"},
+    {MAT_TAG_TzSimple1, "TzSimple1"},
+    {MAT_TAG_QzSimple1, "QzSimple1"},
+    {MAT_TAG_PyLiq1, "PyLiq1"},
+    {MAT_TAG_TzLiq1, "TzLiq1"},
+    {MAT_TAG_PySimple2, "PySimple2"},
+    {MAT_TAG_TzSimple2, "TzSimple2"},
+    {MAT_TAG_QzSimple2, "QzSimple2"},
+    {MAT_TAG_FedeasMaterial, "FedeasMaterial"},
+    {MAT_TAG_FedeasBond1, "FedeasBond1/IsotropicLinElastic"},
+    {MAT_TAG_FedeasBond2, "FedeasBond2/IsotropicLinElasticPoint"},
+    {MAT_TAG_FedeasConcrete1, "FedeasConcrete1/OrthotropicLinElastic"},
+    {MAT_TAG_FedeasConcrete2, "FedeasConcrete2/OrthotropicLinElasticPoint"},
+    {MAT_TAG_FedeasConcrete3, "FedeasConcrete3"},
+    {MAT_TAG_FedeasHardening, "FedeasHardening"},
+    {MAT_TAG_FedeasHysteretic1, "FedeasHysteretic1"},
+    {MAT_TAG_FedeasHysteretic2, "FedeasHysteretic2"},
+    {MAT_TAG_FedeasSteel1, "FedeasSteel1"},
+    {MAT_TAG_FedeasSteel2, "FedeasSteel2"},
+    {MAT_TAG_PlasticDamage, "PlasticDamage"},
+    {MAT_TAG_DrainMaterial, "DrainMaterial"},
+    {MAT_TAG_DrainHardening, "DrainHardening"},
+    {MAT_TAG_DrainBilinear, "DrainBilinear"},
+    {MAT_TAG_DrainClough1, "DrainClough1"},
+    {MAT_TAG_DrainClough2, "DrainClough2"},
+    {MAT_TAG_DrainPinch1, "DrainPinch1"},
+    {MAT_TAG_DrainPinch2, "DrainPinch2"},
+    {MAT_TAG_Bilin, "Bilin"},
+    {MAT_TAG_SnapMaterial, "SnapMaterial"},
+    {MAT_TAG_SnapBilinear, "SnapBilinear"},
+    {MAT_TAG_SnapClough, "SnapClough"},
+    {MAT_TAG_SnapPinch, "SnapPinch"},
+    {MAT_TAG_SnapCloughDamage, "SnapCloughDamage"},
+    {MAT_TAG_SnapPinchingDamage, "SnapPinchingDamage"},
+    {MAT_TAG_ECC01, "ECC01"},
+    {MAT_TAG_Concrete01WithSITC, "Concrete01WithSITC"},
+    {MAT_TAG_Clough1, "Clough1"},
+    {MAT_TAG_Clough2, "Clough2"},
+    {MAT_TAG_Pinch1, "Pinch1"},
+    {MAT_TAG_BiLinear, "BiLinear"},
+    {MAT_TAG_Pinching, "PySimple1/Pinching"},
+    {MAT_TAG_LimitState, "LimitState"},
+    {MAT_TAG_Elastic2Material, "Elastic2Material"},
+    {MAT_TAG_SMA, "Cast/SMA"},
+    {MAT_TAG_SelfCentering, "SelfCentering"},
+    {MAT_TAG_IsotropicLinElastic, "FedeasBond1/IsotropicLinElastic"},
+    {MAT_TAG_IsotropicLinElasticPoint, "FedeasBond2/IsotropicLinElasticPoint"},
+    {MAT_TAG_OrthotropicLinElastic, "FedeasConcrete1/OrthotropicLinElastic"},
+    {MAT_TAG_OrthotropicLinElasticPoint, "FedeasConcrete2/OrthotropicLinElasticPoint"},
+    {0, 0}
+};
+
+static const char *
+findName(const ClassTagName *names, int classTag)
+{
+  for (int i=0; names[i].name != 0; i++)
+    if (names[i].classTag == classTag)
+      return names[i].name;
+
+  return 0;
+}
+
+const char *
+getElementClassName(int classTag)
+{
+  return findName(elementNames, classTag);
+}
+
+const char *
+getNDMaterialClassName(int classTag)
+{
+  return findName(ndMaterialNames, classTag);
+}
+
+const char *
+getUniaxialMaterialClassName(int classTag)
+{
+  return findName(uniaxialMaterialNames, classTag);
+}
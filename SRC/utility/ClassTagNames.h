@@ -0,0 +1,35 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+#ifndef ClassTagNames_h
+#define ClassTagNames_h
+
+// Description: This file contains the declarations of the functions
+// returning the name of a class from its tag in classTags.h, or 0 if
+// the tag is not known. A tag shared by two classes gives both names,
+// separated by a '/'.
+//
+// What: "@(#) ClassTagNames.h, revA"
+
+const char *getElementClassName(int classTag);
+const char *getNDMaterialClassName(int classTag);
+const char *getUniaxialMaterialClassName(int classTag);
+
+#endif
@@ -0,0 +1,475 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the implementation of Profiler.
+//
+// What: "@(#) Profiler.cpp, revA"
+
+#include <Profiler.h>
+#include <ClassTagNames.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#include <sys/time.h>
+#endif
+
+bool Profiler::on = false;
+
+#define PROFILER_MAX_DEPTH 64
+#define PROFILER_MAX_LABEL 256
+
+// a node of the tree is a region entered from the region of its parent
+struct ProfilerNode {
+  const char *region;
+  int eleClassTag;      // element class of the region, or -1
+  int parent;
+  int firstChild;
+  int nextSibling;
+  long numCalls;
+  double time;          // wall time in the region, including the children
+};
+
+static ProfilerNode *theNodes = 0;
+static int numNodes = 0;
+static int sizeNodes = 0;
+
+// the regions entered and not yet left; depth can exceed the size of the
+// stack, the regions that do not fit are not timed
+static int stackNode[PROFILER_MAX_DEPTH];
+static double stackStart[PROFILER_MAX_DEPTH];
+static int depth = 0;
+
+// a counter is identified by its name and the class tag counted; the names
+// are string constants, so they are compared by address before by content
+struct ProfilerCounter {
+  const char *counter;
+  int classTag;
+  const char *className;  // name of the class, or 0 if it is not known
+  long count;
+};
+
+static ProfilerCounter *theCounters = 0;
+static int numCounters = 0;
+static int sizeCounters = 0;
+
+
+static double
+getTime(void)
+{
+#ifdef _WIN32
+  static double tick = 0.0;
+  LARGE_INTEGER count;
+  if (tick == 0.0) {
+    LARGE_INTEGER frequency;
+    QueryPerformanceFrequency(&frequency);
+    tick = 1.0/(double)frequency.QuadPart;
+  }
+  QueryPerformanceCounter(&count);
+  return count.QuadPart*tick;
+#elif defined(CLOCK_MONOTONIC)
+  struct timespec tp;
+  clock_gettime(CLOCK_MONOTONIC, &tp);
+  return tp.tv_sec + 1.0e-9*tp.tv_nsec;
+#else
+  struct timeval tp;
+  gettimeofday(&tp, 0);
+  return tp.tv_sec + 1.0e-6*tp.tv_usec;
+#endif
+}
+
+
+static int
+addNode(const char *region, int eleClassTag, int parent)
+{
+  if (numNodes == sizeNodes) {
+    int newSize = (sizeNodes == 0) ? 64 : 2*sizeNodes;
+    ProfilerNode *newNodes = (ProfilerNode *)realloc(theNodes, newSize*sizeof(ProfilerNode));
+    if (newNodes == 0) {
+      opserr << "WARNING Profiler - out of memory for the regions, profiling stopped\n";
+      Profiler::on = false;
+      return -1;
+    }
+    theNodes = newNodes;
+    sizeNodes = newSize;
+  }
+
+  ProfilerNode &theNode = theNodes[numNodes];
+  theNode.region = region;
+  theNode.eleClassTag = eleClassTag;
+  theNode.parent = parent;
+  theNode.firstChild = -1;
+  theNode.nextSibling = -1;
+  theNode.numCalls = 0;
+  theNode.time = 0.0;
+
+  // the children are kept in the order they were first entered
+  if (parent >= 0) {
+    int *last = &theNodes[parent].firstChild;
+    while (*last >= 0)
+      last = &theNodes[*last].nextSibling;
+    *last = numNodes;
+  }
+
+  return numNodes++;
+}
+
+
+// the child of node for region, added if it is not there; the regions are
+// string constants, so they are compared by address before by content
+static int
+findChild(int node, const char *region, int eleClassTag)
+{
+  for (int child = theNodes[node].firstChild; child >= 0;
+       child = theNodes[child].nextSibling) {
+    ProfilerNode &theChild = theNodes[child];
+    if (theChild.eleClassTag == eleClassTag &&
+	(theChild.region == region || strcmp(theChild.region, region) == 0))
+      return child;
+  }
+
+  return addNode(region, eleClassTag, node);
+}
+
+
+static void
+getLabel(int node, char *label)
+{
+  ProfilerNode &theNode = theNodes[node];
+  if (theNode.eleClassTag < 0)
+    sprintf(label, "%.*s", PROFILER_MAX_LABEL-1, theNode.region);
+  else {
+    const char *className = getElementClassName(theNode.eleClassTag);
+    if (className != 0)
+      sprintf(label, "%.64s::%.160s", className, theNode.region);
+    else
+      sprintf(label, "Element%d::%.160s", theNode.eleClassTag, theNode.region);
+  }
+}
+
+
+// the time of node not spent in its children
+static double
+getSelfTime(int node)
+{
+  double self = theNodes[node].time;
+  for (int child = theNodes[node].firstChild; child >= 0;
+       child = theNodes[child].nextSibling)
+    self -= theNodes[child].time;
+
+  return (self > 0.0) ? self : 0.0;
+}
+
+
+void
+Profiler::start(void)
+{
+  if (theNodes == 0 && addNode("OpenSees", -1, -1) < 0)
+    return;
+
+  on = true;
+}
+
+
+void
+Profiler::stop(void)
+{
+  on = false;
+}
+
+
+// zeroes the times, calls and counts; the regions entered stay in the tree
+void
+Profiler::reset(void)
+{
+  for (int i=0; i<numNodes; i++) {
+    theNodes[i].numCalls = 0;
+    theNodes[i].time = 0.0;
+  }
+
+  for (int i=0; i<numCounters; i++)
+    theCounters[i].count = 0;
+}
+
+
+void
+Profiler::enter(const char *region, int eleClassTag)
+{
+  if (depth < PROFILER_MAX_DEPTH && theNodes != 0) {
+    int parent = (depth == 0) ? 0 : stackNode[depth-1];
+    int node = (parent >= 0) ? findChild(parent, region, eleClassTag) : -1;
+    stackNode[depth] = node;
+    stackStart[depth] = getTime();
+  }
+  depth++;
+}
+
+
+void
+Profiler::leave(void)
+{
+  if (depth == 0)
+    return;
+
+  depth--;
+  if (depth < PROFILER_MAX_DEPTH && theNodes != 0) {
+    int node = stackNode[depth];
+    if (node >= 0) {
+      double dT = getTime() - stackStart[depth];
+      theNodes[node].numCalls++;
+      theNodes[node].time += dT;
+      if (depth == 0) {
+	theNodes[0].numCalls++;
+	theNodes[0].time += dT;
+      }
+    }
+  }
+}
+
+
+void
+Profiler::count(const char *counter, int classTag, const char *className, long n)
+{
+  if (on == false)
+    return;
+
+  for (int i=0; i<numCounters; i++) {
+    ProfilerCounter &theCounter = theCounters[i];
+    if (theCounter.classTag == classTag &&
+	(theCounter.counter == counter || strcmp(theCounter.counter, counter) == 0)) {
+      theCounter.count += n;
+      return;
+    }
+  }
+
+  if (numCounters == sizeCounters) {
+    int newSize = (sizeCounters == 0) ? 16 : 2*sizeCounters;
+    ProfilerCounter *newCounters = (ProfilerCounter *)realloc(theCounters, newSize*sizeof(ProfilerCounter));
+    if (newCounters == 0) {
+      opserr << "WARNING Profiler::count() - out of memory for the counters\n";
+      return;
+    }
+    theCounters = newCounters;
+    sizeCounters = newSize;
+  }
+
+  ProfilerCounter &theCounter = theCounters[numCounters++];
+  theCounter.counter = counter;
+  theCounter.classTag = classTag;
+  theCounter.className = className;
+  theCounter.count = n;
+}
+
+
+// a region of an element class is not entered within itself, so the
+// times of the paths to it can be summed
+void
+Profiler::getElementTime(int eleClassTag, const char *region,
+			 double &time, long &numCalls)
+{
+  time = 0.0;
+  numCalls = 0;
+
+  for (int i=0; i<numNodes; i++) {
+    ProfilerNode &theNode = theNodes[i];
+    if (theNode.eleClassTag == eleClassTag &&
+	(theNode.region == region || strcmp(theNode.region, region) == 0)) {
+      time += theNode.time;
+      numCalls += theNode.numCalls;
+    }
+  }
+}
+
+
+int
+Profiler::getNumCounters(void)
+{
+  return numCounters;
+}
+
+
+void
+Profiler::getCounter(int i, const char *&counter, int &classTag,
+		     const char *&className, long &n)
+{
+  if (i < 0 || i >= numCounters) {
+    counter = 0;
+    classTag = -1;
+    className = 0;
+    n = 0;
+    return;
+  }
+
+  ProfilerCounter &theCounter = theCounters[i];
+  counter = theCounter.counter;
+  classTag = theCounter.classTag;
+  className = theCounter.className;
+  n = theCounter.count;
+}
+
+
+static void
+printJSON(FILE *fp, int node, int level)
+{
+  char label[PROFILER_MAX_LABEL];
+  getLabel(node, label);
+  ProfilerNode &theNode = theNodes[node];
+
+  // value is in microseconds, as read by d3-flame-graph
+  fprintf(fp, "%*s{\"name\": \"%s\", \"value\": %.0f, \"time\": %.9e, ",
+	  2*level, "", label, 1.0e6*theNode.time, theNode.time);
+  fprintf(fp, "\"self\": %.9e, \"calls\": %ld", getSelfTime(node), theNode.numCalls);
+
+  if (theNode.firstChild < 0) {
+    fprintf(fp, "}");
+    return;
+  }
+
+  fprintf(fp, ",\n%*s \"children\": [\n", 2*level, "");
+  for (int child = theNode.firstChild; child >= 0;
+       child = theNodes[child].nextSibling) {
+    printJSON(fp, child, level+1);
+    fprintf(fp, (theNodes[child].nextSibling >= 0) ? ",\n" : "\n");
+  }
+  fprintf(fp, "%*s]}", 2*level, "");
+}
+
+
+int
+Profiler::writeJSON(const char *fileName)
+{
+  if (theNodes == 0) {
+    opserr << "WARNING Profiler::writeJSON() - the profiler has not been started\n";
+    return -1;
+  }
+
+  FILE *fp = fopen(fileName, "w");
+  if (fp == 0) {
+    opserr << "WARNING Profiler::writeJSON() - could not open file " << fileName << endln;
+    return -1;
+  }
+
+  printJSON(fp, 0, 0);
+  fprintf(fp, "\n");
+  fclose(fp);
+
+  return 0;
+}
+
+
+// one line per path of the tree, the frames separated by ; and followed by
+// the microseconds spent in the last frame itself
+static void
+printFolded(FILE *fp, int node, char *path, int length)
+{
+  char label[PROFILER_MAX_LABEL];
+  getLabel(node, label);
+
+  int labelLength = strlen(label);
+  if (length + labelLength + 2 >= PROFILER_MAX_DEPTH*PROFILER_MAX_LABEL)
+    return;
+
+  if (length > 0)
+    path[length++] = ';';
+  strcpy(&path[length], label);
+  length += labelLength;
+
+  double self = getSelfTime(node);
+  if (self > 0.0)
+    fprintf(fp, "%s %.0f\n", path, 1.0e6*self);
+
+  for (int child = theNodes[node].firstChild; child >= 0;
+       child = theNodes[child].nextSibling)
+    printFolded(fp, child, path, length);
+}
+
+
+int
+Profiler::writeFolded(const char *fileName)
+{
+  if (theNodes == 0) {
+    opserr << "WARNING Profiler::writeFolded() - the profiler has not been started\n";
+    return -1;
+  }
+
+  FILE *fp = fopen(fileName, "w");
+  if (fp == 0) {
+    opserr << "WARNING Profiler::writeFolded() - could not open file " << fileName << endln;
+    return -1;
+  }
+
+  char *path = new char[PROFILER_MAX_DEPTH*PROFILER_MAX_LABEL];
+  printFolded(fp, 0, path, 0);
+  delete [] path;
+  fclose(fp);
+
+  return 0;
+}
+
+
+static void
+printNode(OPS_Stream &s, int node, int level, double total)
+{
+  char label[PROFILER_MAX_LABEL];
+  getLabel(node, label);
+  ProfilerNode &theNode = theNodes[node];
+
+  char line[PROFILER_MAX_LABEL + 128];
+  sprintf(line, "%12.6f %6.2f%% %10ld  %*s%s\n", theNode.time,
+	  (total > 0.0) ? 100.0*theNode.time/total : 0.0, theNode.numCalls,
+	  2*level, "", label);
+  s << line;
+
+  for (int child = theNode.firstChild; child >= 0;
+       child = theNodes[child].nextSibling)
+    printNode(s, child, level+1, total);
+}
+
+
+void
+Profiler::Print(OPS_Stream &s)
+{
+  if (theNodes == 0)
+    return;
+
+  s << "     time(s)       %      calls  region\n";
+  printNode(s, 0, 0, theNodes[0].time);
+
+  if (numCounters == 0)
+    return;
+
+  s << "\n       count  counter\n";
+  for (int i=0; i<numCounters; i++) {
+    ProfilerCounter &theCounter = theCounters[i];
+    char line[PROFILER_MAX_LABEL + 32];
+    if (theCounter.className != 0)
+      sprintf(line, "%12ld  %.64s::%.160s\n", theCounter.count,
+	      theCounter.className, theCounter.counter);
+    else
+      sprintf(line, "%12ld  Class%d::%.160s\n", theCounter.count,
+	      theCounter.classTag, theCounter.counter);
+    s << line;
+  }
+}
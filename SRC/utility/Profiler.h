@@ -0,0 +1,84 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+#ifndef Profiler_h
+#define Profiler_h
+
+// Description: This file contains the class definitions for Profiler
+// and ProfileScope. Profiler accumulates the wall time and number of
+// calls of the regions of the analysis it is told about, in a tree of
+// the paths by which the regions were entered. A region is entered by
+// the constructor of a ProfileScope and left by its destructor; a region
+// given an element class tag is reported as that element class, e.g.
+// ElasticBeam3d::update. When the Profiler is off a ProfileScope only
+// tests a flag. The tree is written as JSON, or as the folded stacks
+// read by flamegraph.pl. Besides the regions the Profiler keeps counters
+// of events, e.g. the local iterations of an element or the failures of
+// a material return mapping, per counter name and class tag. The Profiler
+// is not thread safe: the regions must be entered, and the counters
+// counted, by the thread running the analysis.
+//
+// What: "@(#) Profiler.h, revA"
+
+#include <OPS_Globals.h>
+
+class Profiler
+{
+  public:
+    static void start(void);
+    static void stop(void);
+    static void reset(void);
+
+    static void enter(const char *region, int eleClassTag = -1);
+    static void leave(void);
+
+    static void count(const char *counter, int classTag,
+                      const char *className, long n = 1);
+
+    // the sums over the tree of the regions of an element class
+    static void getElementTime(int eleClassTag, const char *region,
+                               double &time, long &numCalls);
+    static int getNumCounters(void);
+    static void getCounter(int i, const char *&counter, int &classTag,
+                           const char *&className, long &n);
+
+    static int writeJSON(const char *fileName);
+    static int writeFolded(const char *fileName);
+    static void Print(OPS_Stream &s);
+
+    static bool on;
+};
+
+
+class ProfileScope
+{
+  public:
+    ProfileScope(const char *region)
+      :active(Profiler::on) {if (active) Profiler::enter(region);}
+    ProfileScope(const char *region, int eleClassTag)
+      :active(Profiler::on) {if (active) Profiler::enter(region, eleClassTag);}
+    ~ProfileScope()
+      {if (active) Profiler::leave();}
+
+  private:
+    bool active;
+};
+
+#endif
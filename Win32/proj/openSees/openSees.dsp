@@ -115,6 +115,10 @@ SOURCE=..\..\..\SRC\modelbuilder\tcl\TclModelBuilder.cpp
 # End Source File
 # Begin Source File
 
+SOURCE=..\..\..\SRC\modelbuilder\tcl\TclModelImport.cpp
+# End Source File
+# Begin Source File
+
 SOURCE=..\..\..\Src\modelbuilder\tcl\TclUniaxialMaterialTester.cpp
 # End Source File
 # Begin Source File
@@ -107,6 +107,10 @@ SOURCE=..\..\..\SRC\modelbuilder\tcl\TclModelBuilder.cpp
 # End Source File
 # Begin Source File
 
+SOURCE=..\..\..\SRC\modelbuilder\tcl\TclModelImport.cpp
+# End Source File
+# Begin Source File
+
 SOURCE=..\..\..\SRC\modelbuilder\tcl\TclUniaxialMaterialTester.cpp
 # End Source File
 # Begin Source File
@@ -190,6 +190,14 @@ SOURCE=..\..\..\SRC\reliability\analysis\gFunction\BasicGFunEvaluator.h
 # End Source File
 # Begin Source File
 
+SOURCE=..\..\..\SRC\reliability\analysis\gFunction\CompiledLimitStateFunction.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=..\..\..\SRC\reliability\analysis\gFunction\CompiledLimitStateFunction.h
+# End Source File
+# Begin Source File
+
 SOURCE=..\..\..\SRC\reliability\analysis\gFunction\GFunEvaluator.cpp
 # End Source File
 # Begin Source File